@@ -60,6 +60,8 @@ void BaseConvolutionBenchmark::add_param_counters(
   state.counters["fil_cols"] = params.window_cols;
   state.counters["pad_rows"] = params.pad_rows;
   state.counters["pad_cols"] = params.pad_cols;
+  state.counters["dilation_rows"] = params.dilation_rows;
+  state.counters["dilation_cols"] = params.dilation_cols;
 }
 
 // Calculate the optimal bandwidth requirements, and add corresponding counters.
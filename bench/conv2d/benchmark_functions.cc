@@ -98,4 +98,7 @@ BM_ALGO_WITH_SNNBACKEND(Tiled)
 BM_WITH_ALGO(Im2col);
 BM_WITH_ALGO(Winograd);
 BM_WITH_ALGO(WinogradLarge);
+BM_WITH_ALGO_AND_DIR(WinogradFused, Forward);
+BM_WITH_ALGO_AND_DIR(ImplicitGemm, Forward);
+BM_WITH_ALGO_AND_DIR(LocalTiled, Forward);
 BM_WITH_ALGO(Matmul);
@@ -0,0 +1,317 @@
+#!/usr/bin/python3
+#
+# Copyright Codeplay Software Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use these files except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generate a conv2d selector table from benchmark results.
+#
+# Run the conv2d network benchmarks (e.g. vgg, resnet, mobilenet) once for
+# each algorithm on the target device with `--benchmark_format=csv`, then pass
+# the resulting files to this script. The fastest algorithm is found for each
+# convolution, and a small decision tree is fitted to those choices over the
+# channels, features, spatial size, window, stride and dilation. The tree is
+# written as a C++ header in src/conv2d/selector/tables, which is compiled into
+# the matching device selector in src/conv2d/selector/default_selector.cc.
+#
+# The generated headers must not be edited by hand. Rules which do not come
+# from the benchmark results, such as which algorithms support dilation, belong
+# in algorithm_supports() in src/conv2d/selector/decision_tree.h.
+
+from __future__ import print_function
+
+import argparse
+import csv
+import os
+from collections import Counter, defaultdict
+
+LICENSE = r"""/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+# Map from the benchmark selector names to the algorithm enum values.
+SELECTOR_ALGORITHMS = {
+    'Direct': 'Direct',
+    'Tiled': 'Tiled',
+    'TiledSelector': 'Tiled',
+    'Im2col': 'Im2col',
+    'WinogradSelector': 'Winograd',
+    'WinogradLargeSelector': 'WinogradLarge',
+    'WinogradFusedSelector': 'WinogradFused',
+    'MatmulSelector': 'Matmul',
+    'ImplicitGemmSelector': 'ImplicitGemm',
+    'LocalTiledSelector': 'LocalTiled',
+}
+
+CONV_TYPES = ['Forward', 'InputBackprop', 'FilterBackprop']
+
+# The features used by the trees, as (DecisionFeature name, value function).
+FEATURES = [
+    ('Batch', lambda p: p['batch']),
+    ('Channels', lambda p: p['channels']),
+    ('Features', lambda p: p['features']),
+    ('OutputSpatial', lambda p: p['out_rows'] * p['out_cols']),
+    ('WindowRows', lambda p: p['fil_rows']),
+    ('WindowCols', lambda p: p['fil_cols']),
+    ('StrideRows', lambda p: p['stride_rows']),
+    ('StrideCols', lambda p: p['stride_cols']),
+    ('DilationRows', lambda p: p['dilation_rows']),
+    ('DilationCols', lambda p: p['dilation_cols']),
+]
+
+PARAM_COLUMNS = [
+    'batch', 'in_rows', 'in_cols', 'channels', 'out_rows', 'out_cols',
+    'features', 'fil_rows', 'fil_cols', 'stride_rows', 'stride_cols',
+    'pad_rows', 'pad_cols'
+]
+
+# Columns which older benchmark results do not have, with their default value.
+OPTIONAL_COLUMNS = {
+    'dilation_rows': 1,
+    'dilation_cols': 1,
+}
+
+
+def parse_label(label):
+    """ Split a benchmark label of comma separated key=value pairs. """
+    values = {}
+    for item in label.split(','):
+        key, _, value = item.partition('=')
+        values[key] = value
+    return values
+
+
+def load_benchmark(filename):
+    """ Load the rows of a benchmark csv file, skipping the preamble. """
+    with open(filename) as inp:
+        lines = inp.readlines()
+    for header_line, line in enumerate(lines):
+        if line[0:4] == 'name':
+            break
+    return list(csv.DictReader(lines[header_line:]))
+
+
+def fastest_algorithms(rows):
+    """
+    Find the fastest algorithm for each convolution.
+
+    Returns a map from the convolution type to a list of (params, algorithm)
+    pairs.
+    """
+    best = {}
+    for row in rows:
+        if row.get('error_occurred', '') == 'true':
+            continue
+        label = parse_label(row.get('label', ''))
+        algorithm = SELECTOR_ALGORITHMS.get(label.get('@selector'))
+        conv_type = label.get('@conv_type')
+        if algorithm is None or conv_type not in CONV_TYPES:
+            continue
+        params = {
+            col: int(float(row[col]))
+            for col in PARAM_COLUMNS if row.get(col)
+        }
+        if len(params) != len(PARAM_COLUMNS):
+            continue
+        for col, default in OPTIONAL_COLUMNS.items():
+            params[col] = int(float(row[col])) if row.get(col) else default
+        time = float(row['real_time'])
+        key = (conv_type,
+               tuple(params[col]
+                     for col in PARAM_COLUMNS + list(OPTIONAL_COLUMNS)))
+        if key not in best or time < best[key][2]:
+            best[key] = (params, algorithm, time)
+
+    samples = defaultdict(list)
+    for (conv_type, _), (params, algorithm, _) in sorted(best.items()):
+        samples[conv_type].append((params, algorithm))
+    return samples
+
+
+def gini(labels):
+    """ Compute the Gini impurity of a list of labels. """
+    total = float(len(labels))
+    counts = Counter(labels)
+    return 1. - sum((c / total)**2 for c in counts.values())
+
+
+def best_split(samples, min_leaf):
+    """ Find the split with the lowest weighted Gini impurity. """
+    labels = [algo for _, algo in samples]
+    best = None
+    best_score = gini(labels)
+    for idx, (_, value_fn) in enumerate(FEATURES):
+        values = sorted(set(value_fn(p) for p, _ in samples))
+        for threshold in values[:-1]:
+            left = [a for p, a in samples if value_fn(p) <= threshold]
+            right = [a for p, a in samples if value_fn(p) > threshold]
+            if len(left) < min_leaf or len(right) < min_leaf:
+                continue
+            score = (len(left) * gini(left) +
+                     len(right) * gini(right)) / len(samples)
+            if score < best_score:
+                best_score = score
+                best = (idx, threshold)
+    return best
+
+
+def build_tree(samples, max_depth, min_leaf, nodes):
+    """
+    Fit a decision tree to the samples, appending the nodes to the list.
+
+    Returns the index of the root node of the tree.
+    """
+    index = len(nodes)
+    labels = [algo for _, algo in samples]
+    majority = Counter(labels).most_common(1)[0][0]
+    split = None
+    if max_depth > 0 and len(set(labels)) > 1:
+        split = best_split(samples, min_leaf)
+    if split is None:
+        nodes.append(('Leaf', 0, 0, 0, majority))
+        return index
+
+    feature, threshold = split
+    value_fn = FEATURES[feature][1]
+    nodes.append(None)
+    left = build_tree([s for s in samples if value_fn(s[0]) <= threshold],
+                      max_depth - 1, min_leaf, nodes)
+    right = build_tree([s for s in samples if value_fn(s[0]) > threshold],
+                       max_depth - 1, min_leaf, nodes)
+    nodes[index] = (FEATURES[feature][0], threshold, left, right,
+                    'NotSupported')
+    return index
+
+
+def format_tree(name, nodes):
+    """ Format the nodes of a tree as a C++ array and DecisionTree. """
+    lines = ['inline constexpr DecisionNode {}_nodes[] = {{'.format(name)]
+    for feature, threshold, left, right, algorithm in nodes:
+        lines.append(
+            '    {{DecisionFeature::{}, {}, {}, {}, Algorithm::{}}},'.format(
+                feature, threshold, left, right, algorithm))
+    lines.append('};')
+    lines.append('inline constexpr DecisionTree {0}{{{0}_nodes, {1}}};'.format(
+        name, len(nodes)))
+    return '\n'.join(lines)
+
+
+def generate_header(device, trees, n_results):
+    """ Generate the C++ header holding the trees for a device. """
+    guard = 'PORTDNN_SRC_CONV2D_SELECTOR_TABLES_{}_H_'.format(device.upper())
+    parts = [
+        LICENSE,
+        '#ifndef {}'.format(guard),
+        '#define {}'.format(guard),
+        '',
+        '// DO NOT MODIFY BY HAND',
+        '// This file was automatically generated by gen_selector_table.py',
+        '// from {} benchmarked convolutions.'.format(n_results),
+    ]
+    if n_results == 0:
+        parts += [
+            '// No benchmark results were available, so the selector always',
+            '// falls back to the DefaultSelector choice.',
+        ]
+    parts += [
+        '',
+        '#include "src/conv2d/selector/decision_tree.h"',
+        '',
+        'namespace sycldnn {',
+        'namespace conv2d {',
+        'namespace internal {',
+        'namespace {} {{'.format(device),
+        '',
+    ]
+    for conv_type in CONV_TYPES:
+        name = {
+            'Forward': 'forward',
+            'InputBackprop': 'input_backprop',
+            'FilterBackprop': 'filter_backprop'
+        }[conv_type]
+        parts.append(format_tree(name, trees[conv_type]))
+        parts.append('')
+    parts += [
+        '}}  // namespace {}'.format(device),
+        '}  // namespace internal',
+        '}  // namespace conv2d',
+        '}  // namespace sycldnn',
+        '#endif  // {}'.format(guard),
+        '',
+    ]
+    return '\n'.join(parts)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate a conv2d selector table from benchmark csvs.')
+    parser.add_argument(
+        'files', nargs='+', help='Filenames of benchmark csv results')
+    parser.add_argument(
+        '--device',
+        required=True,
+        choices=['intel_cpu', 'intel_gpu', 'arm_gpu'],
+        help='The device the benchmarks were run on')
+    parser.add_argument(
+        '--max-depth', type=int, default=4, help='Maximum depth of the trees')
+    parser.add_argument(
+        '--min-leaf',
+        type=int,
+        default=2,
+        help='Minimum number of convolutions in each leaf')
+    parser.add_argument(
+        '--output-dir',
+        default=os.path.join(
+            os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src',
+            'conv2d', 'selector', 'tables'),
+        help='Directory to write the generated header to')
+    args = parser.parse_args()
+
+    rows = []
+    for filename in args.files:
+        rows += load_benchmark(filename)
+    samples = fastest_algorithms(rows)
+
+    trees = {}
+    for conv_type in CONV_TYPES:
+        nodes = []
+        if samples[conv_type]:
+            build_tree(samples[conv_type], args.max_depth, args.min_leaf,
+                       nodes)
+        else:
+            # Without results the selector falls back to the default choice.
+            nodes.append(('Leaf', 0, 0, 0, 'NotSupported'))
+        trees[conv_type] = nodes
+
+    n_results = sum(len(s) for s in samples.values())
+    output = os.path.normpath(
+        os.path.join(args.output_dir, '{}.h'.format(args.device)))
+    with open(output, 'w') as out:
+        out.write(generate_header(args.device, trees, n_results))
+    print('Wrote {} from {} convolutions'.format(output, n_results))
+
+
+if __name__ == "__main__":
+    main()
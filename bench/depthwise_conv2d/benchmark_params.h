@@ -19,6 +19,7 @@
 #include "portdnn/padding_mode.h"
 
 #include "portdnn/depthwise_conv2d/params.h"
+#include "portdnn/depthwise_conv2d/separable_params.h"
 
 #include "portdnn/helpers/padding.h"
 
@@ -69,6 +70,37 @@ inline sycldnn::depthwise_conv2d::DepthwiseConv2DParams deserialize(
   return sycldnn::helpers::add_padding_to(params, mode);
 }
 
+/**
+ * Encode depthwise-separable convolution parameters as a vector.
+ *
+ * The depthwise convolution is encoded as in serialize, followed by the number
+ * of features computed by the pointwise convolution.
+ */
+inline std::vector<int> serialize_separable(int batch, int window, int stride,
+                                            int rows, int cols, int channels,
+                                            int multiplier, int features,
+                                            sycldnn::PaddingMode mode) {
+  auto params =
+      serialize(batch, window, stride, rows, cols, channels, multiplier, mode);
+  params.push_back(features);
+  return params;
+}
+
+/**
+ * Extract depthwise-separable convolution parameters from a benchmark::State
+ * instance.
+ *
+ * Expects the parameters of the benchmark::State to match those provided by the
+ * serialize_separable function.
+ */
+inline sycldnn::depthwise_conv2d::SeparableConv2DParams deserialize_separable(
+    benchmark::State const& state) {
+  sycldnn::depthwise_conv2d::SeparableConv2DParams params;
+  params.depthwise = deserialize(state);
+  params.features = state.range(8);
+  return params;
+}
+
 }  // namespace benchmark_params
 
 #endif  // PORTDNN_BENCH_DEPTHWISE_CONV2D_BENCHMARK_PARAMS_H_
@@ -0,0 +1,27 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "snn_separable_fixture.h"
+
+#include "src/backend/snn_backend_provider.h"
+
+#include "portdnn/backend/snn_backend.h"
+
+#define BM_WITH_FUSED(NAME, FUSED)                                           \
+  SEPARABLE_CONVOLUTION_BENCHMARK(NAME, sycldnn::backend::SNNBackend, float, \
+                                  FUSED)
+
+BM_WITH_FUSED(Fused, true);
+BM_WITH_FUSED(Unfused, false);
@@ -0,0 +1,201 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_BENCH_DEPTHWISE_CONV2D_SNN_SEPARABLE_CONV2D_EXECUTOR_H_
+#define PORTDNN_BENCH_DEPTHWISE_CONV2D_SNN_SEPARABLE_CONV2D_EXECUTOR_H_
+
+#include "portdnn/conv2d/launch.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/selector/constant_selector.h"
+
+#include "portdnn/depthwise_conv2d/launch.h"
+#include "portdnn/depthwise_conv2d/launch_separable.h"
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "portdnn/helpers/handle_exception.h"
+#include "portdnn/helpers/scope_exit.h"
+
+#include "bench/fixture/base_executor.h"
+
+namespace sycldnn {
+namespace bench {
+
+/**
+ * Executor to perform the depthwise-separable convolution benchmark using
+ * portDNN.
+ *
+ * When Fused is false the depthwise convolution and the 1x1 pointwise
+ * convolution are launched separately, with the intermediate tensor stored in
+ * global memory, to give a baseline for the fused kernel.
+ */
+template <typename Benchmark, bool Fused>
+struct SNNSeparableConv2DExecutor : public BaseExecutor {
+ private:
+  using State = ::benchmark::State;
+  using SeparableConv2DParams = depthwise_conv2d::SeparableConv2DParams;
+
+  /** Get a reference to the underlying benchmark fixture. */
+  Benchmark& underlying_benchmark() { return static_cast<Benchmark&>(*this); }
+
+  /** Get the parameters for the pointwise part of the convolution. */
+  static conv2d::Conv2DParams get_pointwise_params(
+      SeparableConv2DParams const& params) {
+    auto const& dw = params.depthwise;
+    conv2d::Conv2DParams pw_params{};
+    pw_params.channels = dw.channels * dw.channel_multiplier;
+    pw_params.features = params.features;
+    pw_params.batch = dw.batch;
+    pw_params.in_rows = dw.out_rows;
+    pw_params.in_cols = dw.out_cols;
+    pw_params.window_rows = 1;
+    pw_params.window_cols = 1;
+    pw_params.stride_rows = 1;
+    pw_params.stride_cols = 1;
+    pw_params.out_rows = dw.out_rows;
+    pw_params.out_cols = dw.out_cols;
+    pw_params.pad_rows = 0;
+    pw_params.pad_cols = 0;
+    return pw_params;
+  }
+
+  /**
+   * Launch the separable convolution, either as a single fused kernel or as
+   * a depthwise convolution followed by a 1x1 matmul convolution.
+   */
+  template <typename Backend>
+  SNNStatus launch(
+      typename Backend::template pointer_type<float const> input,
+      typename Backend::template pointer_type<float const> dw_filter,
+      typename Backend::template pointer_type<float const> pw_filter,
+      typename Backend::template pointer_type<float> intermediate,
+      typename Backend::template pointer_type<float> output,
+      SeparableConv2DParams const& params, Backend& backend) {
+    if (Fused) {
+      return depthwise_conv2d::launch_separable<float>(
+          input, dw_filter, pw_filter, output, params, backend);
+    }
+    auto status = depthwise_conv2d::launch<float, conv2d::conv_type::Forward>(
+        input, dw_filter, intermediate, params.depthwise, backend);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    conv2d::ConstantSelector<conv2d::Algorithm::Matmul> selector;
+    return conv2d::launch<float, conv2d::conv_type::Forward>(
+        intermediate, pw_filter, output, get_pointwise_params(params),
+        selector, backend, typename Backend::template pointer_type<float>{},
+        0);
+  }
+
+ public:
+  /** Execute a separable convolution benchmark with the given parameters. */
+  void execute(State& state, SeparableConv2DParams const& params) {
+    auto& benchmark = underlying_benchmark();
+    auto& backend = benchmark.get_backend();
+
+    auto sizes = sycldnn::depthwise_conv2d::get_separable_sizes(params);
+    size_t const intermediate_size =
+        Fused ? 1
+              : sycldnn::depthwise_conv2d::get_sizes<
+                    conv2d::conv_type::Forward>(params.depthwise)
+                    .output_size;
+
+    std::vector<float> inp_vec(sizes.input_size);
+    std::vector<float> dw_fil_vec(sizes.depthwise_filter_size);
+    std::vector<float> pw_fil_vec(sizes.pointwise_filter_size);
+    std::vector<float> int_vec(intermediate_size);
+    std::vector<float> out_vec(sizes.output_size);
+
+    auto inp_gpu =
+        benchmark.get_initialised_device_memory(inp_vec.size(), inp_vec);
+    auto dw_fil_gpu =
+        benchmark.get_initialised_device_memory(dw_fil_vec.size(), dw_fil_vec);
+    auto pw_fil_gpu =
+        benchmark.get_initialised_device_memory(pw_fil_vec.size(), pw_fil_vec);
+    auto int_gpu =
+        benchmark.get_initialised_device_memory(int_vec.size(), int_vec);
+    auto out_gpu =
+        benchmark.get_initialised_device_memory(out_vec.size(), out_vec);
+
+    SNN_ON_SCOPE_EXIT {
+      benchmark.deallocate_ptr(out_gpu);
+      benchmark.deallocate_ptr(int_gpu);
+      benchmark.deallocate_ptr(pw_fil_gpu);
+      benchmark.deallocate_ptr(dw_fil_gpu);
+      benchmark.deallocate_ptr(inp_gpu);
+    };
+
+    {  // Ensure the kernels are built before benchmarking
+      SNNStatus status;
+      try {
+        status = launch(inp_gpu, dw_fil_gpu, pw_fil_gpu, int_gpu, out_gpu,
+                        params, backend);
+      } catch (cl::sycl::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      }
+
+      if (sycldnn::StatusCode::OK != status.status) {
+        state.SkipWithError(UnsupportedFailure);
+        return;
+      }
+
+      try {
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      } catch (std::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      }
+    }
+
+    for (auto _ : state) {
+      this->start_timing();
+      try {
+        auto status = launch(inp_gpu, dw_fil_gpu, pw_fil_gpu, int_gpu,
+                             out_gpu, params, backend);
+
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      }
+
+      this->end_timing();
+      this->set_iteration_time(state);
+    }
+
+    benchmark.set_items_processed(state, params);
+    benchmark.add_param_counters(state, params);
+    benchmark.template add_bandwidth_counters<float>(
+        state, sizes, Fused ? 0 : intermediate_size);
+
+    this->finish_benchmark(state);
+  }
+};
+
+}  // namespace bench
+}  // namespace sycldnn
+
+#endif  // PORTDNN_BENCH_DEPTHWISE_CONV2D_SNN_SEPARABLE_CONV2D_EXECUTOR_H_
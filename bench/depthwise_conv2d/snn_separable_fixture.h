@@ -0,0 +1,140 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_BENCH_DEPTHWISE_CONV2D_SNN_SEPARABLE_FIXTURE_H_
+#define PORTDNN_BENCH_DEPTHWISE_CONV2D_SNN_SEPARABLE_FIXTURE_H_
+
+#include "benchmark_config.h"
+#include "benchmark_params.h"
+#include "snn_separable_conv2d_executor.h"
+
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "src/backend/backend_provider.h"
+
+#include "bench/fixture/add_computecpp_info.h"
+#include "bench/fixture/add_datatype_info.h"
+#include "bench/fixture/add_sycl_device_info.h"
+#include "bench/fixture/statistic.h"
+#include "bench/fixture/string_reporter.h"
+
+#include <benchmark/benchmark.h>
+
+extern const char* commit_date;
+extern const char* commit_hash;
+
+template <typename Backend, typename DataType, bool Fused>
+class SNNSeparableConvolutionBenchmark
+    : public sycldnn::bench::SNNSeparableConv2DExecutor<
+          SNNSeparableConvolutionBenchmark<Backend, DataType, Fused>, Fused>,
+      public sycldnn::backend::BackendProvider<Backend>,
+      public sycldnn::bench::StringReporter,
+      public benchmark::Fixture {
+ private:
+  using State = benchmark::State;
+  using SeparableConv2DParams =
+      sycldnn::depthwise_conv2d::SeparableConv2DParams;
+  using SeparableConvSizes = sycldnn::depthwise_conv2d::SeparableConvSizes;
+
+ protected:
+  void run(State& state) {
+    auto params = benchmark_params::deserialize_separable(state);
+    this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
+        new sycldnn::bench::MaxStatistic{}});
+    this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
+        new sycldnn::bench::MinStatistic{}});
+    this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
+        new sycldnn::bench::StdDevStatistic{}});
+    this->execute(state, params);
+
+    // Get the SYCL device, and add device and driver info to the benchmark.
+    auto& backend = this->get_backend();
+    auto dev = backend.get_queue().get_device();
+    sycldnn::bench::device_info::add_opencl_device_info(dev, *this);
+    sycldnn::bench::computecpp_info::add_computecpp_version(*this);
+    sycldnn::bench::datatype_info::add_datatype_info<DataType>(*this);
+
+    this->add_to_label("@fused", Fused ? "true" : "false");
+    this->add_to_label("@library", "portDNN");
+    this->add_to_label("@backend", backend.name());
+    this->add_to_label("short_name", "Separable Convolution");
+    this->add_to_label("git_hash", commit_hash);
+    this->set_label(state);
+  }
+
+  void set_model(const char* model_name) {
+    this->add_to_label("@model_name", model_name);
+  }
+
+ public:
+  // Adds the separable convolution parameters to the counter set.
+  void add_param_counters(State& state, SeparableConv2DParams const& params) {
+    auto const& dw = params.depthwise;
+    state.counters["batch"] = dw.batch;
+    state.counters["in_rows"] = dw.in_rows;
+    state.counters["in_cols"] = dw.in_cols;
+    state.counters["channels"] = dw.channels;
+    state.counters["channel_multiplier"] = dw.channel_multiplier;
+    state.counters["features"] = params.features;
+    state.counters["out_rows"] = dw.out_rows;
+    state.counters["out_cols"] = dw.out_cols;
+    state.counters["stride_rows"] = dw.stride_rows;
+    state.counters["stride_cols"] = dw.stride_cols;
+    state.counters["fil_rows"] = dw.window_rows;
+    state.counters["fil_cols"] = dw.window_cols;
+    state.counters["pad_rows"] = dw.pad_rows;
+    state.counters["pad_cols"] = dw.pad_cols;
+  }
+
+  // Adds the bandwidth requirements to the counter set. The intermediate
+  // tensor is written and then read back when the convolutions are not fused.
+  template <typename T>
+  void add_bandwidth_counters(State& state, SeparableConvSizes const& sizes,
+                              size_t intermediate_size) {
+    auto element_bytes = sizeof(T);
+    state.counters["bytes_read"] =
+        (sizes.input_size + sizes.depthwise_filter_size +
+         sizes.pointwise_filter_size + intermediate_size) *
+        element_bytes;
+    state.counters["bytes_written"] =
+        (sizes.output_size + intermediate_size) * element_bytes;
+  }
+
+  // Records the number of operations performed, with a fused multiply-add for
+  // each element of the depthwise window and of the pointwise filter.
+  void set_items_processed(State& state, SeparableConv2DParams const& params) {
+    auto const& dw = params.depthwise;
+    auto window_size = dw.window_rows * dw.window_cols;
+    auto dw_features = dw.channels * dw.channel_multiplier;
+    auto n_pixels = dw.batch * dw.out_rows * dw.out_cols;
+    auto num_ops = 2;
+    state.SetItemsProcessed(state.iterations() * n_pixels * dw_features *
+                            (window_size + params.features) * num_ops);
+  }
+};
+
+#define SEPARABLE_CONVOLUTION_BENCHMARK(name, ...)                    \
+  BENCHMARK_TEMPLATE_DEFINE_F(SNNSeparableConvolutionBenchmark, name, \
+                              __VA_ARGS__)                            \
+  (benchmark::State & state) {                                        \
+    this->set_model(get_benchmark_name());                            \
+    this->run(state);                                                 \
+  }                                                                   \
+  BENCHMARK_REGISTER_F(SNNSeparableConvolutionBenchmark, name)        \
+      ->UseManualTime()                                               \
+      ->Unit(benchmark::kNanosecond)                                  \
+      ->Apply(RunForAllParamSets);
+
+#endif  // PORTDNN_BENCH_DEPTHWISE_CONV2D_SNN_SEPARABLE_FIXTURE_H_
@@ -0,0 +1,257 @@
+#!/usr/bin/python3
+#
+# Copyright Codeplay Software Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use these files except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generate a matmul tile table from benchmark results.
+#
+# Run the tiled_matmul internal benchmark on the target device with
+# `--benchmark_format=csv`, then pass the resulting files to this script. Only
+# the tile and work-group sizes instantiated in src/matmul/launch.cc are
+# considered. The fastest of those is found for each matrix multiply, and a
+# small decision tree is fitted to those choices over m, k, n, the batch size
+# and the transposes. The tree is written as a C++ header in
+# src/matmul/tables, which is compiled into matmul::internal::launch.
+
+from __future__ import print_function
+
+import argparse
+import csv
+import os
+from collections import Counter, defaultdict
+
+LICENSE = r"""/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+# Map from the (row_tile, acc_tile, col_tile, workgroup_rows, workgroup_cols,
+# workgroup_batch) of a benchmark to the TileConfig enum values. These must
+# match the configurations launched in src/matmul/launch.cc.
+TILE_CONFIGS = {
+    (4, 4, 4, 8, 4, 1): 'Tiles444',
+    (1, 8, 4, 1, 64, 1): 'SkinnyRows',
+    (4, 8, 1, 64, 1, 1): 'SkinnyCols',
+    (2, 4, 4, 4, 8, 2): 'SmallBatched',
+}
+
+CONFIG_COLUMNS = [
+    'row_tile', 'acc_tile', 'col_tile', 'workgroup_rows', 'workgroup_cols',
+    'workgroup_batch'
+]
+
+# The features used by the trees, as (TileFeature name, value function).
+FEATURES = [
+    ('M', lambda p: p['m']),
+    ('K', lambda p: p['k']),
+    ('N', lambda p: p['n']),
+    ('Batch', lambda p: p['batch']),
+    ('TransposeLHS', lambda p: p['transpose_lhs']),
+    ('TransposeRHS', lambda p: p['transpose_rhs']),
+]
+
+PARAM_COLUMNS = ['m', 'k', 'n', 'batch']
+
+# Older benchmark results only cover untransposed matrices.
+OPTIONAL_COLUMNS = ['transpose_lhs', 'transpose_rhs']
+
+
+def load_benchmark(filename):
+    """ Load the rows of a benchmark csv file, skipping the preamble. """
+    with open(filename) as inp:
+        lines = inp.readlines()
+    for header_line, line in enumerate(lines):
+        if line[0:4] == 'name':
+            break
+    else:
+        return []
+    return list(csv.DictReader(lines[header_line:]))
+
+
+def fastest_configs(rows):
+    """
+    Find the fastest tile configuration for each matrix multiply.
+
+    Returns a list of (params, config) pairs.
+    """
+    best = {}
+    for row in rows:
+        if row.get('error_occurred', '') == 'true':
+            continue
+        if not all(row.get(col) for col in CONFIG_COLUMNS + PARAM_COLUMNS):
+            continue
+        config = TILE_CONFIGS.get(
+            tuple(int(float(row[col])) for col in CONFIG_COLUMNS))
+        if config is None:
+            continue
+        params = {col: int(float(row[col])) for col in PARAM_COLUMNS}
+        for col in OPTIONAL_COLUMNS:
+            params[col] = int(float(row.get(col) or 0))
+        time = float(row['real_time'])
+        key = tuple(params[col] for col in PARAM_COLUMNS + OPTIONAL_COLUMNS)
+        if key not in best or time < best[key][2]:
+            best[key] = (params, config, time)
+    return [(params, config) for _, (params, config, _) in sorted(best.items())]
+
+
+def gini(labels):
+    """ Compute the Gini impurity of a list of labels. """
+    total = float(len(labels))
+    counts = Counter(labels)
+    return 1. - sum((c / total)**2 for c in counts.values())
+
+
+def best_split(samples, min_leaf):
+    """ Find the split with the lowest weighted Gini impurity. """
+    labels = [config for _, config in samples]
+    best = None
+    best_score = gini(labels)
+    for idx, (_, value_fn) in enumerate(FEATURES):
+        values = sorted(set(value_fn(p) for p, _ in samples))
+        for threshold in values[:-1]:
+            left = [c for p, c in samples if value_fn(p) <= threshold]
+            right = [c for p, c in samples if value_fn(p) > threshold]
+            if len(left) < min_leaf or len(right) < min_leaf:
+                continue
+            score = (len(left) * gini(left) +
+                     len(right) * gini(right)) / len(samples)
+            if score < best_score:
+                best_score = score
+                best = (idx, threshold)
+    return best
+
+
+def build_tree(samples, max_depth, min_leaf, nodes):
+    """
+    Fit a decision tree to the samples, appending the nodes to the list.
+
+    Returns the index of the root node of the tree.
+    """
+    index = len(nodes)
+    labels = [config for _, config in samples]
+    majority = Counter(labels).most_common(1)[0][0]
+    split = None
+    if max_depth > 0 and len(set(labels)) > 1:
+        split = best_split(samples, min_leaf)
+    if split is None:
+        nodes.append(('Leaf', 0, 0, 0, majority))
+        return index
+
+    feature, threshold = split
+    value_fn = FEATURES[feature][1]
+    nodes.append(None)
+    left = build_tree([s for s in samples if value_fn(s[0]) <= threshold],
+                      max_depth - 1, min_leaf, nodes)
+    right = build_tree([s for s in samples if value_fn(s[0]) > threshold],
+                       max_depth - 1, min_leaf, nodes)
+    nodes[index] = (FEATURES[feature][0], threshold, left, right, 'NotSet')
+    return index
+
+
+def generate_header(device, nodes, n_results):
+    """ Generate the C++ header holding the table for a device. """
+    guard = 'PORTDNN_SRC_MATMUL_TABLES_{}_H_'.format(device.upper())
+    parts = [
+        LICENSE,
+        '#ifndef {}'.format(guard),
+        '#define {}'.format(guard),
+        '',
+        '// DO NOT MODIFY BY HAND',
+        '// This file was automatically generated by gen_matmul_tile_table.py',
+        '// from {} benchmarked matrix multiplies.'.format(n_results),
+        '',
+        '#include "src/matmul/tile_table.h"',
+        '',
+        'namespace sycldnn {',
+        'namespace matmul {',
+        'namespace internal {',
+        'namespace {} {{'.format(device),
+        '',
+        'inline constexpr TileNode tile_nodes[] = {',
+    ]
+    for feature, threshold, left, right, config in nodes:
+        parts.append('    {{TileFeature::{}, {}, {}, {}, TileConfig::{}}},'.
+                     format(feature, threshold, left, right, config))
+    parts += [
+        '};',
+        'inline constexpr TileTable tile_table{{tile_nodes, {}}};'.format(
+            len(nodes)),
+        '',
+        '}}  // namespace {}'.format(device),
+        '}  // namespace internal',
+        '}  // namespace matmul',
+        '}  // namespace sycldnn',
+        '#endif  // {}'.format(guard),
+        '',
+    ]
+    return '\n'.join(parts)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate a matmul tile table from benchmark csvs.')
+    parser.add_argument(
+        'files', nargs='+', help='Filenames of benchmark csv results')
+    parser.add_argument(
+        '--device',
+        required=True,
+        choices=['intel_cpu', 'intel_gpu', 'arm_gpu'],
+        help='The device the benchmarks were run on')
+    parser.add_argument(
+        '--max-depth', type=int, default=4, help='Maximum depth of the tree')
+    parser.add_argument(
+        '--min-leaf',
+        type=int,
+        default=2,
+        help='Minimum number of matrix multiplies in each leaf')
+    parser.add_argument(
+        '--output-dir',
+        default=os.path.join(
+            os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src',
+            'matmul', 'tables'),
+        help='Directory to write the generated header to')
+    args = parser.parse_args()
+
+    rows = []
+    for filename in args.files:
+        rows += load_benchmark(filename)
+    samples = fastest_configs(rows)
+
+    nodes = []
+    if samples:
+        build_tree(samples, args.max_depth, args.min_leaf, nodes)
+    else:
+        # Without results the launcher falls back to the default heuristics.
+        nodes.append(('Leaf', 0, 0, 0, 'NotSet'))
+
+    output = os.path.normpath(
+        os.path.join(args.output_dir, '{}.h'.format(args.device)))
+    with open(output, 'w') as out:
+        out.write(generate_header(args.device, nodes, len(samples)))
+    print('Wrote {} from {} matrix multiplies'.format(output, len(samples)))
+
+
+if __name__ == "__main__":
+    main()
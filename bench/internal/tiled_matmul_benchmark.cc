@@ -19,6 +19,7 @@
 
 #include "portdnn/backend/snn_backend.h"
 
+#include "portdnn/internal/matmul/launch.h"
 #include "portdnn/matmul/params.h"
 #include "src/backend/backend_provider.h"
 #include "src/backend/snn_backend_provider.h"
@@ -122,6 +123,8 @@ struct SNNMatmulExecutor : public BaseExecutor {
     auto lhs_mem = backend.get_mem_object(const_lhs_gpu, lhs_vec.size());
     auto rhs_mem = backend.get_mem_object(const_rhs_gpu, rhs_vec.size());
     auto out_mem = backend.get_mem_object(out_gpu, out_vec.size());
+    auto const matmul_params = matmul::internal::resolve_strides<false, false>(
+        sycldnn::matmul::MatmulParams{batch, m, k, n, 0.f});
 
     {  // Ensure the kernel is built before benchmarking
       SNNStatus status;
@@ -131,14 +134,12 @@ struct SNNMatmulExecutor : public BaseExecutor {
                 ? matmul::internal::queue_kernel<DataType, int32_t, false,
                                                  false, RowTile, AccTile,
                                                  ColTile, false>(
-                      lhs_mem, rhs_mem, out_mem,
-                      sycldnn::matmul::MatmulParams{batch, m, k, n, 0.f}, queue,
+                      lhs_mem, rhs_mem, out_mem, matmul_params, queue,
                       workgroup_rows, workgroup_cols, workgroup_batch, {})
                 : matmul::internal::queue_kernel<DataType, int32_t, false,
                                                  false, RowTile, AccTile,
                                                  ColTile, true>(
-                      lhs_mem, rhs_mem, out_mem,
-                      sycldnn::matmul::MatmulParams{batch, m, k, n, 0.f}, queue,
+                      lhs_mem, rhs_mem, out_mem, matmul_params, queue,
                       workgroup_rows, workgroup_cols, workgroup_batch, {});
 
       } catch (cl::sycl::exception const& e) {
@@ -176,14 +177,12 @@ struct SNNMatmulExecutor : public BaseExecutor {
                 ? matmul::internal::queue_kernel<DataType, int32_t, false,
                                                  false, RowTile, AccTile,
                                                  ColTile, false>(
-                      lhs_mem, rhs_mem, out_mem,
-                      sycldnn::matmul::MatmulParams{batch, m, k, n, 0.f}, queue,
+                      lhs_mem, rhs_mem, out_mem, matmul_params, queue,
                       workgroup_rows, workgroup_cols, workgroup_batch, {})
                 : matmul::internal::queue_kernel<DataType, int32_t, false,
                                                  false, RowTile, AccTile,
                                                  ColTile, true>(
-                      lhs_mem, rhs_mem, out_mem,
-                      sycldnn::matmul::MatmulParams{batch, m, k, n, 0.f}, queue,
+                      lhs_mem, rhs_mem, out_mem, matmul_params, queue,
                       workgroup_rows, workgroup_cols, workgroup_batch, {});
         wait_for_event(status.event, backend.get_queue());
       } catch (cl::sycl::exception const& e) {
@@ -210,6 +209,8 @@ struct SNNMatmulExecutor : public BaseExecutor {
     state.counters["k"] = k;
     state.counters["n"] = n;
     state.counters["batch"] = batch;
+    state.counters["transpose_lhs"] = 0;
+    state.counters["transpose_rhs"] = 0;
     state.counters["row_tile"] = RowTile;
     state.counters["acc_tile"] = AccTile;
     state.counters["col_tile"] = ColTile;
@@ -309,6 +310,8 @@ void register_benchmark(
   for (auto bench : registered_benchmarks) {
     bench->Args({m, k, n, batch, 1, 64, 1})
         ->Args({m, k, n, batch, 1, 128, 1})
+        ->Args({m, k, n, batch, 4, 8, 2})
+        ->Args({m, k, n, batch, 8, 4, 1})
         ->Args({m, k, n, batch, 8, 8, 1})
         ->Args({m, k, n, batch, 8, 16, 1})
         ->Args({m, k, n, batch, 8, 32, 1})
@@ -66,8 +66,43 @@ inline constexpr bool is_buffer_backend_v = is_buffer_backend<Backend>::value;
 
 template <typename Backend>
 struct supports_interleaved_matmul
+    : std::integral_constant<
+          bool, std::is_same<Backend, SyclBLASBackend>::value ||
+                    std::is_same<Backend, SNNBackend>::value ||
+                    std::is_same<Backend, SNNUSMBackend>::value> {};
+
+/**
+ * Whether the backend provides matmul_epilogue(), a matrix multiply which
+ * applies a convolution epilogue to its output before it is written.
+ */
+template <typename Backend>
+struct supports_matmul_epilogue
+    : std::integral_constant<bool,
+                             std::is_same<Backend, SNNBackend>::value ||
+                                 std::is_same<Backend, SNNUSMBackend>::value> {
+};
+
+/**
+ * Whether the backend provides batch_matmul_mixed(), a batched matrix
+ * multiply which accumulates in a different data type to its tensors.
+ */
+template <typename Backend>
+struct supports_mixed_precision_matmul
+    : std::integral_constant<bool,
+                             std::is_same<Backend, SNNBackend>::value ||
+                                 std::is_same<Backend, SNNUSMBackend>::value> {
+};
+
+/**
+ * Whether the backend provides strided_batch_matmul(), a batched matrix
+ * multiply with explicit batch strides, which may be zero to reuse a matrix.
+ */
+template <typename Backend>
+struct supports_strided_batch_matmul
     : std::integral_constant<bool,
-                             std::is_same<Backend, SyclBLASBackend>::value> {};
+                             std::is_same<Backend, SNNBackend>::value ||
+                                 std::is_same<Backend, SNNUSMBackend>::value> {
+};
 
 }  // namespace backend
 }  // namespace sycldnn
@@ -26,6 +26,9 @@
 #include "portdnn/backend/backend_helpers.h"
 #include "portdnn/backend/backend_traits.h"
 #include "portdnn/backend/internal_backend.h"
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/internal/conv2d/epilogue.h"
+#include "portdnn/internal/matmul/launch_allocated.h"
 #include "portdnn/matmul/launch.h"
 #include "portdnn/matmul/params.h"
 
@@ -79,10 +82,10 @@ struct SNNUSMMatmulProvider {
                          Index const m, Index const k, Index const n,
                          const std::vector<cl::sycl::event>& events = {}) {
     auto& underlying_backend = static_cast<Backend&>(*this);
-    internal::InternalBackend<Backend> internal_backend{underlying_backend};
-    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+    auto status = matmul::internal::launch_with_allocated_workspace<
+        T, TransposeLHS, TransposeRHS>(
         lhs, rhs, output, sycldnn::matmul::MatmulParams{1, m, k, n, beta},
-        internal_backend, events);
+        underlying_backend, events);
     SNN_ASSERT(status.status == StatusCode::OK,
                "Error launching matmul kernel.");
     return status.event;
@@ -118,10 +121,76 @@ struct SNNUSMMatmulProvider {
                          internal_pointer_type<T> const output, T const beta,
                          Index const m, Index const k, Index const n) {
     auto& underlying_backend = static_cast<Backend&>(*this);
-    internal::InternalBackend<Backend> internal_backend{underlying_backend};
-    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+    auto status = matmul::internal::launch_with_allocated_workspace<
+        T, TransposeLHS, TransposeRHS>(
         lhs, rhs, output, sycldnn::matmul::MatmulParams{1, m, k, n, beta},
-        internal_backend);
+        underlying_backend);
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching matmul kernel.");
+    return status.event;
+  }
+
+  /**
+   * Compute a matrix multiply and apply a convolution epilogue to the result.
+   *
+   * Perform the operation:
+   * \code
+   *   output = epilogue(lhs * rhs)
+   * \endcode
+   * where lhs is a [m x k] matrix and rhs is a [k x n] matrix, both in
+   * row-major ordering. The epilogue is applied in the matmul kernel before
+   * the output is written, so no further pass over the output is needed.
+   *
+   * The columns of the output are treated as the output features, so the
+   * bias holds n values, while the residual is a [m x n] matrix with the same
+   * layout as the output.
+   *
+   * \param [in]  lhs      Pointer to a buffer containing the LHS matrix.
+   * \param [in]  rhs      Pointer to a buffer containing the RHS matrix.
+   * \param [out] output   Pointer to a buffer containing the output matrix.
+   * \param [in]  m        Number of rows in the LHS matrix.
+   * \param [in]  k        Number of columns in the LHS matrix and rows in the
+   *                       RHS matrix.
+   * \param [in]  n        Number of columns in the RHS matrix.
+   * \param [in]  params   The epilogue operations to apply.
+   * \param [in]  bias     Pointer to the bias, only used if params.add_bias
+   *                       is set.
+   * \param [in]  residual Pointer to the residual, only used if
+   *                       params.add_residual is set.
+   * \param [in]  events   Events to wait on before launching the kernel.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T, typename Index>
+  cl::sycl::event matmul_epilogue(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output, Index const m, Index const k,
+      Index const n, conv2d::EpilogueParams const& params,
+      internal_pointer_type<const T> const bias,
+      internal_pointer_type<const T> const residual,
+      const std::vector<cl::sycl::event>& events = {}) {
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    internal::InternalBackend<Backend> internal_backend{underlying_backend};
+    size_t const m_size = static_cast<size_t>(m);
+    size_t const n_size = static_cast<size_t>(n);
+    auto lhs_mem = internal_backend.get_mem_object(lhs, m_size * k);
+    auto rhs_mem = internal_backend.get_mem_object(rhs, n_size * k);
+    auto out_mem = internal_backend.get_mem_object(output, m_size * n_size);
+    size_t const bias_size = params.add_bias ? n_size : 1;
+    size_t const residual_size = params.add_residual ? m_size * n_size : 1;
+    auto epilogue_mem = conv2d::internal::make_epilogue_mem(
+        params, internal_backend.get_mem_object(bias, bias_size),
+        internal_backend.get_mem_object(residual, residual_size));
+    auto matmul_params =
+        matmul::internal::resolve_strides<TransposeLHS, TransposeRHS>(
+            sycldnn::matmul::MatmulParams{1, m, k, n, 0.f});
+    auto queue = underlying_backend.get_queue();
+    auto status =
+        conv2d::internal::launch_matmul_epilogue<T, TransposeLHS,
+                                                 TransposeRHS>(
+            lhs_mem, rhs_mem, out_mem, epilogue_mem, matmul_params, queue,
+            events);
     SNN_ASSERT(status.status == StatusCode::OK,
                "Error launching matmul kernel.");
     return status.event;
@@ -135,9 +204,11 @@ struct SNNUSMMatmulProvider {
    *   output[i] = lhs[i] * rhs[i]
    * \endcode
    * for 0 <= i < batch, where lhs is a [batch x m x k] tensor and rhs is a
-   * [batch x k x n] tensor. Each matrix is assumed to be contiguous in memory
-   * and in row-major format. The `bool` template parameters determine whether
-   * or not to transpose the matrices.
+   * [batch x k x n] tensor. Each matrix is in row-major format. With the
+   * strided batch format each matrix is contiguous in memory, while with the
+   * interleaved batch format the batch is the fastest moving dimension. The
+   * `bool` template parameters determine whether or not to transpose the
+   * matrices.
    *
    * \param [in]     lhs        Pointer to a buffer containing the LHS matrix.
    * \param [in]     rhs        Pointer to a buffer containing the RHS matrix.
@@ -161,17 +232,14 @@ struct SNNUSMMatmulProvider {
       internal_pointer_type<T> const output, Index const n_batches,
       Index const m, Index const k, Index const n,
       sycldnn::BatchFormat const batch_type = sycldnn::BatchFormat::STRIDED) {
-    if (batch_type != sycldnn::BatchFormat::STRIDED) {
-      throw std::runtime_error(
-          "SNN batch matmul only supports strided batch format.");
-    }
 
     auto& underlying_backend = static_cast<Backend&>(*this);
-    internal::InternalBackend<Backend> internal_backend{underlying_backend};
-    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+    auto status = matmul::internal::launch_with_allocated_workspace<
+        T, TransposeLHS, TransposeRHS>(
         lhs, rhs, output,
-        sycldnn::matmul::MatmulParams{n_batches, m, k, n, T{0}},
-        internal_backend);
+        sycldnn::matmul::MatmulParams{n_batches, m, k, n, T{0},
+                                      batch_type},
+        underlying_backend);
     SNN_ASSERT(status.status == StatusCode::OK,
                "Error launching matmul kernel.");
     return status.event;
@@ -185,9 +253,11 @@ struct SNNUSMMatmulProvider {
    *   output[i] = lhs[i] * rhs[i]
    * \endcode
    * for 0 <= i < batch, where lhs is a [batch x m x k] tensor and rhs is a
-   * [batch x k x n] tensor. Each matrix is assumed to be contiguous in memory
-   * and in row-major format. The `bool` template parameters determine whether
-   * or not to transpose the matrices.
+   * [batch x k x n] tensor. Each matrix is in row-major format. With the
+   * strided batch format each matrix is contiguous in memory, while with the
+   * interleaved batch format the batch is the fastest moving dimension. The
+   * `bool` template parameters determine whether or not to transpose the
+   * matrices.
    *
    * \param [in]     lhs        Pointer to a buffer containing the LHS matrix.
    * \param [in]     rhs        Pointer to a buffer containing the RHS matrix.
@@ -214,17 +284,96 @@ struct SNNUSMMatmulProvider {
       Index const m, Index const k, Index const n,
       sycldnn::BatchFormat const batch_type = sycldnn::BatchFormat::STRIDED,
       const std::vector<cl::sycl::event>& events = {}) {
-    if (batch_type != sycldnn::BatchFormat::STRIDED) {
-      throw std::runtime_error(
-          "SNN batch matmul only supports strided batch format.");
-    }
 
     auto& underlying_backend = static_cast<Backend&>(*this);
-    internal::InternalBackend<Backend> internal_backend{underlying_backend};
-    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+    auto status = matmul::internal::launch_with_allocated_workspace<
+        T, TransposeLHS, TransposeRHS>(
         lhs, rhs, output,
-        sycldnn::matmul::MatmulParams{n_batches, m, k, n, T{0}},
-        internal_backend, events);
+        sycldnn::matmul::MatmulParams{n_batches, m, k, n, T{0},
+                                      batch_type},
+        underlying_backend, events);
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching matmul kernel.");
+    return status.event;
+  }
+
+  /**
+   * Compute a batch of matrix multiplies, accumulating the products as
+   * ComputeT while the matrices are stored as T.
+   *
+   * \copydetails batch_matmul()
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T,
+            typename ComputeT, typename Index>
+  cl::sycl::event batch_matmul_mixed(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output, Index const n_batches,
+      Index const m, Index const k, Index const n,
+      sycldnn::BatchFormat const batch_type = sycldnn::BatchFormat::STRIDED,
+      const std::vector<cl::sycl::event>& events = {}) {
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    auto status = matmul::internal::launch_with_allocated_workspace<
+        T, TransposeLHS, TransposeRHS, ComputeT>(
+        lhs, rhs, output,
+        sycldnn::matmul::MatmulParams{n_batches, m, k, n, T{0},
+                                      batch_type},
+        underlying_backend, events);
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching matmul kernel.");
+    return status.event;
+  }
+
+  /**
+   * Compute a batch of matrix multiplies with explicit batch strides.
+   *
+   * Perform the batched matrix multiply operation:
+   * \code
+   *   output[i] = lhs[i] * rhs[i] + beta * output[i]
+   * \endcode
+   * for 0 <= i < n_batches, where matrix i of each tensor starts at i times
+   * the tensor's batch stride. A batch stride of zero uses the same matrix
+   * for every batch, so a single filter can be applied to a batch of images
+   * in one launch. Each matrix is densely packed in row-major format.
+   *
+   * \param [in]     lhs              Pointer to the LHS matrices.
+   * \param [in]     rhs              Pointer to the RHS matrices.
+   * \param [in,out] output           Pointer to the output matrices.
+   * \param [in]     beta             Scale multiplier for the output.
+   * \param [in]     n_batches        Number of matrices to multiply.
+   * \param [in]     m                Number of rows in the LHS matrix.
+   * \param [in]     k                Number of columns in the LHS matrix and
+   *                                  rows in the RHS matrix.
+   * \param [in]     n                Number of columns in the RHS matrix.
+   * \param [in]     lhs_batch_stride Distance between the LHS matrices.
+   * \param [in]     rhs_batch_stride Distance between the RHS matrices.
+   * \param [in]     out_batch_stride Distance between the output matrices.
+   * \param [in]     events           Events which should be completed before
+   *                                  the operation
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T, typename Index>
+  cl::sycl::event strided_batch_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output, T const beta,
+      Index const n_batches, Index const m, Index const k, Index const n,
+      Index const lhs_batch_stride, Index const rhs_batch_stride,
+      Index const out_batch_stride,
+      const std::vector<cl::sycl::event>& events = {}) {
+    using MatmulIndex = sycldnn::matmul::MatmulParams::Index;
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    sycldnn::matmul::MatmulParams params{
+        static_cast<MatmulIndex>(n_batches), static_cast<MatmulIndex>(m),
+        static_cast<MatmulIndex>(k), static_cast<MatmulIndex>(n),
+        static_cast<float>(beta)};
+    params.lhs_batch_stride = static_cast<MatmulIndex>(lhs_batch_stride);
+    params.rhs_batch_stride = static_cast<MatmulIndex>(rhs_batch_stride);
+    params.out_batch_stride = static_cast<MatmulIndex>(out_batch_stride);
+    auto status = matmul::internal::launch_with_allocated_workspace<
+        T, TransposeLHS, TransposeRHS>(lhs, rhs, output, params,
+                                       underlying_backend, events);
     SNN_ASSERT(status.status == StatusCode::OK,
                "Error launching matmul kernel.");
     return status.event;
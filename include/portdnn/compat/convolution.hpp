@@ -26,6 +26,8 @@
 #include "portdnn/conv2d/selector/default_selector.h"
 #include "portdnn/conv2d/selector/direct_selector.h"
 #include "portdnn/conv2d/selector/im2col_selector.h"
+#include "portdnn/conv2d/selector/implicit_gemm_selector.h"
+#include "portdnn/conv2d/selector/local_tiled_selector.h"
 #include "portdnn/conv2d/selector/matmul_selector.h"
 #include "portdnn/conv2d/selector/tiled_selector.h"
 #include "portdnn/conv2d/selector/winograd_selector.h"
@@ -517,6 +519,10 @@ inline std::unique_ptr<conv2d::Selector> getSelector(conv2d::Algorithm algo) {
       return std::make_unique<conv2d::MatmulSelector>();
     case algo_t::Direct:
       return std::make_unique<conv2d::DirectSelector>();
+    case algo_t::ImplicitGemm:
+      return std::make_unique<conv2d::ImplicitGemmSelector>();
+    case algo_t::LocalTiled:
+      return std::make_unique<conv2d::LocalTiledSelector>();
     default:
       return nullptr;
   }
@@ -755,6 +761,62 @@ sycldnn::StatusCode getConvolutionForwardWorkspaceSize(
   return StatusCode::OK;
 }
 
+/**
+ * Selects an algorithm for forward conv2d whose workspace fits within a memory
+ * limit, and queries the workspace size to allocate for it.
+ *
+ * If the requested algorithm needs more workspace than the limit allows then
+ * im2col with a smaller minibatch is tried, followed by algorithms which need
+ * no workspace.
+ * \param handle The SNNHandle.
+ * \param xDesc Descriptor for the input tensor.
+ * \param wDesc Descriptor for the filter.
+ * \param convDesc Descriptor for the convolution operation.
+ * \param yDesc Descriptor for the output tensor, its dimension can be obtained
+ * with getConvolution2dForwardOutputDim.
+ * \param algo The requested convolution algorithm, overwritten with the
+ * algorithm which fits within the limit.
+ * \param workSpaceLimitInBytes The maximum size of the scratchpad memory.
+ * \param workSpaceSizeInBytes Output size of the scratchpad memory to allocate,
+ * which is no larger than the limit.
+ * \return sycldnn::StatusCode::OK, or
+ * sycldnn::StatusCode::InsufficientWorkspace if no algorithm fits the limit.
+ */
+template <typename ValueT = float>
+sycldnn::StatusCode getConvolutionForwardWorkspaceSize(
+    SNNHandle& handle, const TensorDescriptor& xDesc,
+    const FilterDescriptor& wDesc, const ConvolutionDescriptor& convDesc,
+    const TensorDescriptor& yDesc, conv2d::Algorithm* algo,
+    size_t workSpaceLimitInBytes, size_t* workSpaceSizeInBytes) {
+  SNN_UNUSED_VAR(handle);
+  SNN_VALIDATE_PARAM(algo != nullptr, "Algorithm pointer cannot be null");
+  SNN_VALIDATE_PARAM(workSpaceSizeInBytes != nullptr,
+                     "Output pointer cannot be null");
+  std::unique_ptr<conv2d::Selector> selector = internal::getSelector(*algo);
+  SNN_VALIDATE_PARAM(selector != nullptr, "Unsupported algorithm");
+
+  sycldnn::conv2d::Conv2DParams conv_params =
+      internal::descToSnnParams(xDesc, yDesc, wDesc, convDesc);
+  auto selection = conv2d::select_for_workspace_budget<
+      ValueT, sycldnn::conv2d::conv_type::Forward>(conv_params, *selector,
+                                                   workSpaceLimitInBytes);
+  if (selection.algorithm == conv2d::Algorithm::NotSupported) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  // Only ask for the workspace needed by the minibatch which fits.
+  auto const& sizes = selection.workspace_size;
+  size_t workspace = sizes.recommended_size;
+  if (selection.minibatch_size < static_cast<size_t>(conv_params.batch)) {
+    size_t const per_image = (sizes.recommended_size - sizes.required_size) /
+                             (conv_params.batch - 1);
+    workspace =
+        sizes.required_size + (selection.minibatch_size - 1) * per_image;
+  }
+  *algo = selection.algorithm;
+  *workSpaceSizeInBytes = workspace * sizeof(ValueT);
+  return StatusCode::OK;
+}
+
 /**
  * Queries the required workspace size for backwards filter conv2d.
  * \param handle The SNNHandle.
@@ -40,8 +40,27 @@ enum class Algorithm {
   Winograd,
   /** Winograd implementation with larger tile sizes. */
   WinogradLarge,
-  /** Use a matmul for 1x1 NHWC convolutions. */
+  /**
+   * Use a matmul for 1x1 convolutions with unit stride and no padding. NHWC
+   * inputs use a single matmul, while NCHW inputs with an FCHW filter use a
+   * matmul per image, batched into one launch where the backend allows.
+   */
   Matmul,
+  /**
+   * Winograd implementation computed in a single kernel, keeping the input
+   * transform and intermediate tiles in local memory.
+   */
+  WinogradFused,
+  /**
+   * Matrix multiply of the im2col patch matrix with the filter, computing the
+   * patches on the fly so no workspace is needed.
+   */
+  ImplicitGemm,
+  /**
+   * Tiled convolution where each work-group shares an input tile, including
+   * its halo, and a block of the filter between work-items in local memory.
+   */
+  LocalTiled,
 };
 }  // namespace conv2d
 }  // namespace sycldnn
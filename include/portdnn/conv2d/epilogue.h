@@ -0,0 +1,99 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_EPILOGUE_H_
+#define PORTDNN_INCLUDE_CONV2D_EPILOGUE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::Epilogue structure,
+ * which describes the elementwise operations that can be fused onto the end of
+ * a forward convolution.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/** The activation functions which can be applied in a fused epilogue. */
+enum class Activation {
+  /** Do not apply an activation function. */
+  None,
+  /** Apply max(x, 0). */
+  Relu,
+  /** Apply min(max(x, 0), 6). */
+  Relu6,
+  /** Apply tanh(x). */
+  Tanh
+};
+
+/**
+ * The operations applied to each element of the convolution output in a fused
+ * epilogue.
+ *
+ * The epilogue computes
+ *
+ *   output = activation(output_scale * conv + bias[feature] + residual)
+ *
+ * where conv is the result of the convolution, any of the terms can be
+ * disabled and the bias and residual are only read when enabled.
+ */
+struct EpilogueParams {
+  /** Whether to add a bias with one value per output feature. */
+  bool add_bias = false;
+
+  /** Whether to add a residual tensor of the same shape as the output. */
+  bool add_residual = false;
+
+  /** The activation function to apply after all additions. */
+  Activation activation = Activation::None;
+
+  /** Scale factor applied to the convolution result before any additions. */
+  float output_scale = 1.f;
+
+  /** Check whether this epilogue leaves the convolution output unchanged. */
+  bool is_identity() const {
+    return !add_bias && !add_residual && activation == Activation::None &&
+           output_scale == 1.f;
+  }
+};
+
+/**
+ * An epilogue to fuse onto the end of a forward convolution, containing the
+ * operations to apply and the tensors they read.
+ *
+ * The bias and residual pointers are only accessed if the corresponding flags
+ * in the params are set, so can be left default constructed otherwise.
+ */
+template <typename T, typename Backend>
+struct Epilogue {
+  /** The pointer type used for the bias and residual tensors. */
+  using ConstPointer = typename Backend::template pointer_type<T const>;
+
+  /** The operations to apply in the epilogue. */
+  EpilogueParams params = {};
+
+  /** Pointer to the bias, containing one value per output feature. */
+  ConstPointer bias = {};
+
+  /**
+   * Pointer to the residual tensor, which has the same shape and layout as
+   * the convolution output. This must not alias the output tensor.
+   */
+  ConstPointer residual = {};
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_CONV2D_EPILOGUE_H_
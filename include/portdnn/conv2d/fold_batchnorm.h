@@ -0,0 +1,140 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_H_
+#define PORTDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::fold_batchnorm() function, which
+ * asynchronously dispatches the SYCL kernel required to fold a frozen
+ * batchnorm into the filter and bias of the preceding convolution.
+ */
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/fold_batchnorm_params.h"
+#include "portdnn/conv2d/params.h"
+
+#include "portdnn/internal/conv2d/fold_batchnorm.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Fold a frozen batchnorm into the filter and bias of a convolution.
+ *
+ * The folded filter and bias are computed on the device as described in
+ * \ref sycldnn::conv2d::FoldBatchNormParams. Running the convolution with the
+ * folded filter and the folded bias in a \ref sycldnn::conv2d::Epilogue then
+ * gives the result of the convolution followed by the batchnorm, without a
+ * separate batchnorm kernel. The HWCF, FHWC and FCHW filter formats are
+ * supported.
+ *
+ * \param filter        A pointer to the memory representing the filter tensor.
+ * \param bias          A pointer to the memory holding one convolution bias
+ *                      value for each output feature. Only accessed if
+ *                      fold_params.has_bias is set.
+ * \param beta          A pointer to the memory holding the batchnorm beta.
+ * \param gamma         A pointer to the memory holding the batchnorm gamma.
+ * \param mean          A pointer to the memory holding the batchnorm mean.
+ * \param variance      A pointer to the memory holding the batchnorm
+ *                      variance.
+ * \param folded_filter A pointer to the memory to write the folded filter to,
+ *                      in the same format as the filter.
+ * \param folded_bias   A pointer to the memory to write the folded bias to.
+ * \param params        The convolution parameters.
+ * \param fold_params   The batchnorm folding parameters.
+ * \param backend       The backend implementation, used to map between
+ *                      pointer representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus fold_batchnorm(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    Conv2DParams const& params, FoldBatchNormParams const& fold_params,
+    Backend& backend) {
+  return internal::sublaunch_fold_batchnorm<T>(
+      filter, bias, beta, gamma, mean, variance, folded_filter, folded_bias,
+      params, fold_params, backend, {});
+}
+
+/**
+ * Fold a frozen batchnorm into the filter and bias of a convolution.
+ *
+ * The folded filter and bias are computed on the device as described in
+ * \ref sycldnn::conv2d::FoldBatchNormParams. Running the convolution with the
+ * folded filter and the folded bias in a \ref sycldnn::conv2d::Epilogue then
+ * gives the result of the convolution followed by the batchnorm, without a
+ * separate batchnorm kernel. The HWCF, FHWC and FCHW filter formats are
+ * supported.
+ *
+ * \param filter        A pointer to the memory representing the filter tensor.
+ * \param bias          A pointer to the memory holding one convolution bias
+ *                      value for each output feature. Only accessed if
+ *                      fold_params.has_bias is set.
+ * \param beta          A pointer to the memory holding the batchnorm beta.
+ * \param gamma         A pointer to the memory holding the batchnorm gamma.
+ * \param mean          A pointer to the memory holding the batchnorm mean.
+ * \param variance      A pointer to the memory holding the batchnorm
+ *                      variance.
+ * \param folded_filter A pointer to the memory to write the folded filter to,
+ *                      in the same format as the filter.
+ * \param folded_bias   A pointer to the memory to write the folded bias to.
+ * \param params        The convolution parameters.
+ * \param fold_params   The batchnorm folding parameters.
+ * \param backend       The backend implementation, used to map between
+ *                      pointer representations.
+ * \param events        Events which should be completed before the
+ *                      operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus fold_batchnorm(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    Conv2DParams const& params, FoldBatchNormParams const& fold_params,
+    Backend& backend, const std::vector<cl::sycl::event>& events = {}) {
+  return internal::sublaunch_fold_batchnorm<T>(
+      filter, bias, beta, gamma, mean, variance, folded_filter, folded_bias,
+      params, fold_params, backend, events);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_H_
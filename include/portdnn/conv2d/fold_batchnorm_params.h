@@ -0,0 +1,57 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_PARAMS_H_
+#define PORTDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_PARAMS_H_
+
+/**
+ * \file
+ * Contains the declaration of the
+ * \ref sycldnn::conv2d::FoldBatchNormParams structure, which describes a
+ * frozen batchnorm to fold into the preceding convolution.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Parameters for folding a frozen batchnorm into a convolution.
+ *
+ * For each output feature the folded filter and bias are
+ *
+ *   scale          = gamma[feature] / sqrt(variance[feature] + epsilon)
+ *   folded_filter  = filter * scale
+ *   folded_bias    = beta[feature] + (bias[feature] - mean[feature]) * scale
+ *
+ * so that a convolution with the folded filter and a bias epilogue computes
+ * the same result as the original convolution followed by the batchnorm.
+ */
+struct FoldBatchNormParams {
+  /**
+   * The epsilon parameter of the batchnorm, added to the variance to ensure
+   * divisibility by a non-zero value.
+   */
+  float epsilon = 0.001;
+
+  /**
+   * Whether the convolution has a bias. If false the bias pointer is never
+   * accessed, and the convolution bias is treated as zero.
+   */
+  bool has_bias = false;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_PARAMS_H_
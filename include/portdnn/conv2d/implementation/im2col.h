@@ -17,9 +17,11 @@
 #define PORTDNN_INCLUDE_CONV2D_IM2COL_H_
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 #include "portdnn/conv2d/sizes.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
 #include "portdnn/internal/conv2d/im2col.h"
 
 namespace sycldnn {
@@ -44,6 +46,40 @@ inline SNNStatus launch_im2col(
                                               params, workspace_size, backend,
                                               events);
 }
+
+/**
+ * Launch the 2D convolution using im2col, applying the given epilogue to the
+ * output of a forward convolution.
+ *
+ * The final stage of im2col is a matrix multiply provided by the backend.
+ * Backends built on the portDNN matmul kernels apply the epilogue to an NHWC
+ * output with a single group in the matmul kernel, otherwise the epilogue is
+ * applied by a separate kernel once the convolution is complete.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the last kernel
+ * launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_im2col(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (!epilogue.params.is_identity() &&
+      internal::can_fuse_matmul_epilogue<Backend, ConvType>(params)) {
+    return internal::launch_im2col_fused<T, ConvType>(
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
+  }
+  auto status = launch_im2col<T, ConvType>(input, filter, output, workspace,
+                                           params, workspace_size, backend,
+                                           events);
+  return internal::launch_epilogue_after<T>(status, output, epilogue, params,
+                                            backend);
+}
 }  // namespace conv2d
 }  // namespace sycldnn
 #endif  // PORTDNN_INCLUDE_CONV2D_IM2COL_H_
@@ -16,9 +16,16 @@
 #ifndef PORTDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 #define PORTDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 
+#include "portdnn/backend/backend_helpers.h"
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
+#include "portdnn/internal/conv2d/internal_pointer_set.h"
+
+#include <vector>
+
 namespace sycldnn {
 namespace conv2d {
 
@@ -42,6 +49,30 @@ struct MatmulLauncher<conv_type::Forward> {
         params.features, events);
     return {event, StatusCode::OK};
   }
+
+  /**
+   * Compute the convolution with the backend's matmul_epilogue(), which
+   * applies the epilogue in the matmul kernel. Only used if
+   * can_fuse_matmul_epilogue() holds for the backend and parameters.
+   */
+  template <typename T, typename Backend>
+  static SNNStatus launch(
+      typename Backend::template pointer_type<T const> input,
+      typename Backend::template pointer_type<T const> filter,
+      typename Backend::template pointer_type<T> output,
+      Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+      Backend& backend, const std::vector<cl::sycl::event>& events) {
+    if constexpr (backend::supports_matmul_epilogue<Backend>::value) {
+      auto conv_width = params.batch * params.in_rows * params.in_cols;
+      auto event = backend.template matmul_epilogue<false, false>(
+          input, filter, output, conv_width, params.channels,
+          params.features, epilogue.params, epilogue.bias, epilogue.residual,
+          events);
+      return {event, StatusCode::OK};
+    } else {
+      return StatusCode::InvalidAlgorithm;
+    }
+  }
 };
 
 template <>
@@ -78,26 +109,133 @@ struct MatmulLauncher<conv_type::FilterBackprop> {
   }
 };
 
+/**
+ * NCHW matmul launcher.
+ *
+ * For a 1x1 convolution each NCHW image is a (channels x pixels) matrix and
+ * the FCHW filter is a (features x channels) matrix, so the convolution is
+ * computed with one matmul per image, with the pixels as the contiguous
+ * dimension. Backends with a strided batched matmul compute every image in a
+ * single launch, with a batch stride of zero for the filter.
+ */
+template <typename ConvType>
+struct MatmulNCHWLauncher;
+
+template <>
+struct MatmulNCHWLauncher<conv_type::Forward> {
+  template <typename T, typename Backend>
+  static SNNStatus launch(
+      typename Backend::template pointer_type<T const> input,
+      typename Backend::template pointer_type<T const> filter,
+      typename Backend::template pointer_type<T> output,
+      Conv2DParams const& params, Backend& backend,
+      std::vector<cl::sycl::event> events) {
+    InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+    auto const n_pixels = params.in_rows * params.in_cols;
+    if constexpr (backend::supports_strided_batch_matmul<Backend>::value) {
+      auto event = backend.template strided_batch_matmul<false, false>(
+          pointers.filter.get(), pointers.input.get(), pointers.output.get(),
+          T{0}, params.batch, params.features, params.channels, n_pixels,
+          Conv2DParams::Index{0}, params.channels * n_pixels,
+          params.features * n_pixels, events);
+      return {event, StatusCode::OK};
+    }
+    cl::sycl::event event;
+    for (int image = 0; image < params.batch; ++image) {
+      event = backend.template matmul<false, false>(
+          pointers.filter.get(),
+          pointers.input.get() + image * params.channels * n_pixels,
+          pointers.output.get() + image * params.features * n_pixels, T{0},
+          params.features, params.channels, n_pixels, events);
+      events = {event};
+    }
+    return {event, StatusCode::OK};
+  }
+};
+
+template <>
+struct MatmulNCHWLauncher<conv_type::InputBackprop> {
+  template <typename T, typename Backend>
+  static SNNStatus launch(
+      typename Backend::template pointer_type<T const> input,
+      typename Backend::template pointer_type<T const> filter,
+      typename Backend::template pointer_type<T> output,
+      Conv2DParams const& params, Backend& backend,
+      std::vector<cl::sycl::event> events) {
+    InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+    auto const n_pixels = params.in_rows * params.in_cols;
+    if constexpr (backend::supports_strided_batch_matmul<Backend>::value) {
+      auto event = backend.template strided_batch_matmul<true, false>(
+          pointers.filter.get(), pointers.input.get(), pointers.output.get(),
+          T{0}, params.batch, params.channels, params.features, n_pixels,
+          Conv2DParams::Index{0}, params.features * n_pixels,
+          params.channels * n_pixels, events);
+      return {event, StatusCode::OK};
+    }
+    cl::sycl::event event;
+    for (int image = 0; image < params.batch; ++image) {
+      event = backend.template matmul<true, false>(
+          pointers.filter.get(),
+          pointers.input.get() + image * params.features * n_pixels,
+          pointers.output.get() + image * params.channels * n_pixels, T{0},
+          params.channels, params.features, n_pixels, events);
+      events = {event};
+    }
+    return {event, StatusCode::OK};
+  }
+};
+
+template <>
+struct MatmulNCHWLauncher<conv_type::FilterBackprop> {
+  template <typename T, typename Backend>
+  static SNNStatus launch(
+      typename Backend::template pointer_type<T const> input,
+      typename Backend::template pointer_type<T const> filter,
+      typename Backend::template pointer_type<T> output,
+      Conv2DParams const& params, Backend& backend,
+      std::vector<cl::sycl::event> events) {
+    InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+    auto const n_pixels = params.in_rows * params.in_cols;
+    cl::sycl::event event;
+    // The filter gradient is accumulated across the images in the batch, so
+    // every image adds to the same output and the matmuls cannot be batched.
+    for (int image = 0; image < params.batch; ++image) {
+      T const beta = image == 0 ? T{0} : T{1};
+      event = backend.template matmul<false, true>(
+          pointers.filter.get() + image * params.features * n_pixels,
+          pointers.input.get() + image * params.channels * n_pixels,
+          pointers.output.get(), beta, params.features, n_pixels,
+          params.channels, events);
+      events = {event};
+    }
+    return {event, StatusCode::OK};
+  }
+};
+
 }  // namespace internal
 /**
- * Launch a matmul to compute a 1x1 2D convolution.
+ * Launch a matmul to compute a 1x1 2D convolution, applying the given epilogue
+ * to the output of a forward convolution.
  *
- * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * The matrix multiply is provided by the backend. Backends built on the
+ * portDNN matmul kernels apply the epilogue to an NHWC output in the matmul
+ * kernel, otherwise the epilogue is applied by a separate kernel once the
+ * convolution is complete.
  *
- * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ * Returns an SNNStatus containing the SYCL event tied to the last kernel
+ * launch.
  */
 template <typename T, typename ConvType, typename Backend>
 inline SNNStatus launch_matmul(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
   SNN_VALIDATE_PARAM(params.window_rows == 1,
-                     "Matmul can only be used for 1x1 NHWC convolutions.");
+                     "Matmul can only be used for 1x1 convolutions.");
   SNN_VALIDATE_PARAM(params.window_cols == 1,
-                     "Matmul can only be used for 1x1 NHWC convolutions.");
+                     "Matmul can only be used for 1x1 convolutions.");
   SNN_VALIDATE_PARAM(params.stride_rows == 1,
                      "Matmul can only be used with stride 1.");
   SNN_VALIDATE_PARAM(params.stride_cols == 1,
@@ -107,8 +245,41 @@ inline SNNStatus launch_matmul(
   SNN_VALIDATE_PARAM(params.pad_cols == 0,
                      "Matmul can only be used with zero padding.");
 
-  return internal::MatmulLauncher<ConvType>::template launch<T>(
-      input, filter, output, params, backend, events);
+  SNNStatus status;
+  if (params.input_format == DataFormat::NCHW) {
+    SNN_VALIDATE_PARAM(params.filter_format == FilterFormat::FCHW,
+                       "Matmul requires an FCHW filter for NCHW inputs.");
+    status = internal::MatmulNCHWLauncher<ConvType>::template launch<T>(
+        input, filter, output, params, backend, events);
+  } else if (!epilogue.params.is_identity() &&
+             internal::can_fuse_matmul_epilogue<Backend, ConvType>(params)) {
+    return internal::MatmulLauncher<conv_type::Forward>::template launch<T>(
+        input, filter, output, params, epilogue, backend, events);
+  } else {
+    status = internal::MatmulLauncher<ConvType>::template launch<T>(
+        input, filter, output, params, backend, events);
+  }
+  return internal::launch_epilogue_after<T>(status, output, epilogue, params,
+                                            backend);
+}
+
+/**
+ * Launch a matmul to compute a 1x1 2D convolution.
+ *
+ * Will extract the SYCL buffers and SYCL queue from the backend and forward
+ * these on to the precompiled kernels.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_matmul(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return launch_matmul<T, ConvType>(input, filter, output, params,
+                                    Epilogue<T, Backend>{}, backend, events);
 }
 
 }  // namespace conv2d
@@ -17,37 +17,63 @@
 #define PORTDNN_INCLUDE_CONV2D_TILED_H_
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 #include "portdnn/conv2d/sizes.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
 #include "portdnn/internal/conv2d/tiled.h"
 
 namespace sycldnn {
 namespace conv2d {
 /**
- * Launch the direct implementation of a 2D convolution.
+ * Launch the tiled implementation of a 2D convolution, applying the given
+ * epilogue to the output of a forward convolution.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The convolution is accumulated as
+ * ComputeT.
  *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
-template <typename T, typename ConvType, typename Backend>
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend>
 inline SNNStatus launch_tiled(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
   auto conv_sizes = get_sizes<ConvType>(params);
 
   auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
   auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
   auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto epilogue_access = internal::get_epilogue_mem(epilogue, params, backend);
 
   cl::sycl::queue queue = backend.get_queue();
-  return internal::launch_tiled<T, ConvType>(inp_access, fil_access, out_access,
-                                             params, queue, events);
+  return internal::launch_tiled<T, ConvType, ComputeT>(
+      inp_access, fil_access, out_access, epilogue_access, params, queue,
+      events);
+}
+
+/**
+ * Launch the direct implementation of a 2D convolution.
+ *
+ * Will extract the SYCL buffers and SYCL queue from the backend and forward
+ * these on to the precompiled kernels.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_tiled(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return launch_tiled<T, ConvType>(input, filter, output, params,
+                                   Epilogue<T, Backend>{}, backend, events);
 }
 }  // namespace conv2d
 }  // namespace sycldnn
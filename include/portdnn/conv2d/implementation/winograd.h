@@ -16,10 +16,16 @@
 #ifndef PORTDNN_INCLUDE_CONV2D_IMPLEMENTATION_WINOGRAD_H_
 #define PORTDNN_INCLUDE_CONV2D_IMPLEMENTATION_WINOGRAD_H_
 
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 
+#include "portdnn/status.h"
+
 #include "portdnn/internal/conv2d/winograd/launch.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 
@@ -27,16 +33,43 @@ namespace conv2d {
  * Launch the 2D convolution using the Winograd implementation.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The matrix multiplies are accumulated
+ * as ComputeT, which requires a backend providing batch_matmul_mixed() if
+ * ComputeT differs from T.
  *
- * \param input   Pointer to the input buffer
- * \param filter  Pointer to the filter buffer
- * \param output  Pointer to the output buffer
- * \param params  Convolution parameters
- * \param backend Backend to use to allocate temporary buffers and compute
- *                matrix multiplies
+ * \param input    Pointer to the input buffer
+ * \param filter   Pointer to the filter buffer
+ * \param output   Pointer to the output buffer
+ * \param params   Convolution parameters
+ * \param epilogue Epilogue to apply to the output of a forward convolution
+ * \param backend  Backend to use to allocate temporary buffers and compute
+ *                 matrix multiplies
  * \return An SNNStatus containing the SYCL event tied to the kernel launch.
  */
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend>
+inline SNNStatus launch_winograd(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  // Only the forward transforms have NCHW implementations.
+  if (params.input_format == DataFormat::NCHW &&
+      !std::is_same<ConvType, conv_type::Forward>::value) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return internal::winograd::launch<T, ConvType, ComputeT>(
+      input, filter, output, workspace, params, workspace_size, epilogue,
+      backend, events);
+}
+
+/** \copydoc launch_winograd */
 template <typename T, typename ConvType, typename Backend>
 inline SNNStatus launch_winograd(
     typename Backend::template pointer_type<T const> input,
@@ -45,15 +78,39 @@ inline SNNStatus launch_winograd(
     typename Backend::template pointer_type<T> workspace,
     Conv2DParams const& params, size_t workspace_size, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
-  return internal::winograd::launch<T, ConvType>(
-      input, filter, output, workspace, params, workspace_size, backend,
-      events);
+  return launch_winograd<T, ConvType>(input, filter, output, workspace, params,
+                                      workspace_size, Epilogue<T, Backend>{},
+                                      backend, events);
 }
 /**
  * Special launcher to use larger tile sizes for Winograd.
  *
  * \copydoc launch_winograd
  */
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend>
+inline SNNStatus launch_winograd_large(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  // Only the forward transforms have NCHW implementations.
+  if (params.input_format == DataFormat::NCHW &&
+      !std::is_same<ConvType, conv_type::Forward>::value) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return internal::winograd::launch_large<T, ConvType, ComputeT>(
+      input, filter, output, workspace, params, workspace_size, epilogue,
+      backend, events);
+}
+
+/** \copydoc launch_winograd_large */
 template <typename T, typename ConvType, typename Backend>
 inline SNNStatus launch_winograd_large(
     typename Backend::template pointer_type<T const> input,
@@ -62,9 +119,50 @@ inline SNNStatus launch_winograd_large(
     typename Backend::template pointer_type<T> workspace,
     Conv2DParams const& params, size_t workspace_size, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
-  return internal::winograd::launch_large<T, ConvType>(
-      input, filter, output, workspace, params, workspace_size, backend,
-      events);
+  return launch_winograd_large<T, ConvType>(
+      input, filter, output, workspace, params, workspace_size,
+      Epilogue<T, Backend>{}, backend, events);
+}
+
+/**
+ * Launch the forward 2D convolution using the fused Winograd implementation,
+ * which computes the convolution in a single kernel. Only 3x3 forward NHWC
+ * convolutions with unit stride and dilation are supported.
+ *
+ * \copydoc launch_winograd
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_winograd_fused(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (!std::is_same<ConvType, conv_type::Forward>::value ||
+      params.stride_rows != 1 || params.stride_cols != 1 ||
+      params.dilation_rows != 1 || params.dilation_cols != 1 ||
+      params.input_format != DataFormat::NHWC) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return internal::winograd::launch_fused<T>(input, filter, output, workspace,
+                                             params, workspace_size, epilogue,
+                                             backend, events);
+}
+
+/** \copydoc launch_winograd_fused */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_winograd_fused(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return launch_winograd_fused<T, ConvType>(
+      input, filter, output, workspace, params, workspace_size,
+      Epilogue<T, Backend>{}, backend, events);
 }
 
 }  // namespace conv2d
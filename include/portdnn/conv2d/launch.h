@@ -23,9 +23,12 @@
  */
 
 #include "portdnn/backend/backend_helpers.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 #include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/transformed_filter.h"
 #include "portdnn/internal/conv2d/launch.h"
+#include "portdnn/internal/conv2d/transformed_filter.h"
 #include "portdnn/status.h"
 
 namespace sycldnn {
@@ -51,7 +54,14 @@ namespace conv2d {
  * \param workspace Optional pointer to a workspace buffer for use whenever
  *                  temporary memory is required.
  * \param workspace_size The number of elements available in the workspace
- *                       buffer.
+ *                       buffer. If this is non-zero but smaller than the
+ *                       algorithm chosen by the selector requires, that
+ *                       choice is replaced without warning by the algorithm
+ *                       select_for_workspace_budget() picks for a buffer of
+ *                       this size, and StatusCode::InvalidAlgorithm is
+ *                       returned if no algorithm fits. A size of zero
+ *                       always uses the selector's choice, allocating any
+ *                       temporary memory through the backend.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  * launches and a StatusCode enum showing if the launch was OK or whether it
  * encountered some problem.
@@ -92,7 +102,14 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
  * \param workspace Optional pointer to a workspace buffer for use whenever
  *                  temporary memory is required.
  * \param workspace_size The number of elements available in the workspace
- *                       buffer.
+ *                       buffer. If this is non-zero but smaller than the
+ *                       algorithm chosen by the selector requires, that
+ *                       choice is replaced without warning by the algorithm
+ *                       select_for_workspace_budget() picks for a buffer of
+ *                       this size, and StatusCode::InvalidAlgorithm is
+ *                       returned if no algorithm fits. A size of zero
+ *                       always uses the selector's choice, allocating any
+ *                       temporary memory through the backend.
  * \param events Optional vector of
  *               events which the convolution will wait on before launching the
  *               kernels, required for USM
@@ -117,6 +134,425 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                                          workspace_size, events);
 }
 
+/**
+ * Launch a 2D convolution which stores its tensors as T, but accumulates the
+ * convolution as ComputeT.
+ *
+ * This allows half precision tensors to be convolved with single precision
+ * accumulators, which avoids the rounding errors of accumulating long
+ * reductions in half precision while keeping the memory traffic of half
+ * precision tensors. The implementation is chosen by the Selector. Mixed
+ * precision is supported by the forward direct, tiled and Winograd
+ * convolutions, where Winograd also needs the portDNN matmul backends. Other
+ * algorithms and passes return StatusCode::InvalidAlgorithm when ComputeT
+ * differs from T.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer. If this is non-zero but smaller than the
+ *                       algorithm chosen by the selector requires, that
+ *                       choice is replaced without warning by the algorithm
+ *                       select_for_workspace_budget() picks for a buffer of
+ *                       this size, and StatusCode::InvalidAlgorithm is
+ *                       returned if no algorithm fits. A size of zero
+ *                       always uses the selector's choice, allocating any
+ *                       temporary memory through the backend.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename ComputeT, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend> &&
+              !std::is_same<ComputeT, Backend>::value>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Selector& selector,
+                 Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size) {
+  return sublaunch_mixed<T, ConvType, ComputeT, Backend>(
+      input, filter, output, params, selector, backend, workspace,
+      workspace_size, {});
+}
+
+/**
+ * Launch a 2D convolution which stores its tensors as T, but accumulates the
+ * convolution as ComputeT.
+ *
+ * The implementation is chosen by the Selector. Mixed precision is supported
+ * by the forward direct, tiled and Winograd convolutions, where Winograd also
+ * needs the portDNN matmul backends. Other algorithms and passes return
+ * StatusCode::InvalidAlgorithm when ComputeT differs from T.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer. If this is non-zero but smaller than the
+ *                       algorithm chosen by the selector requires, that
+ *                       choice is replaced without warning by the algorithm
+ *                       select_for_workspace_budget() picks for a buffer of
+ *                       this size, and StatusCode::InvalidAlgorithm is
+ *                       returned if no algorithm fits. A size of zero
+ *                       always uses the selector's choice, allocating any
+ *                       temporary memory through the backend.
+ * \param events Optional vector of events which the convolution will wait on
+ *               before launching the kernels, required for USM
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename ComputeT, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend> &&
+              !std::is_same<ComputeT, Backend>::value>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Selector& selector,
+                 Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size,
+                 const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch_mixed<T, ConvType, ComputeT, Backend>(
+      input, filter, output, params, selector, backend, workspace,
+      workspace_size, events);
+}
+
+/**
+ * Launch a forward 2D convolution followed by a fused epilogue, with the
+ * implementation chosen by the Selector.
+ *
+ * The epilogue is applied to each output value before it is written to memory
+ * where the selected algorithm allows it, otherwise it is applied in a single
+ * additional pass over the output.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer. If this is non-zero but smaller than the
+ *                       algorithm chosen by the selector requires, that
+ *                       choice is replaced without warning by the algorithm
+ *                       select_for_workspace_budget() picks for a buffer of
+ *                       this size, and StatusCode::InvalidAlgorithm is
+ *                       returned if no algorithm fits. A size of zero
+ *                       always uses the selector's choice, allocating any
+ *                       temporary memory through the backend.
+ * \param epilogue The operations to apply to the convolution output, and the
+ *                 bias and residual tensors they read.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Selector& selector,
+                 Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size, Epilogue<T, Backend> const& epilogue) {
+  return sublaunch<T, ConvType, Backend>(input, filter, output, params,
+                                         selector, backend, workspace,
+                                         workspace_size, epilogue, {});
+}
+
+/**
+ * Launch a forward 2D convolution followed by a fused epilogue, with the
+ * implementation chosen by the Selector.
+ *
+ * The epilogue is applied to each output value before it is written to memory
+ * where the selected algorithm allows it, otherwise it is applied in a single
+ * additional pass over the output.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer. If this is non-zero but smaller than the
+ *                       algorithm chosen by the selector requires, that
+ *                       choice is replaced without warning by the algorithm
+ *                       select_for_workspace_budget() picks for a buffer of
+ *                       this size, and StatusCode::InvalidAlgorithm is
+ *                       returned if no algorithm fits. A size of zero
+ *                       always uses the selector's choice, allocating any
+ *                       temporary memory through the backend.
+ * \param epilogue The operations to apply to the convolution output, and the
+ *                 bias and residual tensors they read.
+ * \param events Optional vector of events which the convolution will wait on
+ *               before launching the kernels, required for USM
+ * \return Returns an SNNStatus containing the SYCL
+ * event tied to the kernel launches and a StatusCode enum showing if the launch
+ * was OK or whether it encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Selector& selector,
+                 Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size, Epilogue<T, Backend> const& epilogue,
+                 const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch<T, ConvType, Backend>(input, filter, output, params,
+                                         selector, backend, workspace,
+                                         workspace_size, epilogue, events);
+}
+
+/**
+ * Transform a forward convolution filter ahead of time, so that it can be
+ * reused across many convolutions without recomputing the transform.
+ *
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param transformed The handle to write the transformed filter into. Its
+ *                    algorithm and params describe the transform to compute,
+ *                    and its data must hold at least
+ *                    query_transformed_filter_size() elements.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    TransformedFilter<T, Backend> const& transformed, Backend& backend) {
+  return sub_transform_filter<T, Backend>(filter, transformed, backend, {});
+}
+
+/**
+ * Transform a forward convolution filter ahead of time, so that it can be
+ * reused across many convolutions without recomputing the transform.
+ *
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param transformed The handle to write the transformed filter into. Its
+ *                    algorithm and params describe the transform to compute,
+ *                    and its data must hold at least
+ *                    query_transformed_filter_size() elements.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param events Optional vector of events which the transform will wait on
+ *               before launching the kernels, required for USM
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    TransformedFilter<T, Backend> const& transformed, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  return sub_transform_filter<T, Backend>(filter, transformed, backend, events);
+}
+
+/**
+ * Launch a forward 2D convolution using a filter which has been transformed
+ * ahead of time with sycldnn::conv2d::transform_filter().
+ *
+ * The algorithm is the one the filter was transformed for, and no filter
+ * transform is computed, so the workspace only needs to hold
+ * query_workspace_size(filter, params) elements.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The handle to the transformed filter.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 TransformedFilter<T, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size) {
+  return sublaunch_transformed<T, ConvType, Backend>(
+      input, filter, output, params, backend, workspace, workspace_size,
+      Epilogue<T, Backend>{}, {});
+}
+
+/**
+ * Launch a forward 2D convolution using a filter which has been transformed
+ * ahead of time with sycldnn::conv2d::transform_filter().
+ *
+ * The algorithm is the one the filter was transformed for, and no filter
+ * transform is computed, so the workspace only needs to hold
+ * query_workspace_size(filter, params) elements.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The handle to the transformed filter.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param events Optional vector of events which the convolution will wait on
+ *               before launching the kernels, required for USM
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 TransformedFilter<T, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size,
+                 const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch_transformed<T, ConvType, Backend>(
+      input, filter, output, params, backend, workspace, workspace_size,
+      Epilogue<T, Backend>{}, events);
+}
+
+/**
+ * Launch a forward 2D convolution followed by a fused epilogue, using a filter
+ * which has been transformed ahead of time with
+ * sycldnn::conv2d::transform_filter().
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The handle to the transformed filter.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param epilogue The operations to apply to the convolution output, and the
+ *                 bias and residual tensors they read.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 TransformedFilter<T, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size, Epilogue<T, Backend> const& epilogue) {
+  return sublaunch_transformed<T, ConvType, Backend>(
+      input, filter, output, params, backend, workspace, workspace_size,
+      epilogue, {});
+}
+
+/**
+ * Launch a forward 2D convolution followed by a fused epilogue, using a filter
+ * which has been transformed ahead of time with
+ * sycldnn::conv2d::transform_filter().
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The handle to the transformed filter.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param epilogue The operations to apply to the convolution output, and the
+ *                 bias and residual tensors they read.
+ * \param events Optional vector of events which the convolution will wait on
+ *               before launching the kernels, required for USM
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 TransformedFilter<T, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size, Epilogue<T, Backend> const& epilogue,
+                 const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch_transformed<T, ConvType, Backend>(
+      input, filter, output, params, backend, workspace, workspace_size,
+      epilogue, events);
+}
+
 }  // namespace conv2d
 }  // namespace sycldnn
 #endif  // PORTDNN_INCLUDE_CONV2D_LAUNCH_H_
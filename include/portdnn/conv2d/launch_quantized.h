@@ -0,0 +1,153 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_LAUNCH_QUANTIZED_H_
+#define PORTDNN_INCLUDE_CONV2D_LAUNCH_QUANTIZED_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::launch_quantized() function, which
+ * asynchronously dispatches the SYCL kernels required to perform an 8-bit
+ * quantized 2D convolution with 32-bit accumulation.
+ */
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/quantization_params.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/conv2d/selector/selector.h"
+
+#include "portdnn/internal/conv2d/launch_quantized.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Launch an 8-bit quantized forward convolution.
+ *
+ * The input and filter are multiplied in 32-bit integer accumulators, which
+ * are then requantized to the output type using the per feature filter scales
+ * and zero points as described in \ref sycldnn::conv2d::QuantizationParams.
+ * Only the NHWC input and HWCF filter formats are supported.
+ *
+ * The selector chooses the algorithm. The direct, tiled, im2col and matmul
+ * algorithms are supported, where im2col needs a workspace of the size given
+ * by \ref sycldnn::conv2d::query_quantized_workspace_size and matmul only
+ * supports 1x1 convolutions with unit stride and no padding. Other
+ * algorithms return StatusCode::InvalidAlgorithm.
+ *
+ * \param input              A pointer to the memory representing the input
+ *                           tensor.
+ * \param filter             A pointer to the memory representing the filter
+ *                           tensor.
+ * \param filter_scales      A pointer to the memory holding one filter scale
+ *                           for each output feature.
+ * \param filter_zero_points A pointer to the memory holding one filter zero
+ *                           point for each output feature.
+ * \param output             A pointer to the memory representing the output
+ *                           tensor.
+ * \param params             The convolution parameters.
+ * \param quant_params       The quantization parameters.
+ * \param selector           The selector used to choose the algorithm.
+ * \param backend            The backend implementation, used to map between
+ *                           pointer representations.
+ * \param workspace          A pointer to a workspace buffer, only used by
+ *                           im2col.
+ * \param workspace_size     The number of elements in the workspace buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch_quantized(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<float const> filter_scales,
+    typename Backend::template pointer_type<int32_t const> filter_zero_points,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size) {
+  return internal::sublaunch_quantized<T>(
+      input, filter, filter_scales, filter_zero_points, output, params,
+      quant_params, selector, backend, workspace, workspace_size, {});
+}
+
+/**
+ * Launch an 8-bit quantized forward convolution.
+ *
+ * The input and filter are multiplied in 32-bit integer accumulators, which
+ * are then requantized to the output type using the per feature filter scales
+ * and zero points as described in \ref sycldnn::conv2d::QuantizationParams.
+ * Only the NHWC input and HWCF filter formats are supported.
+ *
+ * The selector chooses the algorithm. The direct, tiled, im2col and matmul
+ * algorithms are supported, where im2col needs a workspace of the size given
+ * by \ref sycldnn::conv2d::query_quantized_workspace_size and matmul only
+ * supports 1x1 convolutions with unit stride and no padding. Other
+ * algorithms return StatusCode::InvalidAlgorithm.
+ *
+ * \param input              A pointer to the memory representing the input
+ *                           tensor.
+ * \param filter             A pointer to the memory representing the filter
+ *                           tensor.
+ * \param filter_scales      A pointer to the memory holding one filter scale
+ *                           for each output feature.
+ * \param filter_zero_points A pointer to the memory holding one filter zero
+ *                           point for each output feature.
+ * \param output             A pointer to the memory representing the output
+ *                           tensor.
+ * \param params             The convolution parameters.
+ * \param quant_params       The quantization parameters.
+ * \param selector           The selector used to choose the algorithm.
+ * \param backend            The backend implementation, used to map between
+ *                           pointer representations.
+ * \param workspace          A pointer to a workspace buffer, only used by
+ *                           im2col.
+ * \param workspace_size     The number of elements in the workspace buffer.
+ * \param events             Events which should be completed before the
+ *                           operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_quantized(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<float const> filter_scales,
+    typename Backend::template pointer_type<int32_t const> filter_zero_points,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events = {}) {
+  return internal::sublaunch_quantized<T>(
+      input, filter, filter_scales, filter_zero_points, output, params,
+      quant_params, selector, backend, workspace, workspace_size, events);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_CONV2D_LAUNCH_QUANTIZED_H_
@@ -0,0 +1,122 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_LAUNCH_TRANSPOSED_H_
+#define PORTDNN_INCLUDE_CONV2D_LAUNCH_TRANSPOSED_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::launch_transposed() function, which
+ * launches a 2D transposed convolution using the input backprop kernels of
+ * the equivalent forward convolution.
+ */
+
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/transposed_params.h"
+#include "portdnn/internal/conv2d/launch_transposed.h"
+#include "portdnn/status.h"
+
+namespace sycldnn {
+namespace conv2d {
+/**
+ * Launch a 2D transposed convolution, with the implementation chosen by the
+ * Selector's select_transposed() hook.
+ *
+ * The transposed convolution is computed directly by the input backprop
+ * kernels, so no zeros are inserted into the input and no work is spent on
+ * them.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients, in the layout of the equivalent forward
+ *               convolution.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The transposed convolution parameters.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch_transposed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    TransposedConv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size) {
+  return sublaunch_transposed<T, Backend>(input, filter, output, params,
+                                          selector, backend, workspace,
+                                          workspace_size, {});
+}
+
+/**
+ * Launch a 2D transposed convolution, with the implementation chosen by the
+ * Selector's select_transposed() hook.
+ *
+ * The transposed convolution is computed directly by the input backprop
+ * kernels, so no zeros are inserted into the input and no work is spent on
+ * them.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients, in the layout of the equivalent forward
+ *               convolution.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The transposed convolution parameters.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param events Optional vector of events which the convolution will wait on
+ *               before launching the kernels, required for USM
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_transposed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    TransposedConv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch_transposed<T, Backend>(input, filter, output, params,
+                                          selector, backend, workspace,
+                                          workspace_size, events);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_INCLUDE_CONV2D_LAUNCH_TRANSPOSED_H_
@@ -0,0 +1,71 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_QUANTIZATION_PARAMS_H_
+#define PORTDNN_INCLUDE_CONV2D_QUANTIZATION_PARAMS_H_
+
+#include "portdnn/conv2d/epilogue.h"
+
+#include <cstdint>
+
+/**
+ * \file
+ * Contains the declaration of the
+ * \ref sycldnn::conv2d::QuantizationParams structure, which describes how the
+ * integer tensors of a quantized convolution map to real values.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Quantization parameters for an 8-bit convolution.
+ *
+ * A quantized value q represents the real value scale * (q - zero_point). The
+ * filter is quantized per output feature, so its scales and zero points are
+ * passed to the launch as separate tensors holding one value per feature.
+ *
+ * The convolution accumulates (input - input_zero_point) * (filter -
+ * filter_zero_point[feature]) in 32-bit integers, and then requantizes each
+ * output as
+ *
+ *   out = round(acc * input_scale * filter_scale[feature] / output_scale)
+ *         + output_zero_point
+ *
+ * saturated to the range of the output type.
+ */
+struct QuantizationParams {
+  /** The zero point of the input tensor. */
+  int32_t input_zero_point = 0;
+
+  /** The zero point of the output tensor. */
+  int32_t output_zero_point = 0;
+
+  /** The scale of the input tensor. */
+  float input_scale = 1.f;
+
+  /** The scale of the output tensor. */
+  float output_scale = 1.f;
+
+  /**
+   * The activation applied to the real output value before it is quantized.
+   * Only None, Relu and Relu6 are supported.
+   */
+  Activation activation = Activation::None;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_CONV2D_QUANTIZATION_PARAMS_H_
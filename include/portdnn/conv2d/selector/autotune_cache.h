@@ -0,0 +1,153 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_CACHE_H_
+#define PORTDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_CACHE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::AutotuneCache class,
+ * which stores the algorithm choices made by the
+ * \ref sycldnn::conv2d::AutotuneSelector and persists them to disk.
+ */
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Get a short string naming the convolution type, used as part of the key in
+ * the autotuning cache.
+ * \return Returns a character string naming the convolution type.
+ */
+template <typename ConvType>
+inline char const* conv_type_name();
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::Forward>() {
+  return "Forward";
+}
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::InputBackprop>() {
+  return "InputBackprop";
+}
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::FilterBackprop>() {
+  return "FilterBackprop";
+}
+
+/**
+ * Thread-safe map from a convolution description to the algorithm that was
+ * measured to be fastest for it.
+ *
+ * The cache can be written to and read from a text file, so that the results
+ * of tuning can be reused by later processes. The file starts with a header
+ * line containing \ref AutotuneCache::version, and files written with a
+ * different version are ignored on load.
+ */
+class SNN_EXPORT AutotuneCache {
+ public:
+  /**
+   * The version of the on-disk cache format. This should be incremented
+   * whenever the key format or the set of algorithms changes, so that stale
+   * tuning results are discarded rather than misinterpreted.
+   */
+  static constexpr int version = 4;
+
+  /**
+   * Build the key used to identify a convolution in the cache.
+   * \param device_id A string identifying the device, as returned by
+   *                  \ref AutotuneCache::get_device_id.
+   * \param conv_type The name of the convolution type.
+   * \param data_type A string identifying the data type of the tensors.
+   * \param params    The convolution parameters.
+   * \return Returns a string which uniquely identifies the convolution.
+   */
+  static std::string make_key(std::string const& device_id,
+                              char const* conv_type, char const* data_type,
+                              Conv2DParams const& params);
+
+  /**
+   * Get a string which identifies a SYCL device, including the driver
+   * version, so that tuning results are not shared between different devices.
+   * \param device The SYCL device.
+   * \return Returns a string identifying the device.
+   */
+  static std::string get_device_id(cl::sycl::device const& device);
+
+  /**
+   * Look up the algorithm stored for a given key.
+   * \param key The key built by \ref AutotuneCache::make_key.
+   * \return Returns the stored algorithm, or Algorithm::NotSupported if there
+   *         is no entry for the key.
+   */
+  Algorithm lookup(std::string const& key) const;
+
+  /**
+   * Store the algorithm to use for a given key, replacing any existing entry.
+   * \param key  The key built by \ref AutotuneCache::make_key.
+   * \param algo The algorithm to store.
+   */
+  void insert(std::string const& key, Algorithm algo);
+
+  /**
+   * Load entries from a cache file, adding them to the existing entries.
+   * \param path The path of the cache file.
+   * \return Returns true if the file was read successfully, or false if it
+   *         could not be opened or was written with a different version.
+   */
+  bool load(std::string const& path);
+
+  /**
+   * Write all entries to a cache file, replacing its contents.
+   *
+   * The entries are written to a temporary file which is then renamed over
+   * the cache file, so a concurrent reader sees either the old or the new
+   * file. Concurrent writers do not merge their entries, the last rename
+   * wins.
+   * \param path The path of the cache file.
+   * \return Returns true if the file was written successfully.
+   */
+  bool save(std::string const& path) const;
+
+  /**
+   * Get the number of entries in the cache.
+   * \return Returns the number of entries in the cache.
+   */
+  size_t size() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Algorithm> entries_;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_CACHE_H_
@@ -0,0 +1,336 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
+#define PORTDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
+
+/**
+ * \file
+ * Contains the definition of the \ref sycldnn::conv2d::AutotuneSelector class.
+ * This concrete implementation of \ref sycldnn::conv2d::Selector times every
+ * convolution algorithm the first time it sees a set of parameters and selects
+ * the fastest one, caching the result so later processes can reuse it.
+ */
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/selector/autotune_cache.h"
+#include "portdnn/conv2d/selector/default_selector.h"
+#include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/internal/conv2d/launch.h"
+#include "portdnn/internal/helpers/allocated_pointer.h"
+
+#include "portdnn/helpers/macros.h"
+#include "portdnn/status.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Get a short string naming the data type, used as part of the key in the
+ * autotuning cache.
+ */
+template <typename T>
+struct AutotuneTypeName;
+
+/** Specialisation of AutotuneTypeName for float. */
+template <>
+struct AutotuneTypeName<float> {
+  /** The name of the data type. */
+  static constexpr char const* value = "float";
+};
+
+/** Specialisation of AutotuneTypeName for double. */
+template <>
+struct AutotuneTypeName<double> {
+  /** The name of the data type. */
+  static constexpr char const* value = "double";
+};
+
+/** Specialisation of AutotuneTypeName for half. */
+template <>
+struct AutotuneTypeName<cl::sycl::half> {
+  /** The name of the data type. */
+  static constexpr char const* value = "half";
+};
+
+/** Kernel name for zeroing the autotuner's temporary tensors. */
+template <typename T>
+class AutotuneZeroFill;
+
+/**
+ * A selector which always returns the algorithm it was constructed with. Used
+ * by the autotuner to force a specific algorithm through the normal launch
+ * path.
+ */
+class FixedSelector final : public Selector {
+ public:
+  /**
+   * Construct a selector which always returns the given algorithm.
+   * \param algo The algorithm to return.
+   */
+  explicit FixedSelector(Algorithm algo) : algo_{algo} {}
+
+  /** \copydoc Selector::select_forward */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::select_input_backprop */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::select_filter_backprop */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return "FixedSelector"; }
+
+ private:
+  Algorithm algo_;
+};
+
+}  // namespace internal
+
+/**
+ * A selector which measures the run time of every available convolution
+ * algorithm on the backend's device and selects the fastest.
+ *
+ * Tuning is performed the first time a given combination of device,
+ * convolution type, data type and convolution parameters is seen, using
+ * zero-filled temporary tensors allocated through the backend. The result is
+ * stored in an \ref sycldnn::conv2d::AutotuneCache, which is loaded from and
+ * written back to the given cache file so that the cost of tuning is only paid
+ * once.
+ *
+ * Tuning blocks the calling thread while the candidate algorithms are run. If
+ * no algorithm can be launched successfully the choice of the device's default
+ * selector is used instead.
+ */
+template <typename T, typename Backend>
+class AutotuneSelector final : public Selector {
+ public:
+  /**
+   * Construct an autotuning selector.
+   * \param backend    The backend used to allocate temporary tensors and to
+   *                   launch the candidate convolutions.
+   * \param cache_path The path of the cache file. If empty then the tuning
+   *                   results are only kept in memory.
+   * \param n_reps     The number of timed runs of each algorithm, after an
+   *                   initial untimed warm-up run.
+   */
+  explicit AutotuneSelector(Backend& backend, std::string cache_path = "",
+                            int n_reps = 3)
+      : backend_{backend},
+        cache_path_{std::move(cache_path)},
+        n_reps_{std::max(n_reps, 1)},
+        device_id_{AutotuneCache::get_device_id(
+            backend.get_queue().get_device())},
+        fallback_{get_default_selector(backend.get_queue().get_device())},
+        cache_{} {
+    if (!cache_path_.empty()) {
+      cache_.load(cache_path_);
+    }
+  }
+
+  /** \copydoc Selector::select_forward */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    return select_with_tuning<conv_type::Forward>(params);
+  }
+
+  /** \copydoc Selector::select_input_backprop */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_with_tuning<conv_type::InputBackprop>(params);
+  }
+
+  /** \copydoc Selector::select_filter_backprop */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    return select_with_tuning<conv_type::FilterBackprop>(params);
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return "AutotuneSelector"; }
+
+  /**
+   * Get the cache of tuning results.
+   * \return Returns a reference to the cache used by this selector.
+   */
+  AutotuneCache& cache() { return cache_; }
+
+  /**
+   * Get the number of convolutions tuned by this selector. Selections found
+   * in the cache are not counted.
+   * \return Returns the number of times the algorithms have been timed.
+   */
+  size_t n_tuned() const { return n_tuned_; }
+
+ private:
+  /**
+   * Temporary memory allocated through the backend. The backend allocators
+   * take a size in bytes.
+   */
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  /**
+   * Look up the algorithm for the given parameters in the cache, tuning and
+   * updating the cache file if there is no entry.
+   */
+  template <typename ConvType>
+  Algorithm select_with_tuning(Conv2DParams const& params) {
+    auto key = AutotuneCache::make_key(device_id_, conv_type_name<ConvType>(),
+                                       internal::AutotuneTypeName<T>::value,
+                                       params);
+    auto cached = cache_.lookup(key);
+    if (cached != Algorithm::NotSupported) {
+      return cached;
+    }
+    auto selected = tune<ConvType>(params);
+    ++n_tuned_;
+    if (selected == Algorithm::NotSupported) {
+      return fallback_->select<ConvType>(params);
+    }
+    cache_.insert(key, selected);
+    if (!cache_path_.empty()) {
+      cache_.save(cache_path_);
+    }
+    return selected;
+  }
+
+  /**
+   * Time every algorithm for the given parameters, returning the fastest or
+   * Algorithm::NotSupported if none could be launched.
+   */
+  template <typename ConvType>
+  Algorithm tune(Conv2DParams const& params) {
+    static constexpr Algorithm candidates[] = {
+        Algorithm::Direct,        Algorithm::Tiled,
+        Algorithm::Im2col,        Algorithm::Winograd,
+        Algorithm::WinogradLarge, Algorithm::Matmul,
+        Algorithm::WinogradFused, Algorithm::ImplicitGemm,
+        Algorithm::LocalTiled};
+
+    auto sizes = get_sizes<ConvType>(params);
+    AllocatedPointer input{sizeof(T) * sizes.input_size, backend_};
+    AllocatedPointer filter{sizeof(T) * sizes.filter_size, backend_};
+    AllocatedPointer output{sizeof(T) * sizes.output_size, backend_};
+    // Uninitialised memory may hold NaNs or denormals, which can change the
+    // run time of some devices, so time every algorithm on zeros.
+    zero_fill(input.get(), sizes.input_size);
+    zero_fill(filter.get(), sizes.filter_size);
+
+    Algorithm best_algo = Algorithm::NotSupported;
+    double best_time = std::numeric_limits<double>::max();
+    for (auto algo : candidates) {
+      double time = time_algorithm<ConvType>(params, algo, input.get(),
+                                             filter.get(), output.get());
+      if (time < best_time) {
+        best_time = time;
+        best_algo = algo;
+      }
+    }
+    return best_algo;
+  }
+
+  /** Set the first n_elems values of a temporary tensor to zero. */
+  template <typename Pointer>
+  void zero_fill(Pointer ptr, size_t n_elems) {
+    if (n_elems == 0) {
+      return;
+    }
+    auto mem = backend_.get_mem_object(ptr, n_elems);
+    auto event = backend_.get_queue().submit([&](cl::sycl::handler& cgh) {
+      auto data = mem.write_mem(cgh);
+      cgh.parallel_for<internal::AutotuneZeroFill<T>>(
+          cl::sycl::range<1>{n_elems},
+          [=](cl::sycl::item<1> item) { data.get_pointer()[item[0]] = T{0}; });
+    });
+    event.wait_and_throw();
+  }
+
+  /**
+   * Run the convolution with the given algorithm, returning the mean run time
+   * in seconds, or the maximum double value if the algorithm cannot be
+   * launched for these parameters.
+   */
+  template <typename ConvType, typename Pointer>
+  double time_algorithm(Conv2DParams const& params, Algorithm algo,
+                        Pointer input, Pointer filter, Pointer output) {
+    constexpr double failed = std::numeric_limits<double>::max();
+    internal::FixedSelector selector{algo};
+    auto workspace_size = query_workspace_size<ConvType>(params, selector);
+    // Always allocate at least one element so that there is a valid pointer
+    // to pass to the launcher.
+    AllocatedPointer workspace{
+        sizeof(T) * std::max<size_t>(workspace_size.recommended_size, 1),
+        backend_};
+
+    auto run = [&]() {
+      auto status = sublaunch<T, ConvType>(
+          input, filter, output, params, selector, backend_, workspace.get(),
+          workspace_size.recommended_size, {});
+      if (status.status == StatusCode::OK) {
+        status.event.wait_and_throw();
+      }
+      return status.status;
+    };
+
+    double time = failed;
+    try {
+      if (run() == StatusCode::OK) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n_reps_; ++i) {
+          run();
+        }
+        auto end = std::chrono::steady_clock::now();
+        time = std::chrono::duration<double>(end - start).count() / n_reps_;
+      }
+    } catch (cl::sycl::exception const&) {
+      time = failed;
+    }
+    return time;
+  }
+
+  Backend& backend_;
+  std::string cache_path_;
+  int n_reps_;
+  std::string device_id_;
+  std::unique_ptr<Selector> fallback_;
+  AutotuneCache cache_;
+  size_t n_tuned_ = 0;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
@@ -72,6 +72,20 @@ class Selector {
    */
   virtual Algorithm select_filter_backprop(Conv2DParams const& params) = 0;
 
+  /**
+   * Overrideable function that selects algorithms for transposed
+   * convolutions. A transposed convolution is launched as the input backprop
+   * of an equivalent forward convolution, so by default the input backprop
+   * selection is used.
+   * \param params The parameters of the equivalent forward convolution, as
+   * given by \ref sycldnn::conv2d::get_conv2d_params.
+   * \return Returns a
+   * \ref sycldnn::conv2d::Algorithm.
+   */
+  virtual Algorithm select_transposed(Conv2DParams const& params) {
+    return this->select_input_backprop(params);
+  }
+
   /**
    * Gets the name of the selector.
    * \return Returns a character string containing the descriptive name of the
@@ -45,6 +45,9 @@ class WinogradSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 1 && params.window_cols == 3) {
       return Algorithm::Winograd;
     }
@@ -69,6 +72,9 @@ class WinogradSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 1 && params.window_cols == 3) {
       return Algorithm::Winograd;
     }
@@ -93,6 +99,9 @@ class WinogradSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 1 && params.window_cols == 3) {
       return Algorithm::Winograd;
     }
@@ -129,6 +138,9 @@ class WinogradLargeSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
@@ -148,6 +160,9 @@ class WinogradLargeSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
@@ -167,6 +182,9 @@ class WinogradLargeSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
@@ -181,6 +199,57 @@ class WinogradLargeSelector final : public Selector {
   char const* name() const override { return "WinogradLargeSelector"; }
 };
 
+/** A selector which returns the WinogradFused algorithm if supported. */
+class WinogradFusedSelector final : public Selector {
+ public:
+  /**
+   * Selects the WinogradFused algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::WinogradFused when the fused Winograd algorithm
+   * is supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    if (params.stride_rows != 1 || params.stride_cols != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.window_rows == 3 && params.window_cols == 3) {
+      return Algorithm::WinogradFused;
+    }
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * The fused Winograd algorithm only supports the forward pass.
+   *
+   * \return Returns Algorithm::NotSupported.
+   */
+  Algorithm select_input_backprop(Conv2DParams const&) override {
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * The fused Winograd algorithm only supports the forward pass.
+   *
+   * \return Returns Algorithm::NotSupported.
+   */
+  Algorithm select_filter_backprop(Conv2DParams const&) override {
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Gets the name of the selector.
+   * \return Returns a character string containing the descriptive name of the
+   * selector.
+   */
+  char const* name() const override { return "WinogradFusedSelector"; }
+};
+
 }  // namespace conv2d
 }  // namespace sycldnn
 
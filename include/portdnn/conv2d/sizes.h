@@ -128,7 +128,7 @@ inline ConvSizes get_channel_sizes<conv_type::Forward>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
   size_t fil_size = params.channels * params.features / params.groups;
-  size_t out_size = params.features / params.groups;
+  size_t out_size = params.features;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
@@ -138,7 +138,7 @@ template <>
 inline ConvSizes get_channel_sizes<conv_type::InputBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.features;
-  size_t fil_size = params.channels * params.features;
+  size_t fil_size = params.channels * params.features / params.groups;
   size_t out_size = params.channels;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
@@ -150,7 +150,7 @@ inline ConvSizes get_channel_sizes<conv_type::FilterBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
   size_t fil_size = params.features;
-  size_t out_size = params.channels * params.features;
+  size_t out_size = params.channels * params.features / params.groups;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
@@ -173,7 +173,7 @@ inline ConvSizes get_sizes(Conv2DParams const& params) {
   size_t fil_size = batch_sizes.filter_size * spatial_sizes.filter_size *
                     channel_sizes.filter_size;
   size_t out_size = batch_sizes.output_size * spatial_sizes.output_size *
-                    channel_sizes.output_size * params.groups;
+                    channel_sizes.output_size;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
@@ -0,0 +1,131 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_TRANSFORMED_FILTER_H_
+#define PORTDNN_INCLUDE_CONV2D_TRANSFORMED_FILTER_H_
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/params.h"
+
+#include <stddef.h>
+
+/**
+ * \file
+ * Contains the \ref sycldnn::conv2d::TransformedFilter handle, used to reuse
+ * the filter transform of a forward convolution across many launches.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Handle to a forward convolution filter which has already been transformed
+ * into the layout used by a specific convolution algorithm.
+ *
+ * In inference the filter is constant, so the filter transform computed in
+ * every Winograd or im2col launch can instead be computed once with
+ * sycldnn::conv2d::transform_filter() and the handle passed to
+ * sycldnn::conv2d::launch() in place of the filter.
+ *
+ * The handle does not own its memory. The data pointer must hold at least
+ * query_transformed_filter_size() elements and must outlive any convolution
+ * using the handle.
+ */
+template <typename T, typename Backend>
+struct TransformedFilter {
+  /** The algorithm the filter has been transformed for. */
+  Algorithm algorithm;
+  /**
+   * The parameters of the convolution the filter was transformed for. The
+   * handle can be used with any convolution which matches these parameters in
+   * everything but the batch size and the input and output spatial sizes.
+   */
+  Conv2DParams params;
+  /** Pointer to the transformed filter. */
+  typename Backend::template pointer_type<T> data;
+};
+
+namespace internal {
+
+/** Get the size of a Winograd filter transform using the tile sizes specified
+ * in the template parameters. */
+template <int M, int N, int R, int S>
+size_t winograd_transformed_filter_size(Conv2DParams const& params) {
+  static constexpr int A = M + R - 1;
+  static constexpr int B = N + S - 1;
+  return static_cast<size_t>(A * B) * params.channels * params.features;
+}
+
+}  // namespace internal
+
+/**
+ * Query the number of elements needed to hold the filter of a forward
+ * convolution once it has been transformed for the given algorithm.
+ *
+ * \param params    Convolution parameters describing the computation.
+ * \param algorithm The algorithm to transform the filter for.
+ *
+ * \return The number of elements in the transformed filter, or zero if the
+ *         algorithm does not support pre-transformed filters for these
+ *         parameters.
+ */
+inline size_t query_transformed_filter_size(Conv2DParams const& params,
+                                            Algorithm algorithm) {
+  // The choice of tile sizes here should match that used in
+  // portdnn/internal/conv2d/winograd/launch.h
+  switch (algorithm) {
+    case Algorithm::Winograd:
+      if (params.groups != 1) {
+        return 0;
+      }
+      if (params.window_rows == 3 && params.window_cols == 3) {
+        return internal::winograd_transformed_filter_size<2, 2, 3, 3>(params);
+      }
+      if (params.window_rows == 3 && params.window_cols == 1) {
+        return internal::winograd_transformed_filter_size<2, 1, 3, 1>(params);
+      }
+      if (params.window_rows == 1 && params.window_cols == 3) {
+        return internal::winograd_transformed_filter_size<1, 2, 1, 3>(params);
+      }
+      return 0;
+    case Algorithm::WinogradLarge:
+      if (params.groups == 1 && params.window_rows == 3 &&
+          params.window_cols == 3) {
+        return internal::winograd_transformed_filter_size<4, 4, 3, 3>(params);
+      }
+      return 0;
+    case Algorithm::WinogradFused:
+      if (params.groups == 1 && params.window_rows == 3 &&
+          params.window_cols == 3) {
+        return internal::winograd_transformed_filter_size<2, 2, 3, 3>(params);
+      }
+      return 0;
+    case Algorithm::Im2col:
+      return static_cast<size_t>(params.window_rows) * params.window_cols *
+             params.channels * params.features / params.groups;
+    case Algorithm::Direct:
+    case Algorithm::Tiled:
+    case Algorithm::Matmul:
+    case Algorithm::ImplicitGemm:
+    case Algorithm::LocalTiled:
+    case Algorithm::NotSupported:
+    default:
+      return 0;
+  }
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_CONV2D_TRANSFORMED_FILTER_H_
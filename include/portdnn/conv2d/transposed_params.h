@@ -0,0 +1,193 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_CONV2D_TRANSPOSED_PARAMS_H_
+#define PORTDNN_INCLUDE_CONV2D_TRANSPOSED_PARAMS_H_
+
+#include "portdnn/batch_format.h"
+#include "portdnn/data_format.h"
+#include "portdnn/filter_format.h"
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+
+/**
+ * \file
+ * Contains the declaration of the
+ * \ref sycldnn::conv2d::TransposedConv2DParams structure, which represents the
+ * tensor shapes for a 2D transposed convolution (sometimes called a
+ * deconvolution), and the helpers to map it onto the equivalent convolution.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Parameter struct containing the parameters required for a 2D transposed
+ * convolution.
+ *
+ * A transposed convolution computes the gradient of a forward convolution with
+ * respect to its input, so the strides, padding and dilation describe that
+ * forward convolution. The output spatial size is given by:
+ *
+ *   out = (in - 1) * stride - 2 * pad + dilation * (window - 1) + 1
+ *         + output_pad
+ */
+struct TransposedConv2DParams {
+  /** The underlying data type of all index parameters. */
+  using Index = int;
+
+  /** The number of channels (or feature maps) in each input image. */
+  Index channels;
+
+  /** The number of feature maps (or channels) in each output image. */
+  Index features;
+
+  /** The number of input images per batch. */
+  Index batch;
+
+  /** The number of rows in each input image. */
+  Index in_rows;
+
+  /** The number of columns in each input image. */
+  Index in_cols;
+
+  /** The number of rows in the filter kernel. */
+  Index window_rows;
+
+  /** The number of columns in the filter kernel. */
+  Index window_cols;
+
+  /** The upsampling factor in the row direction. */
+  Index stride_rows;
+
+  /** The upsampling factor in the column direction. */
+  Index stride_cols;
+
+  /** The number of rows in each output image. */
+  Index out_rows;
+
+  /** The number of columns in each output image. */
+  Index out_cols;
+
+  /** The number of rows cropped from both the top and bottom of the output. */
+  Index pad_rows;
+
+  /** The number of columns cropped from both sides of the output. */
+  Index pad_cols;
+
+  /**
+   * The number of extra rows added to the bottom of the output, used to pick
+   * between the output sizes which all map to the same input size when the
+   * stride is greater than one. Must be smaller than the stride or dilation.
+   */
+  Index output_pad_rows = 0;
+
+  /** The number of extra columns added to the right of the output. */
+  Index output_pad_cols = 0;
+
+  /** Spacing between the filter elements in the row direction. */
+  Index dilation_rows = 1;
+
+  /** Spacing between the filter elements in the column direction. */
+  Index dilation_cols = 1;
+
+  /** Number of feature map groups for grouped transposed convolution. */
+  Index groups = 1;
+
+  /** The data format used in the input and output tensors. */
+  sycldnn::DataFormat input_format = sycldnn::DataFormat::NHWC;
+
+  /**
+   * The data format used in the filter tensor. The filter has the layout of
+   * the equivalent forward convolution, so for HWCF the channel dimension
+   * matches the transposed convolution's output features and the feature
+   * dimension matches its input channels.
+   */
+  sycldnn::FilterFormat filter_format = sycldnn::FilterFormat::HWCF;
+
+  /** The layout of the groups in the input and output tensors. */
+  sycldnn::BatchFormat group_format = sycldnn::BatchFormat::STRIDED;
+};
+
+/**
+ * Get the parameters of the forward convolution whose input backprop computes
+ * the given transposed convolution.
+ *
+ * The transposed convolution's input is the convolution's output and vice
+ * versa, so the channels and features swap as well as the spatial sizes.
+ *
+ * \param params The transposed convolution parameters.
+ * \return Returns the equivalent \ref sycldnn::conv2d::Conv2DParams.
+ */
+inline Conv2DParams get_conv2d_params(TransposedConv2DParams const& params) {
+  Conv2DParams conv_params;
+  conv_params.channels = params.features;
+  conv_params.features = params.channels;
+  conv_params.batch = params.batch;
+  conv_params.in_rows = params.out_rows;
+  conv_params.in_cols = params.out_cols;
+  conv_params.window_rows = params.window_rows;
+  conv_params.window_cols = params.window_cols;
+  conv_params.stride_rows = params.stride_rows;
+  conv_params.stride_cols = params.stride_cols;
+  conv_params.out_rows = params.in_rows;
+  conv_params.out_cols = params.in_cols;
+  conv_params.pad_rows = params.pad_rows;
+  conv_params.pad_cols = params.pad_cols;
+  conv_params.dilation_rows = params.dilation_rows;
+  conv_params.dilation_cols = params.dilation_cols;
+  conv_params.groups = params.groups;
+  conv_params.input_format = params.input_format;
+  conv_params.filter_format = params.filter_format;
+  conv_params.group_format = params.group_format;
+  return conv_params;
+}
+
+/**
+ * Fill in the output sizes of a transposed convolution from its input sizes,
+ * window, strides, padding, dilation and output padding.
+ *
+ * \param params The transposed convolution parameters, whose out_rows and
+ *               out_cols will be overwritten.
+ * \return Returns the parameters with the output sizes set.
+ */
+inline TransposedConv2DParams add_output_sizes_to(
+    TransposedConv2DParams params) {
+  params.out_rows = (params.in_rows - 1) * params.stride_rows -
+                    2 * params.pad_rows +
+                    params.dilation_rows * (params.window_rows - 1) + 1 +
+                    params.output_pad_rows;
+  params.out_cols = (params.in_cols - 1) * params.stride_cols -
+                    2 * params.pad_cols +
+                    params.dilation_cols * (params.window_cols - 1) + 1 +
+                    params.output_pad_cols;
+  return params;
+}
+
+/**
+ * Compute the total sizes of the tensors used in a transposed convolution.
+ *
+ * \param params The transposed convolution parameters.
+ * \return Returns a \ref sycldnn::conv2d::ConvSizes instance, containing the
+ *         sizes of the tensors in elements.
+ */
+inline ConvSizes get_transposed_sizes(TransposedConv2DParams const& params) {
+  return get_sizes<conv_type::InputBackprop>(get_conv2d_params(params));
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_INCLUDE_CONV2D_TRANSPOSED_PARAMS_H_
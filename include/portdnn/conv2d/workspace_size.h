@@ -19,6 +19,8 @@
 #include "portdnn/conv2d/algorithm.h"
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/transformed_filter.h"
+#include "portdnn/conv2d/transposed_params.h"
 
 #include "portdnn/internal/conv2d/im2col/kernel_params.h"
 #include "portdnn/internal/conv2d/im2col/tile_info.h"
@@ -27,6 +29,10 @@
 #include "portdnn/internal/conv2d/winograd/kernel_params.h"
 #include "portdnn/internal/conv2d/winograd/tile_info.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 
@@ -46,6 +52,20 @@ struct WorkspaceSize {
   size_t recommended_size;
 };
 
+/**
+ * The algorithm selected to fit within a workspace budget, along with the
+ * workspace it needs and the number of images it will process per minibatch
+ * when given the full budget.
+ */
+struct WorkspaceSelection {
+  /** The selected algorithm, or NotSupported if nothing fits the budget. */
+  Algorithm algorithm;
+  /** The workspace sizes needed by the selected algorithm. */
+  WorkspaceSize workspace_size;
+  /** Number of images computed in each minibatch within the budget. */
+  size_t minibatch_size;
+};
+
 namespace internal {
 
 /** Get the workspace sizes for Winograd using the tile sizes specified in the
@@ -96,6 +116,18 @@ WorkspaceSize workspace_size_for_winograd_large(Conv2DParams const& params) {
   }
 }
 
+/** Get the workspace sizes for the fused Winograd convolution, which only
+ * needs to store the filter transform. */
+template <typename ConvType>
+WorkspaceSize workspace_size_for_winograd_fused(Conv2DParams const& params) {
+  if (!std::is_same<ConvType, conv_type::Forward>::value) {
+    return {0, 0};
+  }
+  size_t filter_transform_size =
+      winograd_transformed_filter_size<2, 2, 3, 3>(params);
+  return {filter_transform_size, filter_transform_size};
+}
+
 /** Get the workspace sizes needed for the Im2col transform tensors. */
 template <typename ConvType>
 WorkspaceSize workspace_size_for_im2col(Conv2DParams const& params) {
@@ -119,6 +151,15 @@ WorkspaceSize workspace_size_for_im2col(Conv2DParams const& params) {
   return {required_size, recommended_size};
 }
 
+/**
+ * Get the number of elements in the im2col patch matrix of one image of a
+ * quantized convolution.
+ */
+inline size_t quantized_im2col_image_size(Conv2DParams const& params) {
+  return static_cast<size_t>(params.out_rows) * params.out_cols *
+         params.window_rows * params.window_cols * params.channels;
+}
+
 /** Get the WorkspaceSize for the specified convolution using the provided
  * Algorithm. */
 template <typename ConvType>
@@ -134,17 +175,131 @@ WorkspaceSize query_workspace_size(Conv2DParams const& params,
     case Algorithm::Im2col:
       return workspace_size_for_im2col<ConvType>(params);
       break;
+    case Algorithm::WinogradFused:
+      return workspace_size_for_winograd_fused<ConvType>(params);
+      break;
     case Algorithm::Direct:
     case Algorithm::Tiled:
     case Algorithm::Matmul:
+    case Algorithm::ImplicitGemm:
+    case Algorithm::LocalTiled:
     case Algorithm::NotSupported:
       return {0, 0};
   }
   SNN_ASSERT(false, "Invalid algorithm passed to query_workspace_size.");
   return {0, 0};
 }
+
+/** Get the WorkspaceSize for a forward convolution using a filter which has
+ * already been transformed for the provided Algorithm. */
+inline WorkspaceSize query_transformed_workspace_size(
+    Conv2DParams const& params, Algorithm algorithm) {
+  auto const sizes =
+      query_workspace_size<conv_type::Forward>(params, algorithm);
+  size_t filter_size = 0;
+  switch (algorithm) {
+    case Algorithm::Winograd:
+    case Algorithm::WinogradLarge:
+    case Algorithm::WinogradFused:
+      filter_size = query_transformed_filter_size(params, algorithm);
+      break;
+    case Algorithm::Im2col:
+      filter_size = im2col::get_transform_sizes<conv_type::Forward>(params)
+                        .filter_transform_size;
+      break;
+    default:
+      break;
+  }
+  return {sizes.required_size - filter_size,
+          sizes.recommended_size - filter_size};
+}
+
+/**
+ * Get the number of images which can be computed in each minibatch given a
+ * workspace of workspace_size elements.
+ *
+ * The workspace sizes are a fixed part, such as the filter transform, plus a
+ * part per image, so the required size covers one image and the recommended
+ * size covers the whole batch.
+ */
+inline size_t minibatch_size_for_workspace(WorkspaceSize const& sizes,
+                                           size_t batch,
+                                           size_t workspace_size) {
+  if (sizes.recommended_size <= workspace_size || batch <= 1) {
+    return batch;
+  }
+  size_t const per_image =
+      (sizes.recommended_size - sizes.required_size) / (batch - 1);
+  if (per_image == 0) {
+    return batch;
+  }
+  size_t const fixed = sizes.required_size - per_image;
+  return std::min(batch, (workspace_size - fixed) / per_image);
+}
+
+/**
+ * Select the algorithm to use for a convolution with at most workspace_size
+ * elements of workspace.
+ *
+ * The selector's choice is used if it fits. Otherwise im2col is tried, as it
+ * can split the batch to fit a small workspace, and then the algorithms which
+ * need no workspace at all.
+ */
+template <typename ConvType>
+WorkspaceSelection select_for_workspace(Conv2DParams const& params,
+                                        Selector& selector,
+                                        size_t workspace_size) {
+  Algorithm const preferred = selector.select<ConvType>(params);
+  if (preferred == Algorithm::NotSupported) {
+    return {Algorithm::NotSupported, {0, 0}, 0};
+  }
+  bool const can_use_implicit_gemm =
+      std::is_same<ConvType, conv_type::Forward>::value &&
+      params.groups == 1 && params.input_format == DataFormat::NHWC &&
+      params.filter_format == FilterFormat::HWCF;
+  Algorithm const candidates[] = {
+      preferred, Algorithm::Im2col,
+      can_use_implicit_gemm ? Algorithm::ImplicitGemm : Algorithm::NotSupported,
+      params.groups == 1 ? Algorithm::Direct : Algorithm::NotSupported};
+  size_t const batch = static_cast<size_t>(params.batch);
+  for (Algorithm algo : candidates) {
+    if (algo == Algorithm::NotSupported) {
+      continue;
+    }
+    auto const sizes = query_workspace_size<ConvType>(params, algo);
+    if (sizes.required_size <= workspace_size) {
+      return {algo, sizes,
+              minibatch_size_for_workspace(sizes, batch, workspace_size)};
+    }
+  }
+  return {Algorithm::NotSupported, {0, 0}, 0};
+}
 }  // namespace internal
 
+/**
+ * Select the algorithm to use for a convolution so that its workspace fits
+ * within a byte budget.
+ *
+ * The algorithm chosen by the selector is returned if its minimum workspace
+ * fits. Otherwise the fastest fallback which fits is returned, preferring
+ * im2col with a reduced minibatch over algorithms which need no workspace.
+ *
+ * \param params Convolution parameters describing the computation.
+ * \param selector Selector giving the preferred algorithm.
+ * \param budget_bytes The maximum size of the workspace buffer in bytes.
+ *
+ * \return A WorkspaceSelection struct containing the algorithm, its workspace
+ *         sizes in elements and the minibatch size implied by the budget. The
+ *         algorithm is NotSupported if no algorithm fits the budget.
+ */
+template <typename T, typename ConvType>
+WorkspaceSelection select_for_workspace_budget(Conv2DParams const& params,
+                                               Selector& selector,
+                                               size_t budget_bytes) {
+  return internal::select_for_workspace<ConvType>(params, selector,
+                                                  budget_bytes / sizeof(T));
+}
+
 /**
  * Query the number of elements that a workspace buffer must hold in order to be
  * used in a convolution computation.
@@ -162,6 +317,64 @@ WorkspaceSize query_workspace_size(Conv2DParams const& params,
       params, selector.select<ConvType>(params));
 }
 
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in a transposed convolution computation.
+ *
+ * \param params Transposed convolution parameters describing the computation.
+ * \param selector Selector to use to determine which algorithm to use.
+ *
+ * \return A WorkspaceSize struct containing the minimum required and
+ *         recommended number of elements that a workspace buffer should hold.
+ */
+inline WorkspaceSize query_workspace_size(TransposedConv2DParams const& params,
+                                          Selector& selector) {
+  auto const conv_params = get_conv2d_params(params);
+  return internal::query_workspace_size<conv_type::InputBackprop>(
+      conv_params, selector.select_transposed(conv_params));
+}
+
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in a forward convolution with a pre-transformed filter.
+ *
+ * No space is needed for the filter transform, so the workspace is smaller
+ * than that needed by the same convolution using an untransformed filter.
+ *
+ * \param filter The transformed filter to use in the convolution.
+ * \param params Convolution parameters describing the computation.
+ *
+ * \return A WorkspaceSize struct containing the minimum required and
+ *         recommended number of elements that a workspace buffer should hold.
+ */
+template <typename T, typename Backend>
+WorkspaceSize query_workspace_size(TransformedFilter<T, Backend> const& filter,
+                                   Conv2DParams const& params) {
+  return internal::query_transformed_workspace_size(params, filter.algorithm);
+}
+
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in a quantized convolution.
+ *
+ * Only the im2col algorithm needs a workspace, which holds the input patches
+ * of at least one image.
+ *
+ * \param params Convolution parameters describing the computation.
+ * \param selector Selector to use to determine which algorithm to use.
+ *
+ * \return A WorkspaceSize struct containing the minimum required and
+ *         recommended number of elements that a workspace buffer should hold.
+ */
+inline WorkspaceSize query_quantized_workspace_size(Conv2DParams const& params,
+                                                    Selector& selector) {
+  if (selector.select<conv_type::Forward>(params) != Algorithm::Im2col) {
+    return {0, 0};
+  }
+  size_t const image_size = internal::quantized_im2col_image_size(params);
+  return {image_size, params.batch * image_size};
+}
+
 }  // namespace conv2d
 }  // namespace sycldnn
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_DEPTHWISE_CONV2D_LAUNCH_SEPARABLE_H_
+#define PORTDNN_INCLUDE_DEPTHWISE_CONV2D_LAUNCH_SEPARABLE_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::depthwise_conv2d::launch_separable() function,
+ * which asynchronously dispatches the SYCL kernel required to perform a
+ * depthwise convolution fused with a following 1x1 pointwise convolution.
+ */
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "portdnn/internal/depthwise_conv2d/launch_separable.h"
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+
+/**
+ * Launch a depthwise convolution fused with a 1x1 pointwise convolution.
+ *
+ * The depthwise results are kept in local memory and multiplied by the
+ * pointwise filter straight away, so the intermediate tensor is never written
+ * to global memory. Only the forward pass is supported.
+ *
+ * \param input            A pointer to the memory representing the input
+ *                         tensor.
+ * \param depthwise_filter A pointer to the memory representing the depthwise
+ *                         filter, in the layout [window_rows][window_cols]
+ *                         [channels * channel_multiplier].
+ * \param pointwise_filter A pointer to the memory representing the pointwise
+ *                         filter, in the layout [channels *
+ *                         channel_multiplier][features].
+ * \param output           A pointer to the memory representing the output
+ *                         tensor.
+ * \param params           The separable convolution parameters.
+ * \param backend          The backend implementation, used to map between
+ *                         pointer representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch_separable(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> depthwise_filter,
+    typename Backend::template pointer_type<T const> pointwise_filter,
+    typename Backend::template pointer_type<T> output,
+    SeparableConv2DParams const& params, Backend& backend) {
+  return internal::sublaunch_separable<T>(input, depthwise_filter,
+                                          pointwise_filter, output, params,
+                                          backend, {});
+}
+
+/**
+ * Launch a depthwise convolution fused with a 1x1 pointwise convolution.
+ *
+ * The depthwise results are kept in local memory and multiplied by the
+ * pointwise filter straight away, so the intermediate tensor is never written
+ * to global memory. Only the forward pass is supported.
+ *
+ * \param input            A pointer to the memory representing the input
+ *                         tensor.
+ * \param depthwise_filter A pointer to the memory representing the depthwise
+ *                         filter, in the layout [window_rows][window_cols]
+ *                         [channels * channel_multiplier].
+ * \param pointwise_filter A pointer to the memory representing the pointwise
+ *                         filter, in the layout [channels *
+ *                         channel_multiplier][features].
+ * \param output           A pointer to the memory representing the output
+ *                         tensor.
+ * \param params           The separable convolution parameters.
+ * \param backend          The backend implementation, used to map between
+ *                         pointer representations.
+ * \param events           Events which should be completed before the
+ *                         operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_separable(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> depthwise_filter,
+    typename Backend::template pointer_type<T const> pointwise_filter,
+    typename Backend::template pointer_type<T> output,
+    SeparableConv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  return internal::sublaunch_separable<T>(input, depthwise_filter,
+                                          pointwise_filter, output, params,
+                                          backend, events);
+}
+
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_DEPTHWISE_CONV2D_LAUNCH_SEPARABLE_H_
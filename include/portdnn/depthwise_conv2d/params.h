@@ -86,6 +86,18 @@ struct DepthwiseConv2DParams {
    */
   Index pad_cols;
 
+  /**
+   * Horizontal stride between elements sampled in the input image. Dilation
+   * is only supported in the forward pass.
+   */
+  Index dilation_rows = 1;
+
+  /**
+   * Vertical stride between elements sampled in the input image. Dilation is
+   * only supported in the forward pass.
+   */
+  Index dilation_cols = 1;
+
   /** The data format used in the input and output tensors. */
   sycldnn::DataFormat input_format = sycldnn::DataFormat::NHWC;
 
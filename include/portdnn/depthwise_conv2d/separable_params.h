@@ -0,0 +1,95 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_DEPTHWISE_CONV2D_SEPARABLE_PARAMS_H_
+#define PORTDNN_INCLUDE_DEPTHWISE_CONV2D_SEPARABLE_PARAMS_H_
+
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/depthwise_conv2d/params.h"
+
+#include <stddef.h>
+
+/**
+ * \file
+ * Contains the declaration of the
+ * \ref sycldnn::depthwise_conv2d::SeparableConv2DParams structure, which
+ * represents the tensor shapes for a depthwise convolution followed by a 1x1
+ * pointwise convolution, and the helper to compute the tensor sizes.
+ */
+namespace sycldnn {
+namespace depthwise_conv2d {
+
+/**
+ * Parameter struct for a depthwise-separable convolution, which is a
+ * depthwise convolution followed by a 1x1 pointwise convolution over all of
+ * the depthwise output features.
+ */
+struct SeparableConv2DParams {
+  /** The underlying data type of all index parameters. */
+  using Index = int;
+
+  /** The parameters of the depthwise convolution. */
+  DepthwiseConv2DParams depthwise;
+
+  /** The number of features computed by the pointwise convolution. */
+  Index features;
+
+  /** The activation applied to the depthwise output before the pointwise. */
+  conv2d::Activation depthwise_activation = conv2d::Activation::None;
+
+  /** The activation applied to the pointwise output. */
+  conv2d::Activation pointwise_activation = conv2d::Activation::None;
+};
+
+/** Tensor sizes for a given depthwise-separable convolution. */
+struct SeparableConvSizes {
+  /** The size of the input tensor in elements. */
+  size_t input_size;
+  /** The size of the depthwise filter tensor in elements. */
+  size_t depthwise_filter_size;
+  /** The size of the pointwise filter tensor in elements. */
+  size_t pointwise_filter_size;
+  /** The size of the output tensor in elements. */
+  size_t output_size;
+};
+
+/**
+ * Compute the total sizes of the tensors used in a depthwise-separable
+ * convolution for the specified parameters.
+ *
+ * The depthwise filter has the layout [window_rows][window_cols][channels *
+ * channel_multiplier], and the pointwise filter has the layout [channels *
+ * channel_multiplier][features].
+ *
+ * \param params The separable convolution parameters.
+ * \return Returns a \ref sycldnn::depthwise_conv2d::SeparableConvSizes
+ *         instance, containing the sizes of the tensors in elements.
+ */
+inline SeparableConvSizes get_separable_sizes(
+    SeparableConv2DParams const& params) {
+  auto const& dw = params.depthwise;
+  size_t dw_features = dw.channels * dw.channel_multiplier;
+  size_t inp_size = dw.batch * dw.in_rows * dw.in_cols * dw.channels;
+  size_t dw_fil_size = dw.window_rows * dw.window_cols * dw_features;
+  size_t pw_fil_size = dw_features * params.features;
+  size_t out_size = dw.batch * dw.out_rows * dw.out_cols * params.features;
+
+  return SeparableConvSizes{inp_size, dw_fil_size, pw_fil_size, out_size};
+}
+
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_DEPTHWISE_CONV2D_SEPARABLE_PARAMS_H_
@@ -25,6 +25,8 @@
 
 #include "portdnn/helpers/ratio.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace helpers {
 /** A simple struct for padding and output sizes. */
@@ -68,9 +70,48 @@ PaddingAndOutput<Index> calculate_padding(Index input, Index window,
   }
 }
 
+namespace internal {
+
+/**
+ * Get the number of rows spanned by the window once dilated, for parameter
+ * structs which contain a dilation.
+ */
+template <typename Params>
+auto dilated_window_rows(Params const& params, int)
+    -> decltype(params.window_rows * params.dilation_rows) {
+  return (params.window_rows - 1) * params.dilation_rows + 1;
+}
+
+/** Get the number of window rows for parameters without a dilation. */
+template <typename Params>
+auto dilated_window_rows(Params const& params, long)
+    -> std::decay_t<decltype(params.window_rows)> {
+  return params.window_rows;
+}
+
+/**
+ * Get the number of columns spanned by the window once dilated, for parameter
+ * structs which contain a dilation.
+ */
+template <typename Params>
+auto dilated_window_cols(Params const& params, int)
+    -> decltype(params.window_cols * params.dilation_cols) {
+  return (params.window_cols - 1) * params.dilation_cols + 1;
+}
+
+/** Get the number of window columns for parameters without a dilation. */
+template <typename Params>
+auto dilated_window_cols(Params const& params, long)
+    -> std::decay_t<decltype(params.window_cols)> {
+  return params.window_cols;
+}
+
+}  // namespace internal
+
 /**
  * Add the padding and output sizes to a parameter struct from the input
- * sizes, window sizes and strides.
+ * sizes, window sizes and strides. If the parameters contain a dilation then
+ * the padding is computed for the dilated window.
  * \param params The parameters that the output will be based on.
  * \param type The type of padding that should be used to calculate the actual
  *             size of padding to be used in the convolution.
@@ -79,12 +120,14 @@ PaddingAndOutput<Index> calculate_padding(Index input, Index window,
 template <typename Params>
 Params add_padding_to(Params params, PaddingMode type) {
   auto row_padding = sycldnn::helpers::calculate_padding(
-      params.in_rows, params.window_rows, params.stride_rows, type);
+      params.in_rows, internal::dilated_window_rows(params, 0),
+      params.stride_rows, type);
   params.out_rows = row_padding.output;
   params.pad_rows = row_padding.padding;
 
   auto col_padding = sycldnn::helpers::calculate_padding(
-      params.in_cols, params.window_cols, params.stride_cols, type);
+      params.in_cols, internal::dilated_window_cols(params, 0),
+      params.stride_cols, type);
   params.out_cols = col_padding.output;
   params.pad_cols = col_padding.padding;
 
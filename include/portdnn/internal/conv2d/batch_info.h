@@ -37,6 +37,11 @@ struct BatchInfo {
   size_t n_batches;
   /** Number of images in the last batch. */
   size_t last_batch_size;
+  /**
+   * Number of transform buffers the batches alternate between. Batch `i` uses
+   * buffer `i % n_buffers`, each of which holds `images_per_batch` images.
+   */
+  size_t n_buffers;
 };
 
 /**
@@ -52,7 +57,7 @@ inline BatchInfo get_batch_info(size_t minibatch_size, size_t n_images) {
       helpers::round_ratio_up_above_zero(n_images, minibatch_size);
   size_t const last_batch_size = n_images - minibatch_size * (n_batches - 1);
 
-  return BatchInfo{minibatch_size, n_batches, last_batch_size};
+  return BatchInfo{minibatch_size, n_batches, last_batch_size, 1};
 }
 
 /**
@@ -75,7 +80,30 @@ inline BatchInfo get_batch_info(size_t buffer_size, size_t n_images,
       helpers::round_ratio_up_above_zero(n_images, n_batches);
   size_t const last_batch_size = n_images - minibatch_size * (n_batches - 1);
 
-  return BatchInfo{minibatch_size, n_batches, last_batch_size};
+  return BatchInfo{minibatch_size, n_batches, last_batch_size, 1};
+}
+
+/**
+ * Split a transform buffer into two halves, so that alternate minibatches can
+ * use separate buffers. This allows the transforms of one minibatch to run
+ * while the previous minibatch is still reading its transformed data.
+ *
+ * If all the images fit into a single minibatch, or each minibatch only holds
+ * a single image, then the buffer is not split.
+ *
+ * \param batch_info The batch info for a single buffer.
+ * \param n_images   The total number of images to process.
+ * \return A BatchInfo struct with half the images per batch and two buffers.
+ */
+inline BatchInfo double_buffer_batch_info(BatchInfo const& batch_info,
+                                          size_t n_images) {
+  if (batch_info.n_batches == 1 || batch_info.images_per_batch < 2) {
+    return batch_info;
+  }
+  BatchInfo double_buffered =
+      get_batch_info(batch_info.images_per_batch / 2, n_images);
+  double_buffered.n_buffers = 2;
+  return double_buffered;
 }
 
 }  // namespace internal
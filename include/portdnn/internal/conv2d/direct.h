@@ -21,6 +21,8 @@
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
+
 #include "portdnn/export.h"
 
 namespace sycldnn {
@@ -29,11 +31,19 @@ namespace internal {
 /**
  * The internal direct convolution launcher.
  *
+ * The epilogue is applied to the output of forward convolutions in the same
+ * kernel which computes the convolution, and is ignored otherwise.
+ *
+ * The convolution is accumulated as ComputeT. A ComputeT which differs from T
+ * is only supported by forward NHWC convolutions.
+ *
  * Implemented in the compiled SYCL DNN library.
  */
-template <typename T, typename ConvType, template <typename> class MemObj>
+template <typename T, typename ConvType, typename ComputeT = T,
+          template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch_direct(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events);
@@ -0,0 +1,208 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+
+#include "portdnn/data_format.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/matmul/params.h"
+
+#include <stddef.h>
+#include <type_traits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+/**
+ * \file
+ * Contains helpers to pass a \ref sycldnn::conv2d::Epilogue through to the
+ * convolution kernels, the matrix multiply with a fused epilogue used by the
+ * backends built on the portDNN matmul kernels, and the standalone epilogue
+ * launcher used when the backend's matrix multiply cannot apply an epilogue.
+ */
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/** The epilogue operations together with the memory objects they read. */
+template <typename T, template <typename> class MemObj>
+struct EpilogueMem {
+  /** The operations to apply in the epilogue. */
+  EpilogueParams params;
+  /** Memory object for the bias tensor. */
+  MemObj<T const> bias;
+  /** Memory object for the residual tensor. */
+  MemObj<T const> residual;
+};
+
+/** Construct an EpilogueMem, deducing the memory object type. */
+template <typename T, template <typename> class MemObj>
+EpilogueMem<T, MemObj> make_epilogue_mem(EpilogueParams const& params,
+                                         MemObj<T const> const& bias,
+                                         MemObj<T const> const& residual) {
+  return EpilogueMem<T, MemObj>{params, bias, residual};
+}
+
+/**
+ * Get the memory objects for the tensors used in an epilogue.
+ *
+ * Tensors which are not used by the epilogue are never accessed by the
+ * kernels, so are only given a single element extent.
+ *
+ * \param epilogue The user provided epilogue.
+ * \param params   The convolution parameters.
+ * \param backend  The backend to provide the memory objects.
+ * \return The epilogue memory objects to pass to the kernel launchers.
+ */
+template <typename T, typename Backend>
+auto get_epilogue_mem(Epilogue<T, Backend> const& epilogue,
+                      Conv2DParams const& params, Backend& backend) {
+  size_t const bias_size = epilogue.params.add_bias ? params.features : 1;
+  size_t const residual_size =
+      epilogue.params.add_residual
+          ? get_sizes<conv_type::Forward>(params).output_size
+          : 1;
+  return make_epilogue_mem(
+      epilogue.params, backend.get_mem_object(epilogue.bias, bias_size),
+      backend.get_mem_object(epilogue.residual, residual_size));
+}
+
+/**
+ * Get the epilogue for a subset of the output tensor, used when an algorithm
+ * splits the computation into minibatches.
+ *
+ * \param epilogue The epilogue for the whole output tensor.
+ * \param offset   Offset of the minibatch in the output tensor.
+ * \return The epilogue for the minibatch.
+ */
+template <typename T, typename Backend>
+Epilogue<T, Backend> offset_epilogue(Epilogue<T, Backend> const& epilogue,
+                                     size_t offset) {
+  Epilogue<T, Backend> offset_epilogue{epilogue};
+  if (epilogue.params.add_residual) {
+    offset_epilogue.residual = epilogue.residual + offset;
+  }
+  return offset_epilogue;
+}
+
+/**
+ * Launch a matrix multiply which applies an epilogue to its output in
+ * registers, before the output is written.
+ *
+ * Computes output = epilogue(op(lhs) * op(rhs)) for a single matrix multiply,
+ * where the columns of the output are the output features used to index the
+ * bias, and the residual has the same layout as the output. This provides
+ * matmul_epilogue() for the backends using the portDNN matmul kernels.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param lhs      The left hand matrix.
+ * \param rhs      The right hand matrix.
+ * \param output   The output matrix.
+ * \param epilogue The epilogue to apply.
+ * \param params   The matrix multiply parameters, with explicit strides as
+ *                 given by matmul::internal::resolve_strides().
+ * \param queue    SYCL queue to enqueue the kernel to.
+ * \param events   Vector of events to synchronize on before launching the
+ *                 kernel.
+ * \return An SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_matmul_epilogue(
+    MemObj<T const>& lhs, MemObj<T const>& rhs, MemObj<T>& output,
+    EpilogueMem<T, MemObj>& epilogue, matmul::MatmulParams const& params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+/**
+ * Check whether the epilogue of a convolution whose final stage is the
+ * backend's matrix multiply can be applied by that matrix multiply.
+ *
+ * This needs a backend providing matmul_epilogue(), and a forward convolution
+ * computed with a single matmul whose columns are the output features, so an
+ * NHWC convolution with one group.
+ */
+template <typename Backend, typename ConvType>
+bool can_fuse_matmul_epilogue(Conv2DParams const& params) {
+  return backend::supports_matmul_epilogue<Backend>::value &&
+         std::is_same<ConvType, conv_type::Forward>::value &&
+         params.input_format == DataFormat::NHWC && params.groups == 1;
+}
+
+/**
+ * Launch a kernel to apply an epilogue in place to the convolution output.
+ *
+ * This is used by the algorithms whose final stage is a matrix multiply
+ * provided by the backend, when the backend's matrix multiply cannot apply
+ * the epilogue in the kernel that computes the output.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param output   The convolution output, which is overwritten.
+ * \param epilogue The epilogue to apply.
+ * \param params   The convolution parameters.
+ * \param queue    SYCL queue to enqueue the kernel to.
+ * \param events   Vector of events to synchronize on before launching the
+ *                 kernel.
+ * \return An SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_epilogue(
+    MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+    Conv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+/**
+ * Extract the memory objects from the backend and apply an epilogue in place
+ * to the convolution output, if the epilogue changes the output.
+ *
+ * \param status   The status of the convolution computing the output.
+ * \param output   The convolution output, which is overwritten.
+ * \param epilogue The epilogue to apply.
+ * \param params   The convolution parameters.
+ * \param backend  The backend to provide the memory objects and SYCL queue.
+ * \return An SNNStatus containing the SYCL event of the last kernel launched.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_epilogue_after(
+    SNNStatus const& status, typename Backend::template pointer_type<T> output,
+    Epilogue<T, Backend> const& epilogue, Conv2DParams const& params,
+    Backend& backend) {
+  if (status.status != StatusCode::OK || epilogue.params.is_identity()) {
+    return status;
+  }
+  size_t const output_size = get_sizes<conv_type::Forward>(params).output_size;
+  auto out_mem = backend.get_mem_object(output, output_size);
+  auto epilogue_mem = get_epilogue_mem(epilogue, params, backend);
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_epilogue<T>(out_mem, epilogue_mem, params, queue,
+                            std::vector<cl::sycl::event>{status.event});
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
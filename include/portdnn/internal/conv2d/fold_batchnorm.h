@@ -0,0 +1,138 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_FOLD_BATCHNORM_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_FOLD_BATCHNORM_H_
+
+/**
+ * \file
+ * Contains the internal launcher for the
+ * \ref sycldnn::conv2d::fold_batchnorm() function, which folds a frozen
+ * batchnorm into the filter and bias of a convolution.
+ */
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/fold_batchnorm_params.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+
+#include "portdnn/internal/conv2d/launch.h"
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Launch the kernel to fold a frozen batchnorm into a convolution.
+ *
+ * Implemented in the compiled portDNN library.
+ *
+ * \param filter        A memory object for the convolution filter.
+ * \param bias          A memory object for the convolution bias.
+ * \param beta          A memory object for the batchnorm beta.
+ * \param gamma         A memory object for the batchnorm gamma.
+ * \param mean          A memory object for the batchnorm mean.
+ * \param variance      A memory object for the batchnorm variance.
+ * \param folded_filter A memory object for the folded filter.
+ * \param folded_bias   A memory object for the folded bias.
+ * \param params        The convolution parameters.
+ * \param fold_params   The batchnorm folding parameters.
+ * \param queue         The SYCL queue to enqueue the kernel to.
+ * \param events        Events which should be completed before the
+ *                      operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, template <typename> class MemObj,
+          typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
+SNN_EXPORT SNNStatus launch_fold_batchnorm(
+    MemObj<T const>& filter, MemObj<T const>& bias, MemObj<T const>& beta,
+    MemObj<T const>& gamma, MemObj<T const>& mean, MemObj<T const>& variance,
+    MemObj<T>& folded_filter, MemObj<T>& folded_bias,
+    Conv2DParams const& params, FoldBatchNormParams const& fold_params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+/**
+ * Validate the parameters and fold a frozen batchnorm into a convolution.
+ *
+ * \param filter        A pointer to the convolution filter.
+ * \param bias          A pointer to the convolution bias, only accessed if
+ *                      fold_params.has_bias is set.
+ * \param beta          A pointer to the batchnorm beta.
+ * \param gamma         A pointer to the batchnorm gamma.
+ * \param mean          A pointer to the batchnorm mean.
+ * \param variance      A pointer to the batchnorm variance.
+ * \param folded_filter A pointer to the folded filter.
+ * \param folded_bias   A pointer to the folded bias.
+ * \param params        The convolution parameters.
+ * \param fold_params   The batchnorm folding parameters.
+ * \param backend       The backend implementation, used to map between
+ *                      pointer representations.
+ * \param events        Events which should be completed before the
+ *                      operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus sublaunch_fold_batchnorm(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    Conv2DParams const& params, FoldBatchNormParams const& fold_params,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
+  auto status = validate_params(params);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  SNN_VALIDATE_PARAM(fold_params.epsilon > 0.f,
+                     "The epsilon parameter must be greater than 0.");
+
+  size_t const filter_size = get_sizes<conv_type::Forward>(params).filter_size;
+  size_t const n_features = params.features;
+  size_t const bias_size = fold_params.has_bias ? n_features : 1;
+
+  auto fil_access = backend.get_mem_object(filter, filter_size);
+  auto bias_access = backend.get_mem_object(bias, bias_size);
+  auto beta_access = backend.get_mem_object(beta, n_features);
+  auto gamma_access = backend.get_mem_object(gamma, n_features);
+  auto mean_access = backend.get_mem_object(mean, n_features);
+  auto variance_access = backend.get_mem_object(variance, n_features);
+  auto folded_fil_access = backend.get_mem_object(folded_filter, filter_size);
+  auto folded_bias_access = backend.get_mem_object(folded_bias, n_features);
+  cl::sycl::queue queue = backend.get_queue();
+
+  return internal::launch_fold_batchnorm(
+      fil_access, bias_access, beta_access, gamma_access, mean_access,
+      variance_access, folded_fil_access, folded_bias_access, params,
+      fold_params, queue, events);
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_FOLD_BATCHNORM_H_
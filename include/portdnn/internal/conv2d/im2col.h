@@ -16,13 +16,19 @@
 #ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_H_
 #define PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_H_
 
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
 #include "portdnn/helpers/macros.h"
 #include "portdnn/status.h"
 
 #include "portdnn/internal/conv2d/alloc_info.h"
 #include "portdnn/internal/conv2d/batch_info.h"
+#include "portdnn/internal/conv2d/epilogue.h"
 #include "portdnn/internal/conv2d/internal_pointer_set.h"
+#include "portdnn/internal/conv2d/partial_reduction.h"
 
 #include "portdnn/internal/conv2d/im2col/allocated_pointer_set.h"
 #include "portdnn/internal/conv2d/im2col/full_pointer_set.h"
@@ -33,13 +39,22 @@
 #include "portdnn/internal/conv2d/im2col/tile_info.h"
 #include "portdnn/internal/conv2d/im2col/transform_sizes.h"
 #include "portdnn/internal/conv2d/im2col/workspace_pointer_set.h"
+#include "portdnn/internal/binaryop/launch.h"
 #include "portdnn/internal/transpose/launch.h"
+
+#include "portdnn/binaryop/operators.h"
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 namespace im2col {
 
-/** Launch the input transform and matmul to compute im2col. */
+/**
+ * Launch the input transform and matmul to compute im2col.
+ *
+ * The input transform waits on `events`, while the kernels writing to the
+ * output also wait on `output_events`. A non-identity epilogue is applied by
+ * the matmul, so must only be given if can_fuse_matmul_epilogue() holds.
+ */
 template <typename T, typename ConvType, typename Backend,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::FilterBackprop>::value,
@@ -47,21 +62,20 @@ template <typename T, typename ConvType, typename Backend,
 static SNNStatus launch_im2col_for_minibatch(
     FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
     size_t out_offset, TileInfo const& tile_info, Conv2DParams const& params,
-    Backend& backend, const std::vector<cl::sycl::event>& events) {
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    const std::vector<cl::sycl::event>& output_events) {
   using ConstPointer =
       typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
 
-  const auto filter_size =
-      std::is_same<ConvType, conv_type::InputBackprop>::value
-          ? 0
-          : filter_transform_size<ConvType>(params);
-  auto status = launch_input_transform(pointers, in_offset, filter_size,
-                                       tile_info, params, backend, events);
+  auto status = launch_input_transform(pointers, in_offset, 0, tile_info,
+                                       params, backend, events);
   if (status.status != StatusCode::OK) {
     return status;
   }
 
-  std::vector<cl::sycl::event> dependencies{status.event};
+  std::vector<cl::sycl::event> dependencies{output_events};
+  dependencies.push_back(status.event);
 
   int matmul_size;
   if (std::is_same<ConvType, conv_type::InputBackprop>::value) {
@@ -74,8 +88,52 @@ static SNNStatus launch_im2col_for_minibatch(
   int const tile_size = tile_info.size;
 
   cl::sycl::event event;
-  if (params.groups == 1) {
+  if (params.input_format == sycldnn::DataFormat::NCHW) {
+    // The transform of each NCHW image is a (tile_size x n_pixels) matrix, so
+    // multiplying the FCHW filter by it gives the NCHW output for that image.
+    int const n_pixels = tile_info.number;
+    size_t const transform_stride = n_pixels * tile_size;
+    size_t const output_stride = n_pixels * matmul_size;
+    if constexpr (sycldnn::backend::supports_strided_batch_matmul<
+                      Backend>::value) {
+      // Every image uses the same filter, so its batch stride is zero.
+      event = backend.template strided_batch_matmul<false, false>(
+          ConstPointer{pointers.filter}, ConstPointer{pointers.transform},
+          pointers.output + out_offset, static_cast<T>(0), params.batch,
+          matmul_size, tile_size, n_pixels, 0, tile_size * n_pixels,
+          matmul_size * n_pixels, dependencies);
+      return {event, StatusCode::OK};
+    }
+    for (int image = 0; image < params.batch; ++image) {
+      event = backend.template matmul<false, false>(
+          ConstPointer{pointers.filter},
+          ConstPointer{pointers.transform + image * transform_stride},
+          pointers.output + out_offset + image * output_stride,
+          static_cast<T>(0), matmul_size, tile_size, n_pixels, dependencies);
+      // Chain the matmuls so that the last event covers the whole minibatch.
+      dependencies = {event};
+    }
+  } else if (params.groups == 1) {
     // Regular convolution, no filter/output transformations are needed.
+    if constexpr (sycldnn::backend::supports_matmul_epilogue<Backend>::value) {
+      if (!epilogue.params.is_identity()) {
+        auto const minibatch_epilogue = offset_epilogue(epilogue, out_offset);
+        if (params.filter_format == sycldnn::FilterFormat::FHWC) {
+          event = backend.template matmul_epilogue<false, true>(
+              ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
+              pointers.output + out_offset, n_tiles, tile_size, matmul_size,
+              minibatch_epilogue.params, minibatch_epilogue.bias,
+              minibatch_epilogue.residual, dependencies);
+        } else {
+          event = backend.template matmul_epilogue<false, false>(
+              ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
+              pointers.output + out_offset, n_tiles, tile_size, matmul_size,
+              minibatch_epilogue.params, minibatch_epilogue.bias,
+              minibatch_epilogue.residual, dependencies);
+        }
+        return {event, StatusCode::OK};
+      }
+    }
     if (params.filter_format == sycldnn::FilterFormat::FHWC) {
       event = backend.template matmul<false, true>(
           ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
@@ -99,19 +157,16 @@ static SNNStatus launch_im2col_for_minibatch(
             tile_size, matmul_size, params.group_format, dependencies);
       } else {
         event = backend.template batch_matmul<false, false>(
-            ConstPointer{pointers.transform + filter_size},
-            ConstPointer{pointers.transform},
-            pointers.transform + filter_size + matmul_offset, params.groups,
-            n_tiles, tile_size, matmul_size, params.group_format, dependencies);
+            ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
+            pointers.transform + matmul_offset, params.groups, n_tiles,
+            tile_size, matmul_size, params.group_format, dependencies);
       }
 
       // Transpose needed at the end to reshape the output from GNHWC to NHWGC
       size_t const trans_size = params.groups * n_tiles * matmul_size;
 
       auto in_mem_obj =
-          backend
-              .get_mem_object(pointers.transform + filter_size + matmul_offset,
-                              trans_size)
+          backend.get_mem_object(pointers.transform + matmul_offset, trans_size)
               .as_const();
       auto out_mem_obj =
           backend.get_mem_object(pointers.output + out_offset, trans_size);
@@ -142,6 +197,11 @@ static SNNStatus launch_im2col_for_minibatch(
 /**
  * Launch the input transform and matmul to compute im2col for the filter
  * backprop pass.
+ *
+ * The filter gradient of the minibatch is written to `gradient`, or added to
+ * it if `accumulate` is set. The input transform waits on `events`, while the
+ * kernels writing to the gradient or the shared grouped buffers also wait on
+ * `output_events`.
  */
 template <typename T, typename ConvType, typename Backend,
           typename std::enable_if<
@@ -149,8 +209,11 @@ template <typename T, typename ConvType, typename Backend,
               int>::type = 0>
 static SNNStatus launch_im2col_for_minibatch(
     FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
-    size_t out_offset, TileInfo const& tile_info, Conv2DParams const& params,
-    Backend& backend, const std::vector<cl::sycl::event>& events) {
+    size_t out_offset,
+    typename FullPointerSet<T, Backend, ConvType>::Pointer gradient,
+    bool accumulate, TileInfo const& tile_info, Conv2DParams const& params,
+    Backend& backend, const std::vector<cl::sycl::event>& events,
+    const std::vector<cl::sycl::event>& output_events) {
   using ConstPointer =
       typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
   auto status = launch_input_transform(pointers, in_offset, 0, tile_info,
@@ -159,54 +222,185 @@ static SNNStatus launch_im2col_for_minibatch(
     return status;
   }
 
-  std::vector<cl::sycl::event> dependencies{status.event};
+  std::vector<cl::sycl::event> dependencies{output_events};
+  dependencies.push_back(status.event);
 
   const int n_tiles = tile_info.number;
   const int tile_size = params.batch * tile_info.size;
 
   cl::sycl::event matmul_event;
-  if (in_offset == 0) {
-    matmul_event = backend.template matmul<false, false>(
-        ConstPointer{pointers.transform}, pointers.filter + out_offset,
-        pointers.output, static_cast<T>(0), n_tiles, tile_size, params.features,
-        dependencies);
-  } else {
+  if (params.groups == 1) {
+    T const beta = accumulate ? static_cast<T>(1) : static_cast<T>(0);
     matmul_event = backend.template matmul<false, false>(
         ConstPointer{pointers.transform}, pointers.filter + out_offset,
-        pointers.output, static_cast<T>(1), n_tiles, tile_size, params.features,
-        dependencies);
+        gradient, beta, n_tiles, tile_size, params.features, dependencies);
+    return {matmul_event, StatusCode::OK};
+  }
+
+  // Group convolution. The output gradient is transposed from NHWGF to GNHWF
+  // so that a single strided batched matmul computes the filter gradient of
+  // every group as GHWCF, which is then transposed to HWCGF.
+  int const features_per_group = params.features / params.groups;
+  size_t const out_grad_size = tile_size * params.features;
+  size_t const filter_size = params.groups * n_tiles * features_per_group;
+  auto out_grad_transform =
+      pointers.transform + params.groups * n_tiles * tile_size;
+  auto queue = backend.get_queue();
+
+  auto out_grad_mem = backend.get_mem_object_internal(
+      pointers.filter + out_offset, out_grad_size);
+  auto out_grad_transform_mem =
+      backend.get_mem_object_internal(out_grad_transform, out_grad_size);
+  const std::vector<int> NHWGF_TO_GNHWF = {1, 0, 2};
+  auto out_grad_status = sycldnn::transpose::internal::launch(
+      out_grad_mem, out_grad_transform_mem,
+      {tile_size, params.groups, features_per_group}, NHWGF_TO_GNHWF, queue,
+      events);
+  if (out_grad_status.status != StatusCode::OK) {
+    return out_grad_status;
+  }
+  dependencies.push_back(out_grad_status.event);
+
+  // Batched matmuls have no beta, so when accumulating the gradient of the
+  // minibatch is computed separately and then added to the output.
+  matmul_event = backend.template batch_matmul<false, false>(
+      ConstPointer{pointers.transform}, ConstPointer{out_grad_transform},
+      pointers.filter_transform, params.groups, n_tiles, tile_size,
+      features_per_group, params.group_format, dependencies);
+
+  auto matmul_mem = backend.get_mem_object_internal(pointers.filter_transform,
+                                                    filter_size)
+                        .as_const();
+  auto output_mem = backend.get_mem_object_internal(gradient, filter_size);
+  const std::vector<int> GHWCF_TO_HWCGF = {1, 0, 2};
+  std::vector<int> const filter_dims = {params.groups, n_tiles,
+                                        features_per_group};
+  if (!accumulate) {
+    return sycldnn::transpose::internal::launch(matmul_mem, output_mem,
+                                                filter_dims, GHWCF_TO_HWCGF,
+                                                queue, {matmul_event});
+  }
+
+  auto grad_transform_mem = backend.get_mem_object_internal(
+      pointers.filter_transform + filter_size, filter_size);
+  auto transpose_status = sycldnn::transpose::internal::launch(
+      matmul_mem, grad_transform_mem, filter_dims, GHWCF_TO_HWCGF, queue,
+      {matmul_event});
+  if (transpose_status.status != StatusCode::OK) {
+    return transpose_status;
   }
-  return {matmul_event, StatusCode::OK};
+  auto output_const_mem = output_mem.as_const();
+  auto grad_transform_const_mem = grad_transform_mem.as_const();
+  return sycldnn::binaryop::internal::launch_binaryop<binaryop::Add>(
+      output_const_mem, grad_transform_const_mem, output_mem,
+      static_cast<int>(filter_size), queue, {transpose_status.event});
 }
 
-/** Loop over the minibatches to compute im2col. */
+/**
+ * Get the pointers to use in the minibatches once the filter transform has
+ * been computed.
+ *
+ * If the filter needed transforming then the transform is stored at the start
+ * of the transform buffer, so the filter pointer is moved to it and the
+ * remaining buffer is used for the input transform.
+ */
 template <typename T, typename ConvType, typename Backend>
-static SNNStatus launch_im2col_for_all_minibatches(
+static FullPointerSet<T, Backend, ConvType> use_filter_transform(
     FullPointerSet<T, Backend, ConvType> const& pointers,
-    TileInfo const& tile_info, BatchInfo const& batch_info,
-    Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
-  auto filter_status =
-      launch_filter_transform(pointers, params, backend, events);
-  if (filter_status.status != StatusCode::OK) {
-    return filter_status;
+    Conv2DParams const& params) {
+  using ConstPointer =
+      typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
+  size_t const filter_size = filter_transform_size<ConvType>(params);
+  if (filter_size == 0) {
+    return pointers;
+  }
+  return {pointers.input, ConstPointer{pointers.transform},
+          pointers.transform + filter_size, pointers.output};
+}
+
+/**
+ * The filter backprop filter pointer holds the output gradient, so is never
+ * replaced. Grouped filter backprop keeps its filter gradient buffer at the
+ * start of the transform buffer, and uses the remaining buffer for the input
+ * transform. Any partial gradient buffers are kept as they are.
+ */
+template <typename T, typename Backend>
+static FullPointerSet<T, Backend, conv_type::FilterBackprop>
+use_filter_transform(
+    FullPointerSet<T, Backend, conv_type::FilterBackprop> const& pointers,
+    Conv2DParams const& params) {
+  size_t const filter_size =
+      filter_transform_size<conv_type::FilterBackprop>(params);
+  if (filter_size == 0) {
+    return pointers;
   }
+  FullPointerSet<T, Backend, conv_type::FilterBackprop> moved{
+      pointers.input, pointers.filter, pointers.transform + filter_size,
+      pointers.output, pointers.transform};
+  moved.partials = pointers.partials;
+  moved.n_partials = pointers.n_partials;
+  return moved;
+}
+
+/**
+ * The input backprop pointer set already has a separate buffer for the filter
+ * transform, so is used unchanged.
+ */
+template <typename T, typename Backend>
+static FullPointerSet<T, Backend, conv_type::InputBackprop>
+use_filter_transform(
+    FullPointerSet<T, Backend, conv_type::InputBackprop> const& pointers,
+    Conv2DParams const& /*params*/) {
+  return pointers;
+}
+
+/**
+ * Loop over the minibatches to compute im2col, using a filter which is already
+ * in the layout required by the matrix multiplies.
+ *
+ * When there is more than one minibatch the transform buffer is split in two,
+ * so that the input transform of one minibatch can run concurrently with the
+ * matmul of the previous minibatch. Each input transform only waits for the
+ * minibatch which last used the same half of the buffer, while the kernels
+ * writing the output are chained so that the last event covers all of them.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+static SNNStatus launch_im2col_for_minibatches(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
+  auto const buffered_info = double_buffer_batch_info(batch_info, params.batch);
+  auto const transform_sizes = get_transform_sizes<ConvType>(params);
+  size_t const buffer_size =
+      buffered_info.images_per_batch * (transform_sizes.input_transform_size +
+                                        transform_sizes.output_transform_size);
 
   auto kernel_params = get_kernel_params<ConvType>(params);
-  kernel_params.batch = batch_info.images_per_batch;
+  kernel_params.batch = buffered_info.images_per_batch;
 
-  cl::sycl::event dep_event = filter_status.event;
-  for (size_t i = 0; i < batch_info.n_batches; ++i) {
+  std::vector<cl::sycl::event> buffer_events[2] = {events, events};
+  std::vector<cl::sycl::event> output_events;
+  cl::sycl::event dep_event;
+  for (size_t i = 0; i < buffered_info.n_batches; ++i) {
     auto offset =
-        calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
-    if (i == batch_info.n_batches - 1) {
-      kernel_params.batch = batch_info.last_batch_size;
+        calculate_offsets<ConvType>(i, buffered_info.images_per_batch, params);
+    if (i == buffered_info.n_batches - 1) {
+      kernel_params.batch = buffered_info.last_batch_size;
     }
-    auto status =
-        launch_im2col_for_minibatch(pointers, offset.in, offset.out, tile_info,
-                                    kernel_params, backend, {dep_event});
-    // Each minibatch depends on previous for safe re-use of transform buffer
+    size_t const buffer = i % buffered_info.n_buffers;
+    auto minibatch_pointers = pointers;
+    minibatch_pointers.transform = pointers.transform + buffer * buffer_size;
+    auto status = launch_im2col_for_minibatch(
+        minibatch_pointers, offset.in, offset.out, tile_info, kernel_params,
+        epilogue, backend, buffer_events[buffer], output_events);
+    // Each minibatch depends on the last one to use the same transform buffer
     dep_event = status.event;
+    buffer_events[buffer] = {dep_event};
+    output_events = {dep_event};
     if (status.status != StatusCode::OK) {
       return status;
     }
@@ -215,6 +409,97 @@ static SNNStatus launch_im2col_for_all_minibatches(
   return SNNStatus{dep_event, StatusCode::OK};
 }
 
+/**
+ * Loop over the minibatches to compute the im2col filter backprop.
+ *
+ * If there is a partial gradient buffer for every minibatch after the first
+ * then the minibatches do not depend on each other, and the partial gradients
+ * are summed into the output with a tree reduction. Otherwise each minibatch
+ * accumulates into the output in turn. The grouped minibatches always share
+ * the buffer holding the gradient before it is transposed, so the kernels
+ * writing to it are chained. The filter backprop has no epilogue.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+static SNNStatus launch_im2col_for_minibatches(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Epilogue<T, Backend> const& /*epilogue*/,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
+  auto const buffered_info = double_buffer_batch_info(batch_info, params.batch);
+  auto const transform_sizes = get_transform_sizes<ConvType>(params);
+  size_t const buffer_size =
+      buffered_info.images_per_batch * (transform_sizes.input_transform_size +
+                                        transform_sizes.output_transform_size);
+  size_t const partial_size = get_sizes<ConvType>(params).output_size;
+  bool const use_partials = buffered_info.n_batches > 1 &&
+                            pointers.n_partials + 1 >= buffered_info.n_batches;
+
+  auto kernel_params = get_kernel_params<ConvType>(params);
+  kernel_params.batch = buffered_info.images_per_batch;
+
+  std::vector<cl::sycl::event> buffer_events[2] = {events, events};
+  std::vector<cl::sycl::event> output_events;
+  std::vector<cl::sycl::event> partial_events;
+  cl::sycl::event dep_event;
+  for (size_t i = 0; i < buffered_info.n_batches; ++i) {
+    auto offset =
+        calculate_offsets<ConvType>(i, buffered_info.images_per_batch, params);
+    if (i == buffered_info.n_batches - 1) {
+      kernel_params.batch = buffered_info.last_batch_size;
+    }
+    size_t const buffer = i % buffered_info.n_buffers;
+    auto minibatch_pointers = pointers;
+    minibatch_pointers.transform = pointers.transform + buffer * buffer_size;
+    auto gradient = pointers.output;
+    if (use_partials && i > 0) {
+      gradient = pointers.partials + (i - 1) * partial_size;
+    }
+    bool const accumulate = !use_partials && i > 0;
+    auto status = launch_im2col_for_minibatch(
+        minibatch_pointers, offset.in, offset.out, gradient, accumulate,
+        tile_info, kernel_params, backend, buffer_events[buffer],
+        output_events);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    dep_event = status.event;
+    buffer_events[buffer] = {dep_event};
+    if (use_partials) {
+      partial_events.push_back(dep_event);
+    }
+    if (!use_partials || params.groups > 1) {
+      output_events = {dep_event};
+    }
+  }
+  if (use_partials) {
+    return launch_partial_reduction<T>(pointers.output, pointers.partials,
+                                       partial_size,
+                                       buffered_info.n_batches - 1, backend,
+                                       partial_events);
+  }
+  return SNNStatus{dep_event, StatusCode::OK};
+}
+
+/** Transform the filter then loop over the minibatches to compute im2col. */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_im2col_for_all_minibatches(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
+  auto filter_status =
+      launch_filter_transform(pointers, params, backend, events);
+  if (filter_status.status != StatusCode::OK) {
+    return filter_status;
+  }
+  return launch_im2col_for_minibatches(use_filter_transform(pointers, params),
+                                       tile_info, batch_info, params, epilogue,
+                                       backend, {filter_status.event});
+}
+
 /**
  * Split the input tensor into minibatches to ensure that the temporary
  * transform buffer can be safely allocated and create SYCL buffers using the
@@ -225,8 +510,8 @@ SNNStatus allocate_and_launch_im2col(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
   InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
 
   auto const tile_info = im2col::get_tile_info<ConvType>(params);
@@ -235,12 +520,14 @@ SNNStatus allocate_and_launch_im2col(
   im2col::AllocatedPointerSet<T, Backend, ConvType> all_pointers{
       pointers, size_per_image, params, backend};
 
+  size_t const alloc_size_per_image =
+      size_per_image + im2col::output_transform_size<ConvType>(params);
   auto const batch_info = get_batch_info(all_pointers.allocated_transform_size,
-                                         params.batch, size_per_image);
+                                         params.batch, alloc_size_per_image);
 
   const auto launch_status = im2col::launch_im2col_for_all_minibatches(
       all_pointers.to_full_pointer_set(), tile_info, batch_info, params,
-      backend, events);
+      epilogue, backend, events);
   all_pointers.pass_event_to_ptrs(launch_status.event);
   return launch_status;
 }
@@ -257,7 +544,8 @@ SNNStatus launch_im2col_with_workspace(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
 
@@ -272,11 +560,158 @@ SNNStatus launch_im2col_with_workspace(
 
   return im2col::launch_im2col_for_all_minibatches(
       all_pointers.to_full_pointer_set(), tile_info, batch_info, params,
-      backend, events);
+      epilogue, backend, events);
+}
+
+/**
+ * Get the parameters to use when computing a convolution with im2col.
+ *
+ * Degenerate case of depthwise convolution where the feature_multiplier==1.
+ * In this case the input and filter dimensions become NHWG and HWG
+ * respectively. Thus, the groups are interleaved into the data and an
+ * interleaved batch_matmul can be used. This prevents us from having to do
+ * a filter and output transpose.
+ *
+ * The filter backprop has to accumulate across minibatches, which is only
+ * implemented for strided groups, so it is left unchanged.
+ */
+template <typename Backend, typename ConvType = conv_type::Forward>
+Conv2DParams get_im2col_params(Conv2DParams const& params) {
+  Conv2DParams im2col_params = params;
+  if (sycldnn::backend::supports_interleaved_matmul<Backend>::value &&
+      !std::is_same<ConvType, conv_type::FilterBackprop>::value &&
+      (params.groups == params.channels) &&
+      (params.groups == params.features) &&
+      params.group_format == sycldnn::BatchFormat::STRIDED &&
+      params.filter_format == sycldnn::FilterFormat::HWCF) {
+    im2col_params.group_format = sycldnn::BatchFormat::INTERLEAVED;
+  }
+  return im2col_params;
+}
+
+/**
+ * Transform a forward convolution filter into the layout used by the im2col
+ * matrix multiplies, so that it can be reused across many convolutions.
+ *
+ * Filters which are used as they are by im2col are copied into the transform.
+ */
+template <typename T, typename Backend>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto const im2col_params = get_im2col_params<Backend>(params);
+  size_t const filter_size =
+      get_sizes<conv_type::Forward>(params).filter_size;
+  auto filter_mem = backend.get_mem_object(filter, filter_size);
+  auto transform_mem = backend.get_mem_object(transform, filter_size);
+  auto queue = backend.get_queue();
+  if (filter_transform_size<conv_type::Forward>(im2col_params) == 0) {
+    return sycldnn::transpose::internal::launch(
+        filter_mem, transform_mem, {static_cast<int>(filter_size)}, {0}, queue,
+        events);
+  }
+  return launch_grouped_filter_transform(filter_mem, transform_mem,
+                                         im2col_params, queue, events);
+}
+
+/**
+ * Compute a forward convolution with im2col, using a filter which has already
+ * been transformed with transform_filter().
+ *
+ * No filter transform is launched, and no space for it is needed in the
+ * workspace. A non-identity epilogue is applied by the matmul, so must only
+ * be given if can_fuse_matmul_epilogue() holds.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed_filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using ConvType = conv_type::Forward;
+  auto const im2col_params = get_im2col_params<Backend>(params);
+  InternalPointerSet<T, Backend> pointers{input, transformed_filter, output,
+                                          backend};
+
+  auto const tile_info = get_tile_info<ConvType>(im2col_params);
+  size_t const size_per_image =
+      im2col_params.groups * tile_info.number * tile_info.size;
+  constexpr bool filter_transformed = true;
+
+  if (workspace_size == 0) {
+    AllocatedPointerSet<T, Backend, ConvType> all_pointers{
+        pointers, size_per_image, im2col_params, backend, filter_transformed};
+    auto const batch_info =
+        get_batch_info(all_pointers.allocated_transform_size,
+                       im2col_params.batch, size_per_image);
+    auto const status = launch_im2col_for_minibatches(
+        all_pointers.to_full_pointer_set(), tile_info, batch_info,
+        im2col_params, epilogue, backend, events);
+    all_pointers.pass_event_to_ptrs(status.event);
+    return status;
+  }
+  WorkspacePointerSet<T, Backend, ConvType> all_pointers{
+      pointers,       workspace, size_per_image,    im2col_params,
+      workspace_size, backend,   filter_transformed};
+  auto const batch_info =
+      get_batch_info(all_pointers.minibatch_size, im2col_params.batch);
+  return launch_im2col_for_minibatches(all_pointers.to_full_pointer_set(),
+                                       tile_info, batch_info, im2col_params,
+                                       epilogue, backend, events);
 }
 
 }  // namespace im2col
 
+/**
+ * The internal im2col convolution launcher, applying an epilogue in the
+ * matmul which computes the output.
+ *
+ * Use im2col to compute a convolution, by transforming the input data then
+ * computing a matrix multiply with the filter to give the output. A
+ * non-identity epilogue must only be given if can_fuse_matmul_epilogue()
+ * holds.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_im2col_fused(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  // Only the forward, ungrouped transform has an NCHW implementation.
+  if (params.input_format == DataFormat::NCHW &&
+      (params.groups != 1 ||
+       !std::is_same<ConvType, conv_type::Forward>::value)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  // Grouped backprop transforms assume an HWCF filter, and the filter
+  // backprop only supports strided groups.
+  if (params.groups != 1 &&
+      !std::is_same<ConvType, conv_type::Forward>::value &&
+      (params.filter_format != sycldnn::FilterFormat::HWCF ||
+       (std::is_same<ConvType, conv_type::FilterBackprop>::value &&
+        params.group_format != sycldnn::BatchFormat::STRIDED))) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto const im2col_params =
+      im2col::get_im2col_params<Backend, ConvType>(params);
+  if (workspace_size == 0) {
+    return im2col::allocate_and_launch_im2col<T, ConvType>(
+        input, filter, output, im2col_params, epilogue, backend, events);
+  } else {
+    return im2col::launch_im2col_with_workspace<T, ConvType>(
+        input, filter, output, workspace, im2col_params, workspace_size,
+        epilogue, backend, events);
+  }
+}
+
 /**
  * The internal im2col convolution launcher.
  *
@@ -291,39 +726,10 @@ SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
                         Conv2DParams const& params, size_t workspace_size,
                         Backend& backend,
                         const std::vector<cl::sycl::event>& events) {
-  if (sycldnn::backend::supports_interleaved_matmul<Backend>::value &&
-      (params.groups == params.channels) &&
-      (params.groups == params.features) &&
-      params.group_format == sycldnn::BatchFormat::STRIDED &&
-      params.filter_format == sycldnn::FilterFormat::HWCF) {
-    /**
-     * Degenerate case of depthwise convolution where the feature_multiplier==1.
-     * In this case the input and filter dimensions become NHWG and HWG
-     * respectively. Thus, the groups are interleaved into the data and an
-     * interleaved batch_matmul can be used. This prevents us from having to do
-     * a filter and output transpose.
-     */
-
-    Conv2DParams interleaved_params = params;
-    interleaved_params.group_format = sycldnn::BatchFormat::INTERLEAVED;
-    if (workspace_size == 0) {
-      return im2col::allocate_and_launch_im2col<T, ConvType>(
-          input, filter, output, interleaved_params, backend, events);
-    } else {
-      return im2col::launch_im2col_with_workspace<T, ConvType>(
-          input, filter, output, workspace, interleaved_params, workspace_size,
-          backend, events);
-    }
-  }
-
-  if (workspace_size == 0) {
-    return im2col::allocate_and_launch_im2col<T, ConvType>(
-        input, filter, output, params, backend, events);
-  } else {
-    return im2col::launch_im2col_with_workspace<T, ConvType>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
-  }
+  return launch_im2col_fused<T, ConvType>(input, filter, output, workspace,
+                                          params, workspace_size,
+                                          Epilogue<T, Backend>{}, backend,
+                                          events);
 }
 }  // namespace internal
 }  // namespace conv2d
@@ -16,9 +16,12 @@
 #ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_ALLOCATED_POINTER_SET_H_
 #define PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_ALLOCATED_POINTER_SET_H_
 
+#include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
 
 #include "portdnn/internal/conv2d/alloc_info.h"
+#include "portdnn/internal/conv2d/batch_info.h"
 
 #include "portdnn/internal/conv2d/im2col/full_pointer_set.h"
 #include "portdnn/internal/conv2d/im2col/transform_sizes.h"
@@ -34,7 +37,9 @@ namespace im2col {
  * Set of all pointers required for im2col.
  *
  * Will allocate a temporary buffer for the input transform on construction,
- * which will be automatically deallocated on destruction.
+ * which will be automatically deallocated on destruction. If the filter has
+ * already been transformed then no space is allocated for the filter
+ * transform.
  */
 template <typename T, typename Backend, typename ConvType>
 struct AllocatedPointerSet {
@@ -46,9 +51,9 @@ struct AllocatedPointerSet {
 
   AllocatedPointerSet(InternalPointerSet<T, Backend> const& set,
                       size_t size_per_image, Conv2DParams const& params,
-                      Backend& backend)
-      : allocated_transform_size{get_transform_size(size_per_image, params,
-                                                    backend)},
+                      Backend& backend, bool filter_transformed = false)
+      : allocated_transform_size{get_transform_size(
+            size_per_image, params, filter_transformed, backend)},
         input{set.input.get()},
         filter{set.filter.get()},
         transform{sizeof(T) * allocated_transform_size, backend},
@@ -72,7 +77,7 @@ struct AllocatedPointerSet {
  private:
   static size_t get_transform_size(size_t size_per_image,
                                    Conv2DParams const& params,
-                                   Backend& backend) {
+                                   bool filter_transformed, Backend& backend) {
     auto queue = backend.get_queue();
     auto device = queue.get_device();
 
@@ -83,18 +88,17 @@ struct AllocatedPointerSet {
     auto const transform_sizes = get_transform_sizes<ConvType>(params);
     auto const alloc_size_per_image =
         size_per_image + transform_sizes.output_transform_size;
+    size_t const filter_size =
+        filter_transformed ? 0 : transform_sizes.filter_transform_size;
 
-    SNN_ASSERT(alloc_size_per_image + transform_sizes.filter_transform_size <
-                   alloc_limit,
+    SNN_ASSERT(alloc_size_per_image + filter_size < alloc_limit,
                "There is not enough available memory to safely allocate "
                "transformation memory for a single image");
 
     size_t const images_per_alloc =
-        std::min((alloc_limit - transform_sizes.filter_transform_size) /
-                     alloc_size_per_image,
+        std::min((alloc_limit - filter_size) / alloc_size_per_image,
                  static_cast<size_t>(params.batch));
-    return images_per_alloc * alloc_size_per_image +
-           transform_sizes.filter_transform_size;
+    return images_per_alloc * alloc_size_per_image + filter_size;
   }
 };
 
@@ -116,8 +120,10 @@ struct AllocatedPointerSet<T, Backend, conv_type::InputBackprop> {
   AllocatedPointerSet(InternalPointerSet<T, Backend> const& set,
                       size_t size_per_image, Conv2DParams const& params,
                       Backend& backend)
-      : allocated_transform_size{get_transform_size(size_per_image,
-                                                    params.batch, backend)},
+      : allocated_transform_size{get_transform_size(
+            size_per_image +
+                output_transform_size<conv_type::InputBackprop>(params),
+            params.batch, backend)},
         input{set.input.get()},
         original_filter{set.filter.get()},
         filter{
@@ -155,6 +161,109 @@ struct AllocatedPointerSet<T, Backend, conv_type::InputBackprop> {
   }
 };
 
+/**
+ * Set of all pointers required for filter backprop.
+ *
+ * Will allocate a temporary buffer for the input transform on construction,
+ * which will be automatically deallocated on destruction. If the allocation
+ * limit leaves room then the buffer also holds a partial gradient for each
+ * minibatch after the first, so that the minibatches can run concurrently
+ * before the partial gradients are summed.
+ */
+template <typename T, typename Backend>
+struct AllocatedPointerSet<T, Backend, conv_type::FilterBackprop> {
+  using ConvType = conv_type::FilterBackprop;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  AllocatedPointerSet(InternalPointerSet<T, Backend> const& set,
+                      size_t size_per_image, Conv2DParams const& params,
+                      Backend& backend)
+      : allocated_transform_size{get_transform_size(
+            size_per_image + output_transform_size<ConvType>(params), params,
+            backend)},
+        n_partials{get_n_partials(
+            size_per_image + output_transform_size<ConvType>(params), params,
+            allocated_transform_size, backend)},
+        input{set.input.get()},
+        filter{set.filter.get()},
+        transform{sizeof(T) * (allocated_transform_size +
+                               n_partials * partial_size(params)),
+                  backend},
+        output{set.output.get()} {}
+
+  FullPointerSet<T, Backend, ConvType> to_full_pointer_set() {
+    FullPointerSet<T, Backend, ConvType> pointers{input, filter,
+                                                  transform.get(), output};
+    pointers.partials = transform.get() + allocated_transform_size;
+    pointers.n_partials = n_partials;
+    return pointers;
+  }
+
+  /** Add events to pointer on which to wait for before releasing memory */
+  inline void pass_event_to_ptrs(const cl::sycl::event& event) {
+    transform.set_event(event);
+  }
+
+  size_t allocated_transform_size;
+  size_t n_partials;
+  ConstPointer input;
+  ConstPointer filter;
+  AllocatedPointer transform;
+  Pointer output;
+
+ private:
+  static size_t alloc_limit(Backend& backend) {
+    auto queue = backend.get_queue();
+    auto device = queue.get_device();
+    size_t const max_alloc_bytes =
+        device.template get_info<cl::sycl::info::device::max_mem_alloc_size>();
+    return max_alloc_bytes / sizeof(T);
+  }
+
+  static size_t partial_size(Conv2DParams const& params) {
+    return get_sizes<ConvType>(params).output_size;
+  }
+
+  static size_t get_transform_size(size_t alloc_size_per_image,
+                                   Conv2DParams const& params,
+                                   Backend& backend) {
+    size_t const limit = alloc_limit(backend);
+    size_t const filter_size = filter_transform_size<ConvType>(params);
+
+    SNN_ASSERT(alloc_size_per_image + filter_size < limit,
+               "There is not enough available memory to safely allocate "
+               "transformation memory for a single image");
+
+    size_t const images_per_alloc =
+        std::min((limit - filter_size) / alloc_size_per_image,
+                 static_cast<size_t>(params.batch));
+    return images_per_alloc * alloc_size_per_image + filter_size;
+  }
+
+  /**
+   * Get the number of partial gradients to allocate after the transforms, or
+   * zero if they would take the allocation over the limit and the minibatches
+   * must accumulate into the output in turn.
+   */
+  static size_t get_n_partials(size_t alloc_size_per_image,
+                               Conv2DParams const& params,
+                               size_t transform_size, Backend& backend) {
+    auto const batch_info =
+        get_batch_info(transform_size, params.batch, alloc_size_per_image);
+    size_t const n_partials =
+        double_buffer_batch_info(batch_info, params.batch).n_batches - 1;
+    if (transform_size + n_partials * partial_size(params) >
+        alloc_limit(backend)) {
+      return 0;
+    }
+    return n_partials;
+  }
+};
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
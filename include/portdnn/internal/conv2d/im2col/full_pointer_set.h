@@ -16,6 +16,10 @@
 #ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_FULL_POINTER_SET_H_
 #define PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_FULL_POINTER_SET_H_
 
+#include "portdnn/conv2d/conv_type.h"
+
+#include <stddef.h>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -55,6 +59,46 @@ struct FullPointerSet<T, Backend, conv_type::InputBackprop> {
   Pointer output;
 };
 
+/**
+ * Set of all pointers required for im2col filter backprop.
+ *
+ * Grouped filter backprop computes the filter gradient for all groups in a
+ * temporary buffer before transposing it into the output, so needs an
+ * additional pointer to that buffer.
+ *
+ * When there is room for them, the minibatches after the first each write a
+ * separate partial gradient to the `n_partials` buffers at `partials`, which
+ * are then summed into the output.
+ */
+template <typename T, typename Backend>
+struct FullPointerSet<T, Backend, conv_type::FilterBackprop> {
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+
+  FullPointerSet(ConstPointer input, ConstPointer filter, Pointer transform,
+                 Pointer output)
+      : FullPointerSet{input, filter, transform, output, transform} {}
+
+  FullPointerSet(ConstPointer input, ConstPointer filter, Pointer transform,
+                 Pointer output, Pointer filter_transform)
+      : input{input},
+        filter{filter},
+        transform{transform},
+        output{output},
+        filter_transform{filter_transform},
+        partials{},
+        n_partials{0} {}
+
+  ConstPointer input;
+  ConstPointer filter;
+  Pointer transform;
+  Pointer output;
+  Pointer filter_transform;
+  Pointer partials;
+  size_t n_partials;
+};
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
@@ -52,8 +52,36 @@ SNN_EXPORT SNNStatus launch_filter_transform(
     cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
 
 /**
- * For forward and filter backprop the original filter is used,
- *  so just return.*/
+ * Launch the transpose which makes the filter for each group contiguous in a
+ * grouped HWCF filter, as required by the batched matrix multiply.
+ *
+ * \param [in]  filter    User provided filter tensor
+ * \param [out] transform Filter transform tensor to fill with the transposed
+ *                        filter values
+ * \param [in]  params    Kernel parameters for the convolution
+ * \param [in]  queue     SYCL queue to enqueue the kernel to
+ * \param [in]  events    Events to wait on before launching the kernel
+ * \return An SNNStatus with event linked to the kernel launch or an error code.
+ */
+template <typename T, template <typename> class MemObj>
+SNNStatus launch_grouped_filter_transform(
+    MemObj<T const>& filter, MemObj<T>& transform, Conv2DParams const& params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  int const features_per_group = params.features / params.groups;
+  int const channels_per_group = params.channels / params.groups;
+  const std::vector<int> HWCGF_TO_HWCFG = {3, 0, 1, 2, 4};
+  return sycldnn::transpose::internal::launch(
+      filter, transform,
+      {params.window_rows, params.window_cols, channels_per_group,
+       params.groups, features_per_group},
+      HWCGF_TO_HWCFG, queue, events);
+}
+
+/**
+ * For forward the original filter is used unless the groups need to be made
+ * contiguous. The filter backprop has no filter to transform, as the filter
+ * transform buffer is only used to hold the grouped filter gradient.
+ */
 template <typename T, typename ConvType, typename Backend,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::InputBackprop>::value,
@@ -63,7 +91,8 @@ static SNNStatus launch_filter_transform(
     Conv2DParams const& params, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   auto queue = backend.get_queue();
-  if (filter_transform_size<ConvType>(params) == 0)
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value ||
+      filter_transform_size<ConvType>(params) == 0)
     return {sycldnn::helpers::multi_event_to_one(events, queue),
             StatusCode::OK};
 
@@ -72,18 +101,13 @@ static SNNStatus launch_filter_transform(
           params.filter_format == sycldnn::FilterFormat::HWCF,
       "Interleaved group format is only supported for HWCF filter format.");
 
-  int const features_per_group = params.features / params.groups;
   int const channels_per_group = params.channels / params.groups;
   int const total_size = params.window_rows * params.window_cols *
                          channels_per_group * params.features;
   auto in_mem_obj = backend.get_mem_object(pointers.filter, total_size);
   auto out_mem_obj = backend.get_mem_object(pointers.transform, total_size);
-  const std::vector<int> HWCGF_TO_HWCFG = {3, 0, 1, 2, 4};
-  return sycldnn::transpose::internal::launch(
-      in_mem_obj, out_mem_obj,
-      {params.window_rows, params.window_cols, channels_per_group,
-       params.groups, features_per_group},
-      HWCGF_TO_HWCFG, queue, events);
+  return launch_grouped_filter_transform(in_mem_obj, out_mem_obj, params, queue,
+                                         events);
 }
 
 /**
@@ -100,8 +124,7 @@ static SNNStatus launch_filter_transform(
     FullPointerSet<T, Backend, ConvType> const& pointers,
     Conv2DParams const& params, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
-  size_t const filter_size = params.window_rows * params.window_cols *
-                             params.channels * params.features;
+  size_t const filter_size = filter_transform_size<ConvType>(params);
   auto filter_access =
       backend.get_mem_object_internal(pointers.original_filter, filter_size);
 
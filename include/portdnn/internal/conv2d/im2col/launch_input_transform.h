@@ -72,7 +72,7 @@ static SNNStatus launch_input_transform(
     n_tiles = params.batch * tile_info.number;
     tile_size = tile_info.size;
   }
-  size_t const transform_size = n_tiles * tile_size;
+  size_t const transform_size = params.groups * n_tiles * tile_size;
   auto transform_acc = backend.get_mem_object_internal(
       pointers.transform + out_offset, transform_size);
 
@@ -56,13 +56,14 @@ inline TileInfo get_tile_info<conv_type::InputBackprop>(
     Conv2DParams const& params) {
   const int n_tiles = params.in_rows * params.in_cols;
   const int tile_size =
-      params.window_rows * params.window_cols * params.features;
+      params.window_rows * params.window_cols * params.features / params.groups;
   return TileInfo{n_tiles, tile_size};
 }
 template <>
 inline TileInfo get_tile_info<conv_type::FilterBackprop>(
     Conv2DParams const& params) {
-  const int n_tiles = params.window_rows * params.window_cols * params.channels;
+  const int n_tiles =
+      params.window_rows * params.window_cols * params.channels / params.groups;
   const int tile_size = params.out_rows * params.out_cols;
   return TileInfo{n_tiles, tile_size};
 }
@@ -51,17 +51,36 @@ size_t filter_transform_size(Conv2DParams const& params) {
 }
 
 template <>
-size_t filter_transform_size<conv_type::InputBackprop>(
+inline size_t filter_transform_size<conv_type::InputBackprop>(
     Conv2DParams const& params) {
   return params.window_rows * params.window_cols * params.channels *
          params.features / params.groups;
 }
 
-/** Get the tensor size needed for the output transform. */
+/**
+ * Grouped filter backprop computes the filter gradient with the groups as the
+ * outer dimension, and needs a second buffer of the same size to transpose it
+ * into before accumulating into the output.
+ */
+template <>
+inline size_t filter_transform_size<conv_type::FilterBackprop>(
+    Conv2DParams const& params) {
+  if (params.groups == 1) {
+    return 0;
+  }
+  return 2 * params.window_rows * params.window_cols * params.channels *
+         params.features / params.groups;
+}
+
+/**
+ * Get the tensor size needed for the output transform.
+ *
+ * For the filter backprop this holds the output gradient, transposed so that
+ * the values for each group are contiguous.
+ */
 template <typename ConvType>
 size_t output_transform_size(Conv2DParams const& params) {
-  if (!std::is_same<ConvType, conv_type::Forward>::value ||
-      params.groups == 1 ||
+  if (params.groups == 1 ||
       (params.group_format == sycldnn::BatchFormat::INTERLEAVED &&
        params.filter_format == sycldnn::FilterFormat::HWCF)) {
     return 0;
@@ -69,6 +88,16 @@ size_t output_transform_size(Conv2DParams const& params) {
   return params.out_rows * params.out_cols * params.features;
 }
 
+template <>
+inline size_t output_transform_size<conv_type::InputBackprop>(
+    Conv2DParams const& params) {
+  if (params.groups == 1 ||
+      params.group_format == sycldnn::BatchFormat::INTERLEAVED) {
+    return 0;
+  }
+  return params.in_rows * params.in_cols * params.channels;
+}
+
 /** Get the tensor size needed for the input transform. */
 template <typename ConvType>
 size_t input_transform_size(Conv2DParams const& params) {
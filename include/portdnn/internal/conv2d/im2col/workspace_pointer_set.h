@@ -16,15 +16,21 @@
 #ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_WORKSPACE_POINTER_SET_H_
 #define PORTDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_WORKSPACE_POINTER_SET_H_
 
+#include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
 
 #include "portdnn/internal/conv2d/alloc_info.h"
+#include "portdnn/internal/conv2d/batch_info.h"
+#include "portdnn/internal/conv2d/partial_reduction.h"
 
 #include "portdnn/internal/conv2d/im2col/full_pointer_set.h"
 #include "portdnn/internal/conv2d/im2col/transform_sizes.h"
 
 #include "portdnn/internal/helpers/allocated_pointer.h"
 
+#include <algorithm>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -33,7 +39,9 @@ namespace im2col {
 /**
  * Set of all pointers required for im2col.
  *
- * Will use the given workspace to provide any required temporary buffers.
+ * Will use the given workspace to provide any required temporary buffers. If
+ * the filter has already been transformed then no space is set aside for the
+ * filter transform.
  */
 template <typename T, typename Backend, typename ConvType>
 struct WorkspacePointerSet {
@@ -46,9 +54,10 @@ struct WorkspacePointerSet {
   WorkspacePointerSet(InternalPointerSet<T, Backend> const& set,
                       typename Backend::template pointer_type<T> workspace,
                       size_t size_per_image, Conv2DParams const& params,
-                      size_t workspace_size, Backend& backend)
+                      size_t workspace_size, Backend& backend,
+                      bool filter_transformed = false)
       : minibatch_size{get_minibatch_size(workspace_size, size_per_image,
-                                          params)},
+                                          params, filter_transformed)},
         input{set.input.get()},
         filter{set.filter.get()},
         transform{workspace, backend},
@@ -67,9 +76,12 @@ struct WorkspacePointerSet {
  private:
   /** Get the size of minibatch to use for the given workspace size. */
   static size_t get_minibatch_size(size_t workspace_size, size_t size_per_image,
-                                   Conv2DParams const& params) {
+                                   Conv2DParams const& params,
+                                   bool filter_transformed) {
     auto const transform_sizes = get_transform_sizes<ConvType>(params);
-    return (workspace_size - transform_sizes.filter_transform_size) /
+    size_t const filter_size =
+        filter_transformed ? 0 : transform_sizes.filter_transform_size;
+    return (workspace_size - filter_size) /
            (size_per_image + transform_sizes.output_transform_size);
   }
 };
@@ -99,7 +111,8 @@ struct WorkspacePointerSet<T, Backend, conv_type::InputBackprop> {
       : minibatch_size{get_minibatch_size(
             workspace_size,
             filter_transform_size<conv_type::InputBackprop>(params),
-            size_per_image)},
+            size_per_image +
+                output_transform_size<conv_type::InputBackprop>(params))},
         input{set.input.get()},
         original_filter{set.filter.get()},
         filter{workspace, backend},
@@ -128,6 +141,109 @@ struct WorkspacePointerSet<T, Backend, conv_type::InputBackprop> {
   }
 };
 
+/**
+ * /copydoc WorkspacePointerSet
+ *
+ * The filter backprop minibatches accumulate into the filter gradient. If the
+ * workspace has room then the minibatch is reduced so that each minibatch
+ * after the first can write a separate partial gradient to the end of the
+ * workspace, letting the minibatches run concurrently before the partial
+ * gradients are summed.
+ */
+template <typename T, typename Backend>
+struct WorkspacePointerSet<T, Backend, conv_type::FilterBackprop> {
+  using ConvType = conv_type::FilterBackprop;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+
+  WorkspacePointerSet(InternalPointerSet<T, Backend> const& set,
+                      typename Backend::template pointer_type<T> workspace,
+                      size_t size_per_image, Conv2DParams const& params,
+                      size_t workspace_size, Backend& backend)
+      : minibatch_size{get_minibatch_size(
+            workspace_size,
+            size_per_image + output_transform_size<ConvType>(params),
+            params)},
+        n_partials{get_n_partials(
+            workspace_size,
+            size_per_image + output_transform_size<ConvType>(params), params,
+            minibatch_size)},
+        input{set.input.get()},
+        filter{set.filter.get()},
+        transform{workspace, backend},
+        output{set.output.get()},
+        partials{workspace + filter_transform_size<ConvType>(params) +
+                     minibatch_size * (size_per_image +
+                                       output_transform_size<ConvType>(params)),
+                 backend} {}
+
+  FullPointerSet<T, Backend, ConvType> to_full_pointer_set() {
+    FullPointerSet<T, Backend, ConvType> pointers{input, filter,
+                                                  transform.get(), output};
+    pointers.partials = partials.get();
+    pointers.n_partials = n_partials;
+    return pointers;
+  }
+
+  size_t minibatch_size;
+  size_t n_partials;
+  ConstPointer input;
+  ConstPointer filter;
+  InternalPointer transform;
+  Pointer output;
+  InternalPointer partials;
+
+ private:
+  /**
+   * Get the size of minibatch to use for the given workspace size, giving up
+   * to half of it to make room for the partial gradients.
+   *
+   * The first minibatch writes straight into the output, so one fewer partial
+   * gradient than minibatches is stored in the workspace.
+   */
+  static size_t get_minibatch_size(size_t workspace_size, size_t size_per_image,
+                                   Conv2DParams const& params) {
+    size_t const transform_workspace_size =
+        workspace_size - filter_transform_size<ConvType>(params);
+    size_t const minibatch_size = std::min<size_t>(
+        transform_workspace_size / size_per_image, params.batch);
+    size_t const partial_size = get_sizes<ConvType>(params).output_size;
+    size_t const partial_minibatch = partial_minibatch_size(
+        transform_workspace_size + partial_size, params.batch, size_per_image,
+        partial_size, minibatch_size);
+    return partial_minibatch > 0 ? partial_minibatch : minibatch_size;
+  }
+
+  /**
+   * Get the number of partial gradients to store after the transforms, or
+   * zero if they do not all fit and the minibatches must accumulate into the
+   * output in turn.
+   */
+  static size_t get_n_partials(size_t workspace_size, size_t size_per_image,
+                               Conv2DParams const& params,
+                               size_t minibatch_size) {
+    if (minibatch_size == 0) {
+      return 0;
+    }
+    size_t const n_batches =
+        double_buffer_batch_info(get_batch_info(minibatch_size, params.batch),
+                                 params.batch)
+            .n_batches;
+    size_t const n_partials = n_batches - 1;
+    size_t const transform_workspace_size =
+        workspace_size - filter_transform_size<ConvType>(params);
+    size_t const partial_size = get_sizes<ConvType>(params).output_size;
+    if (minibatch_size * size_per_image + n_partials * partial_size >
+        transform_workspace_size) {
+      return 0;
+    }
+    return n_partials;
+  }
+};
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
@@ -27,11 +27,15 @@
 
 #include "portdnn/backend/backend_helpers.h"
 #include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 #include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/workspace_size.h"
 
 #include "portdnn/conv2d/implementation/direct.h"
 #include "portdnn/conv2d/implementation/im2col.h"
+#include "portdnn/conv2d/implementation/implicit_gemm.h"
+#include "portdnn/conv2d/implementation/local_tiled.h"
 #include "portdnn/conv2d/implementation/matmul.h"
 #include "portdnn/conv2d/implementation/tiled.h"
 #include "portdnn/conv2d/implementation/winograd.h"
@@ -39,7 +43,7 @@
 namespace sycldnn {
 namespace conv2d {
 
-SNNStatus validate_params(Conv2DParams const& params) {
+inline SNNStatus validate_params(Conv2DParams const& params) {
   SNN_VALIDATE_PARAM(params.batch > 0,
                      "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(params.channels > 0,
@@ -73,10 +77,11 @@ SNNStatus validate_params(Conv2DParams const& params) {
                      "Channels must be divisble by groups.");
   SNN_VALIDATE_PARAM(params.features % params.groups == 0,
                      "Features must be divisble by groups.");
-  SNN_VALIDATE_PARAM(params.dilation_rows == 1,
-                     "Currently portDNN only supports dilation 1.");
-  SNN_VALIDATE_PARAM(params.dilation_cols == 1,
-                     "Currently portDNN only supports dilation 1.");
+  SNN_VALIDATE_PARAM(params.dilation_rows > 0,
+                     "The dilation in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(
+      params.dilation_cols > 0,
+      "The dilation in the column direction must be positive.");
 
   auto implies = [](bool x, bool y) { return !x || y; };
   SNN_VALIDATE_PARAM(implies(params.input_format == DataFormat::NHWC,
@@ -103,27 +108,39 @@ SNNStatus select_and_launch(
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Algorithm& algo_tag, Backend& backend,
     typename Backend::template pointer_type<T> workspace,
-    size_t workspace_size) {
+    size_t workspace_size, Epilogue<T, Backend> const& epilogue) {
   switch (algo_tag) {
     case Algorithm::Direct:
-      return launch_direct<T, ConvType>(input, filter, output, params, backend,
-                                        {});
+      return launch_direct<T, ConvType>(input, filter, output, params,
+                                        epilogue, backend, {});
     case Algorithm::Tiled:
-      return launch_tiled<T, ConvType>(input, filter, output, params, backend,
-                                       {});
+      return launch_tiled<T, ConvType>(input, filter, output, params, epilogue,
+                                       backend, {});
     case Algorithm::Im2col:
       return launch_im2col<T, ConvType>(input, filter, output, workspace,
-                                        params, workspace_size, backend, {});
+                                        params, workspace_size, epilogue,
+                                        backend, {});
     case Algorithm::Winograd:
       return launch_winograd<T, ConvType>(input, filter, output, workspace,
-                                          params, workspace_size, backend, {});
+                                          params, workspace_size, epilogue,
+                                          backend, {});
     case Algorithm::WinogradLarge:
-      return launch_winograd_large<T, ConvType>(input, filter, output,
-                                                workspace, params,
-                                                workspace_size, backend, {});
+      return launch_winograd_large<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, epilogue,
+          backend, {});
+    case Algorithm::WinogradFused:
+      return launch_winograd_fused<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, epilogue,
+          backend, {});
     case Algorithm::Matmul:
-      return launch_matmul<T, ConvType>(input, filter, output, params, backend,
-                                        {});
+      return launch_matmul<T, ConvType>(input, filter, output, params,
+                                        epilogue, backend, {});
+    case Algorithm::ImplicitGemm:
+      return launch_implicit_gemm<T, ConvType>(input, filter, output, params,
+                                               epilogue, backend, {});
+    case Algorithm::LocalTiled:
+      return launch_local_tiled<T, ConvType>(input, filter, output, params,
+                                             epilogue, backend, {});
     case Algorithm::NotSupported:
     default:
       return StatusCode::InvalidAlgorithm;
@@ -137,30 +154,41 @@ SNNStatus select_and_launch_usm(
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Algorithm& algo_tag, Backend& backend,
     typename Backend::template pointer_type<T> workspace, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue,
     const std::vector<cl::sycl::event>& events) {
   // TODO Expand switch statement with more supported USM algos
   switch (algo_tag) {
     case Algorithm::Direct:
-      return launch_direct<T, ConvType>(input, filter, output, params, backend,
-                                        events);
+      return launch_direct<T, ConvType>(input, filter, output, params,
+                                        epilogue, backend, events);
     case Algorithm::Matmul:
-      return launch_matmul<T, ConvType>(input, filter, output, params, backend,
-                                        events);
+      return launch_matmul<T, ConvType>(input, filter, output, params,
+                                        epilogue, backend, events);
+    case Algorithm::ImplicitGemm:
+      return launch_implicit_gemm<T, ConvType>(input, filter, output, params,
+                                               epilogue, backend, events);
+    case Algorithm::LocalTiled:
+      return launch_local_tiled<T, ConvType>(input, filter, output, params,
+                                             epilogue, backend, events);
     case Algorithm::Im2col:
       return launch_im2col<T, ConvType>(input, filter, output, workspace,
-                                        params, workspace_size, backend,
-                                        events);
+                                        params, workspace_size, epilogue,
+                                        backend, events);
     case Algorithm::Winograd:
       return launch_winograd<T, ConvType>(input, filter, output, workspace,
-                                          params, workspace_size, backend,
-                                          events);
+                                          params, workspace_size, epilogue,
+                                          backend, events);
     case Algorithm::WinogradLarge:
       return launch_winograd_large<T, ConvType>(
-          input, filter, output, workspace, params, workspace_size, backend,
-          events);
+          input, filter, output, workspace, params, workspace_size, epilogue,
+          backend, events);
+    case Algorithm::WinogradFused:
+      return launch_winograd_fused<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, epilogue,
+          backend, events);
     case Algorithm::Tiled:
-      return launch_tiled<T, ConvType>(input, filter, output, params, backend,
-                                       events);
+      return launch_tiled<T, ConvType>(input, filter, output, params, epilogue,
+                                       backend, events);
     default:
       return StatusCode::InvalidAlgorithm;
   }
@@ -174,23 +202,31 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> input,
                     Backend& backend,
                     typename Backend::template pointer_type<T> workspace,
                     size_t workspace_size,
+                    Epilogue<T, Backend> const& epilogue,
                     const std::vector<cl::sycl::event>& events) {
   auto status = validate_params(params);
   if (status.status != StatusCode::OK) {
     return status;
   }
-  SNN_VALIDATE_PARAM(
-      (params.groups == 1 || std::is_same<ConvType, conv_type::Forward>::value),
-      "Grouped convolution is only supported for the forward pass.");
   SNN_VALIDATE_PARAM((params.group_format != BatchFormat::INTERLEAVED) ||
                          backend::supports_interleaved_matmul<Backend>::value,
                      "The chosen backend does not support interleaved batched "
                      "matmul, used in im2col algorithm.");
+  SNN_VALIDATE_PARAM((epilogue.params.is_identity() ||
+                      std::is_same<ConvType, conv_type::Forward>::value),
+                     "Fused epilogues are only supported for the forward "
+                     "pass.");
 
   Algorithm algo_tag = selector.select<ConvType>(params);
-  if (params.input_format == DataFormat::NCHW &&
-      algo_tag != Algorithm::Direct) {
-    return StatusCode::InvalidAlgorithm;
+  // A non-empty workspace is the caller's memory budget, so fall back to an
+  // algorithm which fits it rather than failing. An empty workspace leaves
+  // the algorithms to allocate their own temporary memory.
+  if (workspace_size > 0 &&
+      internal::query_workspace_size<ConvType>(params, algo_tag)
+              .required_size > workspace_size) {
+    algo_tag = internal::select_for_workspace<ConvType>(params, selector,
+                                                        workspace_size)
+                   .algorithm;
   }
   if (params.groups > 1 && algo_tag != Algorithm::Im2col) {
     return StatusCode::InvalidAlgorithm;
@@ -198,11 +234,123 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> input,
   if constexpr (backend::is_usm_backend<Backend>::value) {
     return select_and_launch_usm<T, ConvType, Backend>(
         input, filter, output, params, algo_tag, backend, workspace,
-        workspace_size, events);
+        workspace_size, epilogue, events);
   } else {
-    return select_and_launch<T, ConvType, Backend>(input, filter, output,
-                                                   params, algo_tag, backend,
-                                                   workspace, workspace_size);
+    return select_and_launch<T, ConvType, Backend>(
+        input, filter, output, params, algo_tag, backend, workspace,
+        workspace_size, epilogue);
+  }
+}
+
+template <typename T, typename ConvType, typename Backend>
+SNNStatus sublaunch(typename Backend::template pointer_type<T const> input,
+                    typename Backend::template pointer_type<T const> filter,
+                    typename Backend::template pointer_type<T> output,
+                    Conv2DParams const& params, Selector& selector,
+                    Backend& backend,
+                    typename Backend::template pointer_type<T> workspace,
+                    size_t workspace_size,
+                    const std::vector<cl::sycl::event>& events) {
+  return sublaunch<T, ConvType, Backend>(input, filter, output, params,
+                                         selector, backend, workspace,
+                                         workspace_size,
+                                         Epilogue<T, Backend>{}, events);
+}
+
+/**
+ * Launch the mixed precision implementation of the selected algorithm, which
+ * stores its tensors as T but accumulates the convolution as ComputeT.
+ *
+ * Only the direct, tiled and Winograd algorithms have mixed precision
+ * implementations, and the Winograd algorithms also need a backend which
+ * provides batch_matmul_mixed().
+ */
+template <typename T, typename ConvType, typename ComputeT, typename Backend>
+SNNStatus select_and_launch_mixed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Algorithm algo_tag, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events) {
+  constexpr bool mixed_matmul =
+      backend::supports_mixed_precision_matmul<Backend>::value;
+  switch (algo_tag) {
+    case Algorithm::Direct:
+      return launch_direct<T, ConvType, ComputeT>(
+          input, filter, output, params, Epilogue<T, Backend>{}, backend,
+          events);
+    case Algorithm::Tiled:
+      return launch_tiled<T, ConvType, ComputeT>(input, filter, output, params,
+                                                 Epilogue<T, Backend>{},
+                                                 backend, events);
+    case Algorithm::Winograd:
+      if constexpr (mixed_matmul) {
+        return launch_winograd<T, ConvType, ComputeT>(
+            input, filter, output, workspace, params, workspace_size,
+            Epilogue<T, Backend>{}, backend, events);
+      } else {
+        return StatusCode::InvalidAlgorithm;
+      }
+    case Algorithm::WinogradLarge:
+      if constexpr (mixed_matmul) {
+        return launch_winograd_large<T, ConvType, ComputeT>(
+            input, filter, output, workspace, params, workspace_size,
+            Epilogue<T, Backend>{}, backend, events);
+      } else {
+        return StatusCode::InvalidAlgorithm;
+      }
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
+
+/**
+ * Launch a 2D convolution which stores its tensors as T, but accumulates the
+ * convolution as ComputeT.
+ *
+ * The algorithm is chosen by the selector in the same way as \ref sublaunch,
+ * and launched with select_and_launch_mixed(). Mixed precision kernels are
+ * only generated for the forward pass, so any other pass, or an algorithm
+ * without a mixed precision implementation, returns
+ * StatusCode::InvalidAlgorithm. When ComputeT is T this is equivalent to
+ * \ref sublaunch.
+ */
+template <typename T, typename ConvType, typename ComputeT, typename Backend>
+SNNStatus sublaunch_mixed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events) {
+  if constexpr (std::is_same<T, ComputeT>::value) {
+    return sublaunch<T, ConvType, Backend>(input, filter, output, params,
+                                           selector, backend, workspace,
+                                           workspace_size, events);
+  } else if constexpr (!std::is_same<ConvType, conv_type::Forward>::value) {
+    return StatusCode::InvalidAlgorithm;
+  } else {
+    auto status = validate_params(params);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    Algorithm algo_tag = selector.select<ConvType>(params);
+    if (workspace_size > 0 &&
+        internal::query_workspace_size<ConvType>(params, algo_tag)
+                .required_size > workspace_size) {
+      algo_tag = internal::select_for_workspace<ConvType>(params, selector,
+                                                          workspace_size)
+                     .algorithm;
+    }
+    // Grouped convolutions are only implemented by im2col, which has no mixed
+    // precision implementation.
+    if (params.groups > 1) {
+      return StatusCode::InvalidAlgorithm;
+    }
+    return select_and_launch_mixed<T, ConvType, ComputeT, Backend>(
+        input, filter, output, params, algo_tag, backend, workspace,
+        workspace_size, events);
   }
 }
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_LAUNCH_QUANTIZED_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_LAUNCH_QUANTIZED_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::launch_quantized() function, which
+ * asynchronously dispatches the SYCL kernel required to perform an 8-bit
+ * quantized 2D convolution.
+ */
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/quantization_params.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/conv2d/selector/selector.h"
+
+#include "portdnn/internal/conv2d/launch.h"
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Launch a quantized forward convolution which needs no workspace, using the
+ * direct, tiled or matmul kernels.
+ *
+ * Implemented in the compiled portDNN library.
+ *
+ * \param input              A memory object for the input tensor.
+ * \param filter             A memory object for the filter tensor.
+ * \param filter_scales      A memory object for the per feature filter
+ *                           scales.
+ * \param filter_zero_points A memory object for the per feature filter zero
+ *                           points.
+ * \param output             A memory object for the output tensor.
+ * \param params             The convolution parameters.
+ * \param quant_params       The quantization parameters.
+ * \param algorithm          The algorithm to use, one of Direct, Tiled or
+ *                           Matmul.
+ * \param queue              The SYCL queue to enqueue the kernel to.
+ * \param events             Events which should be completed before the
+ *                           operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, template <typename> class MemObj,
+          typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
+SNN_EXPORT SNNStatus launch_quantized(
+    MemObj<T const>& input, MemObj<T const>& filter,
+    MemObj<float const>& filter_scales,
+    MemObj<int32_t const>& filter_zero_points, MemObj<T>& output,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    Algorithm algorithm, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+/**
+ * Launch a quantized forward convolution as an im2col transform into the
+ * workspace followed by a quantized matrix multiply. If the workspace cannot
+ * hold the patches of the whole batch, the images are split into minibatches.
+ *
+ * Implemented in the compiled portDNN library.
+ *
+ * \param input              A memory object for the input tensor.
+ * \param filter             A memory object for the filter tensor.
+ * \param filter_scales      A memory object for the per feature filter
+ *                           scales.
+ * \param filter_zero_points A memory object for the per feature filter zero
+ *                           points.
+ * \param output             A memory object for the output tensor.
+ * \param workspace          A memory object for the workspace, holding the
+ *                           patches of at least one image.
+ * \param params             The convolution parameters.
+ * \param quant_params       The quantization parameters.
+ * \param queue              The SYCL queue to enqueue the kernels to.
+ * \param events             Events which should be completed before the
+ *                           operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the last
+ * kernel launch and a StatusCode enum showing if the launch was OK or whether
+ * it encountered some problem.
+ */
+template <typename T, template <typename> class MemObj,
+          typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
+SNN_EXPORT SNNStatus launch_quantized_im2col(
+    MemObj<T const>& input, MemObj<T const>& filter,
+    MemObj<float const>& filter_scales,
+    MemObj<int32_t const>& filter_zero_points, MemObj<T>& output,
+    MemObj<T>& workspace, Conv2DParams const& params,
+    QuantizationParams const& quant_params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+/**
+ * Validate the parameters, select an algorithm and launch a quantized forward
+ * convolution.
+ *
+ * \param input              A pointer to the input tensor.
+ * \param filter             A pointer to the filter tensor.
+ * \param filter_scales      A pointer to the per feature filter scales.
+ * \param filter_zero_points A pointer to the per feature filter zero points.
+ * \param output             A pointer to the output tensor.
+ * \param params             The convolution parameters.
+ * \param quant_params       The quantization parameters.
+ * \param selector           The selector used to choose the algorithm.
+ * \param backend            The backend implementation, used to map between
+ *                           pointer representations.
+ * \param workspace          A pointer to the workspace, only used by im2col.
+ * \param workspace_size     The number of elements in the workspace.
+ * \param events             Events which should be completed before the
+ *                           operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus sublaunch_quantized(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<float const> filter_scales,
+    typename Backend::template pointer_type<int32_t const> filter_zero_points,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events) {
+  static_assert(std::is_same<T, int8_t>::value ||
+                    std::is_same<T, uint8_t>::value,
+                "Quantized convolutions only support int8_t and uint8_t.");
+  auto status = validate_params(params);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  SNN_VALIDATE_PARAM(params.groups == 1,
+                     "Quantized convolutions do not support groups.");
+  SNN_VALIDATE_PARAM(params.input_format == DataFormat::NHWC &&
+                         params.filter_format == FilterFormat::HWCF,
+                     "Quantized convolutions only support NHWC input and "
+                     "HWCF filter formats.");
+  SNN_VALIDATE_PARAM(quant_params.input_scale > 0.f,
+                     "The input scale must be positive.");
+  SNN_VALIDATE_PARAM(quant_params.output_scale > 0.f,
+                     "The output scale must be positive.");
+  SNN_VALIDATE_PARAM(quant_params.activation != Activation::Tanh,
+                     "Quantized convolutions do not support tanh.");
+
+  Algorithm const algorithm = selector.select<conv_type::Forward>(params);
+  if (algorithm == Algorithm::Matmul) {
+    bool const is_1x1 = params.window_rows == 1 && params.window_cols == 1 &&
+                        params.stride_rows == 1 && params.stride_cols == 1 &&
+                        params.pad_rows == 0 && params.pad_cols == 0;
+    if (!is_1x1) {
+      return StatusCode::InvalidAlgorithm;
+    }
+  } else if (algorithm != Algorithm::Direct &&
+             algorithm != Algorithm::Tiled &&
+             algorithm != Algorithm::Im2col) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  auto sizes = get_sizes<conv_type::Forward>(params);
+  size_t const n_features = static_cast<size_t>(params.features);
+
+  auto inp_access = backend.get_mem_object(input, sizes.input_size);
+  auto fil_access = backend.get_mem_object(filter, sizes.filter_size);
+  auto scale_access = backend.get_mem_object(filter_scales, n_features);
+  auto zero_point_access =
+      backend.get_mem_object(filter_zero_points, n_features);
+  auto out_access = backend.get_mem_object(output, sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+
+  if (algorithm == Algorithm::Im2col) {
+    if (workspace_size < quantized_im2col_image_size(params)) {
+      return StatusCode::InsufficientWorkspace;
+    }
+    auto workspace_access = backend.get_mem_object(workspace, workspace_size);
+    return internal::launch_quantized_im2col(
+        inp_access, fil_access, scale_access, zero_point_access, out_access,
+        workspace_access, params, quant_params, queue, events);
+  }
+  return internal::launch_quantized(inp_access, fil_access, scale_access,
+                                    zero_point_access, out_access, params,
+                                    quant_params, algorithm, queue, events);
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_LAUNCH_QUANTIZED_H_
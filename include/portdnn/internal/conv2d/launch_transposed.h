@@ -0,0 +1,109 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_LAUNCH_TRANSPOSED_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_LAUNCH_TRANSPOSED_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::sublaunch_transposed() function, which
+ * dispatches a 2D transposed convolution as the input backprop of the
+ * equivalent forward convolution.
+ */
+
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/transposed_params.h"
+
+#include "portdnn/internal/conv2d/launch.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+inline SNNStatus validate_transposed_params(
+    TransposedConv2DParams const& params) {
+  SNN_VALIDATE_PARAM(
+      params.output_pad_rows >= 0,
+      "The output padding in the row direction must be non-negative.");
+  SNN_VALIDATE_PARAM(
+      params.output_pad_cols >= 0,
+      "The output padding in the column direction must be non-negative.");
+  SNN_VALIDATE_PARAM(
+      params.output_pad_rows < params.stride_rows ||
+          params.output_pad_rows < params.dilation_rows,
+      "The output padding in the row direction must be smaller than either "
+      "the stride or the dilation.");
+  SNN_VALIDATE_PARAM(
+      params.output_pad_cols < params.stride_cols ||
+          params.output_pad_cols < params.dilation_cols,
+      "The output padding in the column direction must be smaller than either "
+      "the stride or the dilation.");
+
+  auto const expected = add_output_sizes_to(params);
+  SNN_VALIDATE_PARAM(params.out_rows == expected.out_rows,
+                     "The number of output rows does not match the input "
+                     "rows, window, stride, padding and output padding.");
+  SNN_VALIDATE_PARAM(params.out_cols == expected.out_cols,
+                     "The number of output columns does not match the input "
+                     "columns, window, stride, padding and output padding.");
+  return StatusCode::OK;
+}
+
+template <typename T, typename Backend>
+SNNStatus sublaunch_transposed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    TransposedConv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events) {
+  auto const conv_params = get_conv2d_params(params);
+  auto status = validate_params(conv_params);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  status = validate_transposed_params(params);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  SNN_VALIDATE_PARAM((params.group_format != BatchFormat::INTERLEAVED) ||
+                         backend::supports_interleaved_matmul<Backend>::value,
+                     "The chosen backend does not support interleaved batched "
+                     "matmul, used in im2col algorithm.");
+
+  Algorithm algo_tag = selector.select_transposed(conv_params);
+  if (conv_params.groups > 1 && algo_tag != Algorithm::Im2col) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  using ConvType = conv_type::InputBackprop;
+  if constexpr (backend::is_usm_backend<Backend>::value) {
+    return select_and_launch_usm<T, ConvType, Backend>(
+        input, filter, output, conv_params, algo_tag, backend, workspace,
+        workspace_size, Epilogue<T, Backend>{}, events);
+  } else {
+    return select_and_launch<T, ConvType, Backend>(
+        input, filter, output, conv_params, algo_tag, backend, workspace,
+        workspace_size, Epilogue<T, Backend>{});
+  }
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_LAUNCH_TRANSPOSED_H_
@@ -0,0 +1,127 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_PARTIAL_REDUCTION_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_PARTIAL_REDUCTION_H_
+
+#include "portdnn/status.h"
+
+#include "portdnn/binaryop/operators.h"
+#include "portdnn/internal/binaryop/launch.h"
+#include "portdnn/internal/conv2d/batch_info.h"
+
+#include <CL/sycl.hpp>
+
+#include <vector>
+
+/**
+ * \file
+ * Contains sycldnn::conv2d::internal::launch_partial_reduction(), used by the
+ * filter backprop passes to sum the partial gradients computed separately for
+ * each minibatch, and sycldnn::conv2d::internal::partial_minibatch_size() to
+ * choose a minibatch which leaves room for those partial gradients.
+ */
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Sum a set of equally sized partial results into the first one.
+ *
+ * The remaining partials are contiguous in memory, and are summed as a tree
+ * by repeatedly adding the back half of them onto the front half, so that
+ * only a logarithmic number of kernels have to run one after the other. The
+ * final sum is then added into `first`.
+ *
+ * \param first        The partial result to accumulate into.
+ * \param rest         The other `n_rest` partial results, one after another.
+ * \param partial_size The number of elements in each partial result.
+ * \param n_rest       The number of partial results in `rest`.
+ * \param backend      The backend used to map the pointers to memory objects.
+ * \param events       Events which should be completed before the reduction.
+ * \return An SNNStatus containing the event of the last kernel launched.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_partial_reduction(
+    typename Backend::template internal_pointer_type<T> first,
+    typename Backend::template internal_pointer_type<T> rest,
+    size_t partial_size, size_t n_rest, Backend& backend,
+    std::vector<cl::sycl::event> events) {
+  auto queue = backend.get_queue();
+  while (n_rest > 1) {
+    size_t const half = n_rest / 2;
+    size_t const add_size = half * partial_size;
+    auto front_mem = backend.get_mem_object_internal(rest, add_size);
+    auto back_mem = backend.get_mem_object_internal(
+        rest + (n_rest - half) * partial_size, add_size);
+    auto front_const_mem = front_mem.as_const();
+    auto back_const_mem = back_mem.as_const();
+    auto status = binaryop::internal::launch_binaryop<binaryop::Add>(
+        front_const_mem, back_const_mem, front_mem, static_cast<int>(add_size),
+        queue, events);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    events = {status.event};
+    n_rest -= half;
+  }
+  if (n_rest == 0) {
+    return {events.empty() ? cl::sycl::event{} : events.back(),
+            StatusCode::OK};
+  }
+  auto first_mem = backend.get_mem_object_internal(first, partial_size);
+  auto rest_mem = backend.get_mem_object_internal(rest, partial_size);
+  auto first_const_mem = first_mem.as_const();
+  auto rest_const_mem = rest_mem.as_const();
+  return binaryop::internal::launch_binaryop<binaryop::Add>(
+      first_const_mem, rest_const_mem, first_mem,
+      static_cast<int>(partial_size), queue, events);
+}
+
+/**
+ * Get the largest minibatch size for a filter backprop which leaves room in
+ * the workspace for a separate partial gradient per minibatch.
+ *
+ * Giving up some of the minibatch lets the minibatches run concurrently, but
+ * if the minibatch would have to be more than halved then zero is returned and
+ * the minibatches accumulate into the output in turn.
+ *
+ * \param workspace_size Number of elements available in the workspace buffer
+ * \param batch          Total number of images
+ * \param size_per_image Transform buffer size needed for each image
+ * \param partial_size   Size of a partial gradient
+ * \param minibatch_size The minibatch size without partial gradients
+ * \return The minibatch size to use with partial gradients, or zero.
+ */
+inline size_t partial_minibatch_size(size_t workspace_size, size_t batch,
+                                     size_t size_per_image,
+                                     size_t partial_size,
+                                     size_t minibatch_size) {
+  for (size_t mb = minibatch_size; mb > 0 && 2 * mb >= minibatch_size; --mb) {
+    size_t const n_batches =
+        double_buffer_batch_info(get_batch_info(mb, batch), batch).n_batches;
+    if (mb * size_per_image + n_batches * partial_size <= workspace_size) {
+      return mb;
+    }
+  }
+  return 0;
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_PARTIAL_REDUCTION_H_
@@ -0,0 +1,202 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_TRANSFORMED_FILTER_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_TRANSFORMED_FILTER_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::sub_transform_filter() and
+ * \ref sycldnn::conv2d::sublaunch_transformed() functions, which dispatch
+ * convolutions using a \ref sycldnn::conv2d::TransformedFilter to the
+ * algorithm the filter was transformed for.
+ */
+
+#include "portdnn/status.h"
+
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/transformed_filter.h"
+
+#include "portdnn/internal/conv2d/epilogue.h"
+#include "portdnn/internal/conv2d/im2col.h"
+#include "portdnn/internal/conv2d/launch.h"
+#include "portdnn/internal/conv2d/winograd/launch.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Check whether a filter transformed for one convolution can be used in
+ * another. The filter transforms do not depend on the batch size or the input
+ * and output spatial sizes, so these are allowed to differ.
+ */
+inline bool filter_params_match(Conv2DParams const& transformed,
+                                Conv2DParams const& params) {
+  return transformed.channels == params.channels &&
+         transformed.features == params.features &&
+         transformed.window_rows == params.window_rows &&
+         transformed.window_cols == params.window_cols &&
+         transformed.groups == params.groups &&
+         transformed.group_format == params.group_format &&
+         transformed.input_format == params.input_format &&
+         transformed.filter_format == params.filter_format;
+}
+
+/** Check whether the Winograd kernels can compute the given convolution. */
+inline bool winograd_supports(Conv2DParams const& params) {
+  return params.stride_rows == 1 && params.stride_cols == 1 &&
+         params.dilation_rows == 1 && params.dilation_cols == 1;
+}
+
+/** Check the parameters shared by the filter transform and the launch. */
+template <typename Backend>
+SNNStatus validate_transformed_params(Conv2DParams const& params,
+                                      Algorithm algorithm) {
+  auto status = validate_params(params);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  SNN_VALIDATE_PARAM((params.group_format != BatchFormat::INTERLEAVED) ||
+                         backend::supports_interleaved_matmul<Backend>::value,
+                     "The chosen backend does not support interleaved batched "
+                     "matmul, used in im2col algorithm.");
+  SNN_VALIDATE_PARAM(query_transformed_filter_size(params, algorithm) > 0,
+                     "The chosen algorithm does not support pre-transformed "
+                     "filters for these parameters.");
+  // The fused Winograd kernel and grouped im2col only support NHWC.
+  if (params.input_format == DataFormat::NCHW &&
+      (algorithm == Algorithm::WinogradFused || params.groups != 1)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return StatusCode::OK;
+}
+
+}  // namespace internal
+
+/**
+ * Transform a forward convolution filter into the layout used by the algorithm
+ * given in the transformed filter handle.
+ */
+template <typename T, typename Backend>
+SNNStatus sub_transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    TransformedFilter<T, Backend> const& transformed, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto const& params = transformed.params;
+  auto status = internal::validate_transformed_params<Backend>(
+      params, transformed.algorithm);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  switch (transformed.algorithm) {
+    case Algorithm::Winograd:
+    case Algorithm::WinogradFused:
+      if (!internal::winograd_supports(params)) {
+        return StatusCode::InvalidAlgorithm;
+      }
+      // The fused kernel uses the same 2x2 output tiles as the Winograd
+      // kernels for 3x3 windows, so shares the filter transform.
+      return internal::winograd::transform_filter<T>(filter, transformed.data,
+                                                     params, backend, events);
+    case Algorithm::WinogradLarge:
+      if (!internal::winograd_supports(params)) {
+        return StatusCode::InvalidAlgorithm;
+      }
+      return internal::winograd::transform_filter_large<T>(
+          filter, transformed.data, params, backend, events);
+    case Algorithm::Im2col:
+      return internal::im2col::transform_filter<T>(filter, transformed.data,
+                                                   params, backend, events);
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
+
+/**
+ * Launch a convolution using a pre-transformed filter, with the algorithm
+ * given by the transformed filter handle.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus sublaunch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    TransformedFilter<T, Backend> const& filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, Epilogue<T, Backend> const& epilogue,
+    const std::vector<cl::sycl::event>& events) {
+  SNN_VALIDATE_PARAM((std::is_same<ConvType, conv_type::Forward>::value),
+                     "Pre-transformed filters are only supported for the "
+                     "forward pass.");
+  SNN_VALIDATE_PARAM(internal::filter_params_match(filter.params, params),
+                     "The transformed filter was computed for a convolution "
+                     "with different filter parameters.");
+  auto status =
+      internal::validate_transformed_params<Backend>(params, filter.algorithm);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  switch (filter.algorithm) {
+    case Algorithm::Winograd:
+      if (!internal::winograd_supports(params)) {
+        return StatusCode::InvalidAlgorithm;
+      }
+      return internal::winograd::launch_transformed<T>(
+          input, filter.data, output, workspace, params, workspace_size,
+          epilogue, backend, events);
+    case Algorithm::WinogradLarge:
+      if (!internal::winograd_supports(params)) {
+        return StatusCode::InvalidAlgorithm;
+      }
+      return internal::winograd::launch_large_transformed<T>(
+          input, filter.data, output, workspace, params, workspace_size,
+          epilogue, backend, events);
+    case Algorithm::WinogradFused:
+      if (!internal::winograd_supports(params)) {
+        return StatusCode::InvalidAlgorithm;
+      }
+      return internal::winograd::launch_fused_transformed<T>(
+          input, filter.data, output, params, epilogue, backend, events);
+    case Algorithm::Im2col: {
+      // The epilogue is applied by the matmul if the backend supports it,
+      // otherwise by a separate kernel after the convolution.
+      if (internal::can_fuse_matmul_epilogue<Backend, ConvType>(params)) {
+        return internal::im2col::launch_transformed<T>(
+            input, filter.data, output, workspace, params, workspace_size,
+            epilogue, backend, events);
+      }
+      auto im2col_status = internal::im2col::launch_transformed<T>(
+          input, filter.data, output, workspace, params, workspace_size,
+          Epilogue<T, Backend>{}, backend, events);
+      return internal::launch_epilogue_after<T>(im2col_status, output,
+                                                epilogue, params, backend);
+    }
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_TRANSFORMED_FILTER_H_
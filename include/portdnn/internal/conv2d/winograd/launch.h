@@ -18,14 +18,19 @@
 
 #include "portdnn/status.h"
 
+#include "portdnn/backend/backend_helpers.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
 
 #include "portdnn/internal/conv2d/batch_info.h"
+#include "portdnn/internal/conv2d/epilogue.h"
 #include "portdnn/internal/conv2d/internal_pointer_set.h"
+#include "portdnn/internal/conv2d/partial_reduction.h"
 
 #include "portdnn/internal/conv2d/winograd/calculate_offsets.h"
 #include "portdnn/internal/conv2d/winograd/kernel_params.h"
 #include "portdnn/internal/conv2d/winograd/launch_filter_transform.h"
+#include "portdnn/internal/conv2d/winograd/launch_fused.h"
 #include "portdnn/internal/conv2d/winograd/launch_input_transform.h"
 #include "portdnn/internal/conv2d/winograd/launch_output_transform.h"
 #include "portdnn/internal/conv2d/winograd/pointer_set.h"
@@ -49,78 +54,166 @@ namespace internal {
 namespace winograd {
 
 /**
- * Launch the kernels to compute a convolution over all minibatches.
+ * Launch the input transform, matrix multiply and output transform kernels to
+ * compute a convolution over all minibatches, using a filter transform which
+ * has already been computed.
+ *
+ * When there is more than one minibatch the input and intermediate transform
+ * buffers are split in two, so that the input transform of one minibatch can
+ * run concurrently with the matrix multiply of the previous minibatch.
+ *
+ * The matrix multiply accumulates over the channels as ComputeT, which
+ * requires the backend to provide batch_matmul_mixed() if ComputeT is not T.
+ * The transforms only sum a few terms, so are computed as T.
  *
  * \param pointers   Full set of pointers for the convolution
  * \param params     Kernel parameters for the convolution
  * \param tile_info  Information about the number of Winograd tiles
  * \param batch_info Information about the minibatch size
+ * \param epilogue   Epilogue to apply to the output of a forward convolution
  * \param backend    Backend to use for matrix multiplication
  * \param events    Vector of events to synchronize on before launching kernel
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
 template <
-    typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
+    typename T, int M, int N, int R, int S, typename ConvType,
+    typename ComputeT = T, typename Backend,
     typename std::enable_if<
         !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
         0>
-SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
-                                 Conv2DParams const& params,
-                                 TileInfo const& tile_info,
-                                 BatchInfo const& batch_info, Backend& backend,
-                                 const std::vector<cl::sycl::event>& events) {
+SNNStatus launch_with_transformed_filter(
+    FullPointerSet<T, Backend> const& pointers, Conv2DParams const& params,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = false;
   // Need to transpose for the input backprop, but not for the forward pass
   constexpr bool transpose_filter =
       std::is_same<ConvType, conv_type::InputBackprop>::value;
-  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
-      pointers.filter, pointers.filter_transform, params, tile_info, backend,
-      events);
-  if (fil_status.status != StatusCode::OK) {
-    return fil_status;
-  }
 
-  cl::sycl::event last_event = fil_status.event;
+  auto const buffered_info = double_buffer_batch_info(batch_info, params.batch);
+  size_t const input_buffer_size = buffered_info.images_per_batch * A * B *
+                                   tile_info.number * params.channels;
+  size_t const inter_buffer_size = buffered_info.images_per_batch * A * B *
+                                   tile_info.number * params.features;
+
+  std::vector<cl::sycl::event> buffer_events[2] = {events, events};
+  std::vector<cl::sycl::event> output_events;
+  cl::sycl::event last_event;
   Conv2DParams kernel_params{params};
-  kernel_params.batch = batch_info.images_per_batch;
-  for (size_t i = 0; i < batch_info.n_batches; ++i) {
+  kernel_params.batch = buffered_info.images_per_batch;
+  for (size_t i = 0; i < buffered_info.n_batches; ++i) {
     auto offset =
-        calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
-    if (i == batch_info.n_batches - 1) {
-      kernel_params.batch = batch_info.last_batch_size;
+        calculate_offsets<ConvType>(i, buffered_info.images_per_batch, params);
+    if (i == buffered_info.n_batches - 1) {
+      kernel_params.batch = buffered_info.last_batch_size;
     }
+    size_t const buffer = i % buffered_info.n_buffers;
+    auto input_transform =
+        pointers.input_transform + buffer * input_buffer_size;
+    auto intermediate = pointers.intermediate + buffer * inter_buffer_size;
 
     auto inp_status = launch_input_transform<T, ConvType, M, N, R, S>(
-        pointers.input + offset.in, pointers.input_transform, kernel_params,
-        tile_info, backend, std::vector<cl::sycl::event>{last_event});
+        pointers.input + offset.in, input_transform, kernel_params, tile_info,
+        backend, buffer_events[buffer]);
     if (inp_status.status != StatusCode::OK) {
       return inp_status;
     }
     last_event = inp_status.event;
 
-    last_event =
-        backend.template batch_matmul<transpose_input, transpose_filter, T>(
-            pointers.input_transform, pointers.filter_transform,
-            pointers.intermediate, A * B,
-            tile_info.number * kernel_params.batch, kernel_params.channels,
-            kernel_params.features, sycldnn::BatchFormat::STRIDED,
-            std::vector<cl::sycl::event>{last_event});
+    if constexpr (std::is_same<T, ComputeT>::value) {
+      last_event =
+          backend.template batch_matmul<transpose_input, transpose_filter, T>(
+              input_transform, pointers.filter_transform, intermediate, A * B,
+              tile_info.number * kernel_params.batch, kernel_params.channels,
+              kernel_params.features, sycldnn::BatchFormat::STRIDED,
+              std::vector<cl::sycl::event>{last_event});
+    } else {
+      static_assert(
+          sycldnn::backend::supports_mixed_precision_matmul<Backend>::value,
+          "The backend cannot accumulate a matmul in a different data type.");
+      last_event = backend.template batch_matmul_mixed<
+          transpose_input, transpose_filter, T, ComputeT>(
+          input_transform, pointers.filter_transform, intermediate, A * B,
+          tile_info.number * kernel_params.batch, kernel_params.channels,
+          kernel_params.features, sycldnn::BatchFormat::STRIDED,
+          std::vector<cl::sycl::event>{last_event});
+    }
 
+    // Chain the output transforms so the last one depends on every minibatch.
+    output_events.push_back(last_event);
     auto out_status = launch_output_transform<T, ConvType, M, N, R, S>(
-        pointers.intermediate, pointers.output + offset.out, kernel_params,
-        tile_info, backend, std::vector<cl::sycl::event>{last_event});
+        intermediate, pointers.output + offset.out,
+        offset_epilogue(epilogue, offset.out), kernel_params, tile_info,
+        backend, output_events);
     if (out_status.status != StatusCode::OK) {
       return out_status;
     }
     last_event = out_status.event;
+    buffer_events[buffer] = {last_event};
+    output_events = {last_event};
   }
   return SNNStatus{last_event, StatusCode::OK};
 }
 
-/** \copydoc launch_with_transforms() */
+/**
+ * Launch the kernels to compute a convolution over all minibatches.
+ *
+ * \param pointers   Full set of pointers for the convolution
+ * \param params     Kernel parameters for the convolution
+ * \param tile_info  Information about the number of Winograd tiles
+ * \param batch_info Information about the minibatch size
+ * \param epilogue   Epilogue to apply to the output of a forward convolution
+ * \param backend    Backend to use for matrix multiplication
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <
+    typename T, int M, int N, int R, int S, typename ConvType,
+    typename ComputeT = T, typename Backend,
+    typename std::enable_if<
+        !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
+        0>
+SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
+                                 Conv2DParams const& params,
+                                 TileInfo const& tile_info,
+                                 BatchInfo const& batch_info,
+                                 Epilogue<T, Backend> const& epilogue,
+                                 Backend& backend,
+                                 const std::vector<cl::sycl::event>& events) {
+  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
+      pointers.filter, pointers.filter_transform, params, tile_info, backend,
+      events);
+  if (fil_status.status != StatusCode::OK) {
+    return fil_status;
+  }
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType, ComputeT>(
+      pointers, params, tile_info, batch_info, epilogue, backend,
+      {fil_status.event});
+}
+
+/**
+ * Launch the kernels to compute a filter backprop over all minibatches.
+ *
+ * If the intermediate buffer holds a partial gradient for every minibatch
+ * then the minibatches do not depend on each other, and the partial gradients
+ * are summed with a tree reduction before a single output transform.
+ * Otherwise each minibatch accumulates into the output in turn.
+ *
+ * \param pointers   Full set of pointers for the convolution
+ * \param params     Kernel parameters for the convolution
+ * \param tile_info  Information about the number of Winograd tiles
+ * \param batch_info Information about the minibatch size
+ * \param backend    Backend to use for matrix multiplication
+ * \param events     Vector of events to synchronize on before launching kernel
+ * \param n_partials Number of partial gradients the intermediate buffer holds
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
 template <
     typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
     typename std::enable_if<
@@ -129,8 +222,11 @@ template <
 SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
-                                 BatchInfo const& batch_info, Backend& backend,
-                                 const std::vector<cl::sycl::event>& events) {
+                                 BatchInfo const& batch_info,
+                                 Epilogue<T, Backend> const& /*epilogue*/,
+                                 Backend& backend,
+                                 const std::vector<cl::sycl::event>& events,
+                                 size_t n_partials = 1) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = true;
@@ -142,37 +238,74 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
   // filter.
   std::swap(pointers.filter_transform, pointers.intermediate);
 
+  auto const buffered_info = double_buffer_batch_info(batch_info, params.batch);
+  size_t const input_buffer_size = buffered_info.images_per_batch * A * B *
+                                   tile_info.number * params.channels;
+  size_t const filter_buffer_size = buffered_info.images_per_batch * A * B *
+                                    tile_info.number * params.features;
+
+  // The transforms of each minibatch only wait for the last minibatch to use
+  // the same buffers. Without a partial gradient per minibatch the matmuls
+  // are serialized as they all share the intermediate buffer and accumulate
+  // into the output.
+  std::vector<cl::sycl::event> buffer_events[2] = {events, events};
   cl::sycl::event last_event;
   Conv2DParams kernel_params{params};
-  kernel_params.batch = batch_info.images_per_batch;
-  for (size_t i = 0; i < batch_info.n_batches; ++i) {
+  kernel_params.batch = buffered_info.images_per_batch;
+  bool const use_partials =
+      buffered_info.n_batches > 1 && n_partials >= buffered_info.n_batches;
+  size_t const partial_size = A * B * params.channels * params.features;
+  std::vector<cl::sycl::event> partial_events;
+  for (size_t i = 0; i < buffered_info.n_batches; ++i) {
     auto offset =
-        calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
+        calculate_offsets<ConvType>(i, buffered_info.images_per_batch, params);
 
-    if (i == batch_info.n_batches - 1) {
-      kernel_params.batch = batch_info.last_batch_size;
+    if (i == buffered_info.n_batches - 1) {
+      kernel_params.batch = buffered_info.last_batch_size;
     }
+    size_t const buffer = i % buffered_info.n_buffers;
+    auto input_transform =
+        pointers.input_transform + buffer * input_buffer_size;
+    auto filter_transform =
+        pointers.filter_transform + buffer * filter_buffer_size;
+
     auto inp_status = launch_input_transform<T, ConvType, M, N, R, S>(
-        pointers.input + offset.in, pointers.input_transform, kernel_params,
-        tile_info, backend, events);
+        pointers.input + offset.in, input_transform, kernel_params, tile_info,
+        backend, buffer_events[buffer]);
     if (inp_status.status != StatusCode::OK) {
       return inp_status;
     }
 
     auto fil_status = launch_filter_transform_filter_backprop<T, M, N, R, S>(
-        pointers.filter + offset.out, pointers.filter_transform, kernel_params,
+        pointers.filter + offset.out, filter_transform, kernel_params,
         tile_info, backend, std::vector<cl::sycl::event>{inp_status.event});
     if (fil_status.status != StatusCode::OK) {
       return fil_status;
     }
 
+    if (use_partials) {
+      last_event =
+          backend.template batch_matmul<transpose_input, transpose_filter, T>(
+              input_transform, filter_transform,
+              pointers.intermediate + i * partial_size, A * B,
+              kernel_params.channels, tile_info.number * kernel_params.batch,
+              kernel_params.features, sycldnn::BatchFormat::STRIDED,
+              std::vector<cl::sycl::event>{fil_status.event});
+      partial_events.push_back(last_event);
+      buffer_events[buffer] = {last_event};
+      continue;
+    }
+
+    std::vector<cl::sycl::event> matmul_events{fil_status.event};
+    if (i > 0) {
+      matmul_events.push_back(last_event);
+    }
     last_event =
         backend.template batch_matmul<transpose_input, transpose_filter, T>(
-            pointers.input_transform, pointers.filter_transform,
-            pointers.intermediate, A * B, kernel_params.channels,
-            tile_info.number * kernel_params.batch, kernel_params.features,
-            sycldnn::BatchFormat::STRIDED,
-            std::vector<cl::sycl::event>{fil_status.event});
+            input_transform, filter_transform, pointers.intermediate, A * B,
+            kernel_params.channels, tile_info.number * kernel_params.batch,
+            kernel_params.features, sycldnn::BatchFormat::STRIDED,
+            matmul_events);
 
     if (i == 0) {
       // For the first mini-batch we want to overwrite the output buffer
@@ -196,6 +329,19 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
       }
       last_event = out_status.event;
     }
+    buffer_events[buffer] = {last_event};
+  }
+  if (use_partials) {
+    auto reduce_status = launch_partial_reduction<T>(
+        pointers.intermediate, pointers.intermediate + partial_size,
+        partial_size, buffered_info.n_batches - 1, backend, partial_events);
+    if (reduce_status.status != StatusCode::OK) {
+      return reduce_status;
+    }
+    kernel_params.batch = params.batch;
+    return launch_output_transform_filter_backprop<T, M, N, R, S, false>(
+        pointers.intermediate, pointers.output, kernel_params, tile_info,
+        backend, std::vector<cl::sycl::event>{reduce_status.event});
   }
   return SNNStatus{last_event, StatusCode::OK};
 }
@@ -211,6 +357,8 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
  * \param workspace      Pointer to user provided workspace buffer
  * \param params         User provided convolution parameters
  * \param workspace_size Number of elements available in the workspace buffer
+ * \param epilogue       Epilogue to apply to the output of a forward
+ *                       convolution
  * \param backend        User provided backend to handle allocations and matrix
  *                       multiplies
  * \param events    Vector of events to synchronize on before launching kernel
@@ -218,13 +366,14 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
  * kernel launched.
  */
 template <typename T, typename ConvType, int M, int N, int R, int S,
-          typename Backend>
+          typename ComputeT = T, typename Backend>
 SNNStatus split_workspace_and_launch_with_tiles(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   using InternalPointer =
       ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
@@ -242,16 +391,30 @@ SNNStatus split_workspace_and_launch_with_tiles(
       A * B * tile_info.number * kernel_params.features;
   size_t const workspace_minus_filter = workspace_size - filter_transform_size;
 
-  size_t const minibatch_size = std::min<size_t>(
+  size_t minibatch_size = std::min<size_t>(
       workspace_minus_filter / (input_transform_size + inter_transform_size),
       params.batch);
+  size_t n_partials = 1;
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    size_t const partial_minibatch = partial_minibatch_size(
+        workspace_size, params.batch,
+        input_transform_size + inter_transform_size, filter_transform_size,
+        minibatch_size);
+    if (partial_minibatch > 0) {
+      minibatch_size = partial_minibatch;
+      n_partials = double_buffer_batch_info(
+                       get_batch_info(minibatch_size, params.batch),
+                       params.batch)
+                       .n_batches;
+    }
+  }
   size_t const mb_input_transform_size = input_transform_size * minibatch_size;
+  size_t const partials_size = n_partials * filter_transform_size;
 
   InternalPointer filter_transform_ptr{workspace, backend};
-  InternalPointer input_transform_ptr{workspace + filter_transform_size,
-                                      backend};
+  InternalPointer input_transform_ptr{workspace + partials_size, backend};
   InternalPointer inter_transform_ptr{
-      workspace + filter_transform_size + mb_input_transform_size, backend};
+      workspace + partials_size + mb_input_transform_size, backend};
 
   auto all_pointers = FullPointerSet<T, Backend>{
       input_pointers.input.get(),  input_pointers.filter.get(),
@@ -259,8 +422,15 @@ SNNStatus split_workspace_and_launch_with_tiles(
       filter_transform_ptr.get(),  inter_transform_ptr.get()};
 
   auto batch_info = get_batch_info(minibatch_size, params.batch);
-  return launch_with_transforms<T, M, N, R, S, ConvType>(
-      all_pointers, kernel_params, tile_info, batch_info, backend, events);
+  if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return launch_with_transforms<T, M, N, R, S, ConvType>(
+        all_pointers, kernel_params, tile_info, batch_info, epilogue, backend,
+        events, n_partials);
+  } else {
+    return launch_with_transforms<T, M, N, R, S, ConvType, ComputeT>(
+        all_pointers, kernel_params, tile_info, batch_info, epilogue, backend,
+        events);
+  }
 }
 
 /**
@@ -269,20 +439,21 @@ SNNStatus split_workspace_and_launch_with_tiles(
  * buffers to use in the computation.
  */
 template <typename T, typename ConvType, int M, int N, int R, int S,
-          typename Backend>
+          typename ComputeT = T, typename Backend>
 SNNStatus launch_with_tiles(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   if (workspace_size == 0) return StatusCode::InsufficientWorkspace;
 
   return split_workspace_and_launch_with_tiles<T, ConvType, M, N, R, S,
-                                               Backend>(
-      input, filter, output, workspace, params, workspace_size, backend,
-      events);
+                                               ComputeT, Backend>(
+      input, filter, output, workspace, params, workspace_size, epilogue,
+      backend, events);
 }
 
 /**
@@ -290,16 +461,24 @@ SNNStatus launch_with_tiles(
  * available Winograd tile sizes and launch those kernels using
  * launch_with_tiles().
  *
- * \param input   User provided input pointer
- * \param filter  User provided filter pointer
- * \param output  User provided output pointer
- * \param params  User provided convolution parameters
- * \param backend User provided backend to handle allocations and matrix
- *                multiplies
+ * The matrix multiplies of a forward or input backprop convolution are
+ * accumulated as ComputeT. The filter backprop always accumulates as T.
+ *
+ * \param input     User provided input pointer
+ * \param filter    User provided filter pointer
+ * \param output    User provided output pointer
+ * \param workspace User provided workspace pointer
+ * \param params    User provided convolution parameters
+ * \param workspace_size Number of elements available in the workspace buffer
+ * \param epilogue  Epilogue to apply to the output of a forward convolution
+ * \param backend   User provided backend to handle allocations and matrix
+ *                  multiplies
+ * \param events    Vector of events to synchronize on before launching kernel
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
-template <typename T, typename ConvType, typename Backend,
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::FilterBackprop>::value,
               int>::type = 0>
@@ -308,27 +487,29 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
                  Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend, const std::vector<cl::sycl::event>& events) {
+                 Epilogue<T, Backend> const& epilogue, Backend& backend,
+                 const std::vector<cl::sycl::event>& events) {
   if (params.window_rows == 3 && params.window_cols == 3) {
-    return launch_with_tiles<T, ConvType, 2, 2, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+    return launch_with_tiles<T, ConvType, 2, 2, 3, 3, ComputeT>(
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
-    return launch_with_tiles<T, ConvType, 2, 1, 3, 1>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+    return launch_with_tiles<T, ConvType, 2, 1, 3, 1, ComputeT>(
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
-    return launch_with_tiles<T, ConvType, 1, 2, 1, 3>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+    return launch_with_tiles<T, ConvType, 1, 2, 1, 3, ComputeT>(
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   return StatusCode::InvalidAlgorithm;
 }
 
 /** \copydoc sycldnn::conv2d::internal::winograd::launch() */
-template <typename T, typename ConvType, typename Backend,
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend,
           typename std::enable_if<
               std::is_same<ConvType, conv_type::FilterBackprop>::value,
               int>::type = 0>
@@ -337,27 +518,31 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
                  Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend, const std::vector<cl::sycl::event>& events) {
+                 Epilogue<T, Backend> const& epilogue, Backend& backend,
+                 const std::vector<cl::sycl::event>& events) {
+  static_assert(std::is_same<T, ComputeT>::value,
+                "The filter backprop accumulates in the data type.");
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 2, 2>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 3, 1, 2, 1>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 3, 1, 2>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   return StatusCode::InvalidAlgorithm;
 }
 
 /** \copydoc sycldnn::conv2d::internal::winograd::launch() */
-template <typename T, typename ConvType, typename Backend,
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::FilterBackprop>::value,
               int>::type = 0>
@@ -366,18 +551,19 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T> output,
                        typename Backend::template pointer_type<T> workspace,
                        Conv2DParams const& params, size_t workspace_size,
-                       Backend& backend,
+                       Epilogue<T, Backend> const& epilogue, Backend& backend,
                        const std::vector<cl::sycl::event>& events) {
   if (params.window_rows == 3 && params.window_cols == 3) {
-    return launch_with_tiles<T, ConvType, 4, 4, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+    return launch_with_tiles<T, ConvType, 4, 4, 3, 3, ComputeT>(
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   return StatusCode::InvalidAlgorithm;
 }
 
 /** \copydoc sycldnn::conv2d::internal::winograd::launch() */
-template <typename T, typename ConvType, typename Backend,
+template <typename T, typename ConvType, typename ComputeT = T,
+          typename Backend,
           typename std::enable_if<
               std::is_same<ConvType, conv_type::FilterBackprop>::value,
               int>::type = 0>
@@ -386,16 +572,322 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T> output,
                        typename Backend::template pointer_type<T> workspace,
                        Conv2DParams const& params, size_t workspace_size,
-                       Backend& backend,
+                       Epilogue<T, Backend> const& epilogue, Backend& backend,
                        const std::vector<cl::sycl::event>& events) {
+  static_assert(std::is_same<T, ComputeT>::value,
+                "The filter backprop accumulates in the data type.");
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        input, filter, output, workspace, params, workspace_size, epilogue,
+        backend, events);
   }
   return StatusCode::InvalidAlgorithm;
 }
 
+/**
+ * Launch the Winograd filter transform for a forward convolution filter into
+ * a user provided buffer, using the tile sizes specified in the template
+ * parameters.
+ *
+ * \param filter    User provided filter pointer
+ * \param transform User provided pointer to write the filter transform to
+ * \param params    User provided convolution parameters
+ * \param backend   User provided backend to map between pointer types
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * filter transform kernel.
+ */
+template <typename T, int M, int N, int R, int S, typename Backend>
+SNNStatus transform_filter_with_tiles(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using ConvType = conv_type::Forward;
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer transform_ptr{transform, backend};
+  return launch_filter_transform<T, ConvType, M, N, R, S>(
+      filter_ptr.get(), transform_ptr.get(), kernel_params, tile_info, backend,
+      events);
+}
+
+/**
+ * Launch a forward Winograd convolution using a filter transform computed by
+ * transform_filter_with_tiles(), so the workspace only needs to hold the input
+ * and intermediate transforms.
+ *
+ * \param input          User provided input pointer
+ * \param transform      User provided filter transform pointer
+ * \param output         User provided output pointer
+ * \param workspace      Pointer to user provided workspace buffer
+ * \param params         User provided convolution parameters
+ * \param workspace_size Number of elements available in the workspace buffer
+ * \param epilogue       Epilogue to apply to the output
+ * \param backend        User provided backend to handle allocations and matrix
+ *                       multiplies
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <typename T, int M, int N, int R, int S, typename Backend>
+SNNStatus launch_transformed_with_tiles(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using ConvType = conv_type::Forward;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+
+  size_t const input_transform_size =
+      A * B * tile_info.number * kernel_params.channels;
+  size_t const inter_transform_size =
+      A * B * tile_info.number * kernel_params.features;
+  size_t const minibatch_size = std::min<size_t>(
+      workspace_size / (input_transform_size + inter_transform_size),
+      params.batch);
+  if (minibatch_size == 0) return StatusCode::InsufficientWorkspace;
+  size_t const mb_input_transform_size = input_transform_size * minibatch_size;
+
+  ConstInternalPointer input_ptr{input, backend};
+  InternalPointer output_ptr{output, backend};
+  InternalPointer filter_transform_ptr{transform, backend};
+  InternalPointer input_transform_ptr{workspace, backend};
+  InternalPointer inter_transform_ptr{workspace + mb_input_transform_size,
+                                      backend};
+
+  auto all_pointers = FullPointerSet<T, Backend>{
+      input_ptr.get(),
+      ConstPointer{filter_transform_ptr.get()},
+      output_ptr.get(),
+      input_transform_ptr.get(),
+      filter_transform_ptr.get(),
+      inter_transform_ptr.get()};
+
+  auto batch_info = get_batch_info(minibatch_size, params.batch);
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType>(
+      all_pointers, kernel_params, tile_info, batch_info, epilogue, backend,
+      events);
+}
+
+/**
+ * Launch the Winograd filter transform for a forward convolution filter into
+ * a user provided buffer, matching the tile sizes used by launch().
+ *
+ * \copydetails transform_filter_with_tiles()
+ */
+template <typename T, typename Backend>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, 2, 2, 3, 3>(filter, transform, params,
+                                                      backend, events);
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return transform_filter_with_tiles<T, 2, 1, 3, 1>(filter, transform, params,
+                                                      backend, events);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, 1, 2, 1, 3>(filter, transform, params,
+                                                      backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch the Winograd filter transform for a forward convolution filter into
+ * a user provided buffer, matching the tile sizes used by launch_large().
+ *
+ * \copydetails transform_filter_with_tiles()
+ */
+template <typename T, typename Backend>
+SNNStatus transform_filter_large(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, 4, 4, 3, 3>(filter, transform, params,
+                                                      backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a forward Winograd convolution using a filter transform computed by
+ * transform_filter().
+ *
+ * \copydetails launch_transformed_with_tiles()
+ */
+template <typename T, typename Backend>
+SNNStatus launch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_transformed_with_tiles<T, 2, 2, 3, 3>(
+        input, transform, output, workspace, params, workspace_size, epilogue,
+        backend, events);
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return launch_transformed_with_tiles<T, 2, 1, 3, 1>(
+        input, transform, output, workspace, params, workspace_size, epilogue,
+        backend, events);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return launch_transformed_with_tiles<T, 1, 2, 1, 3>(
+        input, transform, output, workspace, params, workspace_size, epilogue,
+        backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a forward Winograd convolution using a filter transform computed by
+ * transform_filter_large().
+ *
+ * \copydetails launch_transformed_with_tiles()
+ */
+template <typename T, typename Backend>
+SNNStatus launch_large_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size,
+    Epilogue<T, Backend> const& epilogue, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_transformed_with_tiles<T, 4, 4, 3, 3>(
+        input, transform, output, workspace, params, workspace_size, epilogue,
+        backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a forward Winograd convolution in a single kernel, using a filter
+ * transform computed by transform_filter(). The input transform and the
+ * intermediate tiles are kept in local memory, so no workspace is needed.
+ *
+ * \param input     User provided input pointer
+ * \param transform User provided filter transform pointer
+ * \param output    User provided output pointer
+ * \param params    User provided convolution parameters
+ * \param epilogue  Epilogue to apply to the output
+ * \param backend   User provided backend to map between pointer types
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * kernel launched.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_fused_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> transform,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Epilogue<T, Backend> const& epilogue,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
+  using ConvType = conv_type::Forward;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  if (params.window_rows != 3 || params.window_cols != 3) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, 2, 2, 3, 3>(kernel_params);
+  ConstInternalPointer input_ptr{input, backend};
+  InternalPointer transform_ptr{transform, backend};
+  InternalPointer output_ptr{output, backend};
+  return launch_fused_kernel<T, 2, 2, 3, 3>(
+      input_ptr.get(), ConstPointer{transform_ptr.get()}, output_ptr.get(),
+      epilogue, kernel_params, tile_info, backend, events);
+}
+
+/**
+ * Launch a forward Winograd convolution in a single kernel. The filter
+ * transform is written to the workspace, which must be large enough to hold
+ * it, before launching the fused kernel with launch_fused_transformed().
+ *
+ * \param input          User provided input pointer
+ * \param filter         User provided filter pointer
+ * \param output         User provided output pointer
+ * \param workspace      User provided workspace pointer
+ * \param params         User provided convolution parameters
+ * \param workspace_size Number of elements available in the workspace buffer
+ * \param epilogue       Epilogue to apply to the output
+ * \param backend        User provided backend to map between pointer types
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * last kernel launched.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_fused(typename Backend::template pointer_type<T const> input,
+                       typename Backend::template pointer_type<T const> filter,
+                       typename Backend::template pointer_type<T> output,
+                       typename Backend::template pointer_type<T> workspace,
+                       Conv2DParams const& params, size_t workspace_size,
+                       Epilogue<T, Backend> const& epilogue, Backend& backend,
+                       const std::vector<cl::sycl::event>& events) {
+  using ConvType = conv_type::Forward;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  constexpr int A = 4;
+  constexpr int B = 4;
+  if (params.window_rows != 3 || params.window_cols != 3) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto kernel_params = get_params<ConvType>(params);
+  size_t const filter_transform_size =
+      A * B * kernel_params.channels * kernel_params.features;
+  if (workspace_size < filter_transform_size) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  auto const tile_info = get_tile_info<ConvType, 2, 2, 3, 3>(kernel_params);
+  InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+  InternalPointer filter_transform_ptr{workspace, backend};
+
+  auto filter_status = launch_filter_transform<T, ConvType, 2, 2, 3, 3>(
+      pointers.filter.get(), filter_transform_ptr.get(), kernel_params,
+      tile_info, backend, events);
+  if (filter_status.status != StatusCode::OK) {
+    return filter_status;
+  }
+  return launch_fused_kernel<T, 2, 2, 3, 3>(
+      pointers.input.get(), ConstPointer{filter_transform_ptr.get()},
+      pointers.output.get(), epilogue, kernel_params, tile_info, backend,
+      {filter_status.event});
+}
+
 }  // namespace winograd
 }  // namespace internal
 }  // namespace conv2d
@@ -0,0 +1,119 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_LAUNCH_FUSED_H_
+#define PORTDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_LAUNCH_FUSED_H_
+
+#include "portdnn/accessor_types.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/internal/conv2d/epilogue.h"
+#include "portdnn/internal/conv2d/winograd/tile_info.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+/**
+ * \file
+ * Contains the sycldnn::conv2d::internal::winograd::launch_fused_kernel()
+ * function to launch the single kernel Winograd convolution, which computes
+ * the input transform, the products with the filter transform and the output
+ * transform without writing any intermediate tensors to global memory.
+ */
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+/**
+ * Launch the fused Winograd convolution kernel.
+ *
+ * \param input            Input tensor
+ * \param filter_transform Winograd filter transform computed by the filter
+ *                         transform kernel
+ * \param output           Output tensor
+ * \param epilogue         Epilogue to apply to the output
+ * \param params           Kernel parameters for the convolution
+ * \param tile_info        Winograd tile information
+ * \param queue            SYCL queue to enqueue the kernels to
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus event containing an event corresponding to the kernel
+ * launched.
+ */
+template <typename T, int M, int N, int R, int S,
+          template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_fused_kernel(
+    MemObj<T const>& input, MemObj<T const>& filter_transform,
+    MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+    Conv2DParams const& params, TileInfo const& tile_info,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+/**
+ * Extract the buffers from the backend and launch the fused Winograd
+ * convolution kernel.
+ *
+ * \param input            Input tensor
+ * \param filter_transform Winograd filter transform
+ * \param output           Output tensor
+ * \param epilogue         Epilogue to apply to the output
+ * \param params           Kernel parameters for the convolution
+ * \param tile_info        Winograd tile information
+ * \param backend          Backend to provide SYCL buffers from the pointers
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \return An SNNStatus event containing an event corresponding to the kernel
+ * launched.
+ */
+template <typename T, int M, int N, int R, int S, typename Backend>
+SNNStatus launch_fused_kernel(
+    typename Backend::template internal_pointer_type<T const> input,
+    typename Backend::template internal_pointer_type<T const> filter_transform,
+    typename Backend::template internal_pointer_type<T> output,
+    Epilogue<T, Backend> const& epilogue, Conv2DParams const& params,
+    TileInfo const& tile_info, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+
+  size_t const input_size =
+      params.batch * params.in_rows * params.in_cols * params.channels;
+  auto input_acc = backend.get_mem_object_internal(input, input_size);
+
+  size_t const transform_size = A * B * params.channels * params.features;
+  auto transform_acc =
+      backend.get_mem_object_internal(filter_transform, transform_size);
+
+  size_t const output_size =
+      params.batch * params.out_rows * params.out_cols * params.features;
+  auto output_acc = backend.get_mem_object_internal(output, output_size);
+  auto epilogue_acc = get_epilogue_mem(epilogue, params, backend);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_fused_kernel<T, M, N, R, S>(input_acc, transform_acc,
+                                            output_acc, epilogue_acc, params,
+                                            tile_info, queue, events);
+}
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_LAUNCH_FUSED_H_
@@ -21,7 +21,9 @@
 #include "portdnn/status.h"
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/internal/conv2d/epilogue.h"
 #include "portdnn/internal/conv2d/winograd/tile_info.h"
 
 #include <stddef.h>
@@ -50,6 +52,7 @@ namespace winograd {
  *
  * \param intermediate Intermediate tensor
  * \param output       Output temporary transform tensor
+ * \param epilogue     Epilogue to apply to the output of a forward convolution
  * \param params       Kernel parameters for the convolution
  * \param tile_info    Winograd tile information
  * \param queue        SYCL queue to enqueue the kernels to
@@ -61,8 +64,9 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
           bool Accumulate, template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch_output_transform(
     MemObj<T const>& intermediate, MemObj<T>& output,
-    Conv2DParams const& params, TileInfo const& tile_info,
-    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+    EpilogueMem<T, MemObj>& epilogue, Conv2DParams const& params,
+    TileInfo const& tile_info, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
 
 /**
  * Extract the buffers from the backend and launch the Winograd output transform
@@ -70,6 +74,7 @@ SNN_EXPORT SNNStatus launch_output_transform(
  *
  * \param inter     Intermediate tensor
  * \param output    Output temporary transform tensor
+ * \param epilogue  Epilogue to apply to the output of a forward convolution
  * \param params    Kernel parameters for the convolution
  * \param tile_info Winograd tile information
  * \param backend   Backend to provide SYCL buffers from the pointers
@@ -82,7 +87,8 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNNStatus launch_output_transform(
     typename Backend::template internal_pointer_type<T const> inter,
     typename Backend::template internal_pointer_type<T> output,
-    Conv2DParams const& params, TileInfo const& tile_info, Backend& backend,
+    Epilogue<T, Backend> const& epilogue, Conv2DParams const& params,
+    TileInfo const& tile_info, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
@@ -94,10 +100,11 @@ SNNStatus launch_output_transform(
   size_t const output_size =
       params.batch * params.out_rows * params.out_cols * params.features;
   auto output_acc = backend.get_mem_object_internal(output, output_size);
+  auto epilogue_acc = get_epilogue_mem(epilogue, params, backend);
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S, false>(
-      inter_acc, output_acc, params, tile_info, queue, events);
+      inter_acc, output_acc, epilogue_acc, params, tile_info, queue, events);
 }
 
 /**
@@ -128,10 +135,12 @@ SNNStatus launch_output_transform_filter_backprop(
 
   size_t const output_size = M * N * params.channels * params.features;
   auto output_acc = backend.get_mem_object_internal(output, output_size);
+  auto epilogue_acc =
+      get_epilogue_mem(Epilogue<T, Backend>{}, params, backend);
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S, Accumulate>(
-      inter_acc, output_acc, params, tile_info, queue, events);
+      inter_acc, output_acc, epilogue_acc, params, tile_info, queue, events);
 }
 
 }  // namespace winograd
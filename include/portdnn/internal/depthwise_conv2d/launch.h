@@ -25,6 +25,8 @@
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
 
+#include "portdnn/conv2d/conv_type.h"
+
 #include "portdnn/depthwise_conv2d/params.h"
 
 #include <CL/sycl.hpp>
@@ -106,6 +108,14 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> input,
   SNN_VALIDATE_PARAM(
       params.pad_cols >= 0,
       "The padding in the column direction must be non-negative.");
+  SNN_VALIDATE_PARAM(params.dilation_rows > 0,
+                     "The dilation in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(params.dilation_cols > 0,
+                     "The dilation in the column direction must be positive.");
+  SNN_VALIDATE_PARAM(
+      (params.dilation_rows == 1 && params.dilation_cols == 1) ||
+          std::is_same<ConvType, conv2d::conv_type::Forward>::value,
+      "Dilation is only supported for the forward pass.");
   SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC,
                      "Currently portDNN only supports the NHWC data format.");
   SNN_VALIDATE_PARAM(params.filter_format == sycldnn::FilterFormat::HWCF,
@@ -0,0 +1,146 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_DEPTHWISE_CONV2D_LAUNCH_SEPARABLE_H_
+#define PORTDNN_INCLUDE_INTERNAL_DEPTHWISE_CONV2D_LAUNCH_SEPARABLE_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::depthwise_conv2d::launch_separable() function,
+ * which asynchronously dispatches the SYCL kernel required to perform a fused
+ * depthwise-separable convolution.
+ */
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "portdnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/**
+ * Launch a fused depthwise-separable convolution.
+ *
+ * Implemented in the compiled portDNN library.
+ *
+ * \param input            A memory object for the input tensor.
+ * \param depthwise_filter A memory object for the depthwise filter tensor.
+ * \param pointwise_filter A memory object for the pointwise filter tensor.
+ * \param output           A memory object for the output tensor.
+ * \param params           The separable convolution parameters.
+ * \param queue            The SYCL queue to enqueue the kernel to.
+ * \param events           Events which should be completed before the
+ *                         operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, template <typename> class MemObj,
+          typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
+SNN_EXPORT SNNStatus launch_separable(
+    MemObj<T const>& input, MemObj<T const>& depthwise_filter,
+    MemObj<T const>& pointwise_filter, MemObj<T>& output,
+    SeparableConv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+/**
+ * Validate the parameters and launch a fused depthwise-separable convolution.
+ *
+ * \param input            A pointer to the input tensor.
+ * \param depthwise_filter A pointer to the depthwise filter tensor.
+ * \param pointwise_filter A pointer to the pointwise filter tensor.
+ * \param output           A pointer to the output tensor.
+ * \param params           The separable convolution parameters.
+ * \param backend          The backend implementation, used to map between
+ *                         pointer representations.
+ * \param events           Events which should be completed before the
+ *                         operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus sublaunch_separable(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> depthwise_filter,
+    typename Backend::template pointer_type<T const> pointwise_filter,
+    typename Backend::template pointer_type<T> output,
+    SeparableConv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto const& dw = params.depthwise;
+  SNN_VALIDATE_PARAM(dw.batch > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(dw.channels > 0,
+                     "The number of channels must be positive.");
+  SNN_VALIDATE_PARAM(dw.channel_multiplier > 0,
+                     "The channel multiplier must be positive.");
+  SNN_VALIDATE_PARAM(params.features > 0,
+                     "The number of pointwise features must be positive.");
+  SNN_VALIDATE_PARAM(dw.in_rows > 0,
+                     "The number of input rows must be positive.");
+  SNN_VALIDATE_PARAM(dw.in_cols > 0,
+                     "The number of input columns must be positive.");
+  SNN_VALIDATE_PARAM(dw.out_rows > 0,
+                     "The number of output rows must be positive.");
+  SNN_VALIDATE_PARAM(dw.out_cols > 0,
+                     "The number of output columns must be positive.");
+  SNN_VALIDATE_PARAM(dw.window_rows > 0,
+                     "The number of window rows must be positive.");
+  SNN_VALIDATE_PARAM(dw.window_cols > 0,
+                     "The number of window columns must be positive.");
+  SNN_VALIDATE_PARAM(dw.stride_rows > 0,
+                     "The stride in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(dw.stride_cols > 0,
+                     "The stride in the column direction must be positive.");
+  SNN_VALIDATE_PARAM(dw.dilation_rows > 0,
+                     "The dilation in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(dw.dilation_cols > 0,
+                     "The dilation in the column direction must be positive.");
+  SNN_VALIDATE_PARAM(dw.pad_rows >= 0,
+                     "The padding in the row direction must be non-negative.");
+  SNN_VALIDATE_PARAM(
+      dw.pad_cols >= 0,
+      "The padding in the column direction must be non-negative.");
+  SNN_VALIDATE_PARAM(dw.input_format == sycldnn::DataFormat::NHWC,
+                     "Currently portDNN only supports the NHWC data format.");
+  SNN_VALIDATE_PARAM(dw.filter_format == sycldnn::FilterFormat::HWCF,
+                     "Currently portDNN only supports the HWCF filter format.");
+
+  auto sizes = get_separable_sizes(params);
+
+  auto inp_access = backend.get_mem_object(input, sizes.input_size);
+  auto dw_fil_access =
+      backend.get_mem_object(depthwise_filter, sizes.depthwise_filter_size);
+  auto pw_fil_access =
+      backend.get_mem_object(pointwise_filter, sizes.pointwise_filter_size);
+  auto out_access = backend.get_mem_object(output, sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+
+  return internal::launch_separable(inp_access, dw_fil_access, pw_fil_access,
+                                    out_access, params, queue, events);
+}
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_DEPTHWISE_CONV2D_LAUNCH_SEPARABLE_H_
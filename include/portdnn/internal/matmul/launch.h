@@ -21,6 +21,7 @@
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
 
+#include "portdnn/internal/matmul/split_k.h"
 #include "portdnn/matmul/params.h"
 
 #include "portdnn/export.h"
@@ -32,21 +33,71 @@ namespace internal {
 /**
  * The internal matrix multiply launcher.
  *
- * Implemented in the compiled SYCL DNN library.
+ * The tensors are stored as T and the products are accumulated as ComputeT.
+ * The strides in the parameters must all be explicit, as given by
+ * resolve_strides(). Implemented in the compiled SYCL DNN library.
  */
 template <typename T, bool TransposeLHS, bool TransposeRHS,
-          template <typename> class MemObj>
+          typename ComputeT = T, template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs,
                             MemObj<T>& output, MatmulParams const& params,
                             cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events);
 
+/**
+ * The internal matrix multiply launcher using a workspace.
+ *
+ * As above, but the workspace may be used to hold ComputeT partial sums when
+ * the reduction dimension is split across work-groups. The workspace is only
+ * used if it holds at least split_k_workspace_size(params) values, otherwise
+ * this falls back to the launcher without a workspace.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                            MemObj<T>& output, MemObj<ComputeT>& workspace,
+                            MatmulParams const& params,
+                            cl::sycl::queue& queue,
+                            const std::vector<cl::sycl::event>& events);
+
+/**
+ * Replace any packed strides in the parameters with the strides of densely
+ * packed matrices, so the kernels only need to handle explicit strides.
+ */
+template <bool TransposeLHS, bool TransposeRHS>
+MatmulParams resolve_strides(MatmulParams params) {
+  auto resolve = [](MatmulParams::Index& stride, MatmulParams::Index value) {
+    if (stride == MatmulParams::packed) {
+      stride = value;
+    }
+  };
+  resolve(params.lda, TransposeLHS ? params.m : params.k);
+  resolve(params.ldb, TransposeRHS ? params.k : params.n);
+  resolve(params.ldc, params.n);
+  resolve(params.lhs_batch_stride, params.m * params.k);
+  resolve(params.rhs_batch_stride, params.k * params.n);
+  resolve(params.out_batch_stride, params.m * params.n);
+  return params;
+}
+
+/**
+ * Get the number of elements spanned by a batch of strided matrices, each
+ * with the given number of rows and columns.
+ */
+inline size_t strided_size(MatmulParams::Index batches,
+                           MatmulParams::Index batch_stride,
+                           MatmulParams::Index rows, MatmulParams::Index cols,
+                           MatmulParams::Index ld) {
+  return static_cast<size_t>(batches - 1) * batch_stride +
+         static_cast<size_t>(rows - 1) * ld + cols;
+}
+
 /**
  * Launch a batched matrix multiplication.
  *
  * Will compute: output[i] = beta * output[i] + op(lhs[i]) * op(rhs[i])
  * where i ranges over the number of batches and op(X) is either X or X^T if
- * TransposeX is true.
+ * TransposeX is true. The products are accumulated as ComputeT.
  *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
@@ -54,25 +105,70 @@ SNN_EXPORT SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs,
  * \param params The parameters of the matrix multiplication operation.
  * \param backend The backend implementation, used to map between pointer
  *                representations.
+ * \param workspace A pointer to temporary memory for split-K partial sums.
+ * \param workspace_size The number of ComputeT values in the workspace. A
+ *                       size of zero disables splitting the reduction.
+ * \param events Events which should be completed before the operation.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
  */
-template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
-SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
-                    typename Backend::template pointer_type<T const> rhs,
-                    typename Backend::template pointer_type<T> output,
-                    MatmulParams const& params, Backend& backend,
-                    const std::vector<cl::sycl::event>& events = {}) {
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend>
+SNNStatus sublaunch(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output,
+    MatmulParams const& params, Backend& backend,
+    typename Backend::template pointer_type<ComputeT> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events = {}) {
   SNN_VALIDATE_PARAM(params.batches > 0,
                      "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(params.m > 0, "The value of m must be positive.");
   SNN_VALIDATE_PARAM(params.k > 0, "The value of k must  be positive.");
   SNN_VALIDATE_PARAM(params.n > 0, "The value of n must be positive.");
+  SNN_VALIDATE_PARAM(
+      params.batch_type == BatchFormat::STRIDED ||
+          (params.lda == MatmulParams::packed &&
+           params.ldb == MatmulParams::packed &&
+           params.ldc == MatmulParams::packed &&
+           params.lhs_batch_stride == MatmulParams::packed &&
+           params.rhs_batch_stride == MatmulParams::packed &&
+           params.out_batch_stride == MatmulParams::packed),
+      "Only packed strides are supported for the interleaved batch format.");
 
-  size_t lhs_size = params.batches * params.m * params.k;
-  size_t rhs_size = params.batches * params.k * params.n;
-  size_t out_size = params.batches * params.m * params.n;
+  auto const strided_params =
+      resolve_strides<TransposeLHS, TransposeRHS>(params);
+  SNN_VALIDATE_PARAM(
+      strided_params.lda >= (TransposeLHS ? params.m : params.k),
+      "The leading dimension of the LHS must be at least its row length.");
+  SNN_VALIDATE_PARAM(
+      strided_params.ldb >= (TransposeRHS ? params.k : params.n),
+      "The leading dimension of the RHS must be at least its row length.");
+  SNN_VALIDATE_PARAM(strided_params.ldc >= params.n,
+                     "The leading dimension of the output must be at least "
+                     "n.");
+  SNN_VALIDATE_PARAM(strided_params.lhs_batch_stride >= 0,
+                     "The LHS batch stride must not be negative.");
+  SNN_VALIDATE_PARAM(strided_params.rhs_batch_stride >= 0,
+                     "The RHS batch stride must not be negative.");
+  SNN_VALIDATE_PARAM(
+      params.batches == 1 ||
+          strided_params.out_batch_stride >=
+              strided_size(1, 0, params.m, params.n, strided_params.ldc),
+      "The output batch stride must not let output matrices overlap.");
+
+  size_t lhs_size = strided_size(
+      params.batches, strided_params.lhs_batch_stride,
+      TransposeLHS ? params.k : params.m, TransposeLHS ? params.m : params.k,
+      strided_params.lda);
+  size_t rhs_size = strided_size(
+      params.batches, strided_params.rhs_batch_stride,
+      TransposeRHS ? params.n : params.k, TransposeRHS ? params.k : params.n,
+      strided_params.ldb);
+  size_t out_size =
+      strided_size(params.batches, strided_params.out_batch_stride, params.m,
+                   params.n, strided_params.ldc);
 
   auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
   auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
@@ -80,8 +176,33 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
 
   auto sycl_queue = backend.get_queue();
 
-  return internal::launch<T, TransposeLHS, TransposeRHS>(
-      lhs_acc, rhs_acc, out_acc, params, sycl_queue, events);
+  size_t const required_workspace = split_k_workspace_size(strided_params);
+  if (required_workspace > 0 && workspace_size >= required_workspace) {
+    auto workspace_acc = backend.get_mem_object(workspace, workspace_size);
+    return internal::launch<T, TransposeLHS, TransposeRHS, ComputeT>(
+        lhs_acc, rhs_acc, out_acc, workspace_acc, strided_params, sycl_queue,
+        events);
+  }
+  return internal::launch<T, TransposeLHS, TransposeRHS, ComputeT>(
+      lhs_acc, rhs_acc, out_acc, strided_params, sycl_queue, events);
+}
+
+/**
+ * Launch a batched matrix multiplication without a workspace.
+ *
+ * See the overload above; the reduction dimension is never split, so no
+ * temporary memory is needed.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend>
+SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
+                    typename Backend::template pointer_type<T const> rhs,
+                    typename Backend::template pointer_type<T> output,
+                    MatmulParams const& params, Backend& backend,
+                    const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
+      lhs, rhs, output, params, backend,
+      typename Backend::template pointer_type<ComputeT>{}, 0, events);
 }
 
 }  // namespace internal
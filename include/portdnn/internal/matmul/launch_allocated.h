@@ -0,0 +1,94 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_MATMUL_LAUNCH_ALLOCATED_H_
+#define PORTDNN_INCLUDE_INTERNAL_MATMUL_LAUNCH_ALLOCATED_H_
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/status.h"
+
+#include "portdnn/backend/backend_traits.h"
+#include "portdnn/backend/internal_backend.h"
+
+#include "portdnn/internal/helpers/allocated_pointer.h"
+#include "portdnn/internal/matmul/launch.h"
+#include "portdnn/internal/matmul/split_k.h"
+#include "portdnn/matmul/params.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/** The internal pointer representation of the given backend. */
+template <typename T, typename Backend>
+using internal_pointer_t = typename sycldnn::backend::BackendTraits<
+    Backend>::template internal_pointer_type<T>;
+
+/**
+ * Launch a batched matrix multiplication on internal pointers, allocating
+ * the split-K workspace when needed.
+ *
+ * If split_k_factor() chooses to split the reduction dimension then a
+ * temporary buffer of split_k_workspace_size(params) ComputeT values is
+ * allocated through the backend to hold the partial sums, and released once
+ * the kernels using it have completed. Otherwise no memory is allocated.
+ *
+ * This is used by the matmul providers, whose callers cannot pass a
+ * workspace.
+ *
+ * \param lhs A pointer to the memory representing the left hand matrix.
+ * \param rhs A pointer to the memory representing the right hand matrix.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The parameters of the matrix multiplication operation.
+ * \param backend The backend used to allocate the workspace and to map
+ *                between pointer representations.
+ * \param events Events which should be completed before the operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend>
+SNNStatus launch_with_allocated_workspace(
+    internal_pointer_t<T const, Backend> lhs,
+    internal_pointer_t<T const, Backend> rhs,
+    internal_pointer_t<T, Backend> output, MatmulParams const& params,
+    Backend& backend, const std::vector<cl::sycl::event>& events = {}) {
+  sycldnn::backend::internal::InternalBackend<Backend> internal_backend{
+      backend};
+  size_t const workspace_size = split_k_workspace_size(
+      resolve_strides<TransposeLHS, TransposeRHS>(params));
+  if (workspace_size == 0) {
+    return sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
+        lhs, rhs, output, params, internal_backend, events);
+  }
+
+  ::sycldnn::internal::helpers::AllocatedPointer<ComputeT, Backend> workspace{
+      sizeof(ComputeT) * workspace_size, backend};
+  auto status = sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
+      lhs, rhs, output, params, internal_backend, workspace.get(),
+      workspace_size, events);
+  if (status.status == StatusCode::OK) {
+    workspace.set_event(status.event);
+  }
+  return status;
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // PORTDNN_INCLUDE_INTERNAL_MATMUL_LAUNCH_ALLOCATED_H_
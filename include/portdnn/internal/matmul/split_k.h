@@ -0,0 +1,104 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_INTERNAL_MATMUL_SPLIT_K_H_
+#define PORTDNN_INCLUDE_INTERNAL_MATMUL_SPLIT_K_H_
+
+#include "portdnn/matmul/params.h"
+
+#include <stddef.h>
+#include <algorithm>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * The number of accumulation values in each tile of the split-K kernel. The
+ * slices are a multiple of this, and it should match the tile sizes used in
+ * src/matmul/launch.cc.
+ */
+constexpr int split_k_acc_tile = 4;
+
+/**
+ * Choose how many slices to split the accumulation dimension into.
+ *
+ * Fully connected layers with a small batch and the filter backprop
+ * multiplies have a small output but a large accumulation dimension, so a
+ * kernel with a work-item per output tile launches too few work-items to
+ * fill the device. Splitting the accumulation dimension across work-items
+ * gives more parallelism, at the cost of writing and adding the partial sums.
+ *
+ * \return Returns the number of slices, or one if the accumulation dimension
+ *         should not be split.
+ */
+inline int split_k_factor(MatmulParams const& params) {
+  // The number of work-items to aim for, the smallest slice worth computing
+  // and the largest number of partial sums to add for each output.
+  constexpr long target_work_items = 4096;
+  constexpr int min_split_size = 256;
+  constexpr int max_splits = 64;
+  // The split-K kernel uses 4x4 output tiles. Outputs with enough tiles for
+  // a quarter of the target work-items are not worth splitting.
+  long const output_tiles = static_cast<long>(params.batches) *
+                            ((params.m + 3) / 4) * ((params.n + 3) / 4);
+  if (output_tiles * 4 > target_work_items ||
+      params.k < 2 * min_split_size) {
+    return 1;
+  }
+  long splits = (target_work_items + output_tiles - 1) / output_tiles;
+  splits = std::min<long>(splits, params.k / min_split_size);
+  splits = std::min<long>(splits, max_splits);
+  return static_cast<int>(splits);
+}
+
+/**
+ * Get the number of values in each slice when splitting the accumulation
+ * dimension into n_splits slices. Each slice holds a multiple of the
+ * accumulation tile, so only the last slice can be ragged.
+ */
+inline int split_k_slice_size(MatmulParams const& params, int n_splits) {
+  int const slice = (params.k + n_splits - 1) / n_splits;
+  return (slice + split_k_acc_tile - 1) / split_k_acc_tile * split_k_acc_tile;
+}
+
+/**
+ * Get the number of slices actually used when splitting the accumulation
+ * dimension into n_splits slices. Rounding the slices up can leave fewer
+ * slices than requested.
+ */
+inline int split_k_used_splits(MatmulParams const& params, int n_splits) {
+  int const slice = split_k_slice_size(params, n_splits);
+  return (params.k + slice - 1) / slice;
+}
+
+/**
+ * Get the number of ComputeT values needed to hold the partial sums of a
+ * split-K matrix multiply, or zero if the accumulation dimension is not
+ * split for these parameters.
+ */
+inline size_t split_k_workspace_size(MatmulParams const& params) {
+  int const n_splits = split_k_factor(params);
+  if (n_splits <= 1 || params.batch_type != BatchFormat::STRIDED) {
+    return 0;
+  }
+  return static_cast<size_t>(params.batches) * params.m * params.n *
+         split_k_used_splits(params, n_splits);
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // PORTDNN_INCLUDE_INTERNAL_MATMUL_SPLIT_K_H_
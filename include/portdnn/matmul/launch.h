@@ -28,6 +28,7 @@
 #include "portdnn/helpers/macros.h"
 #include "portdnn/internal/matmul/launch.h"
 #include "portdnn/matmul/params.h"
+#include "portdnn/matmul/workspace_size.h"
 
 namespace sycldnn {
 namespace matmul {
@@ -38,6 +39,10 @@ namespace matmul {
  * where i ranges over the number of batches and op(X) is either X or X^T if
  * TransposeX is true.
  *
+ * The tensors are stored as T, while the products are accumulated as
+ * ComputeT. Setting ComputeT to float for half tensors keeps the accuracy of
+ * a float reduction while halving the memory traffic.
+ *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
  * \param output A pointer to the memory representing the output tensor.
@@ -48,15 +53,16 @@ namespace matmul {
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
  */
-template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend,
           typename = typename std::enable_if<
               !sycldnn::backend::is_usm_backend_v<Backend>>::type>
 SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T const> rhs,
                  typename Backend::template pointer_type<T> output,
                  MatmulParams const& params, Backend& backend) {
-  return internal::sublaunch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output,
-                                                            params, backend);
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
+      lhs, rhs, output, params, backend);
 }
 
 /**
@@ -66,6 +72,10 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
  * where i ranges over the number of batches and op(X) is either X or X^T if
  * TransposeX is true.
  *
+ * The tensors are stored as T, while the products are accumulated as
+ * ComputeT. Setting ComputeT to float for half tensors keeps the accuracy of
+ * a float reduction while halving the memory traffic.
+ *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
  * \param output A pointer to the memory representing the output tensor.
@@ -77,7 +87,8 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
  */
-template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend,
           typename = typename std::enable_if<
               sycldnn::backend::is_usm_backend_v<Backend>>::type>
 SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
@@ -85,10 +96,80 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T> output,
                  MatmulParams const& params, Backend& backend,
                  const std::vector<cl::sycl::event>& events = {}) {
-  return internal::sublaunch<T, TransposeLHS, TransposeRHS>(
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
       lhs, rhs, output, params, backend, events);
 }
 
+/**
+ * Launch a batched matrix multiplication using a workspace.
+ *
+ * As above, but a workspace of at least query_workspace_size(params) ComputeT
+ * elements allows the accumulation dimension to be split across work-groups,
+ * which gives more parallelism for multiplies with a small output. A smaller
+ * workspace is not used.
+ *
+ * \param lhs A pointer to the memory representing the left hand matrix.
+ * \param rhs A pointer to the memory representing the right hand matrix.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The parameters of the matrix multiplication operation.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param workspace A pointer to the temporary workspace memory.
+ * \param workspace_size The number of ComputeT elements in the workspace.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend,
+          typename = typename std::enable_if<
+              !sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output,
+                 MatmulParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<ComputeT> workspace,
+                 size_t workspace_size) {
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
+      lhs, rhs, output, params, backend, workspace, workspace_size);
+}
+
+/**
+ * Launch a batched matrix multiplication using a workspace.
+ *
+ * As above, but a workspace of at least query_workspace_size(params) ComputeT
+ * elements allows the accumulation dimension to be split across work-groups,
+ * which gives more parallelism for multiplies with a small output. A smaller
+ * workspace is not used.
+ *
+ * \param lhs A pointer to the memory representing the left hand matrix.
+ * \param rhs A pointer to the memory representing the right hand matrix.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The parameters of the matrix multiplication operation.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param workspace A pointer to the temporary workspace memory.
+ * \param workspace_size The number of ComputeT elements in the workspace.
+ * \param events Events which should be completed before the operation
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          typename ComputeT = T, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output,
+                 MatmulParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<ComputeT> workspace,
+                 size_t workspace_size,
+                 const std::vector<cl::sycl::event>& events = {}) {
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS, ComputeT>(
+      lhs, rhs, output, params, backend, workspace, workspace_size, events);
+}
+
 }  // namespace matmul
 }  // namespace sycldnn
 #endif  // PORTDNN_INCLUDE_MATMUL_LAUNCH_H_
@@ -52,6 +52,36 @@ struct MatmulParams {
 
   /** Specifies how the batches are strided in the tensor*/
   sycldnn::BatchFormat batch_type = sycldnn::BatchFormat::STRIDED;
+
+  /** Stride value which selects the stride of densely packed matrices. */
+  static constexpr Index packed = -1;
+
+  /** The distance between consecutive rows of the left hand matrix in memory
+   * (between columns if TransposeLHS). Must be at least k (m if
+   * TransposeLHS), or packed. */
+  Index lda = packed;
+
+  /** The distance between consecutive rows of the right hand matrix in memory
+   * (between columns if TransposeRHS). Must be at least n (k if
+   * TransposeRHS), or packed. */
+  Index ldb = packed;
+
+  /** The distance between consecutive rows of the output matrix in memory.
+   * Must be at least n, or packed. */
+  Index ldc = packed;
+
+  /** The distance between consecutive left hand matrices in memory. A stride
+   * of zero uses the same matrix for every batch. */
+  Index lhs_batch_stride = packed;
+
+  /** The distance between consecutive right hand matrices in memory. A stride
+   * of zero uses the same matrix for every batch. */
+  Index rhs_batch_stride = packed;
+
+  /** The distance between consecutive output matrices in memory. If there is
+   * more than one batch, the output matrices must not overlap, so this must
+   * be at least (m - 1) * ldc + n. */
+  Index out_batch_stride = packed;
 };
 
 }  // namespace matmul
@@ -0,0 +1,51 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_INCLUDE_MATMUL_WORKSPACE_SIZE_H_
+#define PORTDNN_INCLUDE_MATMUL_WORKSPACE_SIZE_H_
+
+/**
+ * \file
+ * Provides the \ref sycldnn::matmul::query_workspace_size() function, which
+ * gives the size of the optional workspace used by a matrix multiply.
+ */
+#include "portdnn/internal/matmul/split_k.h"
+#include "portdnn/matmul/params.h"
+
+#include <cstddef>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Get the number of ComputeT elements a workspace needs to hold for the
+ * matrix multiply to split its accumulation dimension across work-groups.
+ *
+ * The workspace is optional. Multiplies with a small output and a large
+ * accumulation dimension run faster when given it, while a launch without a
+ * workspace, or with a smaller one, computes the same result without
+ * splitting.
+ *
+ * \param params The parameters of the matrix multiplication operation.
+ * \return Returns the number of elements, or zero if the multiply does not
+ *         use a workspace.
+ */
+inline size_t query_workspace_size(MatmulParams const& params) {
+  return internal::split_k_workspace_size(params);
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // PORTDNN_INCLUDE_MATMUL_WORKSPACE_SIZE_H_
@@ -16,6 +16,7 @@
 #ifndef PORTDNN_SRC_CONV2D_DIRECT_KERNELS_H_
 #define PORTDNN_SRC_CONV2D_DIRECT_KERNELS_H_
 
+#include "src/conv2d/epilogue/epilogue_op.h"
 #include "src/helpers/math.h"
 #include "src/helpers/tensor_index.h"
 #include "src/helpers/vector_io.h"
@@ -35,10 +36,14 @@ namespace direct {
 
 /**
  * SYCL kernel for direct convolution computation.
+ *
+ * The tensors are stored as T, while the convolution is accumulated as
+ * ComputeT. Only the NHWC forward kernel supports a ComputeT which differs
+ * from T.
  */
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int StaticWindow, int StaticStride, int VectorWidth, typename Layout,
-          bool isUSM>
+          bool isUSM, typename ComputeT = T>
 struct DirectConv2D;
 
 }  // namespace direct
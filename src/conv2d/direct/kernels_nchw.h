@@ -30,7 +30,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
 
   DirectConv2D(const Conv2DParams& params, const ReadMem<const T, isUSM> input,
-               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output)
+               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output,
+               EpilogueOp<T, isUSM> const& epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features},
         div_features_{params.features},
@@ -45,13 +46,16 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
         input_mem_{input},
         filter_mem_{filter},
-        output_mem_{output} {}
+        output_mem_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
     Index index = item.get_id(0);
@@ -98,13 +102,15 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         Index in_row_idx = in_chan_idx + rstart * in_cols_;
         Index fil_row_idx = fil_chan_idx + firstr * col_window;
         for (Index r = rstart, i = firstr; i < row_window;
-             ++r, ++i, in_row_idx += in_cols_, fil_row_idx += col_window) {
+             r += dilation_rows_, ++i, in_row_idx += dilation_rows_ * in_cols_,
+                   fil_row_idx += col_window) {
           if (r >= 0 && r < in_rows_) {
             Index in_col_idx = in_row_idx + cstart;
             Index fil_col_idx = fil_row_idx + firstc;
 
             for (Index c = cstart, j = firstc; j < col_window;
-                 ++c, ++j, ++in_col_idx, ++fil_col_idx) {
+                 c += dilation_cols_, ++j, in_col_idx += dilation_cols_,
+                       ++fil_col_idx) {
               if (c >= 0 && c < in_cols_) {
                 T in_val = input_data_n[in_col_idx];
                 T fil_val = filter_data_n[fil_col_idx];
@@ -115,10 +121,24 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }  // row loop
       }    // channel loop
 
-      output_data[index] = out_val;
+      output_data[index] = epilogue_.apply(out_val, feature, index);
     }
   }
 
+  /**
+   * Replace the runtime window and stride sizes. Used to pass in values from
+   * specialization constants, so that the JIT compiler can treat them as
+   * compile time constants.
+   */
+  inline SNN_ALWAYS_INLINE void specialize(Index window_rows, Index window_cols,
+                                           Index stride_rows,
+                                           Index stride_cols) {
+    window_rows_ = window_rows;
+    window_cols_ = window_cols;
+    stride_rows_ = stride_rows;
+    stride_cols_ = stride_cols;
+  }
+
  private:
   /** Check whether the window size is available at compile time or whether the
    * runtime value has to be used. */
@@ -140,10 +160,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
-  const Index window_rows_;
-  const Index window_cols_;
-  const Index stride_rows_;
-  const Index stride_cols_;
+  Index window_rows_;
+  Index window_cols_;
+  Index stride_rows_;
+  Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -151,6 +173,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
+  const EpilogueOp<T, isUSM> epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, bool isUSM>
@@ -175,12 +198,16 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{static_window_param(params.window_rows) - params.pad_rows -
-                  1},
-        pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
-                  1},
+        pad_rows_{(static_window_param(params.window_rows) - 1) *
+                      params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(static_window_param(params.window_cols) - 1) *
+                      params.dilation_cols -
+                  params.pad_cols},
         input_mem_{input},
         filter_mem_{filter},
         output_mem_{output} {}
@@ -224,27 +251,33 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const auto filter_data_n =
           filter_data + feature * row_window * col_window;
 
+      // The padding and window start indices are computed for the dilated
+      // window, in which only every dilation-th element is part of the filter.
+      const Index dilated_row_window = (row_window - 1) * dilation_rows_ + 1;
+      const Index dilated_col_window = (col_window - 1) * dilation_cols_ + 1;
+
       Index in_chan_idx = 0;
       Index fil_chan_idx = 0;
       for (Index channel = 0; channel < channels_; ++channel,
                  in_chan_idx += out_cols_ * out_rows_,
                  fil_chan_idx += features_ * row_window * col_window) {
         Index in_row_idx = in_chan_idx + rstart * out_cols_;
-        Index fil_row_idx =
-            fil_chan_idx + (row_window - firstr - 1) * col_window;
-        for (Index r = rstart, i = firstr; i < row_window; ++r, i += row_stride,
-                   in_row_idx += out_cols_,
-                   fil_row_idx -= row_stride * col_window) {
-          if (r >= 0 && r < out_rows_) {
+        Index fil_row = dilated_row_window - firstr - 1;
+        for (Index r = rstart, i = firstr; i < dilated_row_window; ++r,
+                   i += row_stride, in_row_idx += out_cols_,
+                   fil_row -= row_stride) {
+          if (r >= 0 && r < out_rows_ && fil_row % dilation_rows_ == 0) {
             Index in_col_idx = in_row_idx + cstart;
-            Index fil_col_idx = fil_row_idx + (col_window - firstc - 1);
+            Index fil_row_idx =
+                fil_chan_idx + (fil_row / dilation_rows_) * col_window;
+            Index fil_col = dilated_col_window - firstc - 1;
 
-            for (Index c = cstart, j = firstc; j < col_window; ++c,
-                       j += col_stride, ++in_col_idx,
-                       fil_col_idx -= col_stride) {
-              if (c >= 0 && c < out_cols_) {
+            for (Index c = cstart, j = firstc; j < dilated_col_window; ++c,
+                       j += col_stride, ++in_col_idx, fil_col -= col_stride) {
+              if (c >= 0 && c < out_cols_ && fil_col % dilation_cols_ == 0) {
                 T in_val = input_data_n[in_col_idx];
-                T fil_val = filter_data_n[fil_col_idx];
+                T fil_val =
+                    filter_data_n[fil_row_idx + fil_col / dilation_cols_];
                 out_val = helpers::math::mad(in_val, fil_val, out_val);
               }
             }  // col loop
@@ -256,6 +289,20 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
     }
   }
 
+  /**
+   * Replace the runtime window and stride sizes. Used to pass in values from
+   * specialization constants, so that the JIT compiler can treat them as
+   * compile time constants.
+   */
+  inline SNN_ALWAYS_INLINE void specialize(Index window_rows, Index window_cols,
+                                           Index stride_rows,
+                                           Index stride_cols) {
+    window_rows_ = window_rows;
+    window_cols_ = window_cols;
+    stride_rows_ = stride_rows;
+    stride_cols_ = stride_cols;
+  }
+
  private:
   constexpr Index static_window_param(Index window) const {
     return (StaticWindow > 0 ? StaticWindow : window);
@@ -273,10 +320,12 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
-  const Index window_rows_;
-  const Index window_cols_;
-  const Index stride_rows_;
-  const Index stride_cols_;
+  Index window_rows_;
+  Index window_cols_;
+  Index stride_rows_;
+  Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -317,6 +366,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
@@ -345,9 +396,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index channel = tensor_idx.s1;
       const Index feature = tensor_idx.s0;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -392,6 +443,20 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
     }
   }
 
+  /**
+   * Replace the runtime window and stride sizes. Used to pass in values from
+   * specialization constants, so that the JIT compiler can treat them as
+   * compile time constants.
+   */
+  inline SNN_ALWAYS_INLINE void specialize(Index window_rows, Index window_cols,
+                                           Index stride_rows,
+                                           Index stride_cols) {
+    window_rows_ = window_rows;
+    window_cols_ = window_cols;
+    stride_rows_ = stride_rows;
+    stride_cols_ = stride_cols;
+  }
+
  private:
   constexpr Index static_out_param(Index out) const {
     return (StaticOut > 0 ? StaticOut : out);
@@ -409,10 +474,12 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
-  const Index window_rows_;
-  const Index window_cols_;
-  const Index stride_rows_;
-  const Index stride_cols_;
+  Index window_rows_;
+  Index window_cols_;
+  Index stride_rows_;
+  Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -23,9 +23,9 @@ namespace conv2d {
 namespace internal {
 namespace direct {
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
-          int StaticStride, int VectorWidth, bool isUSM>
+          int StaticStride, int VectorWidth, bool isUSM, typename ComputeT>
 struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
-                    StaticStride, VectorWidth, layout::NHWC, isUSM> {
+                    StaticStride, VectorWidth, layout::NHWC, isUSM, ComputeT> {
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
 
   using ScalarType = T;
@@ -35,8 +35,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using LoadData = helpers::io::Load<DataType>;
   using StoreData = helpers::io::Store<DataType>;
 
+  using ComputeType =
+      typename helpers::VectorType<ComputeT, VectorWidth>::type;
+
   DirectConv2D(const Conv2DParams& params, const ReadMem<const T, isUSM> input,
-               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output)
+               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output,
+               EpilogueOp<T, isUSM> const& epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features / VectorWidth},
         div_features_{params.features / VectorWidth},
@@ -51,13 +55,16 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
         input_mem_{input},
         filter_mem_{filter},
-        output_mem_{output} {}
+        output_mem_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
     Index index = item.get_id(0);
@@ -89,7 +96,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
       const Index rstart = row_window_struct.window_start;
       const Index firstr = row_window_struct.filter_start;
 
-      DataType out_val{0};
+      ComputeType out_val{0};
 
       const auto input_data_n =
           input_data + batch * in_cols_ * in_rows_ * channels_;
@@ -99,15 +106,16 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
 
       Index in_row_idx = rstart * in_cols_ * channels_;
       Index fil_row_idx = firstr * col_window * channels_ * features_;
-      for (Index r = rstart, i = firstr; i < row_window; ++r, ++i,
-                 in_row_idx += in_cols_ * channels_,
+      for (Index r = rstart, i = firstr; i < row_window; r += dilation_rows_,
+                 ++i, in_row_idx += dilation_rows_ * in_cols_ * channels_,
                  fil_row_idx += col_window * channels_ * features_) {
         if (r >= 0 && r < in_rows_) {
           Index in_col_idx = in_row_idx + cstart * channels_;
           Index fil_col_idx = fil_row_idx + firstc * channels_ * features_;
 
-          for (Index c = cstart, j = firstc; j < col_window; ++c, ++j,
-                     in_col_idx += channels_,
+          for (Index c = cstart, j = firstc; j < col_window;
+               c += dilation_cols_, ++j,
+                     in_col_idx += dilation_cols_ * channels_,
                      fil_col_idx += channels_ * features_) {
             if (c >= 0 && c < in_cols_) {
               Index idx = in_col_idx;
@@ -115,8 +123,10 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
 
               for (Index channel = 0; channel < channels_;
                    ++channel, ++idx, k_idx += features_) {
-                DataType in_val = DataType{LoadScalar()(input_data_n, idx)};
-                DataType fil_vals = LoadData()(filter_data_n, k_idx);
+                ComputeType in_val = ComputeType{
+                    static_cast<ComputeT>(LoadScalar()(input_data_n, idx))};
+                ComputeType fil_vals = helpers::convert_vector<ComputeT>(
+                    LoadData()(filter_data_n, k_idx));
 
                 out_val = helpers::math::mad(in_val, fil_vals, out_val);
               }  // channel loop
@@ -125,10 +135,26 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }
       }  // row loop
 
-      StoreData()(output_data, index * VectorWidth, out_val);
+      DataType result = helpers::convert_vector<T>(out_val);
+      result = epilogue_.apply(result, feature, index * VectorWidth);
+      StoreData()(output_data, index * VectorWidth, result);
     }
   }
 
+  /**
+   * Replace the runtime window and stride sizes. Used to pass in values from
+   * specialization constants, so that the JIT compiler can treat them as
+   * compile time constants.
+   */
+  inline SNN_ALWAYS_INLINE void specialize(Index window_rows, Index window_cols,
+                                           Index stride_rows,
+                                           Index stride_cols) {
+    window_rows_ = window_rows;
+    window_cols_ = window_cols;
+    stride_rows_ = stride_rows;
+    stride_cols_ = stride_cols;
+  }
+
  private:
   /** Check whether the window size is available at compile time or whether the
    * runtime value has to be used. */
@@ -150,10 +176,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
-  const Index window_rows_;
-  const Index window_cols_;
-  const Index stride_rows_;
-  const Index stride_cols_;
+  Index window_rows_;
+  Index window_cols_;
+  Index stride_rows_;
+  Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -161,6 +189,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
+  const EpilogueOp<T, isUSM> epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, int VectorWidth, bool isUSM>
@@ -193,12 +222,16 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{static_window_param(params.window_rows) - params.pad_rows -
-                  1},
-        pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
-                  1},
+        pad_rows_{(static_window_param(params.window_rows) - 1) *
+                      params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(static_window_param(params.window_cols) - 1) *
+                      params.dilation_cols -
+                  params.pad_cols},
         input_mem_{input},
         filter_mem_{filter},
         output_mem_{output} {}
@@ -241,24 +274,29 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
+      // The padding and window start indices are computed for the dilated
+      // window, in which only every dilation-th element is part of the filter.
+      const Index dilated_row_window = (row_window - 1) * dilation_rows_ + 1;
+      const Index dilated_col_window = (col_window - 1) * dilation_cols_ + 1;
+
       Index in_row_idx = rstart * out_cols_ * channels_;
-      Index fil_row_idx =
-          (row_window - firstr - 1) * col_window * features_ * channels_;
-      for (Index r = rstart, i = firstr; i < row_window; ++r, i += row_stride,
-                 in_row_idx += out_cols_ * channels_,
-                 fil_row_idx -= row_stride * col_window * features_ *
-                                                         channels_) {
-        if (r >= 0 && r < out_rows_) {
+      Index fil_row = dilated_row_window - firstr - 1;
+      for (Index r = rstart, i = firstr; i < dilated_row_window; ++r,
+                 i += row_stride, in_row_idx += out_cols_ * channels_,
+                 fil_row -= row_stride) {
+        if (r >= 0 && r < out_rows_ && fil_row % dilation_rows_ == 0) {
           Index in_col_idx = in_row_idx + cstart * channels_;
-          Index fil_col_idx =
-              fil_row_idx + (col_window - firstc - 1) * features_ * channels_;
+          Index fil_row_idx =
+              (fil_row / dilation_rows_) * col_window * features_ * channels_;
+          Index fil_col = dilated_col_window - firstc - 1;
 
-          for (Index c = cstart, j = firstc; j < col_window; ++c,
+          for (Index c = cstart, j = firstc; j < dilated_col_window; ++c,
                      j += col_stride, in_col_idx += channels_,
-                     fil_col_idx -= col_stride * features_ * channels_) {
-            if (c >= 0 && c < out_cols_) {
+                     fil_col -= col_stride) {
+            if (c >= 0 && c < out_cols_ && fil_col % dilation_cols_ == 0) {
               Index idx = in_col_idx;
-              Index k_idx = fil_col_idx;
+              Index k_idx = fil_row_idx +
+                            (fil_col / dilation_cols_) * features_ * channels_;
 
               for (Index channel = 0; channel < channels_;
                    channel += VectorWidth, idx += VectorWidth,
@@ -277,6 +315,20 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
     }
   }
 
+  /**
+   * Replace the runtime window and stride sizes. Used to pass in values from
+   * specialization constants, so that the JIT compiler can treat them as
+   * compile time constants.
+   */
+  inline SNN_ALWAYS_INLINE void specialize(Index window_rows, Index window_cols,
+                                           Index stride_rows,
+                                           Index stride_cols) {
+    window_rows_ = window_rows;
+    window_cols_ = window_cols;
+    stride_rows_ = stride_rows;
+    stride_cols_ = stride_cols;
+  }
+
  private:
   constexpr Index static_window_param(Index window) const {
     return (StaticWindow > 0 ? StaticWindow : window);
@@ -294,10 +346,12 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
-  const Index window_rows_;
-  const Index window_cols_;
-  const Index stride_rows_;
-  const Index stride_cols_;
+  Index window_rows_;
+  Index window_cols_;
+  Index stride_rows_;
+  Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -345,6 +399,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
@@ -372,9 +428,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index col_idx = tensor_idx.s1;
       const Index row_idx = tensor_idx.s0;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -419,6 +475,20 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
     }
   }
 
+  /**
+   * Replace the runtime window and stride sizes. Used to pass in values from
+   * specialization constants, so that the JIT compiler can treat them as
+   * compile time constants.
+   */
+  inline SNN_ALWAYS_INLINE void specialize(Index window_rows, Index window_cols,
+                                           Index stride_rows,
+                                           Index stride_cols) {
+    window_rows_ = window_rows;
+    window_cols_ = window_cols;
+    stride_rows_ = stride_rows;
+    stride_cols_ = stride_cols;
+  }
+
  private:
   constexpr Index static_out_param(Index out) const {
     return (StaticOut > 0 ? StaticOut : out);
@@ -436,10 +506,12 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
-  const Index window_rows_;
-  const Index window_cols_;
-  const Index stride_rows_;
-  const Index stride_cols_;
+  Index window_rows_;
+  Index window_cols_;
+  Index stride_rows_;
+  Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "portdnn/internal/conv2d/direct.h"
+#include "portdnn/internal/conv2d/epilogue.h"
 
 #include "portdnn/format_type.h"
 #include "portdnn/mem_object.h"
@@ -87,66 +88,74 @@ inline bool can_use_vector_width(Conv2DParams const& params, int const width) {
 /**
  * \brief The helper ensures that only the instantiated symbols are used.
  */
-template <typename T, typename Index, typename ConvType, bool UseFastDiv,
-          int Window, int Stride, int VectorWidth, typename Layout,
-          template <typename> class MemObj>
+template <typename T, typename ComputeT, typename Index, typename ConvType,
+          bool UseFastDiv, int Window, int Stride, int VectorWidth,
+          typename Layout, template <typename> class MemObj>
 struct queue_kernel_helper {
   SNNStatus operator()(MemObj<T const>&, MemObj<T const>&, MemObj<T>&,
-                       Conv2DParams const&, Index, cl::sycl::queue&,
+                       EpilogueMem<T, MemObj>&, Conv2DParams const&, Index,
+                       cl::sycl::queue&,
                        const std::vector<cl::sycl::event>& events) {
     SNN_UNUSED_VAR(events)
     return StatusCode::InvalidAlgorithm;
   }
 };
 
-template <typename T, typename Index, typename ConvType, bool UseFastDiv,
-          int Window, int Stride, int VectorWidth,
+template <typename T, typename ComputeT, typename Index, typename ConvType,
+          bool UseFastDiv, int Window, int Stride, int VectorWidth,
           template <typename> class MemObj>
-struct queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
-                           VectorWidth, layout::NHWC, MemObj> {
+struct queue_kernel_helper<T, ComputeT, Index, ConvType, UseFastDiv, Window,
+                           Stride, VectorWidth, layout::NHWC, MemObj> {
   SNNStatus operator()(MemObj<T const>& input, MemObj<T const>& filter,
-                       MemObj<T>& output, Conv2DParams const& params,
-                       Index output_size, cl::sycl::queue& queue,
+                       MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                       Conv2DParams const& params, Index output_size,
+                       cl::sycl::queue& queue,
                        const std::vector<cl::sycl::event>& events) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
-                               VectorWidth, layout::NHWC, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+                               VectorWidth, layout::NHWC, MemObj, ComputeT>(
+        input, filter, output, epilogue, params, output_size, queue, events);
   }
 };
 
 #ifdef SNN_ENABLE_NCHW
+// The NCHW kernels always accumulate in the data type.
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, template <typename> class MemObj>
-struct queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride, 1,
-                           layout::NCHW, MemObj> {
+struct queue_kernel_helper<T, T, Index, ConvType, UseFastDiv, Window, Stride,
+                           1, layout::NCHW, MemObj> {
   SNNStatus operator()(MemObj<T const>& input, MemObj<T const>& filter,
-                       MemObj<T>& output, Conv2DParams const& params,
-                       Index output_size, cl::sycl::queue& queue,
+                       MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                       Conv2DParams const& params, Index output_size,
+                       cl::sycl::queue& queue,
                        const std::vector<cl::sycl::event>& events) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                /*VectorWidth=*/1, layout::NCHW, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   }
 };
 #endif
 
-template <typename T, typename Index, typename ConvType, bool UseFastDiv,
-          int Window, int Stride, int VectorWidth,
+template <typename T, typename ComputeT, typename Index, typename ConvType,
+          bool UseFastDiv, int Window, int Stride, int VectorWidth,
           template <typename> class MemObj>
 SNNStatus launch_with_fast_div(MemObj<T const>& input, MemObj<T const>& filter,
-                               MemObj<T>& output, Conv2DParams const& params,
-                               Index output_size, cl::sycl::queue& queue,
+                               MemObj<T>& output,
+                               EpilogueMem<T, MemObj>& epilogue,
+                               Conv2DParams const& params, Index output_size,
+                               cl::sycl::queue& queue,
                                const std::vector<cl::sycl::event>& events) {
   if (params.input_format == DataFormat::NCHW &&
       params.filter_format == FilterFormat::FCHW) {
-    return queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
-                               VectorWidth, layout::NCHW, MemObj>()(
-        input, filter, output, params, output_size, queue, events);
+    return queue_kernel_helper<T, ComputeT, Index, ConvType, UseFastDiv,
+                               Window, Stride, VectorWidth, layout::NCHW,
+                               MemObj>()(input, filter, output, epilogue,
+                                         params, output_size, queue, events);
   } else if (params.input_format == DataFormat::NHWC &&
              params.filter_format == FilterFormat::HWCF) {
-    return queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
-                               VectorWidth, layout::NHWC, MemObj>()(
-        input, filter, output, params, output_size, queue, events);
+    return queue_kernel_helper<T, ComputeT, Index, ConvType, UseFastDiv,
+                               Window, Stride, VectorWidth, layout::NHWC,
+                               MemObj>()(input, filter, output, epilogue,
+                                         params, output_size, queue, events);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -155,21 +164,26 @@ SNNStatus launch_with_fast_div(MemObj<T const>& input, MemObj<T const>& filter,
  * Check whether fast divisions can be used for the convolution, and launch
  * the convolution kernel to do the computation.
  */
-template <typename T, typename Index, typename ConvType, int Window, int Stride,
-          int VectorWidth, template <typename> class MemObj>
+template <typename T, typename ComputeT, typename Index, typename ConvType,
+          int Window, int Stride, int VectorWidth,
+          template <typename> class MemObj>
 SNNStatus launch_with_vector(MemObj<T const>& input, MemObj<T const>& filter,
-                             MemObj<T>& output, Conv2DParams const& params,
-                             Index output_size, cl::sycl::queue& queue,
+                             MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
+                             Conv2DParams const& params, Index output_size,
+                             cl::sycl::queue& queue,
                              const std::vector<cl::sycl::event>& events) {
   auto kernel_params = direct::get_kernel_params<ConvType>(params);
   if (can_use_fast_div<ConvType>(kernel_params, VectorWidth)) {
-    return launch_with_fast_div<T, Index, ConvType, true, Window, Stride,
-                                VectorWidth, MemObj>(
-        input, filter, output, kernel_params, output_size, queue, events);
+    return launch_with_fast_div<T, ComputeT, Index, ConvType, true, Window,
+                                Stride, VectorWidth, MemObj>(
+        input, filter, output, epilogue, kernel_params, output_size, queue,
+        events);
   } else {
-    return launch_with_fast_div<T, Index, ConvType, false, Window, Stride,
-                                VectorWidth, MemObj>(
-        input, filter, output, kernel_params, output_size, queue, events);
+    return launch_with_fast_div<T, ComputeT, Index, ConvType, false, Window,
+                                Stride, VectorWidth, MemObj>(
+        input, filter, output, epilogue, kernel_params, output_size, queue,
+        events);
   }
 }
 
@@ -177,21 +191,25 @@ SNNStatus launch_with_vector(MemObj<T const>& input, MemObj<T const>& filter,
  * Check which vector widths can be used for the convolution, and launch
  * the convolution kernel to do the computation.
  */
-template <typename T, typename Index, typename ConvType, int Window, int Stride,
-          template <typename> class MemObj>
+template <typename T, typename ComputeT, typename Index, typename ConvType,
+          int Window, int Stride, template <typename> class MemObj>
 SNNStatus launch_with_index(MemObj<T const>& input, MemObj<T const>& filter,
-                            MemObj<T>& output, Conv2DParams const& params,
-                            Index output_size, cl::sycl::queue& queue,
+                            MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                            Conv2DParams const& params, Index output_size,
+                            cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
   if (can_use_vector_width<ConvType>(params, 4)) {
-    return launch_with_vector<T, Index, ConvType, Window, Stride, 4, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+    return launch_with_vector<T, ComputeT, Index, ConvType, Window, Stride, 4,
+                              MemObj>(input, filter, output, epilogue, params,
+                                      output_size, queue, events);
   } else if (can_use_vector_width<ConvType>(params, 2)) {
-    return launch_with_vector<T, Index, ConvType, Window, Stride, 2, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+    return launch_with_vector<T, ComputeT, Index, ConvType, Window, Stride, 2,
+                              MemObj>(input, filter, output, epilogue, params,
+                                      output_size, queue, events);
   } else {
-    return launch_with_vector<T, Index, ConvType, Window, Stride, 1, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+    return launch_with_vector<T, ComputeT, Index, ConvType, Window, Stride, 1,
+                              MemObj>(input, filter, output, epilogue, params,
+                                      output_size, queue, events);
   }
 }
 
@@ -199,10 +217,11 @@ SNNStatus launch_with_index(MemObj<T const>& input, MemObj<T const>& filter,
  * Check what data type is required to fit the index sizes, and launch the
  * required kernel.
  */
-template <typename T, typename ConvType, int Window, int Stride,
-          template <typename> class MemObj>
+template <typename T, typename ComputeT, typename ConvType, int Window,
+          int Stride, template <typename> class MemObj>
 SNNStatus launch_with_static_sizes(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events) {
@@ -210,16 +229,18 @@ SNNStatus launch_with_static_sizes(MemObj<T const>& input,
   size_t output_size = conv_sizes.output_size;
   if (output_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
-    return launch_with_index<T, int64_t, ConvType, Window, Stride, MemObj>(
-        input, filter, output, params, static_cast<int64_t>(output_size), queue,
-        events);
+    return launch_with_index<T, ComputeT, int64_t, ConvType, Window, Stride,
+                             MemObj>(input, filter, output, epilogue, params,
+                                     static_cast<int64_t>(output_size), queue,
+                                     events);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
-    return launch_with_index<T, int32_t, ConvType, Window, Stride, MemObj>(
-        input, filter, output, params, static_cast<int32_t>(output_size), queue,
-        events);
+    return launch_with_index<T, ComputeT, int32_t, ConvType, Window, Stride,
+                             MemObj>(input, filter, output, epilogue, params,
+                                     static_cast<int32_t>(output_size), queue,
+                                     events);
   }
 }
 }  // namespace
@@ -227,56 +248,66 @@ SNNStatus launch_with_static_sizes(MemObj<T const>& input,
  * Use static window and stride sizes for the most common cases, or fall back
  * to using dynamic window and strides. This allows the compiler to make use of
  * the static window and stride sizes to better optimise when possible.
+ *
+ * When specialization constants are enabled a single kernel is used for all
+ * window and stride sizes, which is specialized for each size at JIT time.
  */
-template <typename T, typename ConvType, template <typename> class MemObj>
+template <typename T, typename ConvType, typename ComputeT,
+          template <typename> class MemObj>
 SNNStatus launch_direct(MemObj<T const>& input, MemObj<T const>& filter,
-                        MemObj<T>& output, Conv2DParams const& params,
-                        cl::sycl::queue& queue,
+                        MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                        Conv2DParams const& params, cl::sycl::queue& queue,
                         const std::vector<cl::sycl::event>& events) {
+#if defined(SNN_CONV2D_SPEC_CONSTANT_DIRECT)
+  return launch_with_static_sizes<T, ComputeT, ConvType, -1, -1, MemObj>(
+      input, filter, output, epilogue, params, queue, events);
+#else
 #ifdef SNN_CONV2D_STATIC_DIRECT
   if (can_use_static_conv<ConvType>(params, 1, 1)) {
-    return launch_with_static_sizes<T, ConvType, 1, 1, MemObj>(
-        input, filter, output, params, queue, events);
+    return launch_with_static_sizes<T, ComputeT, ConvType, 1, 1, MemObj>(
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 3, 1)) {
-    return launch_with_static_sizes<T, ConvType, 3, 1, MemObj>(
-        input, filter, output, params, queue, events);
+    return launch_with_static_sizes<T, ComputeT, ConvType, 3, 1, MemObj>(
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 3, 2)) {
-    return launch_with_static_sizes<T, ConvType, 3, 2, MemObj>(
-        input, filter, output, params, queue, events);
+    return launch_with_static_sizes<T, ComputeT, ConvType, 3, 2, MemObj>(
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 5, 1)) {
-    return launch_with_static_sizes<T, ConvType, 5, 1, MemObj>(
-        input, filter, output, params, queue, events);
+    return launch_with_static_sizes<T, ComputeT, ConvType, 5, 1, MemObj>(
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 5, 2)) {
-    return launch_with_static_sizes<T, ConvType, 5, 2, MemObj>(
-        input, filter, output, params, queue, events);
+    return launch_with_static_sizes<T, ComputeT, ConvType, 5, 2, MemObj>(
+        input, filter, output, epilogue, params, queue, events);
   } else
 #endif  // SNN_CONV2D_STATIC_DIRECT
   {
-    return launch_with_static_sizes<T, ConvType, 0, 0, MemObj>(
-        input, filter, output, params, queue, events);
+    return launch_with_static_sizes<T, ComputeT, ConvType, 0, 0, MemObj>(
+        input, filter, output, epilogue, params, queue, events);
   }
+#endif  // SNN_CONV2D_SPEC_CONSTANT_DIRECT
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEMOBJ)                   \
-  template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR, MEMOBJ>( \
-      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,   \
-      MEMOBJ<DTYPE> & output, Conv2DParams const& params,          \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events)
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, DIR, MEMOBJ)                   \
+  template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR, CTYPE, MEMOBJ>( \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,          \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue,      \
+      Conv2DParams const& params, cl::sycl::queue& queue,                 \
+      const std::vector<cl::sycl::event>& events)
 
 #ifdef SNN_ENABLE_USM
-#define INSTANTIATE_FOR_MEMOBJ(DTYPE, DIR)        \
-  INSTANTIATE_LAUNCHER(DTYPE, DIR, USMMemObject); \
-  INSTANTIATE_LAUNCHER(DTYPE, DIR, BufferMemObject);
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, DIR)        \
+  INSTANTIATE_LAUNCHER(DTYPE, CTYPE, DIR, USMMemObject); \
+  INSTANTIATE_LAUNCHER(DTYPE, CTYPE, DIR, BufferMemObject);
 #else
-#define INSTANTIATE_FOR_MEMOBJ(DTYPE, DIR) \
-  INSTANTIATE_LAUNCHER(DTYPE, DIR, BufferMemObject);
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, DIR) \
+  INSTANTIATE_LAUNCHER(DTYPE, CTYPE, DIR, BufferMemObject);
 
 #endif  // SNN_ENABLE_USM
 
-#define INSTANTIATE_FOR_TYPE(DTYPE)                        \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, conv_type::Forward);       \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, conv_type::InputBackprop); \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, conv_type::FilterBackprop);
+#define INSTANTIATE_FOR_TYPE(DTYPE)                               \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, DTYPE, conv_type::Forward);       \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, DTYPE, conv_type::InputBackprop); \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, DTYPE, conv_type::FilterBackprop);
 
 INSTANTIATE_FOR_TYPE(float);
 
@@ -286,6 +317,8 @@ INSTANTIATE_FOR_TYPE(double);
 
 #ifdef SNN_USE_HALF
 INSTANTIATE_FOR_TYPE(cl::sycl::half);
+// Half precision forward convolutions with single precision accumulation.
+INSTANTIATE_FOR_MEMOBJ(cl::sycl::half, float, conv_type::Forward);
 #endif  // SNN_USE_HALF
 
 #undef INSTANTIATE_FOR_TYPE
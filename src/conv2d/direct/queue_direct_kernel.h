@@ -21,17 +21,23 @@
 
 #include "portdnn/conv2d/params.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 /**
  * Queue a direct convolution kernel to the provided SYCL queue.
+ *
+ * The epilogue is only applied to forward convolutions. The convolution is
+ * accumulated as ComputeT.
  */
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout,
-          template <typename> class MemObj>
+          template <typename> class MemObj, typename ComputeT = T>
 SNNStatus queue_direct_kernel(MemObj<T const>& input, MemObj<T const>& filter,
                               MemObj<T>& output,
+                              EpilogueMem<T, MemObj>& epilogue,
                               Conv2DParams const& kernel_params,
                               Index output_size, cl::sycl::queue& queue,
                               const std::vector<cl::sycl::event>& events);
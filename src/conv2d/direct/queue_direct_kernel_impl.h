@@ -21,14 +21,73 @@
 #include "portdnn/helpers/minmax.h"
 #include "portdnn/helpers/ratio.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
+
 #include "src/conv2d/direct/kernels_nchw.h"
 #include "src/conv2d/direct/kernels_nhwc.h"
 #include "src/conv2d/direct/queue_direct_kernel.h"
+#include "src/conv2d/epilogue/epilogue_op.h"
 
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 
+#ifdef SNN_CONV2D_SPEC_CONSTANT_DIRECT
+namespace direct {
+/** Specialization constants holding the direct convolution window sizes. */
+inline constexpr cl::sycl::specialization_id<int> window_rows_id;
+inline constexpr cl::sycl::specialization_id<int> window_cols_id;
+/** Specialization constants holding the direct convolution strides. */
+inline constexpr cl::sycl::specialization_id<int> stride_rows_id;
+inline constexpr cl::sycl::specialization_id<int> stride_cols_id;
+}  // namespace direct
+#endif  // SNN_CONV2D_SPEC_CONSTANT_DIRECT
+
+/**
+ * Submit a direct convolution functor to the command group.
+ *
+ * A negative static window or stride size means that the kernel is compiled
+ * once for all sizes, with the window and stride sizes passed as
+ * specialization constants. The JIT compiler then specializes the kernel for
+ * the sizes of each convolution it is launched with.
+ */
+template <int Window, int Stride, typename Functor>
+void submit_direct_functor(cl::sycl::handler& cgh, Functor const& conv,
+                           size_t n_threads,
+                           Conv2DParams const& kernel_params) {
+#ifdef SNN_CONV2D_SPEC_CONSTANT_DIRECT
+  if constexpr (Window < 0 || Stride < 0) {
+    cgh.set_specialization_constant<direct::window_rows_id>(
+        kernel_params.window_rows);
+    cgh.set_specialization_constant<direct::window_cols_id>(
+        kernel_params.window_cols);
+    cgh.set_specialization_constant<direct::stride_rows_id>(
+        kernel_params.stride_rows);
+    cgh.set_specialization_constant<direct::stride_cols_id>(
+        kernel_params.stride_cols);
+    cgh.parallel_for(cl::sycl::range<1>{n_threads},
+                     [=](cl::sycl::item<1> item, cl::sycl::kernel_handler h) {
+                       Functor spec_conv{conv};
+                       spec_conv.specialize(
+                           h.get_specialization_constant<
+                               direct::window_rows_id>(),
+                           h.get_specialization_constant<
+                               direct::window_cols_id>(),
+                           h.get_specialization_constant<
+                               direct::stride_rows_id>(),
+                           h.get_specialization_constant<
+                               direct::stride_cols_id>());
+                       spec_conv(item);
+                     });
+  } else {
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  }
+#else
+  SNN_UNUSED_VAR(kernel_params)
+  cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+#endif  // SNN_CONV2D_SPEC_CONSTANT_DIRECT
+}
+
 template <typename ConvType, int VectorWidth, typename Index>
 Index calculate_required_threads(Index output_size) {
   if (std::is_same<ConvType, conv_type::InputBackprop>::value) {
@@ -40,15 +99,17 @@ Index calculate_required_threads(Index output_size) {
 
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout,
-          template <typename> class MemObj>
+          template <typename> class MemObj, typename ComputeT>
 SNNStatus queue_direct_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
                               MemObj<T>& out_mem,
+                              EpilogueMem<T, MemObj>& epilogue,
                               Conv2DParams const& kernel_params,
                               Index output_size, cl::sycl::queue& queue,
                               const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
   using Functor =
       direct::DirectConv2D<T, Index, ConvType, UseFastDiv, Window, Stride,
-                           VectorWidth, Layout, is_usm_obj_v<MemObj<T>, T> >;
+                           VectorWidth, Layout, is_usm, ComputeT>;
   cl::sycl::device device = queue.get_device();
   Index const workgroup_size =
       device.get_info<cl::sycl::info::device::max_work_group_size>();
@@ -63,9 +124,20 @@ SNNStatus queue_direct_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
     auto filter = fil_mem.read_mem(cgh);
     auto output = out_mem.write_mem(cgh);
 
-    Functor conv{kernel_params, input, filter, output};
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                        epilogue.bias.read_mem(cgh),
+                                        epilogue.residual.read_mem(cgh)};
+      Functor conv{kernel_params, input, filter, output, epilogue_op};
 
-    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+      submit_direct_functor<Window, Stride>(cgh, conv, n_threads,
+                                            kernel_params);
+    } else {
+      Functor conv{kernel_params, input, filter, output};
+
+      submit_direct_functor<Window, Stride>(cgh, conv, n_threads,
+                                            kernel_params);
+    }
   });
   return {event, StatusCode::OK};
 }
@@ -0,0 +1,109 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_EPILOGUE_EPILOGUE_OP_H_
+#define PORTDNN_SRC_CONV2D_EPILOGUE_EPILOGUE_OP_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/conv2d/epilogue.h"
+
+#include "portdnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Apply an activation function to a value, which may be a vector type.
+ */
+template <typename DataType>
+DataType SNN_ALWAYS_INLINE apply_activation(DataType value,
+                                            Activation activation) {
+  switch (activation) {
+    case Activation::Relu:
+      return cl::sycl::max(value, DataType{0});
+    case Activation::Relu6:
+      return cl::sycl::min(cl::sycl::max(value, DataType{0}), DataType{6});
+    case Activation::Tanh:
+      return cl::sycl::tanh(value);
+    case Activation::None:
+    default:
+      return value;
+  }
+}
+
+/**
+ * Device side implementation of a fused convolution epilogue.
+ *
+ * Convolution kernels hold one of these and pass each computed output value
+ * through apply() before writing it to memory, so the epilogue costs no extra
+ * passes over the output tensor.
+ */
+template <typename T, bool IsUSM>
+struct EpilogueOp {
+  EpilogueOp(EpilogueParams const& params, ReadMem<T const, IsUSM> const& bias,
+             ReadMem<T const, IsUSM> const& residual)
+      : add_bias_{params.add_bias},
+        add_residual_{params.add_residual},
+        activation_{params.activation},
+        output_scale_{static_cast<T>(params.output_scale)},
+        bias_mem_{bias},
+        residual_mem_{residual} {}
+
+  /**
+   * Apply the epilogue to a convolution output value.
+   *
+   * If DataType is a vector type then its elements must be consecutive
+   * features, stored at consecutive indices of the output tensor.
+   *
+   * \param value   The value computed by the convolution.
+   * \param feature The output feature of the first element of value.
+   * \param out_idx The index in the output tensor of the first element of
+   *                value.
+   * \return The value to write to the output tensor.
+   */
+  template <typename DataType, typename Index>
+  DataType SNN_ALWAYS_INLINE apply(DataType value, Index feature,
+                                   Index out_idx) const {
+    value *= DataType{output_scale_};
+    if (add_bias_) {
+      value += helpers::io::Load<DataType>()(bias_mem_.get_pointer(), feature);
+    }
+    if (add_residual_) {
+      value +=
+          helpers::io::Load<DataType>()(residual_mem_.get_pointer(), out_idx);
+    }
+    return apply_activation(value, activation_);
+  }
+
+ private:
+  bool const add_bias_;
+  bool const add_residual_;
+  Activation const activation_;
+  T const output_scale_;
+  ReadMem<T const, IsUSM> bias_mem_;
+  ReadMem<T const, IsUSM> residual_mem_;
+};
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_EPILOGUE_EPILOGUE_OP_H_
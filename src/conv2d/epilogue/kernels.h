@@ -0,0 +1,81 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+#define PORTDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/helpers/macros.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Kernel to apply an epilogue in place to a convolution output.
+ *
+ * Each thread handles VectorWidth consecutive elements of the output, which
+ * must all belong to consecutive features, so vectorization is only possible
+ * when the feature dimension is innermost.
+ */
+template <typename T, int VectorWidth, bool IsUSM>
+struct EpilogueFunctor {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+
+  EpilogueFunctor(size_t output_size, size_t n_features, size_t feature_stride,
+                  EpilogueOp<T, IsUSM> const& epilogue,
+                  ReadWriteMem<T, IsUSM> const& output)
+      : output_size_{output_size},
+        n_features_{n_features},
+        feature_stride_{feature_stride},
+        epilogue_{epilogue},
+        output_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    size_t const idx = item.get_id(0) * VectorWidth;
+    if (idx < output_size_) {
+      size_t const feature = (idx / feature_stride_) % n_features_;
+      auto output_ptr = output_.get_pointer();
+      DataType value = helpers::io::Load<DataType>()(
+          helpers::internal::as_const_ptr(output_ptr), idx);
+      value = epilogue_.apply(value, feature, idx);
+      helpers::io::Store<DataType>()(output_ptr, idx, value);
+    }
+  }
+
+ private:
+  /** Number of elements in the output tensor. */
+  size_t output_size_;
+  /** Number of features in the output tensor. */
+  size_t n_features_;
+  /** Distance in elements between consecutive features in the output. */
+  size_t feature_stride_;
+  /** Epilogue to apply to each output value. */
+  EpilogueOp<T, IsUSM> epilogue_;
+  /** Accessor to the output tensor. */
+  ReadWriteMem<T, IsUSM> output_;
+};
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
@@ -0,0 +1,87 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/format_type.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/params.h"
+
+#include "portdnn/internal/conv2d/epilogue.h"
+
+#include "src/conv2d/epilogue/queue_epilogue.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, template <typename> class MemObj>
+SNNStatus launch_epilogue(MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                          Conv2DParams const& params, cl::sycl::queue& queue,
+                          const std::vector<cl::sycl::event>& events) {
+  size_t const n_features = params.features;
+  if (params.input_format == sycldnn::DataFormat::NCHW) {
+    size_t const feature_stride = params.out_rows * params.out_cols;
+    return queue_epilogue<T, 1>(output, epilogue, n_features, feature_stride,
+                                queue, events);
+  }
+  if (n_features % 4 == 0) {
+    return queue_epilogue<T, 4>(output, epilogue, n_features, 1, queue,
+                                events);
+  } else if (n_features % 2 == 0) {
+    return queue_epilogue<T, 2>(output, epilogue, n_features, 1, queue,
+                                events);
+  } else {
+    return queue_epilogue<T, 1>(output, epilogue, n_features, 1, queue,
+                                events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, MEMOBJ)                          \
+  template SNN_EXPORT SNNStatus launch_epilogue<DTYPE, MEMOBJ>(      \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue, \
+      Conv2DParams const& params, cl::sycl::queue& queue,            \
+      const std::vector<cl::sycl::event>& events);
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE)       \
+  INSTANTIATE_LAUNCHER(DTYPE, USMMemObject) \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject)
+#else
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE) \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject)
+#endif
+INSTANTIATE_FOR_MEMOBJ(float)
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_MEMOBJ(double)
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_MEMOBJ(cl::sycl::half)
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_MEMOBJ
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
@@ -0,0 +1,124 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/matmul/params.h"
+
+#include "portdnn/internal/conv2d/epilogue.h"
+
+#include "src/conv2d/epilogue/queue_matmul_epilogue.h"
+#include "src/matmul/tile_table.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+// Launch the kernel with the given tile sizes, only checking the bounds of
+// the matrices when they are not a multiple of the tiles.
+template <typename T, bool TransposeLHS, bool TransposeRHS, int RowTile,
+          int AccTile, int ColTile, template <typename> class MemObj>
+SNNStatus launch_matmul_with_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                            MemObj<T>& output,
+                            EpilogueMem<T, MemObj>& epilogue,
+                            matmul::MatmulParams const& params,
+                            cl::sycl::queue& queue, size_t wg_rows,
+                            size_t wg_cols,
+                            const std::vector<cl::sycl::event>& events) {
+  auto kernel =
+      ((params.m % RowTile == 0) && (params.k % AccTile == 0) &&
+       (params.n % ColTile == 0))
+          ? queue_matmul_epilogue<T, TransposeLHS, TransposeRHS, RowTile,
+                                  AccTile, ColTile, false, MemObj>
+          : queue_matmul_epilogue<T, TransposeLHS, TransposeRHS, RowTile,
+                                  AccTile, ColTile, true, MemObj>;
+  return kernel(lhs, rhs, output, epilogue, params, queue, wg_rows, wg_cols,
+                events);
+}
+
+}  // namespace
+
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus launch_matmul_epilogue(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                                 MemObj<T>& output,
+                                 EpilogueMem<T, MemObj>& epilogue,
+                                 matmul::MatmulParams const& params,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events) {
+  // The tile sizes should match those generated in src/conv2d/CMakeLists.txt.
+  // Only the register tiled kernels take an output operation, so the
+  // configurations using the other kernels fall back to the 4x4x4 tiles.
+  switch (matmul::internal::default_tile_config(params)) {
+    case matmul::internal::TileConfig::SkinnyRows:
+      return launch_matmul_with_tiles<T, TransposeLHS, TransposeRHS, 1, 8, 4>(
+          lhs, rhs, output, epilogue, params, queue, 1, 64, events);
+    case matmul::internal::TileConfig::SkinnyCols:
+      return launch_matmul_with_tiles<T, TransposeLHS, TransposeRHS, 4, 8, 1>(
+          lhs, rhs, output, epilogue, params, queue, 64, 1, events);
+    default:
+      return launch_matmul_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4>(
+          lhs, rhs, output, epilogue, params, queue, 8, 4, events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, MEMOBJ)                      \
+  template SNN_EXPORT SNNStatus                                              \
+  launch_matmul_epilogue<DTYPE, TLHS, TRHS, MEMOBJ>(                         \
+      MEMOBJ<DTYPE const> & lhs, MEMOBJ<DTYPE const> & rhs,                  \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue,         \
+      matmul::MatmulParams const& params, cl::sycl::queue& queue,            \
+      const std::vector<cl::sycl::event>& events);
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS)          \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject) \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, USMMemObject)
+#else
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS) \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject)
+#endif  // SNN_ENABLE_USM
+
+#define INSTANTIATE_FOR_TYPE(DTYPE)          \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, true, true)  \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, false, true) \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, true, false) \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, false, false)
+
+INSTANTIATE_FOR_TYPE(float)
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double)
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half)
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_FOR_MEMOBJ
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
@@ -0,0 +1,67 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_IMPL_H_
+#define PORTDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_IMPL_H_
+
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/helpers/ratio.h"
+
+#include "portdnn/internal/conv2d/epilogue.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+#include "src/conv2d/epilogue/kernels.h"
+#include "src/conv2d/epilogue/queue_epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, int VectorWidth, template <typename> class MemObj>
+SNNStatus queue_epilogue(MemObj<T>& output_mem,
+                         EpilogueMem<T, MemObj>& epilogue, size_t n_features,
+                         size_t feature_stride, cl::sycl::queue& queue,
+                         const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = EpilogueFunctor<T, VectorWidth, is_usm>;
+  cl::sycl::device device = queue.get_device();
+  size_t const workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+
+  size_t const output_size = output_mem.get_extent();
+  size_t const n_threads = helpers::round_up_to_nearest_multiple(
+      output_size / VectorWidth, workgroup_size);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto output = output_mem.read_write_mem(cgh);
+    EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                      epilogue.bias.read_mem(cgh),
+                                      epilogue.residual.read_mem(cgh)};
+    Functor functor{output_size, n_features, feature_stride, epilogue_op,
+                    output};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return SNNStatus{event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_IMPL_H_
@@ -0,0 +1,53 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_EPILOGUE_QUEUE_MATMUL_EPILOGUE_H_
+#define PORTDNN_SRC_CONV2D_EPILOGUE_QUEUE_MATMUL_EPILOGUE_H_
+
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/matmul/params.h"
+
+#include "portdnn/internal/conv2d/epilogue.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Enqueue a matrix multiply kernel which applies an epilogue to each output
+ * block in registers before it is stored.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, int RowTile,
+          int AccTile, int ColTile, bool CheckBounds,
+          template <typename> class MemObj>
+SNNStatus queue_matmul_epilogue(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                                MemObj<T>& output,
+                                EpilogueMem<T, MemObj>& epilogue,
+                                matmul::MatmulParams const& params,
+                                cl::sycl::queue& queue, size_t wg_row,
+                                size_t wg_col,
+                                const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_EPILOGUE_QUEUE_MATMUL_EPILOGUE_H_
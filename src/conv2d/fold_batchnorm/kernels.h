@@ -0,0 +1,130 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_FOLD_BATCHNORM_KERNELS_H_
+#define PORTDNN_SRC_CONV2D_FOLD_BATCHNORM_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/helpers/macros.h"
+
+#include <stddef.h>
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace fold_batchnorm {
+
+/**
+ * Kernel to fold a frozen batchnorm into the filter and bias of the
+ * convolution which precedes it.
+ *
+ * The batchnorm computes gamma * (x - mean) / sqrt(variance + epsilon) + beta
+ * for each output feature, so scaling the filter of each feature by
+ * gamma / sqrt(variance + epsilon) and adjusting the bias gives the same
+ * result as the convolution followed by the batchnorm.
+ *
+ * Each thread computes one element of the folded filter, and the first
+ * n_features threads also compute the folded bias. The feature of a filter
+ * element is (index / feature_stride) % n_features, which covers both filter
+ * formats with the features innermost and those with the features outermost.
+ */
+template <typename T, bool IsUSM>
+struct FoldBatchNormKernel {
+  /** Half precision scales are computed in float to avoid underflow. */
+  using ScaleT = typename std::conditional<
+      std::is_same<T, cl::sycl::half>::value, float, T>::type;
+
+  FoldBatchNormKernel(size_t filter_size, size_t n_features,
+                      size_t feature_stride, float epsilon, bool has_bias,
+                      ReadMem<T const, IsUSM> const& filter,
+                      ReadMem<T const, IsUSM> const& bias,
+                      ReadMem<T const, IsUSM> const& beta,
+                      ReadMem<T const, IsUSM> const& gamma,
+                      ReadMem<T const, IsUSM> const& mean,
+                      ReadMem<T const, IsUSM> const& variance,
+                      WriteMem<T, IsUSM> const& folded_filter,
+                      WriteMem<T, IsUSM> const& folded_bias)
+      : filter_size_{filter_size},
+        n_features_{n_features},
+        feature_stride_{feature_stride},
+        epsilon_{epsilon},
+        has_bias_{has_bias},
+        filter_{filter},
+        bias_{bias},
+        beta_{beta},
+        gamma_{gamma},
+        mean_{mean},
+        variance_{variance},
+        folded_filter_{folded_filter},
+        folded_bias_{folded_bias} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    size_t const idx = item.get_id(0);
+    if (idx < filter_size_) {
+      size_t const feature = (idx / feature_stride_) % n_features_;
+      auto filter_data = filter_.get_pointer();
+      auto folded_filter_data = folded_filter_.get_pointer();
+      folded_filter_data[idx] = static_cast<T>(
+          static_cast<ScaleT>(filter_data[idx]) * get_scale(feature));
+    }
+    if (idx < n_features_) {
+      auto beta_data = beta_.get_pointer();
+      auto mean_data = mean_.get_pointer();
+      auto folded_bias_data = folded_bias_.get_pointer();
+      ScaleT bias = static_cast<ScaleT>(0);
+      if (has_bias_) {
+        bias = static_cast<ScaleT>(bias_.get_pointer()[idx]);
+      }
+      folded_bias_data[idx] = static_cast<T>(
+          static_cast<ScaleT>(beta_data[idx]) +
+          (bias - static_cast<ScaleT>(mean_data[idx])) * get_scale(idx));
+    }
+  }
+
+ private:
+  /** Compute gamma / sqrt(variance + epsilon) for a feature. */
+  ScaleT SNN_ALWAYS_INLINE get_scale(size_t feature) const {
+    auto gamma_data = gamma_.get_pointer();
+    auto variance_data = variance_.get_pointer();
+    return static_cast<ScaleT>(gamma_data[feature]) /
+           cl::sycl::sqrt(static_cast<ScaleT>(variance_data[feature]) +
+                          static_cast<ScaleT>(epsilon_));
+  }
+
+  size_t const filter_size_;
+  size_t const n_features_;
+  size_t const feature_stride_;
+  float const epsilon_;
+  bool const has_bias_;
+  ReadMem<T const, IsUSM> filter_;
+  ReadMem<T const, IsUSM> bias_;
+  ReadMem<T const, IsUSM> beta_;
+  ReadMem<T const, IsUSM> gamma_;
+  ReadMem<T const, IsUSM> mean_;
+  ReadMem<T const, IsUSM> variance_;
+  WriteMem<T, IsUSM> folded_filter_;
+  WriteMem<T, IsUSM> folded_bias_;
+};
+
+}  // namespace fold_batchnorm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_FOLD_BATCHNORM_KERNELS_H_
@@ -0,0 +1,113 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/filter_format.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/fold_batchnorm_params.h"
+#include "portdnn/conv2d/params.h"
+
+#include "portdnn/helpers/ratio.h"
+
+#include "portdnn/internal/conv2d/fold_batchnorm.h"
+
+#include "src/conv2d/fold_batchnorm/kernels.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, template <typename> class MemObj, typename>
+SNNStatus launch_fold_batchnorm(
+    MemObj<T const>& filter_mem, MemObj<T const>& bias_mem,
+    MemObj<T const>& beta_mem, MemObj<T const>& gamma_mem,
+    MemObj<T const>& mean_mem, MemObj<T const>& variance_mem,
+    MemObj<T>& folded_filter_mem, MemObj<T>& folded_bias_mem,
+    Conv2DParams const& params, FoldBatchNormParams const& fold_params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  using Functor =
+      fold_batchnorm::FoldBatchNormKernel<T, is_usm_obj_v<MemObj<T>, T>>;
+  size_t const filter_size = folded_filter_mem.get_extent();
+  size_t const n_features = params.features;
+  // HWCF filters have the features innermost, while the FHWC and FCHW
+  // filters have the features outermost.
+  size_t const feature_stride = params.filter_format == FilterFormat::HWCF
+                                    ? 1
+                                    : filter_size / n_features;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const n_threads =
+      helpers::round_up_to_nearest_multiple(filter_size, workgroup_size);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto filter = filter_mem.read_mem(cgh);
+    auto bias = bias_mem.read_mem(cgh);
+    auto beta = beta_mem.read_mem(cgh);
+    auto gamma = gamma_mem.read_mem(cgh);
+    auto mean = mean_mem.read_mem(cgh);
+    auto variance = variance_mem.read_mem(cgh);
+    auto folded_filter = folded_filter_mem.write_mem(cgh);
+    auto folded_bias = folded_bias_mem.write_mem(cgh);
+    Functor functor(filter_size, n_features, feature_stride,
+                    fold_params.epsilon, fold_params.has_bias, filter, bias,
+                    beta, gamma, mean, variance, folded_filter, folded_bias);
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, MEM_OBJ)                              \
+  template SNN_EXPORT SNNStatus launch_fold_batchnorm<DTYPE, MEM_OBJ>(    \
+      MEM_OBJ<DTYPE const> & filter, MEM_OBJ<DTYPE const> & bias,         \
+      MEM_OBJ<DTYPE const> & beta, MEM_OBJ<DTYPE const> & gamma,          \
+      MEM_OBJ<DTYPE const> & mean, MEM_OBJ<DTYPE const> & variance,       \
+      MEM_OBJ<DTYPE> & folded_filter, MEM_OBJ<DTYPE> & folded_bias,       \
+      Conv2DParams const& params, FoldBatchNormParams const& fold_params, \
+      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events)
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE)        \
+  INSTANTIATE_LAUNCHER(DTYPE, USMMemObject); \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject)
+#else
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE) \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject)
+#endif
+INSTANTIATE_FOR_MEMOBJ(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_MEMOBJ(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_MEMOBJ(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_MEMOBJ
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
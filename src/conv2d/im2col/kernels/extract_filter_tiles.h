@@ -31,6 +31,14 @@ namespace conv2d {
 namespace internal {
 namespace im2col {
 
+/**
+ * Mirror the filter for the input backprop, and transpose it so that the
+ * features come before the channels.
+ *
+ * For grouped convolutions the filter for each group is made contiguous for
+ * strided groups, or the groups are kept as the inner-most dimension for
+ * interleaved groups, to match the batched matrix multiply.
+ */
 template <typename T, typename Index, bool isUSM>
 struct ExtractFilterTiles {
   using Load = helpers::io::Load<T>;
@@ -40,11 +48,14 @@ struct ExtractFilterTiles {
                      ReadMem<T const, isUSM> const& input,
                      WriteMem<T, isUSM> const& output)
       : n_items_{params.window_rows * params.window_cols * params.channels *
-                 params.features},
+                 params.features / params.groups},
         n_window_rows_{params.window_rows},
         n_window_cols_{params.window_cols},
-        n_channels_{params.channels},
+        n_channels_{params.channels / params.groups},
         n_features_{params.features},
+        n_groups_{params.groups},
+        n_group_features_{params.features / params.groups},
+        interleaved_{params.group_format == sycldnn::BatchFormat::INTERLEAVED},
         input_mem_{input},
         output_mem_{output} {}
 
@@ -68,10 +79,25 @@ struct ExtractFilterTiles {
 
       Index const out_row = n_window_rows_ - 1 - row;
       Index const out_col = n_window_cols_ - 1 - col;
-      Index const out_idx =
-          ((out_row * n_window_cols_ + out_col) * n_features_ + feature) *
-              n_channels_ +
-          channel;
+      Index const window_idx = out_row * n_window_cols_ + out_col;
+      Index out_idx;
+      if (interleaved_) {
+        Index const group = feature % n_groups_;
+        Index const group_feature = feature / n_groups_;
+        out_idx =
+            ((window_idx * n_group_features_ + group_feature) * n_channels_ +
+             channel) *
+                n_groups_ +
+            group;
+      } else {
+        Index const group = feature / n_group_features_;
+        Index const group_feature = feature % n_group_features_;
+        Index const group_window_idx =
+            group * n_window_rows_ * n_window_cols_ + window_idx;
+        out_idx = (group_window_idx * n_group_features_ + group_feature) *
+                      n_channels_ +
+                  channel;
+      }
       Store()(output_data, out_idx, in_val);
     }
   }
@@ -82,6 +108,9 @@ struct ExtractFilterTiles {
   Index const n_window_cols_;
   Index const n_channels_;
   Index const n_features_;
+  Index const n_groups_;
+  Index const n_group_features_;
+  bool const interleaved_;
   ReadMem<T const, isUSM> input_mem_;
   WriteMem<T, isUSM> output_mem_;
 };
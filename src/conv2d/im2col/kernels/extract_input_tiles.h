@@ -20,11 +20,13 @@
 
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 
 #include "portdnn/helpers/macros.h"
 #include "portdnn/helpers/minmax.h"
 
 #include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_element.h"
 #include "src/helpers/vector_io.h"
 #include "src/helpers/vector_type.h"
 #include "src/helpers/window_index.h"
@@ -35,7 +37,7 @@ namespace internal {
 namespace im2col {
 
 template <typename T, typename Index, int VectorWidth, typename ConvType,
-          bool isUSM>
+          typename Layout, bool isUSM>
 struct ExtractInputTiles;
 /**
  * Have one thread per input entry. That thread is then responsible for writing
@@ -43,7 +45,8 @@ struct ExtractInputTiles;
  * contraction.
  */
 template <typename T, typename Index, int VectorWidth, bool isUSM>
-struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
+struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward,
+                         layout::NHWC, isUSM> {
   using VecType = typename helpers::VectorType<T, VectorWidth>::type;
   using Load = helpers::io::Load<VecType>;
   using Store = helpers::io::Store<VecType>;
@@ -70,8 +73,12 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
         stride_cols_{params.stride_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{params.window_rows - params.pad_rows - 1},
-        pad_cols_{params.window_cols - params.pad_cols - 1},
+        pad_rows_{(params.window_rows - 1) * params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(params.window_cols - 1) * params.dilation_cols -
+                  params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -127,18 +134,25 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
       Index const rstart = row_window_struct.window_start;
       Index const firstr = row_window_struct.filter_start;
 
-      for (Index r = rstart, in_r = window_rows_ - 1 - firstr; in_r >= 0;
+      // The window indices are computed in the dilated window, where only
+      // every dilation-th entry corresponds to an element of the filter.
+      Index const dilated_rows = (window_rows_ - 1) * dilation_rows_ + 1;
+      Index const dilated_cols = (window_cols_ - 1) * dilation_cols_ + 1;
+
+      for (Index r = rstart, in_r = dilated_rows - 1 - firstr; in_r >= 0;
            ++r, in_r -= stride_rows_) {
-        if (r >= 0 && r < out_rows_) {
-          for (Index c = cstart, in_c = window_cols_ - 1 - firstc; in_c >= 0;
+        if (r >= 0 && r < out_rows_ && in_r % dilation_rows_ == 0) {
+          for (Index c = cstart, in_c = dilated_cols - 1 - firstc; in_c >= 0;
                ++c, in_c -= stride_cols_) {
-            if (c >= 0 && c < out_cols_) {
+            if (c >= 0 && c < out_cols_ && in_c % dilation_cols_ == 0) {
               auto tile_start =
                   output_data +
                   (((group * batch_ + batch) * out_rows_ + r) * out_cols_ + c) *
                       tile_size_;
-              Index tile_idx =
-                  (in_r * window_cols_ + in_c) * channels_ + group_channel;
+              Index tile_idx = ((in_r / dilation_rows_) * window_cols_ +
+                                in_c / dilation_cols_) *
+                                   channels_ +
+                               group_channel;
               Store()(tile_start, tile_idx, in_val);
             }
           }
@@ -163,13 +177,15 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
   Index const out_cols_;
   Index const pad_rows_;
   Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   ReadMem<T const, isUSM> input_accessor_;
   WriteMem<T, isUSM> output_accessor_;
 };
 
 template <typename T, typename Index, int VectorWidth, bool isUSM>
 struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
-                         isUSM> {
+                         layout::NHWC, isUSM> {
   using VecType = typename helpers::VectorType<T, VectorWidth>::type;
   using Load = helpers::io::Load<VecType>;
   using Store = helpers::io::Store<VecType>;
@@ -177,9 +193,17 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
   ExtractInputTiles(Index tile_size, Conv2DParams const& params,
                     ReadMem<T const, isUSM> const& input,
                     WriteMem<T, isUSM> const& output)
-      : tile_size_{tile_size},
+      : tile_size_{params.group_format == sycldnn::BatchFormat::STRIDED
+                       ? tile_size
+                       : tile_size * params.groups},
+        groups_{params.group_format == sycldnn::BatchFormat::STRIDED
+                    ? params.groups
+                    : 1},
         channels_{params.channels},
         features_{params.features},
+        group_features_{params.group_format == sycldnn::BatchFormat::STRIDED
+                            ? params.features / params.groups
+                            : params.features},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -191,6 +215,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -209,6 +235,21 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
       row_idx = tensor_idx.s1;
       batch = tensor_idx.s0;
     }
+
+    Index group;
+    Index group_feature;
+    if (groups_ == 1) {
+      group = 0;
+      group_feature = feature;
+    } else {
+      auto feature_groups_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              feature, group_features_, group_features_);
+
+      group = feature_groups_idx.s0;
+      group_feature = feature_groups_idx.s1;
+    }
+
     if (feature < features_ && col_idx < out_cols_ && row_idx < out_rows_ &&
         batch < batch_) {
       auto input_data = input_accessor_.get_pointer();
@@ -222,16 +263,19 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
       Index const cstart = col_idx * stride_cols_ - pad_cols_;
       Index const rstart = row_idx * stride_rows_ - pad_rows_;
 
-      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0; ++r, --in_r) {
+      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0;
+           r += dilation_rows_, --in_r) {
         if (r >= 0 && r < in_rows_) {
           for (Index c = cstart, in_c = window_cols_ - 1; in_c >= 0;
-               ++c, --in_c) {
+               c += dilation_cols_, --in_c) {
             if (c >= 0 && c < in_cols_) {
               auto tile_start =
                   output_data +
-                  ((batch * in_rows_ + r) * in_cols_ + c) * tile_size_;
+                  (((group * batch_ + batch) * in_rows_ + r) * in_cols_ + c) *
+                      tile_size_;
               Index tile_idx =
-                  (in_r * window_cols_ + in_c) * features_ + feature;
+                  (in_r * window_cols_ + in_c) * group_features_ +
+                  group_feature;
               Store()(tile_start, tile_idx, in_val);
             }
           }
@@ -242,8 +286,10 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
 
  private:
   Index const tile_size_;
+  Index const groups_;
   Index const channels_;
   Index const features_;
+  Index const group_features_;
   Index const batch_;
   Index const in_rows_;
   Index const in_cols_;
@@ -255,13 +301,15 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
   Index const out_cols_;
   Index const pad_rows_;
   Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   ReadMem<T const, isUSM> input_accessor_;
   WriteMem<T, isUSM> output_accessor_;
 };
 
 template <typename T, typename Index, int VectorWidth, bool isUSM>
 struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
-                         isUSM> {
+                         layout::NHWC, isUSM> {
   using VecType = typename helpers::VectorType<T, 1>::type;
   using Load = helpers::io::Load<VecType>;
   using Store = helpers::io::Store<VecType>;
@@ -270,6 +318,7 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
                     ReadMem<T const, isUSM> const& input,
                     WriteMem<T, isUSM> const& output)
       : tile_size_{tile_size},
+        group_channels_{params.channels / params.groups},
         channels_{params.channels},
         features_{params.features},
         batch_{params.batch},
@@ -304,6 +353,14 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
       batch = tensor_idx.s0;
     }
 
+    // Grouped filter backprop only supports strided groups, where the
+    // transform for each group is contiguous.
+    auto const channel_groups_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten2d(
+            channel, group_channels_, group_channels_);
+    Index const group = channel_groups_idx.s0;
+    Index const group_channel = channel_groups_idx.s1;
+
     if (channel < channels_ && col_idx < in_cols_ && row_idx < in_rows_ &&
         batch < batch_) {
       auto input_data = input_accessor_.get_pointer();
@@ -316,46 +373,42 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
 
       // c is the index in the padded output tensor (ie with lots of extra
       // zeros), but without the first padding. first_padded_c adds this extra
-      // padding.
+      // padding. In these kernel parameters the stride and dilation have been
+      // swapped, so an output index c_out and a window index c_win use this
+      // input if c == c_out * stride_cols_ + c_win * dilation_cols_.
       Index const c = col_idx + pad_cols_;
       Index const first_padded_c = c - (window_cols_ - 1) * dilation_cols_;
       // The first and last output indices affected by this input.
       Index const last_used_c = c / stride_cols_;
-      Index const cstart =
-          helpers::round_ratio_up(first_padded_c, stride_cols_);
+      Index const cstart = helpers::max(
+          helpers::round_ratio_up(first_padded_c, stride_cols_), Index{0});
       Index const cend = helpers::min(last_used_c + 1, out_cols_);
 
       Index const r = row_idx + pad_rows_;
       Index const last_used_r = r / stride_rows_;
       Index const first_padded_r = r - (window_rows_ - 1) * dilation_rows_;
-      Index const rstart =
-          helpers::round_ratio_up(first_padded_r, stride_rows_);
+      Index const rstart = helpers::max(
+          helpers::round_ratio_up(first_padded_r, stride_rows_), Index{0});
       Index const rend = helpers::min(last_used_r + 1, out_rows_);
 
-      Index init_r = rstart;
-      Index init_r_idx = window_rows_ - 1;
-      if (init_r < 0) {
-        Index n_inc =
-            helpers::round_ratio_up_above_zero(-init_r, dilation_rows_);
-        init_r_idx -= n_inc * stride_rows_;
-        init_r += n_inc * dilation_rows_;
-      }
-      Index init_c = cstart;
-      Index init_c_idx = window_cols_ - 1;
-      if (init_c < 0) {
-        Index n_inc =
-            helpers::round_ratio_up_above_zero(-init_c, dilation_cols_);
-        init_c_idx -= n_inc * stride_cols_;
-        init_c += n_inc * dilation_cols_;
-      }
-
-      for (Index r = init_r, in_r = init_r_idx; r < rend;
-           r += dilation_rows_, in_r -= stride_rows_) {
-        for (Index c = init_c, in_c = init_c_idx; c < cend;
-             c += dilation_cols_, in_c -= stride_cols_) {
+      for (Index out_r = rstart; out_r < rend; ++out_r) {
+        Index const win_r_offset = r - out_r * stride_rows_;
+        if (win_r_offset % dilation_rows_ != 0) {
+          continue;
+        }
+        Index const in_r = win_r_offset / dilation_rows_;
+        for (Index out_c = cstart; out_c < cend; ++out_c) {
+          Index const win_c_offset = c - out_c * stride_cols_;
+          if (win_c_offset % dilation_cols_ != 0) {
+            continue;
+          }
+          Index const in_c = win_c_offset / dilation_cols_;
           auto tile_start =
               output_data +
-              ((r * out_cols_ + c) * channels_ + channel) * tile_size_;
+              (((group * out_rows_ + out_r) * out_cols_ + out_c) *
+                   group_channels_ +
+               group_channel) *
+                  tile_size_;
           Index tile_idx =
               ((batch * window_rows_ + in_r) * window_cols_ + in_c);
           Store()(tile_start, tile_idx, in_val);
@@ -366,6 +419,7 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
 
  private:
   Index const tile_size_;
+  Index const group_channels_;
   Index const channels_;
   Index const features_;
   Index const batch_;
@@ -385,6 +439,115 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
   WriteMem<T, isUSM> output_accessor_;
 };
 
+/**
+ * Forward im2col transform for NCHW inputs.
+ *
+ * Each image is expanded into a (Channel * Window rows * Window cols) x
+ * (Output rows * Output cols) matrix, so that multiplying an FCHW filter by it
+ * gives the NCHW output for that image. Each thread computes VectorWidth
+ * consecutive output columns for one output row of one channel, so the writes
+ * are contiguous. When VectorWidth is larger than one the column stride must
+ * be 1, so the loads from each input row are contiguous too.
+ *
+ * Every entry in the transform is written, including the zeros in the padding,
+ * so the transform does not need to be zeroed first.
+ */
+template <typename T, typename Index, int VectorWidth, bool isUSM>
+struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward,
+                         layout::NCHW, isUSM> {
+  using VecType = typename helpers::VectorType<T, VectorWidth>::type;
+  using Load = helpers::io::Load<VecType>;
+  using Store = helpers::io::Store<VecType>;
+
+  ExtractInputTiles(Index tile_size, Conv2DParams const& params,
+                    ReadMem<T const, isUSM> const& input,
+                    WriteMem<T, isUSM> const& output)
+      : tile_size_{tile_size},
+        channels_{params.channels},
+        batch_{params.batch},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        input_accessor_{input},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<3> item) const {
+    Index const col = item.get_id(0) * VectorWidth;
+    Index const row = item.get_id(1);
+    Index const plane = item.get_id(2);
+
+    if (col < out_cols_ && row < out_rows_ && plane < batch_ * channels_) {
+      auto const plane_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              plane, channels_, channels_);
+      Index const batch = plane_idx.s0;
+      Index const channel = plane_idx.s1;
+
+      Index const n_pixels = out_rows_ * out_cols_;
+      auto input_data =
+          input_accessor_.get_pointer() + plane * in_rows_ * in_cols_;
+      auto output_data =
+          output_accessor_.get_pointer() + batch * tile_size_ * n_pixels +
+          channel * window_rows_ * window_cols_ * n_pixels +
+          row * out_cols_ + col;
+
+      Index const rstart = row * stride_rows_ - pad_rows_;
+      Index const cstart = col * stride_cols_ - pad_cols_;
+      for (Index r = 0; r < window_rows_; ++r) {
+        Index const in_row = rstart + r * dilation_rows_;
+        bool const valid_row = in_row >= 0 && in_row < in_rows_;
+        for (Index c = 0; c < window_cols_; ++c) {
+          Index const in_col = cstart + c * dilation_cols_;
+          VecType value{0};
+          if (valid_row) {
+            Index const in_idx = in_row * in_cols_ + in_col;
+            if (in_col >= 0 && in_col + VectorWidth <= in_cols_) {
+              value = Load()(input_data, in_idx);
+            } else {
+              SNN_PRAGMA_UNROLL
+              for (int v = 0; v < VectorWidth; ++v) {
+                if (in_col + v >= 0 && in_col + v < in_cols_) {
+                  helpers::vector_element::set(
+                      value, v, helpers::io::Load<T>()(input_data, in_idx + v));
+                }
+              }
+            }
+          }
+          Store()(output_data, (r * window_cols_ + c) * n_pixels, value);
+        }
+      }
+    }
+  }
+
+ private:
+  Index const tile_size_;
+  Index const channels_;
+  Index const batch_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  ReadMem<T const, isUSM> input_accessor_;
+  WriteMem<T, isUSM> output_accessor_;
+};
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
@@ -50,7 +50,7 @@ SNNStatus launch_filter_transform(MemObj<T const>& input, MemObj<T>& output,
                                   cl::sycl::queue& queue,
                                   const std::vector<cl::sycl::event>& events) {
   size_t thread_size = params.window_rows * params.window_cols *
-                       params.channels * params.features;
+                       params.channels * params.features / params.groups;
   if (thread_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
     return launch_with_index<T, int64_t>(input, output, params, thread_size,
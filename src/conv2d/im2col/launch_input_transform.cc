@@ -19,6 +19,7 @@
 
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 
 #include "portdnn/internal/conv2d/im2col/launch_input_transform.h"
 
@@ -28,6 +29,7 @@
 #include <stddef.h>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include <CL/sycl.hpp>
 
@@ -72,24 +74,40 @@ bool can_use_vector<conv_type::FilterBackprop>(Conv2DParams const& /*params*/,
   return false;
 }
 
+#ifdef SNN_ENABLE_NCHW
+/**
+ * Check whether a vector size can be used for the NCHW transform. The vectors
+ * cover neighbouring output columns, so must not span more than one output
+ * row and need contiguous input columns.
+ */
+bool can_use_nchw_vector(Conv2DParams const& params, int vector_width) {
+  return params.stride_cols == 1 && params.out_cols % vector_width == 0;
+}
+#endif  // SNN_ENABLE_NCHW
+
 template <typename T, typename Index, int VectorWidth, typename ConvType,
-          template <typename> class MemObj>
+          typename Layout, template <typename> class MemObj>
 SNNStatus launch_with_index(MemObj<T const>& input, MemObj<T>& output,
                             Conv2DParams const& params, int n_tiles,
                             int tile_size, cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
-  auto status = queue_zero_out_transform<T, VectorWidth>(
-      output, n_tiles, params.groups * tile_size, queue, events);
-  if (status.status != StatusCode::OK) {
-    return status;
+  if constexpr (std::is_same<Layout, layout::NCHW>::value) {
+    // The NCHW transform writes every entry, so does not need zeroing first.
+    return queue_input_transform<T, Index, VectorWidth, ConvType, Layout>(
+        input, output, params, tile_size, queue, events);
   } else {
+    auto status = queue_zero_out_transform<T, VectorWidth>(
+        output, n_tiles, params.groups * tile_size, queue, events);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
     std::vector<cl::sycl::event> dependencies{status.event};
-    return queue_input_transform<T, Index, VectorWidth, ConvType>(
+    return queue_input_transform<T, Index, VectorWidth, ConvType, Layout>(
         input, output, params, tile_size, queue, dependencies);
   }
 }
 
-template <typename T, int VectorWidth, typename ConvType,
+template <typename T, int VectorWidth, typename ConvType, typename Layout,
           template <typename> class MemObj>
 SNNStatus launch_with_vector(MemObj<T const>& input, MemObj<T>& output,
                              Conv2DParams const& params, int n_tiles,
@@ -98,13 +116,13 @@ SNNStatus launch_with_vector(MemObj<T const>& input, MemObj<T>& output,
   size_t thread_size = get_thread_size<ConvType>(params, VectorWidth);
   if (thread_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
-    return launch_with_index<T, int64_t, VectorWidth, ConvType>(
+    return launch_with_index<T, int64_t, VectorWidth, ConvType, Layout>(
         input, output, params, n_tiles, tile_size, queue, events);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
-    return launch_with_index<T, int32_t, VectorWidth, ConvType>(
+    return launch_with_index<T, int32_t, VectorWidth, ConvType, Layout>(
         input, output, params, n_tiles, tile_size, queue, events);
   }
 }
@@ -115,15 +133,34 @@ SNNStatus launch_input_transform(MemObj<T const>& input, MemObj<T>& output,
                                  Conv2DParams const& params, int n_tiles,
                                  int tile_size, cl::sycl::queue& queue,
                                  const std::vector<cl::sycl::event>& events) {
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      using Layout = layout::NCHW;
+      if (can_use_nchw_vector(params, 4)) {
+        return launch_with_vector<T, 4, ConvType, Layout>(
+            input, output, params, n_tiles, tile_size, queue, events);
+      } else if (can_use_nchw_vector(params, 2)) {
+        return launch_with_vector<T, 2, ConvType, Layout>(
+            input, output, params, n_tiles, tile_size, queue, events);
+      } else {
+        return launch_with_vector<T, 1, ConvType, Layout>(
+            input, output, params, n_tiles, tile_size, queue, events);
+      }
+    }
+#endif  // SNN_ENABLE_NCHW
+    return StatusCode::InvalidAlgorithm;
+  }
+  using Layout = layout::NHWC;
   if (can_use_vector<ConvType>(params, 4)) {
-    return launch_with_vector<T, 4, ConvType>(input, output, params, n_tiles,
-                                              tile_size, queue, events);
+    return launch_with_vector<T, 4, ConvType, Layout>(
+        input, output, params, n_tiles, tile_size, queue, events);
   } else if (can_use_vector<ConvType>(params, 2)) {
-    return launch_with_vector<T, 2, ConvType>(input, output, params, n_tiles,
-                                              tile_size, queue, events);
+    return launch_with_vector<T, 2, ConvType, Layout>(
+        input, output, params, n_tiles, tile_size, queue, events);
   } else {
-    return launch_with_vector<T, 1, ConvType>(input, output, params, n_tiles,
-                                              tile_size, queue, events);
+    return launch_with_vector<T, 1, ConvType, Layout>(
+        input, output, params, n_tiles, tile_size, queue, events);
   }
 }
 
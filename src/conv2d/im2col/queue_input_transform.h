@@ -20,6 +20,7 @@
 #include "portdnn/status.h"
 
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 
 #include <CL/sycl.hpp>
 
@@ -29,7 +30,7 @@ namespace internal {
 namespace im2col {
 
 template <typename T, typename Index, int VectorWidth, typename ConvType,
-          template <typename> class MemObj>
+          typename Layout, template <typename> class MemObj>
 SNNStatus queue_input_transform(MemObj<T const>& input, MemObj<T>& output,
                                 Conv2DParams const& params, int tile_size,
                                 cl::sycl::queue& queue,
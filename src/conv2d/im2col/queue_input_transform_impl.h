@@ -19,12 +19,15 @@
 #include "portdnn/mem_object.h"
 
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 
 #include "portdnn/helpers/ratio.h"
 
 #include "src/conv2d/im2col/kernels/extract_input_tiles.h"
 #include "src/conv2d/im2col/queue_input_transform.h"
 
+#include <type_traits>
+
 #include <CL/sycl.hpp>
 
 namespace sycldnn {
@@ -44,7 +47,7 @@ template <int VectorWidth, typename ConvType,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::InputBackprop>::value,
               int>::type = 0>
-cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
+cl::sycl::range<3> get_thread_range(Conv2DParams const& params, layout::NHWC) {
   size_t x = round_up(params.channels / VectorWidth);
   size_t y = round_up(params.in_cols);
   size_t z = round_up(params.in_rows * params.batch);
@@ -55,17 +58,26 @@ template <
     int VectorWidth, typename ConvType,
     typename std::enable_if<
         std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
-cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
+cl::sycl::range<3> get_thread_range(Conv2DParams const& params, layout::NHWC) {
   size_t x = round_up(params.features / VectorWidth);
   size_t y = round_up(params.out_cols);
   size_t z = round_up(params.out_rows * params.batch);
   return cl::sycl::range<3>{x, y, z};
 }
 
+/** The NCHW transform has a thread per vector of output columns. */
+template <int VectorWidth, typename ConvType>
+cl::sycl::range<3> get_thread_range(Conv2DParams const& params, layout::NCHW) {
+  size_t x = round_up(params.out_cols / VectorWidth);
+  size_t y = round_up(params.out_rows);
+  size_t z = round_up(params.batch * params.channels);
+  return cl::sycl::range<3>{x, y, z};
+}
+
 }  // namespace
 
 template <typename T, typename Index, int VectorWidth, typename ConvType,
-          template <typename> class MemObj>
+          typename Layout, template <typename> class MemObj>
 SNNStatus queue_input_transform(MemObj<T const>& input_mem,
                                 MemObj<T>& output_mem,
                                 Conv2DParams const& params, int tile_size,
@@ -73,13 +85,14 @@ SNNStatus queue_input_transform(MemObj<T const>& input_mem,
                                 const std::vector<cl::sycl::event>& events) {
   constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
 
-  using Functor = ExtractInputTiles<T, Index, VectorWidth, ConvType, is_usm>;
+  using Functor =
+      ExtractInputTiles<T, Index, VectorWidth, ConvType, Layout, is_usm>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
     auto input = input_mem.read_mem(cgh);
     auto output = output_mem.write_mem(cgh);
-    auto range = get_thread_range<VectorWidth, ConvType>(params);
+    auto range = get_thread_range<VectorWidth, ConvType>(params, Layout{});
     Functor conv{tile_size, params, input, output};
 
     cgh.parallel_for(range, conv);
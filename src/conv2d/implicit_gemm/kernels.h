@@ -0,0 +1,211 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
+#define PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/conv2d/params.h"
+
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_element.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+
+#include "src/matmul/blocks.h"
+
+#include <array>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+/**
+ * Forward NHWC convolution computed as a matrix multiply without
+ * materialising the im2col patch matrix.
+ *
+ * The convolution is the product of the [batch * out_rows * out_cols] x
+ * [window_rows * window_cols * channels] patch matrix with the HWCF filter,
+ * viewed as a [window_rows * window_cols * channels] x [features] matrix. Each
+ * work-item computes a RowTile x ColTile block of the output, and loads the
+ * rows of the patch matrix directly from the input tensor as it walks along
+ * the accumulation dimension. Rows which read from the padding are zero.
+ *
+ * The accumulation dimension is traversed ChannelVector channels at a time,
+ * so the number of channels must be a multiple of ChannelVector.
+ */
+template <typename T, typename Index, int RowTile, int ColTile,
+          int ChannelVector, bool IsUSM>
+struct ImplicitGemmConv {
+  using LhsBlock = matmul::VectorBlock<T, RowTile, ChannelVector>;
+  using LhsVector = typename LhsBlock::VectorType;
+  using OutBlock = matmul::VectorBlock<T, RowTile, ColTile>;
+
+  ImplicitGemmConv(Conv2DParams const& params,
+                   ReadMem<T const, IsUSM> const& input,
+                   ReadMem<T const, IsUSM> const& filter,
+                   WriteMem<T, IsUSM> const& output,
+                   EpilogueOp<T, IsUSM> const& epilogue)
+      : n_rows_{params.batch * params.out_rows * params.out_cols},
+        n_row_blocks_{(n_rows_ + RowTile - 1) / RowTile},
+        n_col_blocks_{(params.features + ColTile - 1) / ColTile},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_mem_{input},
+        filter_mem_{filter},
+        output_mem_{output},
+        epilogue_{epilogue} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+    if (index < n_row_blocks_ * n_col_blocks_) {
+      auto const block_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              index, n_col_blocks_, n_col_blocks_);
+      Index const row = block_idx.s0 * RowTile;
+      Index const col = block_idx.s1 * ColTile;
+
+      auto input_data = input_mem_.get_pointer();
+      auto filter_data = filter_mem_.get_pointer();
+      auto output_data = output_mem_.get_pointer();
+
+      std::array<bool, RowTile> valid_row;
+      std::array<Index, RowTile> batch_offset;
+      std::array<Index, RowTile> row_start;
+      std::array<Index, RowTile> col_start;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < n_rows_;
+        auto const out_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten3d(
+                row + i, out_rows_, out_rows_, out_cols_, out_cols_);
+        batch_offset[i] = out_idx.s0 * in_rows_ * in_cols_ * channels_;
+        row_start[i] = out_idx.s1 * stride_rows_ - pad_rows_;
+        col_start[i] = out_idx.s2 * stride_cols_ - pad_cols_;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int j = 0; j < ColTile; ++j) {
+        valid_col[j] = col + j < features_;
+      }
+      std::array<bool, ChannelVector> valid_acc;
+      for (int k = 0; k < ChannelVector; ++k) {
+        valid_acc[k] = true;
+      }
+      bool const internal_col_block = valid_col[ColTile - 1];
+
+      OutBlock out_block{};
+      for (Index r = 0; r < window_rows_; ++r) {
+        for (Index s = 0; s < window_cols_; ++s) {
+          // The input offsets of the patch matrix rows only change with the
+          // window position, so are computed once for all channels.
+          std::array<bool, RowTile> valid_input;
+          std::array<Index, RowTile> input_offset;
+          for (int i = 0; i < RowTile; ++i) {
+            Index const in_row = row_start[i] + r * dilation_rows_;
+            Index const in_col = col_start[i] + s * dilation_cols_;
+            valid_input[i] = valid_row[i] && in_row >= 0 &&
+                             in_row < in_rows_ && in_col >= 0 &&
+                             in_col < in_cols_;
+            input_offset[i] =
+                batch_offset[i] + (in_row * in_cols_ + in_col) * channels_;
+          }
+          Index filter_offset =
+              (r * window_cols_ + s) * channels_ * features_ + col;
+
+          for (Index channel = 0; channel < channels_;
+               channel += ChannelVector) {
+            LhsBlock lhs_block;
+            for (int i = 0; i < RowTile; ++i) {
+              lhs_block.data(i) =
+                  valid_input[i]
+                      ? matmul::load_row<LhsVector>(input_data +
+                                                    input_offset[i] + channel)
+                      : LhsVector{0};
+            }
+            auto rhs_block =
+                internal_col_block
+                    ? matmul::load<ChannelVector, ColTile, false>(
+                          filter_data + filter_offset, features_)
+                    : matmul::load<ChannelVector, ColTile, false>(
+                          filter_data + filter_offset, features_, valid_acc,
+                          valid_col);
+            matmul::block_mmacc(lhs_block, rhs_block, out_block);
+            filter_offset += ChannelVector * features_;
+          }
+        }
+      }
+
+      namespace vec_elem = helpers::vector_element;
+      for (int i = 0; i < RowTile; ++i) {
+        for (int j = 0; j < ColTile; ++j) {
+          if (valid_row[i] && valid_col[j]) {
+            Index const out_idx = (row + i) * features_ + col + j;
+            vec_elem::set(out_block.data(i), j,
+                          epilogue_.apply(vec_elem::get(out_block.data(i), j),
+                                          col + j, out_idx));
+          }
+        }
+      }
+      auto out_ptr = output_data + row * features_ + col;
+      (valid_row[RowTile - 1] && internal_col_block)
+          ? matmul::store_block<RowTile, ColTile>(out_block, out_ptr, features_)
+          : matmul::store_block<RowTile, ColTile>(out_block, out_ptr, features_,
+                                                  valid_row, valid_col);
+    }
+  }
+
+ private:
+  Index const n_rows_;
+  Index const n_row_blocks_;
+  Index const n_col_blocks_;
+  Index const channels_;
+  Index const features_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  ReadMem<T const, IsUSM> input_mem_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+  EpilogueOp<T, IsUSM> const epilogue_;
+};
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
@@ -0,0 +1,51 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_H_
+#define PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_H_
+
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/params.h"
+
+#include "portdnn/internal/conv2d/epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+/**
+ * Queue the implicit GEMM convolution kernel, computing blocks of RowTile
+ * output pixels by ColTile features in each work-item.
+ */
+template <typename T, typename Index, int RowTile, int ColTile,
+          int ChannelVector, template <typename> class MemObj>
+SNNStatus queue_implicit_gemm(MemObj<T const>& input, MemObj<T const>& filter,
+                              MemObj<T>& output,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
+                              cl::sycl::queue& queue,
+                              const std::vector<cl::sycl::event>& events);
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_H_
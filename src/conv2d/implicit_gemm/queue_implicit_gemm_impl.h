@@ -0,0 +1,77 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_IMPL_H_
+#define PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_IMPL_H_
+
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/helpers/ratio.h"
+
+#include "portdnn/conv2d/params.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+#include "src/conv2d/implicit_gemm/kernels.h"
+#include "src/conv2d/implicit_gemm/queue_implicit_gemm.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+template <typename T, typename Index, int RowTile, int ColTile,
+          int ChannelVector, template <typename> class MemObj>
+SNNStatus queue_implicit_gemm(MemObj<T const>& input_mem,
+                              MemObj<T const>& filter_mem,
+                              MemObj<T>& output_mem,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
+                              cl::sycl::queue& queue,
+                              const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor =
+      ImplicitGemmConv<T, Index, RowTile, ColTile, ChannelVector, is_usm>;
+
+  size_t const n_row_blocks = helpers::round_ratio_up_above_zero(
+      params.batch * params.out_rows * params.out_cols, RowTile);
+  size_t const n_col_blocks =
+      helpers::round_ratio_up_above_zero(params.features, ColTile);
+  size_t const n_threads =
+      helpers::round_up_to_nearest_multiple(n_row_blocks * n_col_blocks, 64);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                      epilogue.bias.read_mem(cgh),
+                                      epilogue.residual.read_mem(cgh)};
+
+    Functor conv{params, input, filter, output, epilogue_op};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  });
+  return SNNStatus{event, StatusCode::OK};
+}
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_IMPL_H_
@@ -0,0 +1,283 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_LOCAL_TILED_KERNELS_H_
+#define PORTDNN_SRC_CONV2D_LOCAL_TILED_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/conv2d/params.h"
+#include "portdnn/helpers/macros.h"
+
+#include "src/helpers/tensor_index.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+
+#include <stddef.h>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace local_tiled {
+
+/**
+ * Forward NHWC convolution using local memory to share the input and filter
+ * between the work-items of a work-group.
+ *
+ * Each work-group computes a TileRows x TileCols block of output pixels for
+ * FeatureBlock features, with one work-item per pixel and feature. The
+ * channels are processed in blocks of ChannelBlock: the work-group
+ * cooperatively loads the input tile needed by its output pixels, including
+ * the halo required by the window, and the filter weights for its features
+ * into local memory, then every work-item accumulates its output value from
+ * the local copies. Each input value is therefore read from global memory
+ * once per work-group rather than once for every window position that uses
+ * it.
+ *
+ * The input tile is stored in local memory in the layout
+ * [tile_rows][tile_cols][ChannelBlock] and the filter block in the layout
+ * [window_rows * window_cols][ChannelBlock][FeatureBlock]. Values outside the
+ * input tensor, or beyond the last channel or feature, are set to zero.
+ */
+template <typename T, typename Index, int TileRows, int TileCols,
+          int FeatureBlock, int ChannelBlock, bool IsUSM>
+struct LocalTiledConv {
+  /** Number of work-items in each work-group. */
+  static constexpr int local_size = TileRows * TileCols * FeatureBlock;
+
+  /** Number of input rows needed to compute TileRows output rows. */
+  static size_t input_tile_rows(Conv2DParams const& params) {
+    return static_cast<size_t>(TileRows - 1) * params.stride_rows +
+           static_cast<size_t>(params.window_rows - 1) * params.dilation_rows +
+           1;
+  }
+
+  /** Number of input columns needed to compute TileCols output columns. */
+  static size_t input_tile_cols(Conv2DParams const& params) {
+    return static_cast<size_t>(TileCols - 1) * params.stride_cols +
+           static_cast<size_t>(params.window_cols - 1) * params.dilation_cols +
+           1;
+  }
+
+  /** Number of input values stored in local memory. */
+  static size_t input_local_size(Conv2DParams const& params) {
+    return input_tile_rows(params) * input_tile_cols(params) * ChannelBlock;
+  }
+
+  /** Number of filter values stored in local memory. */
+  static size_t filter_local_size(Conv2DParams const& params) {
+    return static_cast<size_t>(params.window_rows) * params.window_cols *
+           ChannelBlock * FeatureBlock;
+  }
+
+  /** Total number of elements of local memory required by the kernel. */
+  static size_t local_mem_size(Conv2DParams const& params) {
+    return input_local_size(params) + filter_local_size(params);
+  }
+
+  LocalTiledConv(Conv2DParams const& params,
+                 ReadMem<T const, IsUSM> const& input,
+                 ReadMem<T const, IsUSM> const& filter,
+                 LocalAccessor<T> const& local,
+                 WriteMem<T, IsUSM> const& output,
+                 EpilogueOp<T, IsUSM> const& epilogue)
+      : n_tile_rows_{(params.out_rows + TileRows - 1) / TileRows},
+        n_tile_cols_{(params.out_cols + TileCols - 1) / TileCols},
+        n_feature_blocks_{(params.features + FeatureBlock - 1) / FeatureBlock},
+        in_tile_cols_{static_cast<Index>(input_tile_cols(params))},
+        input_local_size_{static_cast<Index>(input_local_size(params))},
+        filter_local_size_{static_cast<Index>(filter_local_size(params))},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_mem_{input},
+        filter_mem_{filter},
+        local_{local},
+        output_mem_{output},
+        epilogue_{epilogue} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const local_idx = item.get_local_id(0);
+    Index const group_idx = item.get_group(0);
+
+    auto const group_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten2d(
+            group_idx, n_feature_blocks_, n_feature_blocks_);
+    Index const feature_block = group_tensor_idx.s1;
+    auto const tile_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            group_tensor_idx.s0, n_tile_rows_, n_tile_rows_, n_tile_cols_,
+            n_tile_cols_);
+    Index const batch = tile_tensor_idx.s0;
+    Index const tile_row = tile_tensor_idx.s1;
+    Index const tile_col = tile_tensor_idx.s2;
+
+    auto const local_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            local_idx, TileCols, TileCols, FeatureBlock, FeatureBlock);
+    Index const local_row = local_tensor_idx.s0;
+    Index const local_col = local_tensor_idx.s1;
+    Index const local_feature = local_tensor_idx.s2;
+
+    Index const out_row = tile_row * TileRows + local_row;
+    Index const out_col = tile_col * TileCols + local_col;
+    Index const feature = feature_block * FeatureBlock + local_feature;
+
+    Index const in_row_start = tile_row * TileRows * stride_rows_ - pad_rows_;
+    Index const in_col_start = tile_col * TileCols * stride_cols_ - pad_cols_;
+
+    auto input_data = input_mem_.get_pointer();
+    auto filter_data = filter_mem_.get_pointer();
+
+    T accumulator = static_cast<T>(0);
+    for (Index channel = 0; channel < channels_; channel += ChannelBlock) {
+      load_input_block(input_data, batch, in_row_start, in_col_start, channel,
+                       local_idx);
+      load_filter_block(filter_data, feature_block, channel, local_idx);
+      item.barrier(cl::sycl::access::fence_space::local_space);
+
+      for (Index r = 0; r < window_rows_; ++r) {
+        Index const tile_in_row = local_row * stride_rows_ + r * dilation_rows_;
+        for (Index s = 0; s < window_cols_; ++s) {
+          Index const tile_in_col =
+              local_col * stride_cols_ + s * dilation_cols_;
+          Index const input_offset =
+              (tile_in_row * in_tile_cols_ + tile_in_col) * ChannelBlock;
+          Index const filter_offset =
+              input_local_size_ +
+              (r * window_cols_ + s) * ChannelBlock * FeatureBlock +
+              local_feature;
+          SNN_PRAGMA_UNROLL
+          for (int c = 0; c < ChannelBlock; ++c) {
+            accumulator += local_[input_offset + c] *
+                           local_[filter_offset + c * FeatureBlock];
+          }
+        }
+      }
+      // All work-items must finish reading the local memory before the next
+      // channel block overwrites it.
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (out_row < out_rows_ && out_col < out_cols_ && feature < features_) {
+      auto output_data = output_mem_.get_pointer();
+      Index const out_idx =
+          ((batch * out_rows_ + out_row) * out_cols_ + out_col) * features_ +
+          feature;
+      output_data[out_idx] = epilogue_.apply(accumulator, feature, out_idx);
+    }
+  }
+
+ private:
+  /**
+   * Copy the input tile and its halo for a block of channels into local
+   * memory. Consecutive work-items read consecutive channels of a pixel to
+   * keep the global loads coalesced.
+   */
+  template <typename InputPointer>
+  void SNN_ALWAYS_INLINE load_input_block(InputPointer input_data, Index batch,
+                                          Index row_start, Index col_start,
+                                          Index channel_start,
+                                          Index local_idx) const {
+    for (Index idx = local_idx; idx < input_local_size_; idx += local_size) {
+      auto const tile_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten3d(
+              idx, in_tile_cols_, in_tile_cols_, ChannelBlock, ChannelBlock);
+      Index const in_row = row_start + tile_idx.s0;
+      Index const in_col = col_start + tile_idx.s1;
+      Index const channel = channel_start + tile_idx.s2;
+
+      T value = static_cast<T>(0);
+      if (in_row >= 0 && in_row < in_rows_ && in_col >= 0 &&
+          in_col < in_cols_ && channel < channels_) {
+        value = input_data[((batch * in_rows_ + in_row) * in_cols_ + in_col) *
+                               channels_ +
+                           channel];
+      }
+      local_[idx] = value;
+    }
+  }
+
+  /**
+   * Copy the filter weights for a block of channels and features into local
+   * memory. Consecutive work-items read consecutive features to keep the
+   * global loads coalesced.
+   */
+  template <typename FilterPointer>
+  void SNN_ALWAYS_INLINE load_filter_block(FilterPointer filter_data,
+                                           Index feature_block,
+                                           Index channel_start,
+                                           Index local_idx) const {
+    for (Index idx = local_idx; idx < filter_local_size_; idx += local_size) {
+      auto const block_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten3d(
+              idx, ChannelBlock, ChannelBlock, FeatureBlock, FeatureBlock);
+      Index const elem = block_idx.s0;
+      Index const channel = channel_start + block_idx.s1;
+      Index const feature = feature_block * FeatureBlock + block_idx.s2;
+
+      T value = static_cast<T>(0);
+      if (channel < channels_ && feature < features_) {
+        value =
+            filter_data[(elem * channels_ + channel) * features_ + feature];
+      }
+      local_[input_local_size_ + idx] = value;
+    }
+  }
+
+  Index const n_tile_rows_;
+  Index const n_tile_cols_;
+  Index const n_feature_blocks_;
+  Index const in_tile_cols_;
+  Index const input_local_size_;
+  Index const filter_local_size_;
+  Index const channels_;
+  Index const features_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  ReadMem<T const, IsUSM> input_mem_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  LocalAccessor<T> local_;
+  WriteMem<T, IsUSM> output_mem_;
+  EpilogueOp<T, IsUSM> const epilogue_;
+};
+
+}  // namespace local_tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_LOCAL_TILED_KERNELS_H_
@@ -0,0 +1,128 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/internal/conv2d/local_tiled.h"
+
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+
+#include "src/conv2d/local_tiled/queue_local_tiled.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+/** The number of output rows computed by each work-group. */
+constexpr int tile_rows = 4;
+/** The number of output columns computed by each work-group. */
+constexpr int tile_cols = 4;
+/** The number of output features computed by each work-group. */
+constexpr int feature_block = 16;
+/** The number of channels loaded into local memory at a time. */
+constexpr int channel_block = 8;
+
+}  // namespace
+
+template <typename T, typename ConvType, template <typename> class MemObj>
+SNNStatus launch_local_tiled(MemObj<T const>& input, MemObj<T const>& filter,
+                             MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
+                             Conv2DParams const& params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events) {
+  if (!std::is_same<ConvType, conv_type::Forward>::value ||
+      params.groups != 1 || params.input_format != DataFormat::NHWC ||
+      params.filter_format != FilterFormat::HWCF) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  // The halo loaded for each tile grows with the stride, so larger strides
+  // are better served by the other algorithms.
+  if (params.stride_rows > 2 || params.stride_cols > 2) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  size_t const input_size = static_cast<size_t>(params.batch) *
+                            params.in_rows * params.in_cols * params.channels;
+  size_t const output_size = static_cast<size_t>(params.batch) *
+                             params.out_rows * params.out_cols *
+                             params.features;
+  size_t const filter_size = static_cast<size_t>(params.window_rows) *
+                             params.window_cols * params.channels *
+                             params.features;
+  size_t const max_size = std::max({input_size, output_size, filter_size});
+  if (max_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return local_tiled::queue_local_tiled<T, int64_t, tile_rows, tile_cols,
+                                          feature_block, channel_block>(
+        input, filter, output, epilogue, params, queue, events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  }
+  return local_tiled::queue_local_tiled<T, int32_t, tile_rows, tile_cols,
+                                        feature_block, channel_block>(
+      input, filter, output, epilogue, params, queue, events);
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEM_OBJ)                      \
+  template SNN_EXPORT SNNStatus launch_local_tiled<DTYPE, DIR>(        \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,     \
+      MEM_OBJ<DTYPE> & output, EpilogueMem<DTYPE, MEM_OBJ> & epilogue, \
+      Conv2DParams const& params, cl::sycl::queue& queue,              \
+      const std::vector<cl::sycl::event>& events)
+
+#define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                      \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, MEM_OBJ);       \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, MEM_OBJ); \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, MEM_OBJ)
+
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(float, USMMemObject);
+#endif
+INSTANTIATE_FOR_TYPE(float, BufferMemObject);
+
+#ifdef SNN_USE_DOUBLE
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(double, USMMemObject);
+#endif
+INSTANTIATE_FOR_TYPE(double, BufferMemObject);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(cl::sycl::half, USMMemObject);
+#endif
+INSTANTIATE_FOR_TYPE(cl::sycl::half, BufferMemObject);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
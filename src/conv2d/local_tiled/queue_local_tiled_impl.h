@@ -0,0 +1,100 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_LOCAL_TILED_QUEUE_LOCAL_TILED_IMPL_H_
+#define PORTDNN_SRC_CONV2D_LOCAL_TILED_QUEUE_LOCAL_TILED_IMPL_H_
+
+#include "portdnn/accessor_types.h"
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/helpers/ratio.h"
+
+#include "portdnn/conv2d/params.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+#include "src/conv2d/local_tiled/kernels.h"
+#include "src/conv2d/local_tiled/queue_local_tiled.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace local_tiled {
+
+template <typename T, typename Index, int TileRows, int TileCols,
+          int FeatureBlock, int ChannelBlock, template <typename> class MemObj>
+SNNStatus queue_local_tiled(MemObj<T const>& input_mem,
+                            MemObj<T const>& filter_mem, MemObj<T>& output_mem,
+                            EpilogueMem<T, MemObj>& epilogue,
+                            Conv2DParams const& params, cl::sycl::queue& queue,
+                            const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = LocalTiledConv<T, Index, TileRows, TileCols, FeatureBlock,
+                                 ChannelBlock, is_usm>;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_wg_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  if (max_wg_size < static_cast<size_t>(Functor::local_size)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  // The input tile grows with the window and stride, so large windows may not
+  // fit in the local memory of the device.
+  size_t const local_mem_size = Functor::local_mem_size(params);
+  size_t const device_local_mem =
+      device.get_info<cl::sycl::info::device::local_mem_size>();
+  if (local_mem_size * sizeof(T) > device_local_mem) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  size_t const n_tile_rows =
+      helpers::round_ratio_up_above_zero(params.out_rows, TileRows);
+  size_t const n_tile_cols =
+      helpers::round_ratio_up_above_zero(params.out_cols, TileCols);
+  size_t const n_feature_blocks =
+      helpers::round_ratio_up_above_zero(params.features, FeatureBlock);
+  size_t const local_size = Functor::local_size;
+  size_t const global_size = static_cast<size_t>(params.batch) * n_tile_rows *
+                             n_tile_cols * n_feature_blocks * local_size;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                      epilogue.bias.read_mem(cgh),
+                                      epilogue.residual.read_mem(cgh)};
+
+    LocalAccessor<T> local_access{cl::sycl::range<1>{local_mem_size}, cgh};
+
+    Functor conv{params, input, filter, local_access, output, epilogue_op};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{cl::sycl::range<1>{global_size},
+                              cl::sycl::range<1>{local_size}},
+        conv);
+  });
+  return SNNStatus{event, StatusCode::OK};
+}
+
+}  // namespace local_tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_LOCAL_TILED_QUEUE_LOCAL_TILED_IMPL_H_
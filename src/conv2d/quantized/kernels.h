@@ -0,0 +1,479 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_QUANTIZED_KERNELS_H_
+#define PORTDNN_SRC_CONV2D_QUANTIZED_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+#include "portdnn/helpers/macros.h"
+
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/quantization_params.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace quantized {
+
+/**
+ * Requantizes the 32-bit accumulators of a quantized convolution to the
+ * output type, applying the activation by clamping the quantized value.
+ */
+template <typename T>
+struct Requantizer {
+  explicit Requantizer(QuantizationParams const& quant_params)
+      : output_zero_point_{static_cast<float>(quant_params.output_zero_point)},
+        input_scale_{quant_params.input_scale},
+        inv_output_scale_{1.f / quant_params.output_scale},
+        min_output_{output_min(quant_params)},
+        max_output_{output_max(quant_params)} {}
+
+  /** Requantize an accumulator of a feature with the given filter scale. */
+  T SNN_ALWAYS_INLINE apply(int32_t acc, float filter_scale) const {
+    float const real = static_cast<float>(acc) * input_scale_ * filter_scale;
+    float quant =
+        cl::sycl::round(real * inv_output_scale_) + output_zero_point_;
+    quant = cl::sycl::fmin(cl::sycl::fmax(quant, min_output_), max_output_);
+    return static_cast<T>(quant);
+  }
+
+ private:
+  /** The smallest quantized output value, after the activation. */
+  static float output_min(QuantizationParams const& quant_params) {
+    float const type_min =
+        static_cast<float>(std::numeric_limits<T>::lowest());
+    if (quant_params.activation == Activation::None) {
+      return type_min;
+    }
+    return std::max(type_min,
+                    static_cast<float>(quant_params.output_zero_point));
+  }
+
+  /** The largest quantized output value, after the activation. */
+  static float output_max(QuantizationParams const& quant_params) {
+    float const type_max = static_cast<float>(std::numeric_limits<T>::max());
+    if (quant_params.activation != Activation::Relu6) {
+      return type_max;
+    }
+    float const six = std::round(6.f / quant_params.output_scale) +
+                      static_cast<float>(quant_params.output_zero_point);
+    return std::min(type_max, six);
+  }
+
+  float output_zero_point_;
+  float input_scale_;
+  float inv_output_scale_;
+  float min_output_;
+  float max_output_;
+};
+
+/**
+ * Quantized forward convolution over an NHWC input and HWCF filter.
+ *
+ * Each work-item computes FeaturesPerItem consecutive output features for a
+ * single output pixel, so that every input value loaded is reused for all of
+ * them. The products are accumulated in 32-bit integers, and each result is
+ * requantized with the scale of its feature before being saturated to the
+ * output type.
+ */
+template <typename T, typename Index, int FeaturesPerItem, bool IsUSM>
+struct QuantizedConv2D {
+  QuantizedConv2D(Conv2DParams const& params,
+                  QuantizationParams const& quant_params,
+                  ReadMem<T const, IsUSM> const& input,
+                  ReadMem<T const, IsUSM> const& filter,
+                  ReadMem<float const, IsUSM> const& filter_scales,
+                  ReadMem<int32_t const, IsUSM> const& filter_zero_points,
+                  WriteMem<T, IsUSM> const& output)
+      : n_items_{params.batch * params.out_rows * params.out_cols *
+                 (params.features / FeaturesPerItem)},
+        p_{params},
+        input_zero_point_{quant_params.input_zero_point},
+        requantizer_{quant_params},
+        input_mem_{input},
+        filter_mem_{filter},
+        filter_scales_mem_{filter_scales},
+        filter_zero_points_mem_{filter_zero_points},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx >= n_items_) {
+      return;
+    }
+    Index const feature_items = p_.features / FeaturesPerItem;
+    Index const feature = (idx % feature_items) * FeaturesPerItem;
+    Index const pixel = idx / feature_items;
+    Index const col = pixel % p_.out_cols;
+    Index const row = (pixel / p_.out_cols) % p_.out_rows;
+    Index const batch = pixel / (p_.out_cols * p_.out_rows);
+
+    auto input_data = input_mem_.get_pointer();
+    auto filter_data = filter_mem_.get_pointer();
+    auto scales_data = filter_scales_mem_.get_pointer();
+    auto zero_points_data = filter_zero_points_mem_.get_pointer();
+    auto output_data = output_mem_.get_pointer();
+
+    int32_t filter_zero_point[FeaturesPerItem];
+    for (int f = 0; f < FeaturesPerItem; ++f) {
+      filter_zero_point[f] = zero_points_data[feature + f];
+    }
+
+    int32_t acc[FeaturesPerItem] = {0};
+    Index const row_start = row * p_.stride_rows - p_.pad_rows;
+    Index const col_start = col * p_.stride_cols - p_.pad_cols;
+    for (Index kr = 0; kr < p_.window_rows; ++kr) {
+      Index const in_row = row_start + kr * p_.dilation_rows;
+      if (in_row < 0 || in_row >= p_.in_rows) {
+        continue;
+      }
+      for (Index kc = 0; kc < p_.window_cols; ++kc) {
+        Index const in_col = col_start + kc * p_.dilation_cols;
+        if (in_col < 0 || in_col >= p_.in_cols) {
+          continue;
+        }
+        Index const in_offset =
+            ((batch * p_.in_rows + in_row) * p_.in_cols + in_col) *
+            p_.channels;
+        Index const fil_offset =
+            (kr * p_.window_cols + kc) * p_.channels * p_.features + feature;
+        for (Index ch = 0; ch < p_.channels; ++ch) {
+          int32_t const in_val =
+              static_cast<int32_t>(input_data[in_offset + ch]) -
+              input_zero_point_;
+          Index const fil_idx = fil_offset + ch * p_.features;
+          for (int f = 0; f < FeaturesPerItem; ++f) {
+            int32_t const fil_val =
+                static_cast<int32_t>(filter_data[fil_idx + f]) -
+                filter_zero_point[f];
+            acc[f] += in_val * fil_val;
+          }
+        }
+      }
+    }
+
+    Index const out_offset = pixel * p_.features + feature;
+    for (int f = 0; f < FeaturesPerItem; ++f) {
+      output_data[out_offset + f] =
+          requantizer_.apply(acc[f], scales_data[feature + f]);
+    }
+  }
+
+ private:
+  Index const n_items_;
+  Conv2DParams const p_;
+  int32_t const input_zero_point_;
+  Requantizer<T> const requantizer_;
+  ReadMem<T const, IsUSM> input_mem_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  ReadMem<float const, IsUSM> filter_scales_mem_;
+  ReadMem<int32_t const, IsUSM> filter_zero_points_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+/**
+ * Tiled quantized forward convolution over an NHWC input and HWCF filter.
+ *
+ * Each work-item computes a tile of TileCols consecutive output pixels in a
+ * row for FeaturesPerItem consecutive features. Every filter value loaded is
+ * reused for all pixels in the tile, and every input value for all features.
+ */
+template <typename T, typename Index, int TileCols, int FeaturesPerItem,
+          bool IsUSM>
+struct QuantizedTiledConv2D {
+  QuantizedTiledConv2D(
+      Conv2DParams const& params, QuantizationParams const& quant_params,
+      ReadMem<T const, IsUSM> const& input,
+      ReadMem<T const, IsUSM> const& filter,
+      ReadMem<float const, IsUSM> const& filter_scales,
+      ReadMem<int32_t const, IsUSM> const& filter_zero_points,
+      WriteMem<T, IsUSM> const& output)
+      : col_tiles_{(params.out_cols + TileCols - 1) / TileCols},
+        n_items_{params.batch * params.out_rows * col_tiles_ *
+                 (params.features / FeaturesPerItem)},
+        p_{params},
+        input_zero_point_{quant_params.input_zero_point},
+        requantizer_{quant_params},
+        input_mem_{input},
+        filter_mem_{filter},
+        filter_scales_mem_{filter_scales},
+        filter_zero_points_mem_{filter_zero_points},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx >= n_items_) {
+      return;
+    }
+    Index const feature_items = p_.features / FeaturesPerItem;
+    Index const feature = (idx % feature_items) * FeaturesPerItem;
+    Index const tile = idx / feature_items;
+    Index const col = (tile % col_tiles_) * TileCols;
+    Index const row = (tile / col_tiles_) % p_.out_rows;
+    Index const batch = tile / (col_tiles_ * p_.out_rows);
+
+    auto input_data = input_mem_.get_pointer();
+    auto filter_data = filter_mem_.get_pointer();
+    auto scales_data = filter_scales_mem_.get_pointer();
+    auto zero_points_data = filter_zero_points_mem_.get_pointer();
+    auto output_data = output_mem_.get_pointer();
+
+    int32_t filter_zero_point[FeaturesPerItem];
+    for (int f = 0; f < FeaturesPerItem; ++f) {
+      filter_zero_point[f] = zero_points_data[feature + f];
+    }
+
+    int32_t acc[TileCols][FeaturesPerItem] = {{0}};
+    Index const row_start = row * p_.stride_rows - p_.pad_rows;
+    Index const col_start = col * p_.stride_cols - p_.pad_cols;
+    for (Index kr = 0; kr < p_.window_rows; ++kr) {
+      Index const in_row = row_start + kr * p_.dilation_rows;
+      if (in_row < 0 || in_row >= p_.in_rows) {
+        continue;
+      }
+      Index const row_offset = (batch * p_.in_rows + in_row) * p_.in_cols;
+      for (Index kc = 0; kc < p_.window_cols; ++kc) {
+        Index const fil_offset =
+            (kr * p_.window_cols + kc) * p_.channels * p_.features + feature;
+        for (Index ch = 0; ch < p_.channels; ++ch) {
+          int32_t fil_val[FeaturesPerItem];
+          Index const fil_idx = fil_offset + ch * p_.features;
+          for (int f = 0; f < FeaturesPerItem; ++f) {
+            fil_val[f] = static_cast<int32_t>(filter_data[fil_idx + f]) -
+                         filter_zero_point[f];
+          }
+          for (int t = 0; t < TileCols; ++t) {
+            Index const in_col =
+                col_start + t * p_.stride_cols + kc * p_.dilation_cols;
+            if (col + t >= p_.out_cols || in_col < 0 ||
+                in_col >= p_.in_cols) {
+              continue;
+            }
+            int32_t const in_val =
+                static_cast<int32_t>(
+                    input_data[(row_offset + in_col) * p_.channels + ch]) -
+                input_zero_point_;
+            for (int f = 0; f < FeaturesPerItem; ++f) {
+              acc[t][f] += in_val * fil_val[f];
+            }
+          }
+        }
+      }
+    }
+
+    for (int t = 0; t < TileCols; ++t) {
+      if (col + t >= p_.out_cols) {
+        break;
+      }
+      Index const out_offset =
+          ((batch * p_.out_rows + row) * p_.out_cols + col + t) *
+              p_.features +
+          feature;
+      for (int f = 0; f < FeaturesPerItem; ++f) {
+        output_data[out_offset + f] =
+            requantizer_.apply(acc[t][f], scales_data[feature + f]);
+      }
+    }
+  }
+
+ private:
+  Index const col_tiles_;
+  Index const n_items_;
+  Conv2DParams const p_;
+  int32_t const input_zero_point_;
+  Requantizer<T> const requantizer_;
+  ReadMem<T const, IsUSM> input_mem_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  ReadMem<float const, IsUSM> filter_scales_mem_;
+  ReadMem<int32_t const, IsUSM> filter_zero_points_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+/**
+ * Extract the quantized input patches of a number of images into a
+ * [pixels x (window_rows * window_cols * channels)] matrix.
+ *
+ * Each work-item copies one value. Values in the padding are set to the
+ * input zero point, so they add nothing to the accumulators of the matrix
+ * multiply.
+ */
+template <typename T, typename Index, bool IsUSM>
+struct QuantizedIm2col {
+  QuantizedIm2col(Conv2DParams const& params,
+                  QuantizationParams const& quant_params, Index first_image,
+                  Index n_images, ReadMem<T const, IsUSM> const& input,
+                  WriteMem<T, IsUSM> const& patches)
+      : n_items_{n_images * params.out_rows * params.out_cols *
+                 params.window_rows * params.window_cols * params.channels},
+        first_image_{first_image},
+        p_{params},
+        input_zero_point_{static_cast<T>(quant_params.input_zero_point)},
+        input_mem_{input},
+        patches_mem_{patches} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx >= n_items_) {
+      return;
+    }
+    Index const channel = idx % p_.channels;
+    Index const window_idx = idx / p_.channels;
+    Index const kc = window_idx % p_.window_cols;
+    Index const kr = (window_idx / p_.window_cols) % p_.window_rows;
+    Index const pixel = window_idx / (p_.window_cols * p_.window_rows);
+    Index const col = pixel % p_.out_cols;
+    Index const row = (pixel / p_.out_cols) % p_.out_rows;
+    Index const batch = first_image_ + pixel / (p_.out_cols * p_.out_rows);
+
+    Index const in_row =
+        row * p_.stride_rows - p_.pad_rows + kr * p_.dilation_rows;
+    Index const in_col =
+        col * p_.stride_cols - p_.pad_cols + kc * p_.dilation_cols;
+    bool const valid = in_row >= 0 && in_row < p_.in_rows && in_col >= 0 &&
+                       in_col < p_.in_cols;
+
+    auto input_data = input_mem_.get_pointer();
+    auto patches_data = patches_mem_.get_pointer();
+    patches_data[idx] =
+        valid ? input_data[((batch * p_.in_rows + in_row) * p_.in_cols +
+                            in_col) *
+                               p_.channels +
+                           channel]
+              : input_zero_point_;
+  }
+
+ private:
+  Index const n_items_;
+  Index const first_image_;
+  Conv2DParams const p_;
+  T const input_zero_point_;
+  ReadMem<T const, IsUSM> input_mem_;
+  WriteMem<T, IsUSM> patches_mem_;
+};
+
+/**
+ * Quantized matrix multiply of a [m x k] patch matrix with the [k x n]
+ * filter, requantizing each result to the output.
+ *
+ * The columns of the output are the features, so each column has its own
+ * filter zero point and scale. Each work-item computes a RowTile x ColTile
+ * block of the output, reusing every value loaded from one matrix for the
+ * whole tile of the other. The output rows start at out_row_offset, so a
+ * minibatch of patches can write to its part of the output.
+ */
+template <typename T, typename Index, int RowTile, int ColTile, bool IsUSM>
+struct QuantizedMatmul {
+  QuantizedMatmul(Index m, Index k, Index n, Index out_row_offset,
+                  QuantizationParams const& quant_params,
+                  ReadMem<T const, IsUSM> const& lhs,
+                  ReadMem<T const, IsUSM> const& filter,
+                  ReadMem<float const, IsUSM> const& filter_scales,
+                  ReadMem<int32_t const, IsUSM> const& filter_zero_points,
+                  WriteMem<T, IsUSM> const& output)
+      : m_{m},
+        k_{k},
+        n_{n},
+        col_tiles_{(n + ColTile - 1) / ColTile},
+        n_items_{((m + RowTile - 1) / RowTile) * col_tiles_},
+        out_row_offset_{out_row_offset},
+        input_zero_point_{quant_params.input_zero_point},
+        requantizer_{quant_params},
+        lhs_mem_{lhs},
+        filter_mem_{filter},
+        filter_scales_mem_{filter_scales},
+        filter_zero_points_mem_{filter_zero_points},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx >= n_items_) {
+      return;
+    }
+    Index const col = (idx % col_tiles_) * ColTile;
+    Index const row = (idx / col_tiles_) * RowTile;
+
+    auto lhs_data = lhs_mem_.get_pointer();
+    auto filter_data = filter_mem_.get_pointer();
+    auto scales_data = filter_scales_mem_.get_pointer();
+    auto zero_points_data = filter_zero_points_mem_.get_pointer();
+    auto output_data = output_mem_.get_pointer();
+
+    int32_t filter_zero_point[ColTile];
+    for (int c = 0; c < ColTile; ++c) {
+      filter_zero_point[c] = col + c < n_ ? zero_points_data[col + c] : 0;
+    }
+
+    int32_t acc[RowTile][ColTile] = {{0}};
+    for (Index i = 0; i < k_; ++i) {
+      int32_t lhs_val[RowTile];
+      for (int r = 0; r < RowTile; ++r) {
+        lhs_val[r] = row + r < m_ ? static_cast<int32_t>(
+                                        lhs_data[(row + r) * k_ + i]) -
+                                        input_zero_point_
+                                  : 0;
+      }
+      int32_t fil_val[ColTile];
+      for (int c = 0; c < ColTile; ++c) {
+        fil_val[c] =
+            col + c < n_
+                ? static_cast<int32_t>(filter_data[i * n_ + col + c]) -
+                      filter_zero_point[c]
+                : 0;
+      }
+      for (int r = 0; r < RowTile; ++r) {
+        for (int c = 0; c < ColTile; ++c) {
+          acc[r][c] += lhs_val[r] * fil_val[c];
+        }
+      }
+    }
+
+    for (int r = 0; r < RowTile && row + r < m_; ++r) {
+      Index const out_offset = (out_row_offset_ + row + r) * n_ + col;
+      for (int c = 0; c < ColTile && col + c < n_; ++c) {
+        output_data[out_offset + c] =
+            requantizer_.apply(acc[r][c], scales_data[col + c]);
+      }
+    }
+  }
+
+ private:
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  Index const col_tiles_;
+  Index const n_items_;
+  Index const out_row_offset_;
+  int32_t const input_zero_point_;
+  Requantizer<T> const requantizer_;
+  ReadMem<T const, IsUSM> lhs_mem_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  ReadMem<float const, IsUSM> filter_scales_mem_;
+  ReadMem<int32_t const, IsUSM> filter_zero_points_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+}  // namespace quantized
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_QUANTIZED_KERNELS_H_
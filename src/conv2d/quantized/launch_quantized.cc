@@ -0,0 +1,389 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/quantization_params.h"
+#include "portdnn/conv2d/sizes.h"
+
+#include "portdnn/helpers/ratio.h"
+
+#include "portdnn/internal/conv2d/launch_quantized.h"
+
+#include "src/conv2d/quantized/kernels.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+namespace {
+
+// Get the number of threads to launch for n_items work-items, rounded up to
+// a multiple of the device's maximum work-group size.
+size_t get_n_threads(size_t n_items, cl::sycl::queue& queue) {
+  cl::sycl::device device = queue.get_device();
+  size_t const workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  return helpers::round_up_to_nearest_multiple(n_items, workgroup_size);
+}
+
+template <typename T, typename Index, int FeaturesPerItem,
+          template <typename> class MemObj>
+SNNStatus queue_quantized_kernel(MemObj<T const>& input_mem,
+                                 MemObj<T const>& filter_mem,
+                                 MemObj<float const>& filter_scales_mem,
+                                 MemObj<int32_t const>& filter_zero_points_mem,
+                                 MemObj<T>& output_mem,
+                                 Conv2DParams const& params,
+                                 QuantizationParams const& quant_params,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events) {
+  using Functor = quantized::QuantizedConv2D<T, Index, FeaturesPerItem,
+                                             is_usm_obj_v<MemObj<T>, T>>;
+  size_t const n_items = static_cast<size_t>(params.batch) * params.out_rows *
+                         params.out_cols * (params.features / FeaturesPerItem);
+  size_t const n_threads = get_n_threads(n_items, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto filter_scales = filter_scales_mem.read_mem(cgh);
+    auto filter_zero_points = filter_zero_points_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    Functor conv{params,        quant_params,       input, filter,
+                 filter_scales, filter_zero_points, output};
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, int TileCols, int FeaturesPerItem,
+          template <typename> class MemObj>
+SNNStatus queue_quantized_tiled_kernel(
+    MemObj<T const>& input_mem, MemObj<T const>& filter_mem,
+    MemObj<float const>& filter_scales_mem,
+    MemObj<int32_t const>& filter_zero_points_mem, MemObj<T>& output_mem,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  using Functor =
+      quantized::QuantizedTiledConv2D<T, Index, TileCols, FeaturesPerItem,
+                                      is_usm_obj_v<MemObj<T>, T>>;
+  size_t const col_tiles = helpers::round_ratio_up(params.out_cols, TileCols);
+  size_t const n_items = static_cast<size_t>(params.batch) * params.out_rows *
+                         col_tiles * (params.features / FeaturesPerItem);
+  size_t const n_threads = get_n_threads(n_items, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto filter_scales = filter_scales_mem.read_mem(cgh);
+    auto filter_zero_points = filter_zero_points_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    Functor conv{params,        quant_params,       input, filter,
+                 filter_scales, filter_zero_points, output};
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_quantized_im2col(MemObj<T const>& input_mem,
+                                 MemObj<T>& patches_mem, Index first_image,
+                                 Index n_images, Conv2DParams const& params,
+                                 QuantizationParams const& quant_params,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events) {
+  using Functor =
+      quantized::QuantizedIm2col<T, Index, is_usm_obj_v<MemObj<T>, T>>;
+  size_t const n_items = static_cast<size_t>(n_images) * params.out_rows *
+                         params.out_cols * params.window_rows *
+                         params.window_cols * params.channels;
+  size_t const n_threads = get_n_threads(n_items, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto patches = patches_mem.write_mem(cgh);
+    Functor im2col{params,   quant_params, first_image,
+                   n_images, input,        patches};
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, im2col);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, int RowTile, int ColTile,
+          template <typename> class MemObj>
+SNNStatus queue_quantized_matmul(
+    MemObj<T const>& lhs_mem, MemObj<T const>& filter_mem,
+    MemObj<float const>& filter_scales_mem,
+    MemObj<int32_t const>& filter_zero_points_mem, MemObj<T>& output_mem,
+    Index m, Index k, Index n, Index out_row_offset,
+    QuantizationParams const& quant_params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  using Functor = quantized::QuantizedMatmul<T, Index, RowTile, ColTile,
+                                             is_usm_obj_v<MemObj<T>, T>>;
+  size_t const n_items =
+      static_cast<size_t>(helpers::round_ratio_up(m, RowTile)) *
+      helpers::round_ratio_up(n, ColTile);
+  size_t const n_threads = get_n_threads(n_items, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto filter_scales = filter_scales_mem.read_mem(cgh);
+    auto filter_zero_points = filter_zero_points_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    Functor matmul{m,
+                   k,
+                   n,
+                   out_row_offset,
+                   quant_params,
+                   lhs,
+                   filter,
+                   filter_scales,
+                   filter_zero_points,
+                   output};
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, matmul);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus launch_direct_with_index(
+    MemObj<T const>& input, MemObj<T const>& filter,
+    MemObj<float const>& filter_scales,
+    MemObj<int32_t const>& filter_zero_points, MemObj<T>& output,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  if (params.features % 4 == 0) {
+    return queue_quantized_kernel<T, Index, 4>(
+        input, filter, filter_scales, filter_zero_points, output, params,
+        quant_params, queue, events);
+  } else if (params.features % 2 == 0) {
+    return queue_quantized_kernel<T, Index, 2>(
+        input, filter, filter_scales, filter_zero_points, output, params,
+        quant_params, queue, events);
+  } else {
+    return queue_quantized_kernel<T, Index, 1>(
+        input, filter, filter_scales, filter_zero_points, output, params,
+        quant_params, queue, events);
+  }
+}
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus launch_tiled_with_index(
+    MemObj<T const>& input, MemObj<T const>& filter,
+    MemObj<float const>& filter_scales,
+    MemObj<int32_t const>& filter_zero_points, MemObj<T>& output,
+    Conv2DParams const& params, QuantizationParams const& quant_params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  if (params.features % 4 == 0) {
+    return queue_quantized_tiled_kernel<T, Index, 4, 4>(
+        input, filter, filter_scales, filter_zero_points, output, params,
+        quant_params, queue, events);
+  } else if (params.features % 2 == 0) {
+    return queue_quantized_tiled_kernel<T, Index, 4, 2>(
+        input, filter, filter_scales, filter_zero_points, output, params,
+        quant_params, queue, events);
+  } else {
+    return queue_quantized_tiled_kernel<T, Index, 4, 1>(
+        input, filter, filter_scales, filter_zero_points, output, params,
+        quant_params, queue, events);
+  }
+}
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus launch_with_index(MemObj<T const>& input, MemObj<T const>& filter,
+                            MemObj<float const>& filter_scales,
+                            MemObj<int32_t const>& filter_zero_points,
+                            MemObj<T>& output, Conv2DParams const& params,
+                            QuantizationParams const& quant_params,
+                            Algorithm algorithm, cl::sycl::queue& queue,
+                            const std::vector<cl::sycl::event>& events) {
+  switch (algorithm) {
+    case Algorithm::Direct:
+      return launch_direct_with_index<T, Index>(
+          input, filter, filter_scales, filter_zero_points, output, params,
+          quant_params, queue, events);
+    case Algorithm::Tiled:
+      return launch_tiled_with_index<T, Index>(
+          input, filter, filter_scales, filter_zero_points, output, params,
+          quant_params, queue, events);
+    case Algorithm::Matmul: {
+      // A 1x1 convolution with unit stride and no padding has the input as
+      // its patch matrix, so needs no im2col transform.
+      Index const m =
+          static_cast<Index>(params.batch) * params.out_rows * params.out_cols;
+      return queue_quantized_matmul<T, Index, 4, 4>(
+          input, filter, filter_scales, filter_zero_points, output, m,
+          static_cast<Index>(params.channels),
+          static_cast<Index>(params.features), Index{0}, quant_params, queue,
+          events);
+    }
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus launch_im2col_with_index(
+    MemObj<T const>& input, MemObj<T const>& filter,
+    MemObj<float const>& filter_scales,
+    MemObj<int32_t const>& filter_zero_points, MemObj<T>& output,
+    MemObj<T>& workspace, Conv2DParams const& params,
+    QuantizationParams const& quant_params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  Index const pixels = static_cast<Index>(params.out_rows) * params.out_cols;
+  Index const patch_size = static_cast<Index>(params.window_rows) *
+                           params.window_cols * params.channels;
+  size_t const image_size = static_cast<size_t>(pixels) * patch_size;
+  Index const minibatch = static_cast<Index>(std::min<size_t>(
+      static_cast<size_t>(params.batch), workspace.get_extent() / image_size));
+  if (minibatch == 0) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  auto patches = workspace.as_const();
+  SNNStatus status;
+  std::vector<cl::sycl::event> deps = events;
+  for (Index image = 0; image < params.batch; image += minibatch) {
+    Index const n_images =
+        std::min<Index>(minibatch, static_cast<Index>(params.batch) - image);
+    status = queue_quantized_im2col<T, Index>(input, workspace, image,
+                                              n_images, params, quant_params,
+                                              queue, deps);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    status = queue_quantized_matmul<T, Index, 4, 4>(
+        patches, filter, filter_scales, filter_zero_points, output,
+        n_images * pixels, patch_size, static_cast<Index>(params.features),
+        image * pixels, quant_params, queue, {status.event});
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    // The next minibatch overwrites the patches read by this matmul.
+    deps = {status.event};
+  }
+  return status;
+}
+
+// Check whether the tensors of a quantized convolution need 64 bit indices.
+bool needs_int64_index(Conv2DParams const& params) {
+  auto const sizes = get_sizes<conv_type::Forward>(params);
+  size_t const max_size =
+      std::max({sizes.input_size, sizes.filter_size, sizes.output_size});
+  return max_size > static_cast<size_t>(std::numeric_limits<int32_t>::max());
+}
+
+}  // namespace
+
+template <typename T, template <typename> class MemObj, typename>
+SNNStatus launch_quantized(MemObj<T const>& input, MemObj<T const>& filter,
+                           MemObj<float const>& filter_scales,
+                           MemObj<int32_t const>& filter_zero_points,
+                           MemObj<T>& output, Conv2DParams const& params,
+                           QuantizationParams const& quant_params,
+                           Algorithm algorithm, cl::sycl::queue& queue,
+                           const std::vector<cl::sycl::event>& events) {
+  if (needs_int64_index(params)) {
+#ifdef SNN_USE_INT64
+    return launch_with_index<T, int64_t>(input, filter, filter_scales,
+                                         filter_zero_points, output, params,
+                                         quant_params, algorithm, queue,
+                                         events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_with_index<T, int32_t>(input, filter, filter_scales,
+                                         filter_zero_points, output, params,
+                                         quant_params, algorithm, queue,
+                                         events);
+  }
+}
+
+template <typename T, template <typename> class MemObj, typename>
+SNNStatus launch_quantized_im2col(
+    MemObj<T const>& input, MemObj<T const>& filter,
+    MemObj<float const>& filter_scales,
+    MemObj<int32_t const>& filter_zero_points, MemObj<T>& output,
+    MemObj<T>& workspace, Conv2DParams const& params,
+    QuantizationParams const& quant_params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  bool const big_workspace =
+      workspace.get_extent() >
+      static_cast<size_t>(std::numeric_limits<int32_t>::max());
+  if (needs_int64_index(params) || big_workspace) {
+#ifdef SNN_USE_INT64
+    return launch_im2col_with_index<T, int64_t>(
+        input, filter, filter_scales, filter_zero_points, output, workspace,
+        params, quant_params, queue, events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_im2col_with_index<T, int32_t>(
+        input, filter, filter_scales, filter_zero_points, output, workspace,
+        params, quant_params, queue, events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, MEM_OBJ)                                   \
+  template SNN_EXPORT SNNStatus launch_quantized<DTYPE, MEM_OBJ>(              \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,             \
+      MEM_OBJ<float const> & filter_scales,                                    \
+      MEM_OBJ<int32_t const> & filter_zero_points, MEM_OBJ<DTYPE> & output,    \
+      Conv2DParams const& params, QuantizationParams const& quant_params,      \
+      Algorithm algorithm, cl::sycl::queue& queue,                             \
+      const std::vector<cl::sycl::event>& events);                             \
+  template SNN_EXPORT SNNStatus launch_quantized_im2col<DTYPE, MEM_OBJ>(       \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,             \
+      MEM_OBJ<float const> & filter_scales,                                    \
+      MEM_OBJ<int32_t const> & filter_zero_points, MEM_OBJ<DTYPE> & output,    \
+      MEM_OBJ<DTYPE> & workspace, Conv2DParams const& params,                  \
+      QuantizationParams const& quant_params, cl::sycl::queue& queue,          \
+      const std::vector<cl::sycl::event>& events)
+
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_LAUNCHER(int8_t, USMMemObject);
+INSTANTIATE_LAUNCHER(uint8_t, USMMemObject);
+#endif
+INSTANTIATE_LAUNCHER(int8_t, BufferMemObject);
+INSTANTIATE_LAUNCHER(uint8_t, BufferMemObject);
+
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
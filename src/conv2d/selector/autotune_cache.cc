@@ -0,0 +1,154 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/conv2d/selector/autotune_cache.h"
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/params.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace {
+
+/** Header written at the start of every cache file. */
+constexpr char const* cache_header = "portdnn-conv2d-autotune";
+
+/** Check whether an integer read from a cache file is a tunable algorithm. */
+bool is_valid_algorithm(int value) {
+  using sycldnn::conv2d::Algorithm;
+  return value > static_cast<int>(Algorithm::NotSupported) &&
+         value <= static_cast<int>(Algorithm::LocalTiled);
+}
+
+}  // namespace
+
+namespace sycldnn {
+namespace conv2d {
+
+constexpr int AutotuneCache::version;
+
+std::string AutotuneCache::make_key(std::string const& device_id,
+                                    char const* conv_type,
+                                    char const* data_type,
+                                    Conv2DParams const& params) {
+  std::ostringstream key;
+  // Keys are stored one per line followed by the algorithm, so the device
+  // string must not contain any whitespace.
+  for (char c : device_id) {
+    key << (std::isspace(static_cast<unsigned char>(c)) ? '_' : c);
+  }
+  key << ';' << conv_type << ';' << data_type << ';' << params.channels << ','
+      << params.features << ',' << params.batch << ',' << params.in_rows << ','
+      << params.in_cols << ',' << params.window_rows << ','
+      << params.window_cols << ',' << params.stride_rows << ','
+      << params.stride_cols << ',' << params.out_rows << ','
+      << params.out_cols << ',' << params.pad_rows << ',' << params.pad_cols
+      << ',' << params.dilation_rows << ',' << params.dilation_cols << ','
+      << params.groups << ',' << static_cast<int>(params.input_format) << ','
+      << static_cast<int>(params.filter_format) << ','
+      << static_cast<int>(params.group_format);
+  return key.str();
+}
+
+std::string AutotuneCache::get_device_id(cl::sycl::device const& device) {
+  std::string id = device.get_info<cl::sycl::info::device::vendor>();
+  id += '/';
+  id += device.get_info<cl::sycl::info::device::name>();
+  id += '/';
+  id += device.get_info<cl::sycl::info::device::driver_version>();
+  return id;
+}
+
+Algorithm AutotuneCache::lookup(std::string const& key) const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return Algorithm::NotSupported;
+  }
+  return it->second;
+}
+
+void AutotuneCache::insert(std::string const& key, Algorithm algo) {
+  std::lock_guard<std::mutex> lock{mutex_};
+  entries_[key] = algo;
+}
+
+bool AutotuneCache::load(std::string const& path) {
+  std::ifstream file{path};
+  if (!file) {
+    return false;
+  }
+  std::string header;
+  int file_version = 0;
+  if (!(file >> header >> file_version) || header != cache_header ||
+      file_version != version) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock{mutex_};
+  std::string key;
+  int algo;
+  while (file >> key >> algo) {
+    if (is_valid_algorithm(algo)) {
+      entries_[key] = static_cast<Algorithm>(algo);
+    }
+  }
+  return true;
+}
+
+bool AutotuneCache::save(std::string const& path) const {
+  // Write to a temporary file in the same directory and rename it over the
+  // cache, so that other processes never read a partially written file.
+  std::string const temp_path =
+      path + ".tmp." + std::to_string(std::random_device{}());
+  {
+    std::ofstream file{temp_path, std::ios::trunc};
+    if (!file) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock{mutex_};
+    file << cache_header << ' ' << version << '\n';
+    for (auto const& entry : entries_) {
+      file << entry.first << ' ' << static_cast<int>(entry.second) << '\n';
+    }
+    file.close();
+    if (!file) {
+      std::remove(temp_path.c_str());
+      return false;
+    }
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+size_t AutotuneCache::size() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  return entries_.size();
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
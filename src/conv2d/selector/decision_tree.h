@@ -0,0 +1,189 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_SELECTOR_DECISION_TREE_H_
+#define PORTDNN_SRC_CONV2D_SELECTOR_DECISION_TREE_H_
+
+/**
+ * \file
+ * Contains the decision trees used by the per-device selectors to choose a
+ * convolution algorithm from tables generated from benchmark results.
+ */
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/params.h"
+
+#include "portdnn/conv2d/selector/direct_selector.h"
+#include "portdnn/conv2d/selector/im2col_selector.h"
+#include "portdnn/conv2d/selector/implicit_gemm_selector.h"
+#include "portdnn/conv2d/selector/local_tiled_selector.h"
+#include "portdnn/conv2d/selector/matmul_selector.h"
+#include "portdnn/conv2d/selector/tiled_selector.h"
+#include "portdnn/conv2d/selector/winograd_selector.h"
+
+#include <stddef.h>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/** The convolution parameter compared against a threshold in a tree node. */
+enum class DecisionFeature {
+  /** The node is a leaf, holding the chosen algorithm. */
+  Leaf,
+  /** The batch size. */
+  Batch,
+  /** The number of input channels. */
+  Channels,
+  /** The number of output features. */
+  Features,
+  /** The number of output elements in each feature map. */
+  OutputSpatial,
+  /** The number of rows in the filter window. */
+  WindowRows,
+  /** The number of columns in the filter window. */
+  WindowCols,
+  /** The stride in the row direction. */
+  StrideRows,
+  /** The stride in the column direction. */
+  StrideCols,
+  /** The dilation in the row direction. */
+  DilationRows,
+  /** The dilation in the column direction. */
+  DilationCols,
+};
+
+/**
+ * A node in a decision tree. Inner nodes branch to the child at index
+ * less_equal if the feature is less than or equal to the threshold, and to
+ * the child at index greater otherwise. Leaf nodes hold the algorithm.
+ */
+struct DecisionNode {
+  /** The feature to compare, or DecisionFeature::Leaf. */
+  DecisionFeature feature;
+  /** The threshold to compare the feature against. */
+  int threshold;
+  /** Index of the child to use if the feature is at most the threshold. */
+  int less_equal;
+  /** Index of the child to use if the feature exceeds the threshold. */
+  int greater;
+  /** The algorithm chosen at a leaf. */
+  Algorithm algorithm;
+};
+
+/** A decision tree stored as an array of nodes with the root at index 0. */
+struct DecisionTree {
+  /** Pointer to the nodes of the tree. */
+  DecisionNode const* nodes;
+  /** The number of nodes in the tree. */
+  size_t size;
+};
+
+/** Get the value of a decision feature for the given parameters. */
+inline int get_feature(DecisionFeature feature, Conv2DParams const& params) {
+  switch (feature) {
+    case DecisionFeature::Batch:
+      return params.batch;
+    case DecisionFeature::Channels:
+      return params.channels;
+    case DecisionFeature::Features:
+      return params.features;
+    case DecisionFeature::OutputSpatial:
+      return params.out_rows * params.out_cols;
+    case DecisionFeature::WindowRows:
+      return params.window_rows;
+    case DecisionFeature::WindowCols:
+      return params.window_cols;
+    case DecisionFeature::StrideRows:
+      return params.stride_rows;
+    case DecisionFeature::StrideCols:
+      return params.stride_cols;
+    case DecisionFeature::DilationRows:
+      return params.dilation_rows;
+    case DecisionFeature::DilationCols:
+      return params.dilation_cols;
+    case DecisionFeature::Leaf:
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Walk the decision tree for the given parameters.
+ * \return Returns the algorithm at the reached leaf, or
+ *         Algorithm::NotSupported if the tree is empty or malformed.
+ */
+inline Algorithm evaluate(DecisionTree const& tree,
+                          Conv2DParams const& params) {
+  size_t index = 0;
+  // A well formed tree reaches a leaf in fewer steps than it has nodes.
+  for (size_t step = 0; step < tree.size && index < tree.size; ++step) {
+    DecisionNode const& node = tree.nodes[index];
+    if (node.feature == DecisionFeature::Leaf) {
+      return node.algorithm;
+    }
+    bool const go_left = get_feature(node.feature, params) <= node.threshold;
+    index = static_cast<size_t>(go_left ? node.less_equal : node.greater);
+  }
+  return Algorithm::NotSupported;
+}
+
+/** Check whether the algorithm chosen by a selector for params is algo. */
+template <typename AlgoSelector, typename ConvType>
+inline bool selects(Algorithm algo, Conv2DParams const& params) {
+  AlgoSelector selector;
+  return selector.template select<ConvType>(params) == algo;
+}
+
+/**
+ * Check whether an algorithm can compute the given convolution, using the
+ * single algorithm selectors to decide which parameters are supported.
+ *
+ * The trees only see a few parameters, so a leaf may be reached by a
+ * convolution which its algorithm cannot compute.
+ */
+template <typename ConvType>
+inline bool algorithm_supports(Algorithm algo, Conv2DParams const& params) {
+  if (params.groups > 1) {
+    return algo == Algorithm::Im2col;
+  }
+  switch (algo) {
+    case Algorithm::Direct:
+      return selects<DirectSelector, ConvType>(algo, params);
+    case Algorithm::Tiled:
+      return selects<TiledSelector, ConvType>(algo, params);
+    case Algorithm::Im2col:
+      return selects<Im2colSelector, ConvType>(algo, params);
+    case Algorithm::Winograd:
+      return selects<WinogradSelector, ConvType>(algo, params);
+    case Algorithm::WinogradLarge:
+      return selects<WinogradLargeSelector, ConvType>(algo, params);
+    case Algorithm::WinogradFused:
+      return selects<WinogradFusedSelector, ConvType>(algo, params);
+    case Algorithm::Matmul:
+      return selects<MatmulSelector, ConvType>(algo, params);
+    case Algorithm::ImplicitGemm:
+      return selects<ImplicitGemmSelector, ConvType>(algo, params);
+    case Algorithm::LocalTiled:
+      return selects<LocalTiledSelector, ConvType>(algo, params);
+    case Algorithm::NotSupported:
+    default:
+      return false;
+  }
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_SRC_CONV2D_SELECTOR_DECISION_TREE_H_
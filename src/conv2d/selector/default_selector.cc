@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
 
 #include "portdnn/conv2d/selector/default_selector.h"
@@ -21,6 +22,11 @@
 
 #include "portdnn/conv2d/selector/selector.h"
 
+#include "src/conv2d/selector/decision_tree.h"
+#include "src/conv2d/selector/tables/arm_gpu.h"
+#include "src/conv2d/selector/tables/intel_cpu.h"
+#include "src/conv2d/selector/tables/intel_gpu.h"
+
 #include <memory>
 #include <string>
 
@@ -36,6 +42,11 @@
 
 namespace {
 
+/** Check whether the convolution has a dilation other than one. */
+bool is_dilated(sycldnn::conv2d::Conv2DParams const& params) {
+  return params.dilation_rows != 1 || params.dilation_cols != 1;
+}
+
 /**
  * A selector which makes no assumption about the underlying device.
  * This is chosen as a fall-back when the available device is not recognised.
@@ -57,8 +68,9 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Winograd is supported for undilated 1x3s1, 3x1s1, 3x3s1.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        !is_dilated(params)) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -85,13 +97,18 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_input_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    // Im2Col is the only algorithm that supports Grouped Convolution.
+    if (params.groups > 1) {
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Winograd is supported for undilated 1x3s1, 3x1s1, 3x3s1.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        !is_dilated(params)) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -109,13 +126,18 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_filter_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    // Im2Col is the only algorithm that supports Grouped Convolution.
+    if (params.groups > 1) {
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Winograd is supported for undilated 1x3s1, 3x1s1, 3x3s1.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        !is_dilated(params)) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -130,65 +152,108 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
   char const* name() const override { return "DefaultSelector"; }
 };
 
-/** A selector which assumes the underlying device to run on is an Intel CPU. */
-class IntelCPUSelector final : public DefaultSelector {
+/**
+ * A selector backed by decision trees generated from benchmark results by
+ * bench/conv2d/gen_selector_table.py. Falls back to the default selection
+ * when a tree has no data, or chooses an algorithm which does not support the
+ * given convolution.
+ */
+class TableSelector : public DefaultSelector {
  public:
+  /**
+   * Construct a selector from the trees for each convolution type.
+   * \param forward         Decision tree for forward convolutions.
+   * \param input_backprop  Decision tree for input backprop convolutions.
+   * \param filter_backprop Decision tree for filter backprop convolutions.
+   */
+  TableSelector(sycldnn::conv2d::internal::DecisionTree const& forward,
+                sycldnn::conv2d::internal::DecisionTree const& input_backprop,
+                sycldnn::conv2d::internal::DecisionTree const& filter_backprop)
+      : forward_{forward},
+        input_backprop_{input_backprop},
+        filter_backprop_{filter_backprop} {}
+
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    auto algo = select_from_tree<sycldnn::conv2d::conv_type::Forward>(
+        forward_, params);
+    if (algo != sycldnn::conv2d::Algorithm::NotSupported) {
+      return algo;
+    }
     return this->DefaultSelector::select_forward(params);
   }
 
   sycldnn::conv2d::Algorithm select_input_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    auto algo = select_from_tree<sycldnn::conv2d::conv_type::InputBackprop>(
+        input_backprop_, params);
+    if (algo != sycldnn::conv2d::Algorithm::NotSupported) {
+      return algo;
+    }
     return this->DefaultSelector::select_input_backprop(params);
   }
 
   sycldnn::conv2d::Algorithm select_filter_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    auto algo = select_from_tree<sycldnn::conv2d::conv_type::FilterBackprop>(
+        filter_backprop_, params);
+    if (algo != sycldnn::conv2d::Algorithm::NotSupported) {
+      return algo;
+    }
     return this->DefaultSelector::select_filter_backprop(params);
   }
 
-  char const* name() const override { return "IntelCPUSelector"; }
+ private:
+  /**
+   * Get the algorithm chosen by the tree, or NotSupported if the algorithm
+   * cannot compute the convolution.
+   */
+  template <typename ConvType>
+  static sycldnn::conv2d::Algorithm select_from_tree(
+      sycldnn::conv2d::internal::DecisionTree const& tree,
+      sycldnn::conv2d::Conv2DParams const& params) {
+    auto algo = sycldnn::conv2d::internal::evaluate(tree, params);
+    if (sycldnn::conv2d::internal::algorithm_supports<ConvType>(algo,
+                                                                params)) {
+      return algo;
+    }
+    return sycldnn::conv2d::Algorithm::NotSupported;
+  }
+
+  sycldnn::conv2d::internal::DecisionTree forward_;
+  sycldnn::conv2d::internal::DecisionTree input_backprop_;
+  sycldnn::conv2d::internal::DecisionTree filter_backprop_;
 };
 
-/** A selector which assumes the underlying device to run on is an Intel GPU. */
-class IntelGPUSelector final : public DefaultSelector {
+/** A selector which assumes the underlying device to run on is an Intel CPU. */
+class IntelCPUSelector final : public TableSelector {
  public:
-  sycldnn::conv2d::Algorithm select_forward(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_forward(params);
-  }
+  IntelCPUSelector()
+      : TableSelector{sycldnn::conv2d::internal::intel_cpu::forward,
+                      sycldnn::conv2d::internal::intel_cpu::input_backprop,
+                      sycldnn::conv2d::internal::intel_cpu::filter_backprop} {}
 
-  sycldnn::conv2d::Algorithm select_input_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_input_backprop(params);
-  }
+  char const* name() const override { return "IntelCPUSelector"; }
+};
 
-  sycldnn::conv2d::Algorithm select_filter_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_filter_backprop(params);
-  }
+/** A selector which assumes the underlying device to run on is an Intel GPU. */
+class IntelGPUSelector final : public TableSelector {
+ public:
+  IntelGPUSelector()
+      : TableSelector{sycldnn::conv2d::internal::intel_gpu::forward,
+                      sycldnn::conv2d::internal::intel_gpu::input_backprop,
+                      sycldnn::conv2d::internal::intel_gpu::filter_backprop} {}
 
   char const* name() const override { return "IntelGPUSelector"; }
 };
 
 /** A selector which assumes the underlying device to run on is an ARM GPU. */
-class ARMGPUSelector final : public DefaultSelector {
+class ARMGPUSelector final : public TableSelector {
  public:
-  sycldnn::conv2d::Algorithm select_forward(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_forward(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_input_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_input_backprop(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_filter_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_filter_backprop(params);
-  }
+  ARMGPUSelector()
+      : TableSelector{sycldnn::conv2d::internal::arm_gpu::forward,
+                      sycldnn::conv2d::internal::arm_gpu::input_backprop,
+                      sycldnn::conv2d::internal::arm_gpu::filter_backprop} {}
 
   char const* name() const override { return "ARMGPUSelector"; }
 };
@@ -236,10 +301,11 @@ class PowerVRSelector final : public DefaultSelector {
       if (params.features < 30) {
         return sycldnn::conv2d::Algorithm::Tiled;
       }
-      if (params.batch < 4 && params.out_rows < 15 && params.out_cols < 15) {
+      if (params.batch < 4 && params.out_rows < 15 && params.out_cols < 15 &&
+          !is_dilated(params)) {
         return sycldnn::conv2d::Algorithm::Winograd;
       }
-      if (params.out_rows < 13 && params.out_cols < 13) {
+      if (params.out_rows < 13 && params.out_cols < 13 && !is_dilated(params)) {
         return sycldnn::conv2d::Algorithm::Winograd;
       }
     }
@@ -0,0 +1,51 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_SELECTOR_TABLES_INTEL_CPU_H_
+#define PORTDNN_SRC_CONV2D_SELECTOR_TABLES_INTEL_CPU_H_
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by gen_selector_table.py
+// from 0 benchmarked convolutions.
+// No benchmark results were available, so the selector always
+// falls back to the DefaultSelector choice.
+
+#include "src/conv2d/selector/decision_tree.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace intel_cpu {
+
+inline constexpr DecisionNode forward_nodes[] = {
+    {DecisionFeature::Leaf, 0, 0, 0, Algorithm::NotSupported},
+};
+inline constexpr DecisionTree forward{forward_nodes, 1};
+
+inline constexpr DecisionNode input_backprop_nodes[] = {
+    {DecisionFeature::Leaf, 0, 0, 0, Algorithm::NotSupported},
+};
+inline constexpr DecisionTree input_backprop{input_backprop_nodes, 1};
+
+inline constexpr DecisionNode filter_backprop_nodes[] = {
+    {DecisionFeature::Leaf, 0, 0, 0, Algorithm::NotSupported},
+};
+inline constexpr DecisionTree filter_backprop{filter_backprop_nodes, 1};
+
+}  // namespace intel_cpu
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // PORTDNN_SRC_CONV2D_SELECTOR_TABLES_INTEL_CPU_H_
@@ -30,9 +30,11 @@ template <>
 inline Conv2DParams get_kernel_params<conv_type::InputBackprop>(
     Conv2DParams params) {
   // We need to change the padding from input padding to output padding for
-  // the kernel. pad_out = filt_size - 1 - pad_in
-  params.pad_rows = params.window_rows - 1 - params.pad_rows;
-  params.pad_cols = params.window_cols - 1 - params.pad_cols;
+  // the kernel. pad_out = (filt_size - 1) * dilation - pad_in
+  params.pad_rows =
+      (params.window_rows - 1) * params.dilation_rows - params.pad_rows;
+  params.pad_cols =
+      (params.window_cols - 1) * params.dilation_cols - params.pad_cols;
   return params;
 }
 template <>
@@ -30,6 +30,7 @@
 #include "src/helpers/vector_type.h"
 #include "src/helpers/window_index.h"
 
+#include "src/conv2d/epilogue/epilogue_op.h"
 #include "src/conv2d/tiled/tile_info.h"
 #include "src/conv2d/tiled/tiles.h"
 
@@ -38,10 +39,16 @@ namespace conv2d {
 namespace internal {
 namespace tiled {
 
+/**
+ * SYCL kernel for tiled convolution computation.
+ *
+ * The tensors are stored as T, while the convolution is accumulated as
+ * ComputeT. Only the forward kernel supports a ComputeT which differs from T.
+ */
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
           bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
-          bool IsUSM>
+          bool IsUSM, typename ComputeT = T>
 struct TiledConv2D;
 
 /**
@@ -53,13 +60,17 @@ struct TiledConv2D;
  * be controlled using the FeatureVectorWidth template. The channel
  * vectorisation needs the kernel to be modified so that the loop over the
  * channels is split into a vectorised part and a scalar part.
+ *
+ * The output tile is accumulated as ComputeT, and converted to T before the
+ * epilogue is applied and the tile is written out.
  */
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
-          int WindowRows, int WindowCols, int Stride, bool IsUSM>
+          int WindowRows, int WindowCols, int Stride, bool IsUSM,
+          typename ComputeT>
 struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
                    ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
-                   WindowRows, WindowCols, Stride, IsUSM> {
+                   WindowRows, WindowCols, Stride, IsUSM, ComputeT> {
  private:
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
   static constexpr auto InputTileCols = (OutTileCols - 1) * Stride + WindowCols;
@@ -68,13 +79,15 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   using Filter = FilterTile<T, ChannelVectorWidth, FeatureVectorWidth,
                             WindowRows, WindowCols>;
   using Output = OutputTile<T, FeatureVectorWidth, OutTileRows, OutTileCols>;
+  using Accumulator =
+      OutputTile<ComputeT, FeatureVectorWidth, OutTileRows, OutTileCols>;
   using InVecType = typename Input::VecType;
-  using OutVecType = typename Output::VecType;
+  using AccVecType = typename Accumulator::VecType;
 
  public:
   TiledConv2D(ReadMem<T const, IsUSM> input, ReadMem<T const, IsUSM> filter,
               WriteMem<T, IsUSM> output, Conv2DParams const& params,
-              TileInfo const& tile_info)
+              TileInfo const& tile_info, EpilogueOp<T, IsUSM> const& epilogue)
       : n_tile_cols_{tile_info.n_cols},
         n_tile_rows_{tile_info.n_rows},
         n_feature_vectors_{tile_info.output_vectors},
@@ -92,9 +105,12 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_mem_{std::move(input)},
         filter_mem_{std::move(filter)},
-        output_mem_{std::move(output)} {}
+        output_mem_{std::move(output)},
+        epilogue_{epilogue} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     Index const index = item.get_id(0);
@@ -109,8 +125,10 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
               index, div_n_tile_rows_, n_tile_rows_, div_n_tile_cols_,
               n_tile_cols_, div_feature_vectors_, n_feature_vectors_);
       Index const feature = tensor_idx.s3 * FeatureVectorWidth;
-      Index const col_idx = tensor_idx.s2 * OutTileCols;
-      Index const row_idx = tensor_idx.s1 * OutTileRows;
+      Index const col_idx =
+          get_tile_start(tensor_idx.s2, OutTileCols, dilation_cols_);
+      Index const row_idx =
+          get_tile_start(tensor_idx.s1, OutTileRows, dilation_rows_);
       Index const batch = tensor_idx.s0;
 
       const auto col_window =
@@ -120,34 +138,40 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
           helpers::in_window_from_output(row_idx, Stride, pad_rows_);
       const Index rstart = row_window.window_start;
 
-      Output out_tile{};
+      Accumulator acc_tile{};
       Index filter_offset = feature;
       Index input_channel_offset = batch * in_cols_ * in_rows_ * channels_;
       for (Index channel = 0; channel < channels_;
            channel += ChannelVectorWidth) {
         Filter filter_tile{filter_data, filter_offset, channels_, features_};
 
+        // A tile covers every dilation-th output, so the input rows and
+        // columns required by the tile are also spaced by the dilation.
         Index input_offset =
             input_channel_offset + rstart * in_cols_ * channels_;
-        for (Index i = 0; i < InputTileRows; ++i) {
-          if (rstart + i >= 0 && rstart + i < in_rows_) {
-            auto input_tile = Input::load_input_row(
-                input_data, input_offset, cstart, in_cols_, channels_);
-            convolve_tile(input_tile, filter_tile, out_tile, i);
+        for (Index r = rstart, i = 0; i < InputTileRows;
+             r += dilation_rows_, ++i) {
+          if (r >= 0 && r < in_rows_) {
+            auto input_tile =
+                Input::load_input_row(input_data, input_offset, cstart,
+                                      in_cols_, channels_, dilation_cols_);
+            convolve_tile(input_tile, filter_tile, acc_tile, i);
           }
-          input_offset += in_cols_ * channels_;
+          input_offset += dilation_rows_ * in_cols_ * channels_;
         }
         input_channel_offset += ChannelVectorWidth;
         filter_offset += ChannelVectorWidth * features_;
       }
+      auto out_tile = Output::convert_from(acc_tile);
       out_tile.write_out(output_data, batch, row_idx, out_rows_, col_idx,
-                         out_cols_, feature, features_);
+                         out_cols_, feature, features_, dilation_rows_,
+                         dilation_cols_, epilogue_);
     }
   }
 
  private:
   void SNN_ALWAYS_INLINE convolve_tile(Input const& input, Filter const& filter,
-                                       Output& output,
+                                       Accumulator& output,
                                        int const row_idx) const {
     SNN_PRAGMA_UNROLL
     for (int out_row = 0; out_row < OutTileRows; ++out_row) {
@@ -159,7 +183,8 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   }
 
   void SNN_ALWAYS_INLINE convolve_one_row(Input const& input,
-                                          Filter const& filter, Output& output,
+                                          Filter const& filter,
+                                          Accumulator& output,
                                           int const out_row,
                                           int const filter_row) const {
     int in_offset = 0;
@@ -175,16 +200,18 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
     }
   }
 
-  OutVecType SNN_ALWAYS_INLINE forward_accumulate(InVecType input,
+  AccVecType SNN_ALWAYS_INLINE forward_accumulate(InVecType input,
                                                   Filter const& filter,
                                                   int const filter_row,
                                                   int const filter_col,
-                                                  OutVecType value) const {
+                                                  AccVecType value) const {
     SNN_PRAGMA_UNROLL
     for (int i = 0; i < ChannelVectorWidth; i++) {
-      value =
-          helpers::math::mad(OutVecType{helpers::vector_element::get(input, i)},
-                             filter.data(filter_row, filter_col, i), value);
+      AccVecType in_val{
+          static_cast<ComputeT>(helpers::vector_element::get(input, i))};
+      AccVecType fil_val = helpers::convert_vector<ComputeT>(
+          filter.data(filter_row, filter_col, i));
+      value = helpers::math::mad(in_val, fil_val, value);
     }
     return value;
   }
@@ -205,9 +232,12 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadMem<const T, IsUSM> input_mem_;
   const ReadMem<const T, IsUSM> filter_mem_;
   WriteMem<T, IsUSM> output_mem_;
+  const EpilogueOp<T, IsUSM> epilogue_;
 };
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
@@ -247,6 +277,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_mem_{std::move(input)},
         filter_mem_{std::move(filter)},
         output_mem_{std::move(output)} {}
@@ -264,16 +296,26 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
               index, div_n_tile_rows_, n_tile_rows_, div_n_tile_cols_,
               n_tile_cols_, div_channels_, n_channel_vectors_);
       Index const channel = tensor_idx.s3 * ChannelVectorWidth;
-      Index const col_idx = tensor_idx.s2 * OutTileCols;
-      Index const row_idx = tensor_idx.s1 * OutTileRows;
+      Index const col_idx =
+          get_tile_start(tensor_idx.s2, OutTileCols, dilation_cols_);
+      Index const row_idx =
+          get_tile_start(tensor_idx.s1, OutTileRows, dilation_rows_);
       Index const batch = tensor_idx.s0;
 
+      // Dilation is only supported with a unit stride. In that case every
+      // output contributes to the tile, so the window is not clamped to start
+      // at zero. This keeps the rows and columns loaded on the same dilated
+      // grid as the tile, with any out of bounds values skipped or zeroed.
       const auto col_window =
-          helpers::out_window_from_input(col_idx, Stride, pad_cols_);
+          Stride == 1
+              ? helpers::WindowIndices<Index>{col_idx - pad_cols_, 0}
+              : helpers::out_window_from_input(col_idx, Stride, pad_cols_);
       const Index cstart = col_window.window_start;
       const Index first_col = col_window.filter_start;
       const auto row_window =
-          helpers::out_window_from_input(row_idx, Stride, pad_rows_);
+          Stride == 1
+              ? helpers::WindowIndices<Index>{row_idx - pad_rows_, 0}
+              : helpers::out_window_from_input(row_idx, Stride, pad_rows_);
       const Index rstart = row_window.window_start;
       const Index first_row = row_window.filter_start;
 
@@ -288,19 +330,21 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
 
         Index input_offset = input_feat_offset + rstart * out_cols_ * features_;
         for (Index r = rstart, i = first_row; i < InputTileRows;
-             ++r, i += Stride) {
-          if (r < out_rows_) {
-            auto input_tile = Input::load_input_row(
-                input_data, input_offset, cstart, out_cols_, features_);
+             r += dilation_rows_, i += Stride) {
+          if (r >= 0 && r < out_rows_) {
+            auto input_tile =
+                Input::load_input_row(input_data, input_offset, cstart,
+                                      out_cols_, features_, dilation_cols_);
             convolve_tile(input_tile, filter_tile, out_tile, i, first_col);
           }
-          input_offset += out_cols_ * features_;
+          input_offset += dilation_rows_ * out_cols_ * features_;
         }
         input_feat_offset += FeatureVectorWidth;
         filter_offset += FeatureVectorWidth;
       }
       out_tile.write_out(output_data, batch, row_idx, in_rows_, col_idx,
-                         in_cols_, channel, channels_);
+                         in_cols_, channel, channels_, dilation_rows_,
+                         dilation_cols_);
     }
   }
 
@@ -389,6 +433,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadMem<const T, IsUSM> input_mem_;
   const ReadMem<const T, IsUSM> filter_mem_;
   WriteMem<T, IsUSM> output_mem_;
@@ -0,0 +1,181 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
+#define PORTDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/conv2d/params.h"
+
+#include "src/helpers/fast_div.h"
+#include "src/helpers/math.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/window_index.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+#include "src/conv2d/tiled/tile_info.h"
+#include "src/conv2d/tiled/tiles.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace tiled {
+
+/**
+ * Forward convolution on NCHW tensors using a tiled direct computation.
+ *
+ * Each work item computes an OutTileRows x OutTileCols tile of one output
+ * feature map. In NCHW the rows of the input are contiguous, so each input
+ * row needed by the tile is loaded with consecutive loads, and neighbouring
+ * work items handle neighbouring tiles of the same feature map. The FCHW
+ * filter values for one channel are contiguous too.
+ *
+ * There is no channel or feature vectorisation, and dilation is not
+ * supported.
+ */
+template <typename T, typename Index, int OutTileRows, int OutTileCols,
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
+          bool IsUSM>
+struct TiledConv2DNCHW {
+ private:
+  using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
+  static constexpr auto InputTileCols = (OutTileCols - 1) * Stride + WindowCols;
+  static constexpr auto InputTileRows = (OutTileRows - 1) * Stride + WindowRows;
+  static constexpr auto WindowSize = WindowRows * WindowCols;
+  using Input = InputRow<T, 1, InputTileCols>;
+  using Filter = FilterTile<T, 1, 1, WindowRows, WindowCols>;
+  using Output = OutputTile<T, 1, OutTileRows, OutTileCols>;
+
+ public:
+  TiledConv2DNCHW(ReadMem<T const, IsUSM> input,
+                  ReadMem<T const, IsUSM> filter, WriteMem<T, IsUSM> output,
+                  Conv2DParams const& params, TileInfo const& tile_info,
+                  EpilogueOp<T, IsUSM> const& epilogue)
+      : n_tile_cols_{tile_info.n_cols},
+        n_tile_rows_{tile_info.n_rows},
+        div_n_tile_cols_{n_tile_cols_},
+        div_n_tile_rows_{n_tile_rows_},
+        div_features_{params.features},
+        n_elems_{params.batch * n_tile_rows_ * n_tile_cols_ * params.features},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_mem_{std::move(input)},
+        filter_mem_{std::move(filter)},
+        output_mem_{std::move(output)},
+        epilogue_{epilogue} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+
+    if (index < n_elems_) {
+      auto input_data = input_mem_.get_pointer();
+      auto filter_data = filter_mem_.get_pointer();
+      auto output_data = output_mem_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
+              index, div_features_, features_, div_n_tile_rows_, n_tile_rows_,
+              div_n_tile_cols_, n_tile_cols_);
+      Index const col_idx = tensor_idx.s3 * OutTileCols;
+      Index const row_idx = tensor_idx.s2 * OutTileRows;
+      Index const feature = tensor_idx.s1;
+      Index const batch = tensor_idx.s0;
+
+      const Index cstart =
+          helpers::in_window_from_output(col_idx, Stride, pad_cols_)
+              .window_start;
+      const Index rstart =
+          helpers::in_window_from_output(row_idx, Stride, pad_rows_)
+              .window_start;
+
+      Output out_tile{};
+      Index const one = 1;
+      Index filter_offset = feature * channels_ * WindowSize;
+      Index input_channel_offset = batch * channels_ * in_rows_ * in_cols_;
+      for (Index channel = 0; channel < channels_; ++channel) {
+        Filter filter_tile{filter_data, filter_offset, one, one};
+
+        Index input_offset = input_channel_offset + rstart * in_cols_;
+        for (Index r = rstart, i = 0; i < InputTileRows; ++r, ++i) {
+          if (r >= 0 && r < in_rows_) {
+            auto input_tile = Input::load_input_row(input_data, input_offset,
+                                                    cstart, in_cols_, one);
+            convolve_tile(input_tile, filter_tile, out_tile, i);
+          }
+          input_offset += in_cols_;
+        }
+        input_channel_offset += in_rows_ * in_cols_;
+        filter_offset += WindowSize;
+      }
+      out_tile.write_out_nchw(output_data, batch, row_idx, out_rows_, col_idx,
+                              out_cols_, feature, features_, epilogue_);
+    }
+  }
+
+ private:
+  void SNN_ALWAYS_INLINE convolve_tile(Input const& input, Filter const& filter,
+                                       Output& output,
+                                       int const row_idx) const {
+    SNN_PRAGMA_UNROLL
+    for (int out_row = 0; out_row < OutTileRows; ++out_row) {
+      int const filter_row = row_idx - out_row * Stride;
+      if (filter_row >= 0 && filter_row < WindowRows) {
+        SNN_PRAGMA_UNROLL
+        for (int out_col = 0; out_col < OutTileCols; ++out_col) {
+          SNN_PRAGMA_UNROLL
+          for (int filter_col = 0; filter_col < WindowCols; ++filter_col) {
+            output.data(out_row, out_col) = helpers::math::mad(
+                input.data(out_col * Stride + filter_col),
+                filter.data(filter_row, filter_col, 0),
+                output.data(out_row, out_col));
+          }
+        }
+      }
+    }
+  }
+
+  const Index n_tile_cols_;
+  const Index n_tile_rows_;
+  const IndexDivType div_n_tile_cols_;
+  const IndexDivType div_n_tile_rows_;
+  const IndexDivType div_features_;
+  const Index n_elems_;
+  const Index channels_;
+  const Index features_;
+  const Index in_rows_;
+  const Index in_cols_;
+  const Index out_rows_;
+  const Index out_cols_;
+  const Index pad_rows_;
+  const Index pad_cols_;
+  const ReadMem<const T, IsUSM> input_mem_;
+  const ReadMem<const T, IsUSM> filter_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+  const EpilogueOp<T, IsUSM> epilogue_;
+};
+
+}  // namespace tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
@@ -15,6 +15,7 @@
  */
 #include "portdnn/internal/conv2d/tiled.h"
 
+#include "portdnn/format_type.h"
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
 
@@ -51,16 +52,20 @@ inline bool can_use_fast_div<conv_type::Forward>(Conv2DParams const& params,
                                                  int feature_vector_width,
                                                  int tile_rows, int tile_cols) {
   return params.features / feature_vector_width != 1 &&
-         helpers::round_ratio_up_above_zero(params.out_rows, tile_rows) != 1 &&
-         helpers::round_ratio_up_above_zero(params.out_cols, tile_cols) != 1;
+         tiled::get_dilated_tile_count(params.out_rows, tile_rows,
+                                       params.dilation_rows) != 1 &&
+         tiled::get_dilated_tile_count(params.out_cols, tile_cols,
+                                       params.dilation_cols) != 1;
 }
 template <>
 inline bool can_use_fast_div<conv_type::InputBackprop>(
     Conv2DParams const& params, int channel_vector_width,
     int /*feature_vector_width*/, int tile_rows, int tile_cols) {
   return params.channels / channel_vector_width != 1 &&
-         helpers::round_ratio_up_above_zero(params.in_rows, tile_rows) != 1 &&
-         helpers::round_ratio_up_above_zero(params.in_cols, tile_cols) != 1;
+         tiled::get_dilated_tile_count(params.in_rows, tile_rows,
+                                       params.dilation_rows) != 1 &&
+         tiled::get_dilated_tile_count(params.in_cols, tile_cols,
+                                       params.dilation_cols) != 1;
 }
 template <typename ConvType>
 inline bool can_use_sizes(Conv2DParams const& params, int channel_vector,
@@ -82,8 +87,11 @@ inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
                                                     int const feature_vector,
                                                     int const window,
                                                     int const stride) {
+  // The input backprop kernel only supports dilation with a unit stride.
+  bool const dilated = params.dilation_rows != 1 || params.dilation_cols != 1;
   return (params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
+          (stride == 1 || !dilated) &&
           params.features % feature_vector == 0 &&
           params.channels % channel_vector == 0);
 }
@@ -92,11 +100,13 @@ inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
  * Check whether fast divisions can be used for the convolution, and launch
  * whichever kernel is required.
  */
-template <typename T, typename Index, typename ConvType, int TileRows,
-          int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          int Window, int Stride, template <typename> class MemObj>
+template <typename T, typename ComputeT, typename Index, typename ConvType,
+          int TileRows, int TileCols, int ChannelVectorWidth,
+          int FeatureVectorWidth, int Window, int Stride, typename Layout,
+          template <typename> class MemObj>
 SNNStatus launch_with_index_type(MemObj<T const>& input,
                                  MemObj<T const>& filter, MemObj<T>& output,
+                                 EpilogueMem<T, MemObj>& epilogue,
                                  Conv2DParams const& params,
                                  tiled::TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
@@ -106,25 +116,30 @@ SNNStatus launch_with_index_type(MemObj<T const>& input,
                                  FeatureVectorWidth, TileRows, TileCols)) {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, true,
-                              Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue, events);
+                              Window, Window, Stride, Layout, MemObj,
+                              ComputeT>(
+        input, filter, output, epilogue, kernel_params, tile_info, queue,
+        events);
   } else {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, false,
-                              Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue, events);
+                              Window, Window, Stride, Layout, MemObj,
+                              ComputeT>(
+        input, filter, output, epilogue, kernel_params, tile_info, queue,
+        events);
   }
 }
 /**
  * Check what data type is required to fit the index sizes, and launch the
  * required kernel.
  */
-template <typename T, typename ConvType, int TileRows, int TileCols,
-          int ChannelVectorWidth, int FeatureVectorWidth, int Window,
-          int Stride, template <typename> class MemObj>
+template <typename T, typename ComputeT, typename ConvType, int TileRows,
+          int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
+          int Window, int Stride, typename Layout,
+          template <typename> class MemObj>
 SNNStatus launch_with_sizes(MemObj<T const>& input, MemObj<T const>& filter,
-                            MemObj<T>& output, Conv2DParams const& params,
-                            cl::sycl::queue& queue,
+                            MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                            Conv2DParams const& params, cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
   auto const tile_info = tiled::get_tile_info<ConvType>(
       params, TileRows, TileCols, ChannelVectorWidth, FeatureVectorWidth);
@@ -132,27 +147,29 @@ SNNStatus launch_with_sizes(MemObj<T const>& input, MemObj<T const>& filter,
                              tile_info.n_cols * tile_info.output_vectors;
   if (output_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
-    return launch_with_index_type<T, int64_t, ConvType, TileRows, TileCols,
-                                  ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue, events);
+    return launch_with_index_type<T, ComputeT, int64_t, ConvType, TileRows,
+                                  TileCols, ChannelVectorWidth,
+                                  FeatureVectorWidth, Window, Stride, Layout>(
+        input, filter, output, epilogue, params, tile_info, queue, events);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
-    return launch_with_index_type<T, int32_t, ConvType, TileRows, TileCols,
-                                  ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue, events);
+    return launch_with_index_type<T, ComputeT, int32_t, ConvType, TileRows,
+                                  TileCols, ChannelVectorWidth,
+                                  FeatureVectorWidth, Window, Stride, Layout>(
+        input, filter, output, epilogue, params, tile_info, queue, events);
   }
 }
 
 /** Internal tile size launcher for Forward.  */
-template <typename T, typename ConvType, template <typename> class MemObj,
+template <typename T, typename ComputeT, typename ConvType,
+          template <typename> class MemObj,
           typename std::enable_if<
               std::is_same<ConvType, conv_type::Forward>::value, int>::type = 0>
 inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events) {
@@ -160,9 +177,10 @@ inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
                         channel_vector, feature_vector)                       \
   if (can_use_sizes<ConvType>(params, channel_vector, feature_vector, window, \
                               stride)) {                                      \
-    return launch_with_sizes<T, ConvType, tile_row, tile_col, channel_vector, \
-                             feature_vector, window, stride>(                 \
-        input, filter, output, params, queue, events);                        \
+    return launch_with_sizes<T, ComputeT, ConvType, tile_row, tile_col,       \
+                             channel_vector, feature_vector, window, stride,  \
+                             layout::NHWC>(input, filter, output, epilogue,   \
+                                           params, queue, events);            \
   }
 
 // clang-format off
@@ -231,11 +249,13 @@ inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
 
 /** Internal tile size launcher for InputBackprop.  */
 template <
-    typename T, typename ConvType, template <typename> class MemObj,
+    typename T, typename ComputeT, typename ConvType,
+    template <typename> class MemObj,
     typename std::enable_if<
         std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
 inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events) {
@@ -259,14 +279,53 @@ inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
 
 #undef LAUNCH_IF_MATCH
 
+#ifdef SNN_ENABLE_NCHW
+/**
+ * Internal tile size launcher for Forward NCHW. The NCHW kernel does not
+ * vectorise across channels or features, and does not support dilation.
+ */
+template <typename T, template <typename> class MemObj>
+inline SNNStatus launch_tiled_nchw(MemObj<T const>& input,
+                                   MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
+                                   Conv2DParams const& params,
+                                   cl::sycl::queue& queue,
+                                   const std::vector<cl::sycl::event>& events) {
+  using ConvType = conv_type::Forward;
+  if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+    return StatusCode::InvalidAlgorithm;
+  }
+#define LAUNCH_IF_MATCH(params, window, stride, tile_row, tile_col)            \
+  if (can_use_sizes<ConvType>(params, 1, 1, window, stride)) {                 \
+    return launch_with_sizes<T, T, ConvType, tile_row, tile_col, 1, 1, window, \
+                             stride, layout::NCHW>(                            \
+        input, filter, output, epilogue, params, queue, events);               \
+  }
+
+  // clang-format off
+  LAUNCH_IF_MATCH(params, 1, 1, 2, 4)
+  LAUNCH_IF_MATCH(params, 1, 2, 2, 2)
+  LAUNCH_IF_MATCH(params, 3, 1, 3, 4)
+  LAUNCH_IF_MATCH(params, 3, 2, 2, 2)
+  LAUNCH_IF_MATCH(params, 5, 1, 2, 4)
+  // clang-format on
+
+#undef LAUNCH_IF_MATCH
+
+  return StatusCode::InvalidAlgorithm;
+}
+#endif  // SNN_ENABLE_NCHW
+
 /** Internal tile size launcher for FilterBackprop.  */
-template <typename T, typename ConvType, template <typename> class MemObj,
+template <typename T, typename ComputeT, typename ConvType,
+          template <typename> class MemObj,
           typename std::enable_if<
               std::is_same<ConvType, conv_type::FilterBackprop>::value,
               int>::type = 0>
 inline SNNStatus launch_tiled_impl(
     MemObj<T const>& /*input*/, MemObj<T const>& /*filter*/,
-    MemObj<T>& /*output*/, Conv2DParams const& /*params*/,
+    MemObj<T>& /*output*/, EpilogueMem<T, MemObj>& /*epilogue*/,
+    Conv2DParams const& /*params*/,
     cl::sycl::queue& /*queue*/,
     const std::vector<cl::sycl::event>& /*events*/) {
   // Tiled algorithm is not supported for filter backprop.
@@ -274,25 +333,40 @@ inline SNNStatus launch_tiled_impl(
 }
 }  // namespace
 
-template <typename T, typename ConvType, template <typename> class MemObj>
+template <typename T, typename ConvType, typename ComputeT,
+          template <typename> class MemObj>
 inline SNNStatus launch_tiled(MemObj<T const>& input, MemObj<T const>& filter,
-                              MemObj<T>& output, Conv2DParams const& params,
+                              MemObj<T>& output,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
                               cl::sycl::queue& queue,
                               const std::vector<cl::sycl::event>& events) {
-  return launch_tiled_impl<T, ConvType>(input, filter, output, params, queue,
-                                        events);
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    // The NCHW kernels always accumulate in the data type.
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value &&
+                  std::is_same<ComputeT, T>::value) {
+      return launch_tiled_nchw<T>(input, filter, output, epilogue, params,
+                                  queue, events);
+    }
+#endif  // SNN_ENABLE_NCHW
+    return StatusCode::InvalidAlgorithm;
+  }
+  return launch_tiled_impl<T, ComputeT, ConvType>(
+      input, filter, output, epilogue, params, queue, events);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEM_OBJ)                  \
-  template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(          \
-      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter, \
-      MEM_OBJ<DTYPE> & output, Conv2DParams const& params,         \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events)
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, DIR, MEM_OBJ)                  \
+  template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR, CTYPE, MEM_OBJ>( \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,        \
+      MEM_OBJ<DTYPE> & output, EpilogueMem<DTYPE, MEM_OBJ> & epilogue,    \
+      Conv2DParams const& params, cl::sycl::queue& queue,                 \
+      const std::vector<cl::sycl::event>& events)
 
-#define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                      \
-  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, MEM_OBJ);       \
-  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, MEM_OBJ); \
-  INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, MEM_OBJ)
+#define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                             \
+  INSTANTIATE_LAUNCHER(DTYPE, DTYPE, conv_type::Forward, MEM_OBJ);       \
+  INSTANTIATE_LAUNCHER(DTYPE, DTYPE, conv_type::InputBackprop, MEM_OBJ); \
+  INSTANTIATE_LAUNCHER(DTYPE, DTYPE, conv_type::FilterBackprop, MEM_OBJ)
 
 #ifdef SNN_ENABLE_USM
 INSTANTIATE_FOR_TYPE(float, USMMemObject);
@@ -311,6 +385,12 @@ INSTANTIATE_FOR_TYPE(double, BufferMemObject);
 INSTANTIATE_FOR_TYPE(cl::sycl::half, USMMemObject);
 #endif
 INSTANTIATE_FOR_TYPE(cl::sycl::half, BufferMemObject);
+// Half precision forward convolutions with single precision accumulation.
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_LAUNCHER(cl::sycl::half, float, conv_type::Forward, USMMemObject);
+#endif
+INSTANTIATE_LAUNCHER(cl::sycl::half, float, conv_type::Forward,
+                     BufferMemObject);
 #endif  // SNN_USE_HALF
 
 #undef INSTANTIATE_FOR_TYPE
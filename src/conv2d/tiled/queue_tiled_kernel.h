@@ -16,11 +16,14 @@
 #ifndef PORTDNN_SRC_CONV2D_TILED_QUEUE_TILED_KERNEL_H_
 #define PORTDNN_SRC_CONV2D_TILED_QUEUE_TILED_KERNEL_H_
 
+#include "portdnn/format_type.h"
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
 
 #include "portdnn/conv2d/params.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
+
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -29,12 +32,20 @@ namespace sycldnn {
 namespace conv2d {
 namespace internal {
 
+/**
+ * Queue a tiled convolution kernel to the provided SYCL queue.
+ *
+ * The epilogue is only applied to forward convolutions. The convolution is
+ * accumulated as ComputeT.
+ */
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
           bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
-          template <typename> class MemObj>
+          typename Layout, template <typename> class MemObj,
+          typename ComputeT = T>
 SNNStatus queue_tiled_kernel(MemObj<T const>& input, MemObj<T const>& filter,
                              MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
                              Conv2DParams const& kernel_params,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue,
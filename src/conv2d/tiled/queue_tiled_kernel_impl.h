@@ -16,6 +16,7 @@
 #ifndef PORTDNN_SRC_CONV2D_TILED_QUEUE_TILED_KERNEL_IMPL_H_
 #define PORTDNN_SRC_CONV2D_TILED_QUEUE_TILED_KERNEL_IMPL_H_
 
+#include "portdnn/format_type.h"
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
 
@@ -23,11 +24,17 @@
 
 #include "portdnn/conv2d/params.h"
 
+#include "portdnn/internal/conv2d/epilogue.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
 #include "src/conv2d/tiled/kernels.h"
+#include "src/conv2d/tiled/kernels_nchw.h"
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <CL/sycl.hpp>
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -57,17 +64,23 @@ cl::sycl::range<1> get_thread_range(Conv2DParams const& params,
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
           bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
-          template <typename> class MemObj>
+          typename Layout, template <typename> class MemObj,
+          typename ComputeT>
 SNNStatus queue_tiled_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
                              MemObj<T>& out_mem,
+                             EpilogueMem<T, MemObj>& epilogue,
                              Conv2DParams const& kernel_params,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue,
                              const std::vector<cl::sycl::event>& events) {
-  using Functor = tiled::TiledConv2D<T, Index, ConvType, TileRows, TileCols,
-                                     ChannelVectorWidth, FeatureVectorWidth,
-                                     UseFastDiv, WindowRows, WindowCols, Stride,
-                                     is_usm_obj_v<MemObj<T>, T>>;
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = std::conditional_t<
+      std::is_same<Layout, layout::NCHW>::value,
+      tiled::TiledConv2DNCHW<T, Index, TileRows, TileCols, UseFastDiv,
+                             WindowRows, WindowCols, Stride, is_usm>,
+      tiled::TiledConv2D<T, Index, ConvType, TileRows, TileCols,
+                         ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
+                         WindowRows, WindowCols, Stride, is_usm, ComputeT>>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
@@ -75,10 +88,19 @@ SNNStatus queue_tiled_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
     auto filter = fil_mem.read_mem(cgh);
     auto output = out_mem.write_mem(cgh);
 
-    Functor conv{input, filter, output, kernel_params, tile_info};
     auto threads = get_thread_range(kernel_params, tile_info, queue);
 
-    cgh.parallel_for(threads, conv);
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                        epilogue.bias.read_mem(cgh),
+                                        epilogue.residual.read_mem(cgh)};
+      Functor conv{input, filter, output, kernel_params, tile_info,
+                   epilogue_op};
+      cgh.parallel_for(threads, conv);
+    } else {
+      Functor conv{input, filter, output, kernel_params, tile_info};
+      cgh.parallel_for(threads, conv);
+    }
   });
   SNNStatus ok_status{event, StatusCode::OK};
   return ok_status;
@@ -19,6 +19,7 @@
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
 
+#include "portdnn/helpers/macros.h"
 #include "portdnn/helpers/ratio.h"
 
 namespace sycldnn {
@@ -39,6 +40,29 @@ struct TileInfo {
   int output_vectors;
 };
 
+/**
+ * Get the number of tiles required to cover size elements with tiles of
+ * tile_size elements, where each tile covers every dilation-th element.
+ *
+ * Each of the dilation interleaved grids of elements is covered by the same
+ * number of tiles, so some tiles may be entirely out of bounds.
+ */
+inline int get_dilated_tile_count(int size, int tile_size, int dilation) {
+  auto grid_size = helpers::round_ratio_up_above_zero(size, dilation);
+  return dilation * helpers::round_ratio_up_above_zero(grid_size, tile_size);
+}
+
+/**
+ * Get the index of the first element covered by a tile, when tiles cover every
+ * dilation-th element. Consecutive tile indices cover the dilation interleaved
+ * grids of elements before moving on to the next block of elements.
+ */
+template <typename Index>
+inline SNN_ALWAYS_INLINE Index get_tile_start(Index tile_idx, int tile_size,
+                                              Index dilation) {
+  return tile_idx % dilation + (tile_idx / dilation) * tile_size * dilation;
+}
+
 /**
  * Get the number of tiles required for the convolution specified by the
  * parameters and tile sizes.
@@ -56,8 +80,10 @@ template <typename ConvType>
 inline TileInfo get_tile_info(Conv2DParams const& params, int tile_rows,
                               int tile_cols, int /*channel_vector*/,
                               int feature_vector) {
-  auto rows = helpers::round_ratio_up_above_zero(params.out_rows, tile_rows);
-  auto cols = helpers::round_ratio_up_above_zero(params.out_cols, tile_cols);
+  auto rows =
+      get_dilated_tile_count(params.out_rows, tile_rows, params.dilation_rows);
+  auto cols =
+      get_dilated_tile_count(params.out_cols, tile_cols, params.dilation_cols);
   auto output_vector = params.features / feature_vector;
   return {rows, cols, output_vector};
 }
@@ -67,8 +93,10 @@ template <>
 inline TileInfo get_tile_info<conv_type::InputBackprop>(
     Conv2DParams const& params, int tile_rows, int tile_cols,
     int channel_vector, int /*feature_vector*/) {
-  auto rows = helpers::round_ratio_up_above_zero(params.in_rows, tile_rows);
-  auto cols = helpers::round_ratio_up_above_zero(params.in_cols, tile_cols);
+  auto rows =
+      get_dilated_tile_count(params.in_rows, tile_rows, params.dilation_rows);
+  auto cols =
+      get_dilated_tile_count(params.in_cols, tile_cols, params.dilation_cols);
   auto output_vector = params.channels / channel_vector;
   return {rows, cols, output_vector};
 }
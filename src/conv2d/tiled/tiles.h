@@ -65,17 +65,19 @@ struct InputRow final
 
   /**
    * Input row factory method. Will load the input data specified by row, col
-   * and channel into an InputRow tile from the given multi pointer.
+   * and channel into an InputRow tile from the given multi pointer. Consecutive
+   * elements of the tile are loaded from every dilation-th column.
    */
   template <typename Index, MULTI_PTR_TEMPLATE_DECL>
   static InputRow SNN_ALWAYS_INLINE
   load_input_row(cl::sycl::multi_ptr<T const, MULTI_PTR_TEMPLATE> input,
                  Index const offset, Index const col, Index const n_cols,
-                 Index const n_channels) {
-    if (col >= 0 && col + Width < n_cols) {
-      return {input, offset, col, n_cols, n_channels};
+                 Index const n_channels, Index const dilation = 1) {
+    if (col >= 0 && col + Width * dilation < n_cols) {
+      return {input, offset, col, n_cols, n_channels, dilation};
     } else {
-      return {input, offset, col, n_cols, n_channels, check_bounds_tag{}};
+      return {input,      offset,   col, n_cols,
+              n_channels, dilation, check_bounds_tag{}};
     };
   }
 
@@ -84,12 +86,12 @@ struct InputRow final
   SNN_ALWAYS_INLINE InputRow(
       cl::sycl::multi_ptr<T const, MULTI_PTR_TEMPLATE> input,
       Index const offset, Index const col, Index const /*n_cols*/,
-      Index const n_channels) {
+      Index const n_channels, Index const dilation) {
     Index idx = offset + col * n_channels;
     SNN_PRAGMA_UNROLL
     for (int i = 0; i < Width; ++i) {
       data(i) = helpers::io::Load<VecType>()(input, idx);
-      idx += n_channels;
+      idx += dilation * n_channels;
     }
   }
 
@@ -97,14 +99,16 @@ struct InputRow final
   SNN_ALWAYS_INLINE InputRow(
       cl::sycl::multi_ptr<T const, MULTI_PTR_TEMPLATE> input,
       Index const offset, Index const col, Index const n_cols,
-      Index const n_channels, check_bounds_tag) {
+      Index const n_channels, Index const dilation, check_bounds_tag) {
     Index idx = offset + col * n_channels;
+    Index in_col = col;
     SNN_PRAGMA_UNROLL
     for (int i = 0; i < Width; ++i) {
-      data(i) = (col + i < 0 || col + i >= n_cols)
+      data(i) = (in_col < 0 || in_col >= n_cols)
                     ? VecType{0}
                     : helpers::io::Load<VecType>()(input, idx);
-      idx += n_channels;
+      idx += dilation * n_channels;
+      in_col += dilation;
     }
   }
 };
@@ -166,6 +170,15 @@ struct FilterTile : public helpers::RegisterTile3D<
   }
 };
 
+/** Epilogue which leaves the output values unchanged. */
+struct NoEpilogue {
+  template <typename DataType, typename Index>
+  DataType SNN_ALWAYS_INLINE apply(DataType value, Index /*feature*/,
+                                   Index /*out_idx*/) const {
+    return value;
+  }
+};
+
 /* An OutTileRows x OutTileCols tile to collect output results. */
 template <typename T, int VectorWidth, int OutTileRows, int OutTileCols>
 struct OutputTile final
@@ -175,52 +188,117 @@ struct OutputTile final
   using VecType = typename helpers::VectorType<T, VectorWidth>::type;
   using helpers::RegisterTile2D<VecType, OutTileRows, OutTileCols>::data;
 
-  template <typename Index, MULTI_PTR_TEMPLATE_DECL>
+  /**
+   * Output tile factory method. Converts each value of a tile which was
+   * accumulated in another data type to T.
+   */
+  template <typename From>
+  static OutputTile SNN_ALWAYS_INLINE convert_from(
+      OutputTile<From, VectorWidth, OutTileRows, OutTileCols> const& other) {
+    OutputTile tile{};
+    SNN_PRAGMA_UNROLL
+    for (int row = 0; row < OutTileRows; ++row) {
+      SNN_PRAGMA_UNROLL
+      for (int col = 0; col < OutTileCols; ++col) {
+        tile.data(row, col) = helpers::convert_vector<T>(other.data(row, col));
+      }
+    }
+    return tile;
+  }
+
+  /**
+   * Write the tile to the output tensor. Consecutive rows and columns of the
+   * tile are written to every dilation_rows-th row and dilation_cols-th column
+   * of the output. Each value is passed through the epilogue before it is
+   * written.
+   */
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL,
+            typename Epilogue = NoEpilogue>
   void SNN_ALWAYS_INLINE write_out(
       cl::sycl::multi_ptr<T, MULTI_PTR_TEMPLATE> output, Index const batch,
       Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
-    if (out_row + OutTileRows < n_rows && out_col + OutTileCols < n_cols) {
+      Index const n_cols, Index const feature, Index const n_features,
+      Index const dilation_rows = 1, Index const dilation_cols = 1,
+      Epilogue const& epilogue = {}) {
+    if (out_row + OutTileRows * dilation_rows < n_rows &&
+        out_col + OutTileCols * dilation_cols < n_cols) {
       write_out_no_check(output, batch, out_row, n_rows, out_col, n_cols,
-                         feature, n_features);
+                         feature, n_features, dilation_rows, dilation_cols,
+                         epilogue);
     } else {
       write_out_checked(output, batch, out_row, n_rows, out_col, n_cols,
-                        feature, n_features);
+                        feature, n_features, dilation_rows, dilation_cols,
+                        epilogue);
+    }
+  }
+
+  /**
+   * Write the tile to an NCHW output tensor, in which each row of the tile is
+   * contiguous. Each value is passed through the epilogue before it is
+   * written.
+   */
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL, typename Epilogue>
+  void SNN_ALWAYS_INLINE write_out_nchw(
+      cl::sycl::multi_ptr<T, MULTI_PTR_TEMPLATE> output, Index const batch,
+      Index const out_row, Index const n_rows, Index const out_col,
+      Index const n_cols, Index const feature, Index const n_features,
+      Epilogue const& epilogue) {
+    Index row_idx =
+        ((batch * n_features + feature) * n_rows + out_row) * n_cols + out_col;
+    SNN_PRAGMA_UNROLL
+    for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
+      if (tile_row < n_rows - out_row) {
+        SNN_PRAGMA_UNROLL
+        for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
+          if (tile_col < n_cols - out_col) {
+            Index const idx = row_idx + tile_col;
+            helpers::io::Store<VecType>()(
+                output, idx,
+                epilogue.apply(data(tile_row, tile_col), feature, idx));
+          }
+        }
+      }
+      row_idx += n_cols;
     }
   }
 
  private:
-  template <typename Index, MULTI_PTR_TEMPLATE_DECL>
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL, typename Epilogue>
   void SNN_ALWAYS_INLINE write_out_checked(
       cl::sycl::multi_ptr<T, MULTI_PTR_TEMPLATE> output, Index const batch,
       Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
+      Index const n_cols, Index const feature, Index const n_features,
+      Index const dilation_rows, Index const dilation_cols,
+      Epilogue const& epilogue) {
     Index const offset =
         ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
 
     Index row_idx = offset;
     SNN_PRAGMA_UNROLL
     for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
-      if (tile_row < n_rows - out_row) {
+      if (tile_row * dilation_rows < n_rows - out_row) {
         Index idx = row_idx;
         SNN_PRAGMA_UNROLL
         for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
-          if (tile_col < n_cols - out_col) {
-            helpers::io::Store<VecType>()(output, idx,
-                                          data(tile_row, tile_col));
-            idx += n_features;
+          if (tile_col * dilation_cols < n_cols - out_col) {
+            helpers::io::Store<VecType>()(
+                output, idx,
+                epilogue.apply(data(tile_row, tile_col), feature, idx));
+            idx += dilation_cols * n_features;
           }
         }
-        row_idx += n_cols * n_features;
+        row_idx += dilation_rows * n_cols * n_features;
       }
     }
   }
 
-  template <typename Index, MULTI_PTR_TEMPLATE_DECL>
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL, typename Epilogue>
   void SNN_ALWAYS_INLINE write_out_no_check(
       cl::sycl::multi_ptr<T, MULTI_PTR_TEMPLATE> output, Index const batch,
       Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
+      Index const n_cols, Index const feature, Index const n_features,
+      Index const dilation_rows, Index const dilation_cols,
+      Epilogue const& epilogue) {
     Index const offset =
         ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
 
@@ -230,10 +308,12 @@ struct OutputTile final
       Index idx = row_idx;
       SNN_PRAGMA_UNROLL
       for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
-        helpers::io::Store<VecType>()(output, idx, data(tile_row, tile_col));
-        idx += n_features;
+        helpers::io::Store<VecType>()(
+            output, idx,
+            epilogue.apply(data(tile_row, tile_col), feature, idx));
+        idx += dilation_cols * n_features;
       }
-      row_idx += n_cols * n_features;
+      row_idx += dilation_rows * n_cols * n_features;
     }
   }
 };
@@ -20,6 +20,7 @@
 
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 #include "portdnn/helpers/minmax.h"
 
 #include "src/conv2d/winograd/kernels/tiles.h"
@@ -31,7 +32,7 @@ namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, int M, int N, int R, int S,
-          typename ConvType, bool IsUSM>
+          typename ConvType, typename Layout, bool IsUSM>
 struct ExtractFilterTiles {
   ExtractFilterTiles(Conv2DParams const& params, TileInfo const& /*unused*/,
                      ReadMem<T const, IsUSM> const& filter,
@@ -54,8 +55,9 @@ struct ExtractFilterTiles {
       Index const feature_idx = channel_feature_idx.s1;
       Index const channel_idx = channel_feature_idx.s0;
 
-      FilterTile<T, M, N, R, S, ConvType> filter(
-          filter_data, channel_idx, feature_idx, n_channels_, n_features_);
+      FilterTile<T, M, N, R, S, ConvType> filter(Layout{}, filter_data,
+                                                 channel_idx, feature_idx,
+                                                 n_channels_, n_features_);
       TransformedFilterTile<T, M, N, R, S> transformed{filter};
 
       OutputData<T, M, N, R, S>::write_transformed_filter(
@@ -74,7 +76,7 @@ struct ExtractFilterTiles {
 
 template <typename T, typename Index, int M, int N, int R, int S, bool IsUSM>
 struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::InputBackprop,
-                          IsUSM> {
+                          layout::NHWC, IsUSM> {
   using ConvType = conv_type::InputBackprop;
 
   /*
@@ -124,7 +126,7 @@ struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::InputBackprop,
 
 template <typename T, typename Index, int M, int N, int R, int S, bool IsUSM>
 struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::FilterBackprop,
-                          IsUSM> {
+                          layout::NHWC, IsUSM> {
   using ConvType = conv_type::FilterBackprop;
 
   ExtractFilterTiles(Conv2DParams const& params, TileInfo const& tile_info,
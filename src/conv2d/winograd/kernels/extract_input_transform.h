@@ -20,6 +20,7 @@
 
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 
 #include "src/helpers/register_tile.h"
 #include "src/helpers/tensor_index.h"
@@ -29,13 +30,15 @@
 
 #include "src/conv2d/winograd/kernels/tiles.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, int ChannelVector, int M, int N, int R,
-          int S, typename ConvType, bool IsUSM>
+          int S, typename ConvType, typename Layout, bool IsUSM>
 struct ExtractInputTiles {
   using VecType = typename helpers::VectorType<T, ChannelVector>::type;
 
@@ -61,11 +64,24 @@ struct ExtractInputTiles {
       auto input_data = input_mem_.get_pointer();
       auto output_data = output_mem_.get_pointer();
 
-      auto const tile_channel_idx =
-          helpers::TensorIndexHelper<Index, false>::unflatten2d(
-              index, n_channels_ / ChannelVector, n_channels_ / ChannelVector);
-      Index const channel_idx = tile_channel_idx.s1 * ChannelVector;
-      Index const tile_idx = tile_channel_idx.s0;
+      Index channel_idx;
+      Index tile_idx;
+      if constexpr (std::is_same<Layout, layout::NCHW>::value) {
+        // Neighbouring work items handle neighbouring tiles in the same
+        // channel, so their loads from the NCHW input are close together.
+        auto const channel_tile_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten2d(
+                index, n_tiles_, n_tiles_);
+        channel_idx = channel_tile_idx.s0 * ChannelVector;
+        tile_idx = channel_tile_idx.s1;
+      } else {
+        auto const tile_channel_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten2d(
+                index, n_channels_ / ChannelVector,
+                n_channels_ / ChannelVector);
+        channel_idx = tile_channel_idx.s1 * ChannelVector;
+        tile_idx = tile_channel_idx.s0;
+      }
 
       auto const tile_tensor_idx =
           helpers::TensorIndexHelper<Index, false>::unflatten3d(
@@ -77,9 +93,9 @@ struct ExtractInputTiles {
       Index const cstart = col_idx * N - n_pad_cols_;
       Index const rstart = row_idx * M - n_pad_rows_;
 
-      InputTile<VecType, M, N, R, S> inp(input_data, batch, rstart, n_in_rows_,
-                                         cstart, n_in_cols_, channel_idx,
-                                         n_channels_);
+      InputTile<VecType, M, N, R, S> inp(Layout{}, input_data, batch, rstart,
+                                         n_in_rows_, cstart, n_in_cols_,
+                                         channel_idx, n_channels_);
 
       OutputData<VecType, M, N, R, S>::write_transformed_input(
           output_data, tile_idx, channel_idx, n_tiles_, n_channels_,
@@ -104,7 +120,7 @@ struct ExtractInputTiles {
 template <typename T, typename Index, int ChannelVector, int M, int N, int R,
           int S, bool IsUSM>
 struct ExtractInputTiles<T, Index, ChannelVector, M, N, R, S,
-                         conv_type::FilterBackprop, IsUSM> {
+                         conv_type::FilterBackprop, layout::NHWC, IsUSM> {
   using VecType = typename helpers::VectorType<T, ChannelVector>::type;
 
   ExtractInputTiles(Conv2DParams const& params, TileInfo const& tile_info,
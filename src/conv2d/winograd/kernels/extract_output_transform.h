@@ -20,23 +20,29 @@
 
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 #include "portdnn/helpers/minmax.h"
 
 #include "src/helpers/tensor_index.h"
 
+#include "src/conv2d/epilogue/epilogue_op.h"
+
 #include "src/conv2d/winograd/kernels/tiles.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, int M, int N, int R, int S,
-          typename ConvType, bool Accumulate, bool IsUSM>
+          typename ConvType, bool Accumulate, typename Layout, bool IsUSM>
 struct ExtractOutputTiles {
   ExtractOutputTiles(Conv2DParams const& params, TileInfo const& tile_info,
                      ReadMem<T const, IsUSM> const& input,
-                     WriteMem<T, IsUSM> const& output)
+                     WriteMem<T, IsUSM> const& output,
+                     EpilogueOp<T, IsUSM> const& epilogue)
       : n_threads_{params.batch * tile_info.rows * tile_info.cols *
                    params.features},
         n_tiles_{tile_info.number * params.batch},
@@ -46,7 +52,8 @@ struct ExtractOutputTiles {
         n_out_cols_{params.out_cols},
         n_features_{params.features},
         input_mem_{input},
-        output_mem_{output} {}
+        output_mem_{output},
+        epilogue_{epilogue} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     Index const index = item.get_id(0);
@@ -54,11 +61,22 @@ struct ExtractOutputTiles {
       auto input_data = input_mem_.get_pointer();
       auto output_data = output_mem_.get_pointer();
 
-      auto const tile_feature_idx =
-          helpers::TensorIndexHelper<Index, false>::unflatten2d(
-              index, n_features_, n_features_);
-      Index const tile_idx = tile_feature_idx.s0;
-      Index const feature = tile_feature_idx.s1;
+      static constexpr bool is_nchw = std::is_same<Layout, layout::NCHW>::value;
+      Index tile_idx;
+      Index feature;
+      if constexpr (is_nchw) {
+        auto const feature_tile_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten2d(
+                index, n_tiles_, n_tiles_);
+        feature = feature_tile_idx.s0;
+        tile_idx = feature_tile_idx.s1;
+      } else {
+        auto const tile_feature_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten2d(
+                index, n_features_, n_features_);
+        tile_idx = tile_feature_idx.s0;
+        feature = tile_feature_idx.s1;
+      }
 
       auto const tile_tensor_idx =
           helpers::TensorIndexHelper<Index, false>::unflatten3d(
@@ -76,15 +94,30 @@ struct ExtractOutputTiles {
       Index const row = row_idx * M;
       Index const rend = helpers::min(row + M, n_out_rows_);
 
-      Index const offset =
-          ((batch * n_out_rows_ + row) * n_out_cols_ + col) * n_features_ +
-          feature;
+      // Distance in memory between neighbouring output pixels.
+      Index const pixel_stride = is_nchw ? 1 : n_features_;
+      Index offset;
+      if constexpr (is_nchw) {
+        Index const plane = batch * n_features_ + feature;
+        offset = (plane * n_out_rows_ + row) * n_out_cols_ + col;
+      } else {
+        offset = ((batch * n_out_rows_ + row) * n_out_cols_ + col) *
+                     n_features_ +
+                 feature;
+      }
 
       SYCLOutputWindow<Index> out_w{rend - row, cend - col, offset};
 
+      OutputTile<T, M, N, R, S> out_tile{tmp};
+      for (int r = 0; r < M && r < out_w.rsize; ++r) {
+        for (int c = 0; c < N && c < out_w.csize; ++c) {
+          Index const out_idx = offset + (r * n_out_cols_ + c) * pixel_stride;
+          out_tile.data(r, c) =
+              epilogue_.apply(out_tile.data(r, c), feature, out_idx);
+        }
+      }
       OutputData<T, M, N, R, S>::write_output(output_data, out_w, n_out_cols_,
-                                              n_features_,
-                                              OutputTile<T, M, N, R, S>{tmp});
+                                              pixel_stride, out_tile);
     }
   }
 
@@ -98,12 +131,13 @@ struct ExtractOutputTiles {
   Index const n_features_;
   ReadMem<T const, IsUSM> input_mem_;
   WriteMem<T, IsUSM> output_mem_;
+  EpilogueOp<T, IsUSM> const epilogue_;
 };
 
 template <typename T, typename Index, int M, int N, int R, int S,
           bool Accumulate, bool IsUSM>
 struct ExtractOutputTiles<T, Index, M, N, R, S, conv_type::FilterBackprop,
-                          Accumulate, IsUSM> {
+                          Accumulate, layout::NHWC, IsUSM> {
   ExtractOutputTiles(Conv2DParams const& params, TileInfo const& /*unused*/,
                      ReadMem<T const, IsUSM> const& input,
                      WriteMem<T, IsUSM> const& output)
@@ -0,0 +1,286 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_WINOGRAD_KERNELS_FUSED_WINOGRAD_H_
+#define PORTDNN_SRC_CONV2D_WINOGRAD_KERNELS_FUSED_WINOGRAD_H_
+
+#include "portdnn/accessor_types.h"
+
+#include "portdnn/conv2d/params.h"
+#include "portdnn/helpers/minmax.h"
+
+#include "src/helpers/tensor_index.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+
+#include "src/conv2d/winograd/kernels/tiles.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+/**
+ * Forward Winograd convolution computed in a single kernel.
+ *
+ * Each work-group computes TileBlock output tiles for FeatureBlock features,
+ * with one work-item per tile and feature. The channels are processed in
+ * blocks of ChannelBlock: the work-group cooperatively transforms the input
+ * tiles for those channels and loads the corresponding part of the filter
+ * transform into local memory, then every work-item accumulates the
+ * elementwise products into its intermediate tile. Once all channels have been
+ * processed the output transform and epilogue are applied in registers, so
+ * neither the input transform nor the intermediate tensor are written to
+ * global memory.
+ *
+ * The filter transform is expected in the layout written by the Winograd
+ * filter transform kernel, [A * B][channels][features].
+ */
+template <typename T, typename Index, int M, int N, int R, int S,
+          int TileBlock, int FeatureBlock, int ChannelBlock, bool IsUSM>
+struct FusedWinogradConv {
+  static constexpr int A = M + R - 1;
+  static constexpr int B = N + S - 1;
+  /** Number of work-items in each work-group. */
+  static constexpr int local_size = TileBlock * FeatureBlock;
+  /** Number of transformed input values stored in local memory. */
+  static constexpr int input_local_size = ChannelBlock * A * B * TileBlock;
+  /** Number of transformed filter values stored in local memory. */
+  static constexpr int filter_local_size = ChannelBlock * A * B * FeatureBlock;
+  /** Total number of elements of local memory required by the kernel. */
+  static constexpr int local_mem_size = input_local_size + filter_local_size;
+
+  FusedWinogradConv(Conv2DParams const& params, TileInfo const& tile_info,
+                    ReadMem<T const, IsUSM> const& input,
+                    ReadMem<T const, IsUSM> const& filter,
+                    LocalAccessor<T> const& local,
+                    WriteMem<T, IsUSM> const& output,
+                    EpilogueOp<T, IsUSM> const& epilogue)
+      : n_tiles_{tile_info.number * params.batch},
+        n_tile_rows_{tile_info.rows},
+        n_tile_cols_{tile_info.cols},
+        n_feature_blocks_{(params.features + FeatureBlock - 1) / FeatureBlock},
+        n_in_rows_{params.in_rows},
+        n_in_cols_{params.in_cols},
+        n_out_rows_{params.out_rows},
+        n_out_cols_{params.out_cols},
+        n_channels_{params.channels},
+        n_features_{params.features},
+        n_pad_rows_{params.pad_rows},
+        n_pad_cols_{params.pad_cols},
+        input_mem_{input},
+        filter_mem_{filter},
+        local_{local},
+        output_mem_{output},
+        epilogue_{epilogue} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const local_idx = item.get_local_id(0);
+    Index const group_idx = item.get_group(0);
+
+    auto const group_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten2d(
+            group_idx, n_feature_blocks_, n_feature_blocks_);
+    Index const feature_block = group_tensor_idx.s1;
+    Index const tile_block = group_tensor_idx.s0;
+
+    auto const local_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten2d(
+            local_idx, FeatureBlock, FeatureBlock);
+    Index const local_feature = local_tensor_idx.s1;
+    Index const local_tile = local_tensor_idx.s0;
+
+    auto input_data = input_mem_.get_pointer();
+    auto filter_data = filter_mem_.get_pointer();
+
+    IntermediateTile<T, M, N, R, S> accumulator{};
+    for (Index channel = 0; channel < n_channels_; channel += ChannelBlock) {
+      load_input_block(input_data, tile_block, channel, local_idx);
+      load_filter_block(filter_data, feature_block, channel, local_idx);
+      item.barrier(cl::sycl::access::fence_space::local_space);
+
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < ChannelBlock; ++c) {
+        SNN_PRAGMA_UNROLL
+        for (int r = 0; r < A; ++r) {
+          SNN_PRAGMA_UNROLL
+          for (int s = 0; s < B; ++s) {
+            int const elem = (c * A + r) * B + s;
+            accumulator.data(r, s) +=
+                local_[elem * TileBlock + local_tile] *
+                local_[input_local_size + elem * FeatureBlock + local_feature];
+          }
+        }
+      }
+      // All work-items must finish reading the local memory before the next
+      // channel block overwrites it.
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    Index const tile_idx = tile_block * TileBlock + local_tile;
+    Index const feature = feature_block * FeatureBlock + local_feature;
+    if (tile_idx < n_tiles_ && feature < n_features_) {
+      write_output_tile(accumulator, tile_idx, feature);
+    }
+  }
+
+ private:
+  /**
+   * Transform the input tiles for a block of channels and store them in local
+   * memory, in the layout [ChannelBlock][A * B][TileBlock]. Values outside the
+   * input tensor are set to zero so they do not affect the accumulation.
+   */
+  template <typename InputPointer>
+  void SNN_ALWAYS_INLINE load_input_block(InputPointer input_data,
+                                          Index tile_block, Index channel_start,
+                                          Index local_idx) const {
+    for (Index idx = local_idx; idx < TileBlock * ChannelBlock;
+         idx += local_size) {
+      auto const block_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              idx, ChannelBlock, ChannelBlock);
+      Index const local_channel = block_idx.s1;
+      Index const local_tile = block_idx.s0;
+      Index const tile_idx = tile_block * TileBlock + local_tile;
+      Index const channel = channel_start + local_channel;
+      Index const offset = local_channel * A * B * TileBlock + local_tile;
+
+      if (tile_idx < n_tiles_ && channel < n_channels_) {
+        auto const tile_tensor_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten3d(
+                tile_idx, n_tile_rows_, n_tile_rows_, n_tile_cols_,
+                n_tile_cols_);
+        Index const col_idx = tile_tensor_idx.s2;
+        Index const row_idx = tile_tensor_idx.s1;
+        Index const batch = tile_tensor_idx.s0;
+
+        Index const cstart = col_idx * N - n_pad_cols_;
+        Index const rstart = row_idx * M - n_pad_rows_;
+
+        InputTile<T, M, N, R, S> inp(input_data, batch, rstart, n_in_rows_,
+                                     cstart, n_in_cols_, channel, n_channels_);
+        TransformedInputTile<T, M, N, R, S> transformed{inp};
+        SNN_PRAGMA_UNROLL
+        for (int r = 0; r < A; ++r) {
+          SNN_PRAGMA_UNROLL
+          for (int s = 0; s < B; ++s) {
+            local_[offset + (r * B + s) * TileBlock] = transformed.data(r, s);
+          }
+        }
+      } else {
+        SNN_PRAGMA_UNROLL
+        for (int elem = 0; elem < A * B; ++elem) {
+          local_[offset + elem * TileBlock] = static_cast<T>(0);
+        }
+      }
+    }
+  }
+
+  /**
+   * Copy the filter transform for a block of channels and features into local
+   * memory, in the layout [ChannelBlock][A * B][FeatureBlock]. Consecutive
+   * work-items read consecutive features to keep the global loads coalesced.
+   */
+  template <typename FilterPointer>
+  void SNN_ALWAYS_INLINE load_filter_block(FilterPointer filter_data,
+                                           Index feature_block,
+                                           Index channel_start,
+                                           Index local_idx) const {
+    for (Index idx = local_idx; idx < filter_local_size; idx += local_size) {
+      auto const block_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten3d(
+              idx, ChannelBlock, ChannelBlock, FeatureBlock, FeatureBlock);
+      Index const local_feature = block_idx.s2;
+      Index const local_channel = block_idx.s1;
+      Index const elem = block_idx.s0;
+      Index const channel = channel_start + local_channel;
+      Index const feature = feature_block * FeatureBlock + local_feature;
+
+      T value = static_cast<T>(0);
+      if (channel < n_channels_ && feature < n_features_) {
+        value = filter_data[(elem * n_channels_ + channel) * n_features_ +
+                            feature];
+      }
+      local_[input_local_size +
+             (local_channel * A * B + elem) * FeatureBlock + local_feature] =
+          value;
+    }
+  }
+
+  /**
+   * Apply the output transform and epilogue to the accumulated tile, and write
+   * the values which lie inside the output tensor.
+   */
+  void SNN_ALWAYS_INLINE write_output_tile(
+      IntermediateTile<T, M, N, R, S> const& accumulator, Index tile_idx,
+      Index feature) const {
+    auto output_data = output_mem_.get_pointer();
+
+    auto const tile_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            tile_idx, n_tile_rows_, n_tile_rows_, n_tile_cols_, n_tile_cols_);
+    Index const col_idx = tile_tensor_idx.s2;
+    Index const row_idx = tile_tensor_idx.s1;
+    Index const batch = tile_tensor_idx.s0;
+
+    Index const col = col_idx * N;
+    Index const cend = helpers::min(col + N, n_out_cols_);
+
+    Index const row = row_idx * M;
+    Index const rend = helpers::min(row + M, n_out_rows_);
+
+    Index const offset =
+        ((batch * n_out_rows_ + row) * n_out_cols_ + col) * n_features_ +
+        feature;
+
+    SYCLOutputWindow<Index> out_w{rend - row, cend - col, offset};
+
+    OutputTile<T, M, N, R, S> out_tile{accumulator};
+    for (int r = 0; r < M && r < out_w.rsize; ++r) {
+      for (int c = 0; c < N && c < out_w.csize; ++c) {
+        Index const out_idx = offset + (r * n_out_cols_ + c) * n_features_;
+        out_tile.data(r, c) =
+            epilogue_.apply(out_tile.data(r, c), feature, out_idx);
+      }
+    }
+    OutputData<T, M, N, R, S>::write_output(output_data, out_w, n_out_cols_,
+                                            n_features_, out_tile);
+  }
+
+  Index const n_tiles_;
+  Index const n_tile_rows_;
+  Index const n_tile_cols_;
+  Index const n_feature_blocks_;
+  Index const n_in_rows_;
+  Index const n_in_cols_;
+  Index const n_out_rows_;
+  Index const n_out_cols_;
+  Index const n_channels_;
+  Index const n_features_;
+  Index const n_pad_rows_;
+  Index const n_pad_cols_;
+  ReadMem<T const, IsUSM> input_mem_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  LocalAccessor<T> local_;
+  WriteMem<T, IsUSM> output_mem_;
+  EpilogueOp<T, IsUSM> const epilogue_;
+};
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_WINOGRAD_KERNELS_FUSED_WINOGRAD_H_
@@ -17,6 +17,7 @@
 #define PORTDNN_SRC_CONV2D_WINOGRAD_KERNELS_TILES_H_
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/format_type.h"
 
 #include "src/helpers/register_tile.h"
 #include "src/helpers/vector_io.h"
@@ -76,6 +77,45 @@ struct InputTile final
       row_idx += n_cols * n_channels;
     }
   }
+
+  /** Read an NHWC input tile, see the untagged constructor. */
+  template <typename PtrT, MULTI_PTR_TEMPLATE_DECL, typename Index>
+  SNN_ALWAYS_INLINE InputTile(
+      layout::NHWC, cl::sycl::multi_ptr<PtrT const, MULTI_PTR_TEMPLATE> input,
+      Index const batch, Index const rstart, Index const n_rows,
+      Index const cstart, Index const n_cols, Index const channel,
+      Index const n_channels)
+      : InputTile(input, batch, rstart, n_rows, cstart, n_cols, channel,
+                  n_channels) {}
+
+  /**
+   * Read the input data from an NCHW input array. The tile covers a single
+   * channel, so each row of the tile is contiguous in memory.
+   */
+  template <typename PtrT, MULTI_PTR_TEMPLATE_DECL, typename Index>
+  SNN_ALWAYS_INLINE InputTile(
+      layout::NCHW, cl::sycl::multi_ptr<PtrT const, MULTI_PTR_TEMPLATE> input,
+      Index const batch, Index const rstart, Index const n_rows,
+      Index const cstart, Index const n_cols, Index const channel,
+      Index const n_channels)
+      : helpers::RegisterTile2D<T, A, B>{} {
+    Index const offset =
+        ((batch * n_channels + channel) * n_rows + rstart) * n_cols + cstart;
+    input += offset;
+    Index row_idx = 0;
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < A; ++r) {
+      if (r >= -rstart && r < n_rows - rstart) {
+        SNN_PRAGMA_UNROLL
+        for (int c = 0; c < B; ++c) {
+          if (c >= -cstart && c < n_cols - cstart) {
+            data(r, c) = helpers::io::Load<T>()(input, row_idx + c);
+          }
+        }
+      }
+      row_idx += n_cols;
+    }
+  }
 };
 
 template <typename T, int M, int N, int R, int S>
@@ -115,6 +155,33 @@ struct FilterTile<T, M, N, R, S, conv_type::Forward> final
       }
     }
   }
+
+  /** Read an HWCF filter, see the untagged constructor. */
+  template <typename PtrT, MULTI_PTR_TEMPLATE_DECL, typename Index>
+  SNN_ALWAYS_INLINE FilterTile(
+      layout::NHWC, cl::sycl::multi_ptr<PtrT const, MULTI_PTR_TEMPLATE> input,
+      Index const channel, Index const feature, Index const n_channels,
+      Index const n_features)
+      : FilterTile(input, channel, feature, n_channels, n_features) {}
+
+  /**
+   * Read the filter data from a filter in (Feature x Channel x Height x Width)
+   * format, as used alongside NCHW inputs.
+   */
+  template <typename PtrT, MULTI_PTR_TEMPLATE_DECL, typename Index>
+  SNN_ALWAYS_INLINE FilterTile(
+      layout::NCHW, cl::sycl::multi_ptr<PtrT const, MULTI_PTR_TEMPLATE> input,
+      Index const channel, Index const feature, Index const n_channels,
+      Index const /*n_features*/) {
+    input += (feature * n_channels + channel) * R * S;
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < R; ++r) {
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < S; ++c) {
+        data(r, c) = helpers::io::Load<T>()(input, r * S + c);
+      }
+    }
+  }
 };
 
 template <typename T, int M, int N, int R, int S>
@@ -244,6 +311,19 @@ struct IntermediateTile final
   static constexpr int A = M + R - 1;
   static constexpr int B = N + S - 1;
   using helpers::RegisterTile2D<T, A, B>::data;
+  /**
+   * Create an intermediate tile with all values set to zero, to be used to
+   * accumulate the products of transformed inputs and filters directly.
+   */
+  SNN_ALWAYS_INLINE IntermediateTile() {
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < A; ++r) {
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < B; ++c) {
+        data(r, c) = static_cast<T>(0);
+      }
+    }
+  }
   /**
    * Read the intermediate tile from a temporary buffer. The input shape is
    * expected to be
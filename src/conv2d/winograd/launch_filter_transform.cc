@@ -16,11 +16,14 @@
 #include "portdnn/internal/conv2d/winograd/launch_filter_transform.h"
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/format_type.h"
 
 #include "src/conv2d/winograd/queue_filter_transform.h"
 
 #include "portdnn/export.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -33,7 +36,17 @@ SNNStatus launch_filter_transform(MemObj<T const>& input, MemObj<T>& transform,
                                   TileInfo const& tile_info,
                                   cl::sycl::queue& queue,
                                   const std::vector<cl::sycl::event>& events) {
-  return queue_filter_transform<T, int, ConvType, M, N, R, S>(
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      return queue_filter_transform<T, int, ConvType, M, N, R, S,
+                                    layout::NCHW>(input, transform, params,
+                                                  tile_info, queue, events);
+    }
+#endif  // SNN_ENABLE_NCHW
+    return StatusCode::InvalidAlgorithm;
+  }
+  return queue_filter_transform<T, int, ConvType, M, N, R, S, layout::NHWC>(
       input, transform, params, tile_info, queue, events);
 }
 
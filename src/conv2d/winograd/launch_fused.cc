@@ -0,0 +1,84 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/internal/conv2d/winograd/launch_fused.h"
+
+#include "src/conv2d/winograd/queue_fused.h"
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+template <typename T, int M, int N, int R, int S,
+          template <typename> class MemObj>
+SNNStatus launch_fused_kernel(MemObj<T const>& input,
+                              MemObj<T const>& filter_transform,
+                              MemObj<T>& output,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
+                              TileInfo const& tile_info, cl::sycl::queue& queue,
+                              const std::vector<cl::sycl::event>& events) {
+  // Both configurations use work-groups of 128 work-items. When there are few
+  // features, using more tiles per work-group avoids leaving most of the
+  // work-items idle.
+  if (params.features >= 16) {
+    return queue_fused<T, int, M, N, R, S, 8, 16, 4>(
+        input, filter_transform, output, epilogue, params, tile_info, queue,
+        events);
+  }
+  return queue_fused<T, int, M, N, R, S, 32, 4, 4>(
+      input, filter_transform, output, epilogue, params, tile_info, queue,
+      events);
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, M, N, R, S, MEM_OBJ)                 \
+  template SNN_EXPORT SNNStatus launch_fused_kernel<DTYPE, M, N, R, S>(  \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,       \
+      MEM_OBJ<DTYPE> & output, EpilogueMem<DTYPE, MEM_OBJ> & epilogue,   \
+      Conv2DParams const& params, TileInfo const& tile_info,             \
+      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+#define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ) \
+  INSTANTIATE_LAUNCHER(DTYPE, 2, 2, 3, 3, MEM_OBJ)
+
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(float, USMMemObject)
+#endif  // SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(float, BufferMemObject)
+
+#ifdef SNN_USE_DOUBLE
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(double, USMMemObject)
+#endif  // SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(double, BufferMemObject)
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(cl::sycl::half, USMMemObject)
+#endif  // SNN_ENABLE_USM
+INSTANTIATE_FOR_TYPE(cl::sycl::half, BufferMemObject)
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
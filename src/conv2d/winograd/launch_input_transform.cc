@@ -16,11 +16,14 @@
 #include "portdnn/internal/conv2d/winograd/launch_input_transform.h"
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/format_type.h"
 
 #include "src/conv2d/winograd/queue_input_transform.h"
 
 #include "portdnn/export.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -37,6 +40,16 @@ SNNStatus launch_input_transform(MemObj<T const>& input, MemObj<T>& transform,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
                                  const std::vector<cl::sycl::event>& events) {
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      return queue_input_transform<T, int, ConvType, M, N, R, S, 1,
+                                   layout::NCHW>(input, transform, params,
+                                                 tile_info, queue, events);
+    }
+#endif  // SNN_ENABLE_NCHW
+    return StatusCode::InvalidAlgorithm;
+  }
   // The larger input tiles when M is 4 use too many registers if vectorisation
   // is used, which causes performance of the transform kernel to be around half
   // what it is without vectorisation. As we don't currently have a better way
@@ -44,13 +57,16 @@ SNNStatus launch_input_transform(MemObj<T const>& input, MemObj<T>& transform,
   // vectorisation in this case.
   // TODO(jwlawson): Provide better vector size customisation
   if (M != 4 && can_use_vector(params, 4)) {
-    return queue_input_transform<T, int, ConvType, M, N, R, S, 4>(
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 4,
+                                 layout::NHWC>(
         input, transform, params, tile_info, queue, events);
   } else if (M != 4 && can_use_vector(params, 2)) {
-    return queue_input_transform<T, int, ConvType, M, N, R, S, 2>(
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 2,
+                                 layout::NHWC>(
         input, transform, params, tile_info, queue, events);
   } else
-    return queue_input_transform<T, int, ConvType, M, N, R, S, 1>(
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 1,
+                                 layout::NHWC>(
         input, transform, params, tile_info, queue, events);
 }
 
@@ -16,11 +16,14 @@
 #include "portdnn/internal/conv2d/winograd/launch_output_transform.h"
 
 #include "portdnn/conv2d/conv_type.h"
+#include "portdnn/format_type.h"
 
 #include "src/conv2d/winograd/queue_output_transform.h"
 
 #include "portdnn/export.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -29,20 +32,35 @@ namespace winograd {
 template <typename T, typename ConvType, int M, int N, int R, int S,
           bool Accumulate, template <typename> class MemObj>
 SNNStatus launch_output_transform(MemObj<T const>& intermediate,
-                                  MemObj<T>& output, Conv2DParams const& params,
+                                  MemObj<T>& output,
+                                  EpilogueMem<T, MemObj>& epilogue,
+                                  Conv2DParams const& params,
                                   TileInfo const& tile_info,
                                   cl::sycl::queue& queue,
                                   const std::vector<cl::sycl::event>& events) {
-  return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate>(
-      intermediate, output, params, tile_info, queue, events);
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate,
+                                    layout::NCHW>(intermediate, output,
+                                                  epilogue, params, tile_info,
+                                                  queue, events);
+    }
+#endif  // SNN_ENABLE_NCHW
+    return StatusCode::InvalidAlgorithm;
+  }
+  return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate,
+                                layout::NHWC>(intermediate, output, epilogue,
+                                              params, tile_info, queue, events);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC, MEM_OBJ) \
-  template SNN_EXPORT SNNStatus                                      \
-  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(            \
-      MEM_OBJ<DTYPE const> & intermediate, MEM_OBJ<DTYPE> & output,  \
-      Conv2DParams const& params, TileInfo const& tile_info,         \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC, MEM_OBJ)      \
+  template SNN_EXPORT SNNStatus                                           \
+  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(                 \
+      MEM_OBJ<DTYPE const> & intermediate, MEM_OBJ<DTYPE> & output,       \
+      EpilogueMem<DTYPE, MEM_OBJ> & epilogue, Conv2DParams const& params, \
+      TileInfo const& tile_info, cl::sycl::queue& queue,                  \
+      const std::vector<cl::sycl::event>& events);
 
 #define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                                  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 3, 3, false, MEM_OBJ) \
@@ -20,6 +20,7 @@
 #include "portdnn/status.h"
 
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 #include "portdnn/internal/conv2d/winograd/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -30,7 +31,7 @@ namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, template <typename> class MemObj>
+          int S, typename Layout, template <typename> class MemObj>
 SNNStatus queue_filter_transform(MemObj<T const>& input,
                                  MemObj<T>& in_transform,
                                  Conv2DParams const& kernel_params,
@@ -57,14 +57,14 @@ inline cl::sycl::range<1> get_thread_range<conv_type::FilterBackprop>(
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, template <typename> class MemObj>
+          int S, typename Layout, template <typename> class MemObj>
 SNNStatus queue_filter_transform(MemObj<T const>& filter_mem,
                                  MemObj<T>& transform_mem,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
                                  const std::vector<cl::sycl::event>& events) {
-  using Functor = ExtractFilterTiles<T, Index, M, N, R, S, ConvType,
+  using Functor = ExtractFilterTiles<T, Index, M, N, R, S, ConvType, Layout,
                                      is_usm_obj_v<MemObj<T>, T>>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
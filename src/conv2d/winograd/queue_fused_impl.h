@@ -0,0 +1,80 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_CONV2D_WINOGRAD_QUEUE_FUSED_IMPL_H_
+#define PORTDNN_SRC_CONV2D_WINOGRAD_QUEUE_FUSED_IMPL_H_
+
+#include "portdnn/mem_object.h"
+
+#include "portdnn/helpers/ratio.h"
+
+#include "src/conv2d/winograd/queue_fused.h"
+
+#include "src/conv2d/winograd/kernels/fused_winograd.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+template <typename T, typename Index, int M, int N, int R, int S,
+          int TileBlock, int FeatureBlock, int ChannelBlock,
+          template <typename> class MemObj>
+SNNStatus queue_fused(MemObj<T const>& input_mem,
+                      MemObj<T const>& filter_transform_mem,
+                      MemObj<T>& output_mem, EpilogueMem<T, MemObj>& epilogue,
+                      Conv2DParams const& params, TileInfo const& tile_info,
+                      cl::sycl::queue& queue,
+                      const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = FusedWinogradConv<T, Index, M, N, R, S, TileBlock,
+                                    FeatureBlock, ChannelBlock, is_usm>;
+
+  size_t const n_tile_blocks = helpers::round_ratio_up_above_zero(
+      params.batch * tile_info.number, TileBlock);
+  size_t const n_feature_blocks =
+      helpers::round_ratio_up_above_zero(params.features, FeatureBlock);
+  size_t const local_size = Functor::local_size;
+  size_t const global_size = n_tile_blocks * n_feature_blocks * local_size;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter_transform = filter_transform_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                      epilogue.bias.read_mem(cgh),
+                                      epilogue.residual.read_mem(cgh)};
+
+    LocalAccessor<T> local_access{
+        cl::sycl::range<1>{static_cast<size_t>(Functor::local_mem_size)}, cgh};
+
+    Functor conv{params,       tile_info, input,      filter_transform,
+                 local_access, output,    epilogue_op};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{cl::sycl::range<1>{global_size},
+                              cl::sycl::range<1>{local_size}},
+        conv);
+  });
+  return SNNStatus{event, StatusCode::OK};
+}
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_CONV2D_WINOGRAD_QUEUE_FUSED_IMPL_H_
@@ -21,6 +21,7 @@
 
 #include "portdnn/conv2d/conv_type.h"
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
 
 #include "portdnn/internal/conv2d/winograd/tile_info.h"
 
@@ -30,7 +31,8 @@ namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, int ChannelVector, template <typename> class MemObj>
+          int S, int ChannelVector, typename Layout,
+          template <typename> class MemObj>
 SNNStatus queue_input_transform(MemObj<T const>& input, MemObj<T>& in_transform,
                                 Conv2DParams const& params,
                                 TileInfo const& tile_info,
@@ -47,15 +47,17 @@ inline cl::sycl::range<1> get_thread_range(Conv2DParams const& params,
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, int ChannelVector, template <typename> class MemObj>
+          int S, int ChannelVector, typename Layout,
+          template <typename> class MemObj>
 SNNStatus queue_input_transform(MemObj<T const>& input_mem,
                                 MemObj<T>& transform_mem,
                                 Conv2DParams const& params,
                                 TileInfo const& tile_info,
                                 cl::sycl::queue& queue,
                                 const std::vector<cl::sycl::event>& events) {
-  using Functor = ExtractInputTiles<T, Index, ChannelVector, M, N, R, S,
-                                    ConvType, is_usm_obj_v<MemObj<T>, T>>;
+  using Functor =
+      ExtractInputTiles<T, Index, ChannelVector, M, N, R, S, ConvType, Layout,
+                        is_usm_obj_v<MemObj<T>, T>>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
@@ -20,6 +20,8 @@
 #include "portdnn/status.h"
 
 #include "portdnn/conv2d/params.h"
+#include "portdnn/format_type.h"
+#include "portdnn/internal/conv2d/epilogue.h"
 #include "portdnn/internal/conv2d/winograd/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -30,9 +32,11 @@ namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, bool Accumulate, template <typename> class MemObj>
+          int S, bool Accumulate, typename Layout,
+          template <typename> class MemObj>
 SNNStatus queue_output_transform(MemObj<T const>& intermediate,
                                  MemObj<T>& output,
+                                 EpilogueMem<T, MemObj>& epilogue,
                                  Conv2DParams const& kernel_params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
@@ -59,24 +59,36 @@ inline cl::sycl::range<1> get_thread_range<conv_type::FilterBackprop>(
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, bool Accumulate, template <typename> class MemObj>
+          int S, bool Accumulate, typename Layout,
+          template <typename> class MemObj>
 SNNStatus queue_output_transform(MemObj<T const>& intermediate_mem,
                                  MemObj<T>& output_mem,
+                                 EpilogueMem<T, MemObj>& epilogue,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
                                  const std::vector<cl::sycl::event>& events) {
-  using Functor = ExtractOutputTiles<T, Index, M, N, R, S, ConvType, Accumulate,
-                                     is_usm_obj_v<MemObj<T>, T>>;
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = ExtractOutputTiles<T, Index, M, N, R, S, ConvType,
+                                     Accumulate, Layout, is_usm>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
     auto intermediate = intermediate_mem.read_mem(cgh);
     auto output = output_mem.write_mem(cgh);
     auto range = get_thread_range<ConvType>(params, tile_info);
-    Functor conv{params, tile_info, intermediate, output};
+    if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+      Functor conv{params, tile_info, intermediate, output};
 
-    cgh.parallel_for(range, conv);
+      cgh.parallel_for(range, conv);
+    } else {
+      EpilogueOp<T, is_usm> epilogue_op{epilogue.params,
+                                        epilogue.bias.read_mem(cgh),
+                                        epilogue.residual.read_mem(cgh)};
+      Functor conv{params, tile_info, intermediate, output, epilogue_op};
+
+      cgh.parallel_for(range, conv);
+    }
   });
   return SNNStatus{event, StatusCode::OK};
 }
@@ -27,6 +27,7 @@
 #include <stddef.h>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include <CL/sycl.hpp>
 
@@ -75,6 +76,69 @@ struct Launcher<conv2d::conv_type::FilterBackprop, T, Index, VectorWidth,
   }
 };
 
+template <typename ConvType>
+bool can_use_tiled(DepthwiseConv2DParams const& p) {
+  return std::is_same<ConvType, conv2d::conv_type::Forward>::value &&
+         (p.window_cols == 3 || p.window_cols == 5) &&
+         (p.stride_cols == 1 || p.stride_cols == 2);
+}
+
+template <int ChannelVectorWidth, int MultiplierVectorWidth, typename T,
+          typename IndexType, template <typename> class MemObj>
+SNNStatus launch_tiled_with_vectors(
+    MemObj<T const>& input, MemObj<T const>& filter, MemObj<T>& output,
+    DepthwiseConv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_cols == 3) {
+    if (params.stride_cols == 1) {
+      return queue_tiled_kernel<ChannelVectorWidth, MultiplierVectorWidth, 3,
+                                1, T, IndexType>(input, filter, output, params,
+                                                 queue, events);
+    }
+    return queue_tiled_kernel<ChannelVectorWidth, MultiplierVectorWidth, 3, 2,
+                              T, IndexType>(input, filter, output, params,
+                                            queue, events);
+  }
+  if (params.stride_cols == 1) {
+    return queue_tiled_kernel<ChannelVectorWidth, MultiplierVectorWidth, 5, 1,
+                              T, IndexType>(input, filter, output, params,
+                                            queue, events);
+  }
+  return queue_tiled_kernel<ChannelVectorWidth, MultiplierVectorWidth, 5, 2, T,
+                            IndexType>(input, filter, output, params, queue,
+                                       events);
+}
+
+/**
+ * The tiled kernel vectorises in the channels when each channel has a single
+ * output feature, otherwise it vectorises in the channel multiplier.
+ */
+template <typename T, typename IndexType, template <typename> class MemObj>
+SNNStatus launch_tiled(MemObj<T const>& input, MemObj<T const>& filter,
+                       MemObj<T>& output, DepthwiseConv2DParams const& params,
+                       cl::sycl::queue& queue,
+                       const std::vector<cl::sycl::event>& events) {
+  if (params.channel_multiplier == 1) {
+    if (params.channels % 4 == 0) {
+      return launch_tiled_with_vectors<4, 1, T, IndexType>(
+          input, filter, output, params, queue, events);
+    } else if (params.channels % 2 == 0) {
+      return launch_tiled_with_vectors<2, 1, T, IndexType>(
+          input, filter, output, params, queue, events);
+    }
+  } else {
+    if (params.channel_multiplier % 4 == 0) {
+      return launch_tiled_with_vectors<1, 4, T, IndexType>(
+          input, filter, output, params, queue, events);
+    } else if (params.channel_multiplier % 2 == 0) {
+      return launch_tiled_with_vectors<1, 2, T, IndexType>(
+          input, filter, output, params, queue, events);
+    }
+  }
+  return launch_tiled_with_vectors<1, 1, T, IndexType>(input, filter, output,
+                                                       params, queue, events);
+}
+
 template <typename ConvType, typename T, typename IndexType,
           template <typename> class MemObj,
           typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
@@ -83,6 +147,14 @@ SNNStatus launch_vectorised(MemObj<T const>& input, MemObj<T const>& filter,
                             DepthwiseConv2DParams const& params,
                             IndexType output_size, cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
+  if (can_use_tiled<ConvType>(params)) {
+    return launch_tiled<T, IndexType>(input, filter, output, params, queue,
+                                      events);
+  }
+  // Only the tiled kernel supports dilation.
+  if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+    return StatusCode::InvalidAlgorithm;
+  }
   if (can_vectorize<ConvType>(params, 4)) {
     return Launcher<ConvType, T, IndexType, 4, MemObj>::launch(
         input, filter, output, params, output_size, queue, events);
@@ -0,0 +1,120 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "portdnn/mem_object.h"
+#include "portdnn/status.h"
+
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "portdnn/internal/depthwise_conv2d/launch_separable.h"
+
+#include "src/depthwise_conv2d/queue_depthwise_conv2d.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <CL/sycl.hpp>
+
+#include "portdnn/export.h"
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+namespace {
+
+template <typename T, typename IndexType, template <typename> class MemObj>
+SNNStatus launch_separable_vectorised(
+    MemObj<T const>& input, MemObj<T const>& depthwise_filter,
+    MemObj<T const>& pointwise_filter, MemObj<T>& output,
+    SeparableConv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.features % 4 == 0) {
+    return queue_separable_kernel<4, T, IndexType>(
+        input, depthwise_filter, pointwise_filter, output, params, queue,
+        events);
+  } else if (params.features % 2 == 0) {
+    return queue_separable_kernel<2, T, IndexType>(
+        input, depthwise_filter, pointwise_filter, output, params, queue,
+        events);
+  } else {
+    return queue_separable_kernel<1, T, IndexType>(
+        input, depthwise_filter, pointwise_filter, output, params, queue,
+        events);
+  }
+}
+
+}  // namespace
+
+template <typename T, template <typename> class MemObj, typename>
+SNNStatus launch_separable(MemObj<T const>& input,
+                           MemObj<T const>& depthwise_filter,
+                           MemObj<T const>& pointwise_filter,
+                           MemObj<T>& output,
+                           SeparableConv2DParams const& params,
+                           cl::sycl::queue& queue,
+                           const std::vector<cl::sycl::event>& events) {
+  auto const sizes = get_separable_sizes(params);
+  size_t const max_size =
+      std::max({sizes.input_size, sizes.depthwise_filter_size,
+                sizes.pointwise_filter_size, sizes.output_size});
+  if (max_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return launch_separable_vectorised<T, int64_t>(
+        input, depthwise_filter, pointwise_filter, output, params, queue,
+        events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_separable_vectorised<T, int32_t>(
+        input, depthwise_filter, pointwise_filter, output, params, queue,
+        events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, MEM_OBJ)                                 \
+  template SNN_EXPORT SNNStatus launch_separable<DTYPE, MEM_OBJ>(            \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & depthwise_filter, \
+      MEM_OBJ<DTYPE const> & pointwise_filter, MEM_OBJ<DTYPE> & output,      \
+      SeparableConv2DParams const& params, cl::sycl::queue& queue,           \
+      const std::vector<cl::sycl::event>& events)
+
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_LAUNCHER(float, USMMemObject);
+#endif
+INSTANTIATE_LAUNCHER(float, BufferMemObject);
+
+#ifdef SNN_USE_DOUBLE
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_LAUNCHER(double, USMMemObject);
+#endif
+INSTANTIATE_LAUNCHER(double, BufferMemObject);
+#endif
+
+#ifdef SNN_USE_HALF
+#ifdef SNN_ENABLE_USM
+INSTANTIATE_LAUNCHER(cl::sycl::half, USMMemObject);
+#endif
+INSTANTIATE_LAUNCHER(cl::sycl::half, BufferMemObject);
+#endif
+
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
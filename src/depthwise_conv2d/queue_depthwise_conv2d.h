@@ -20,6 +20,7 @@
 #include "portdnn/status.h"
 
 #include "portdnn/depthwise_conv2d/params.h"
+#include "portdnn/depthwise_conv2d/separable_params.h"
 
 #include <CL/sycl.hpp>
 
@@ -43,6 +44,25 @@ SNNStatus queue_kernel_fil_bk(MemObj<T const>& input, MemObj<T const>& filter,
                               Index output_size, cl::sycl::queue& queue,
                               const std::vector<cl::sycl::event>& events);
 
+template <int ChannelVectorWidth, int MultiplierVectorWidth, int WindowCols,
+          int Stride, typename T, typename Index,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_kernel(MemObj<T const>& input, MemObj<T const>& filter,
+                             MemObj<T>& output,
+                             DepthwiseConv2DParams const& kernel_params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events);
+
+template <int VectorWidth, typename T, typename Index,
+          template <typename> class MemObj>
+SNNStatus queue_separable_kernel(MemObj<T const>& input,
+                                 MemObj<T const>& depthwise_filter,
+                                 MemObj<T const>& pointwise_filter,
+                                 MemObj<T>& output,
+                                 SeparableConv2DParams const& params,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events);
+
 }  // namespace internal
 }  // namespace depthwise_conv2d
 }  // namespace sycldnn
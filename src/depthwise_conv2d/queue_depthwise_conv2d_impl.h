@@ -23,8 +23,11 @@
 #include "portdnn/helpers/minmax.h"
 #include "portdnn/helpers/ratio.h"
 
+#include "src/conv2d/tiled/tile_info.h"
 #include "src/depthwise_conv2d/kernels.h"
 #include "src/depthwise_conv2d/queue_depthwise_conv2d.h"
+#include "src/depthwise_conv2d/separable_kernels.h"
+#include "src/depthwise_conv2d/tiled_kernels.h"
 
 #include <CL/sycl.hpp>
 
@@ -124,6 +127,101 @@ SNNStatus queue_kernel_fil_bk(MemObj<T const>& input_mem,
   return {event, StatusCode::OK};
 }
 
+template <int ChannelVectorWidth, int MultiplierVectorWidth, int WindowCols,
+          int Stride, typename T, typename Index,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_kernel(MemObj<T const>& input_mem,
+                             MemObj<T const>& filter_mem, MemObj<T>& output_mem,
+                             DepthwiseConv2DParams const& kernel_params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events) {
+  // Wider strips reuse more of the input window, but strided convolutions
+  // need more input registers for each output column.
+  constexpr int OutTileCols = Stride == 1 ? 4 : 2;
+  using Functor =
+      DepthwiseConv2DTiled<T, Index, ChannelVectorWidth, MultiplierVectorWidth,
+                           OutTileCols, WindowCols, Stride,
+                           is_usm_obj_v<MemObj<T>, T>>;
+  constexpr int FeatureVectorWidth = ChannelVectorWidth * MultiplierVectorWidth;
+
+  Index const n_tile_cols = conv2d::internal::tiled::get_dilated_tile_count(
+      kernel_params.out_cols, OutTileCols, kernel_params.dilation_cols);
+  Index const n_feature_vectors = kernel_params.channels *
+                                  kernel_params.channel_multiplier /
+                                  FeatureVectorWidth;
+  size_t const n_items = static_cast<size_t>(kernel_params.batch) *
+                         kernel_params.out_rows * n_tile_cols *
+                         n_feature_vectors;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const n_threads =
+      helpers::round_up_to_nearest_multiple(n_items, workgroup_size);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+    Functor conv(n_tile_cols, kernel_params, input, filter, output);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <int VectorWidth, typename T, typename Index,
+          template <typename> class MemObj>
+SNNStatus queue_separable_kernel(MemObj<T const>& input_mem,
+                                 MemObj<T const>& depthwise_filter_mem,
+                                 MemObj<T const>& pointwise_filter_mem,
+                                 MemObj<T>& output_mem,
+                                 SeparableConv2DParams const& params,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events) {
+  constexpr int TilePixels = 8;
+  constexpr int FeatureItems = 16;
+  using Functor = SeparableConv2D<T, Index, VectorWidth, TilePixels,
+                                  FeatureItems, is_usm_obj_v<MemObj<T>, T>>;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_wg_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  if (max_wg_size < static_cast<size_t>(Functor::local_size)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  auto const& dw = params.depthwise;
+  size_t const n_pixels =
+      static_cast<size_t>(dw.batch) * dw.out_rows * dw.out_cols;
+  size_t const n_pixel_blocks =
+      helpers::round_ratio_up_above_zero(n_pixels, TilePixels);
+  size_t const n_feature_blocks = helpers::round_ratio_up_above_zero(
+      static_cast<size_t>(params.features / VectorWidth), FeatureItems);
+  size_t const local_size = Functor::local_size;
+  size_t const n_threads = n_pixel_blocks * n_feature_blocks * local_size;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto depthwise_filter = depthwise_filter_mem.read_mem(cgh);
+    auto pointwise_filter = pointwise_filter_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+
+    LocalAccessor<T> local_mem{
+        cl::sycl::range<1>{static_cast<size_t>(Functor::local_mem_size)}, cgh};
+
+    Functor conv(params, input, depthwise_filter, pointwise_filter, local_mem,
+                 output);
+
+    cgh.parallel_for(cl::sycl::nd_range<1>{cl::sycl::range<1>{n_threads},
+                                           cl::sycl::range<1>{local_size}},
+                     conv);
+  });
+  return {event, StatusCode::OK};
+}
+
 }  // namespace internal
 }  // namespace depthwise_conv2d
 }  // namespace sycldnn
@@ -0,0 +1,209 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_DEPTHWISE_CONV2D_SEPARABLE_KERNELS_H_
+#define PORTDNN_SRC_DEPTHWISE_CONV2D_SEPARABLE_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+#include "portdnn/helpers/macros.h"
+#include "portdnn/helpers/minmax.h"
+
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+#include "src/helpers/window_index.h"
+
+#include "src/conv2d/epilogue/epilogue_op.h"
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/**
+ * Depthwise convolution fused with a 1x1 pointwise convolution.
+ *
+ * Each work-group computes TilePixels output pixels for FeatureItems vectors
+ * of pointwise features, with one work-item per pixel and feature vector. The
+ * depthwise features are processed in blocks of FeatureItems: each work-item
+ * computes one depthwise value for its pixel and stores it in local memory,
+ * then every work-item accumulates the products of its pixel's depthwise
+ * values with the pointwise filter. The intermediate tensor is therefore
+ * never written to global memory.
+ *
+ * Work-groups covering different blocks of pointwise features recompute the
+ * same depthwise values, which is cheap compared to the pointwise products.
+ */
+template <typename T, typename Index, int VectorWidth, int TilePixels,
+          int FeatureItems, bool IsUSM>
+struct SeparableConv2D {
+  /** Number of work-items in each work-group. */
+  static constexpr int local_size = TilePixels * FeatureItems;
+  /** Number of depthwise values stored in local memory. */
+  static constexpr int local_mem_size = TilePixels * FeatureItems;
+
+ private:
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+  using Load = typename helpers::io::Load<DataType>;
+  using Store = typename helpers::io::Store<DataType>;
+
+ public:
+  SeparableConv2D(SeparableConv2DParams const& params,
+                  ReadMem<T const, IsUSM> const& input,
+                  ReadMem<T const, IsUSM> const& depthwise_filter,
+                  ReadMem<T const, IsUSM> const& pointwise_filter,
+                  LocalAccessor<T> const& local,
+                  WriteMem<T, IsUSM> const& output)
+      : n_pixels_{params.depthwise.batch * params.depthwise.out_rows *
+                  params.depthwise.out_cols},
+        n_feature_blocks_{(params.features / VectorWidth + FeatureItems - 1) /
+                          FeatureItems},
+        dw_features_{params.depthwise.channels *
+                     params.depthwise.channel_multiplier},
+        features_{params.features},
+        p_{params.depthwise},
+        depthwise_activation_{params.depthwise_activation},
+        pointwise_activation_{params.pointwise_activation},
+        input_mem_{input},
+        dw_filter_mem_{depthwise_filter},
+        pw_filter_mem_{pointwise_filter},
+        local_{local},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const local_idx = item.get_local_id(0);
+    Index const group_idx = item.get_group(0);
+
+    auto const group_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten2d(
+            group_idx, n_feature_blocks_, n_feature_blocks_);
+    Index const feature_block = group_tensor_idx.s1;
+    Index const pixel_block = group_tensor_idx.s0;
+
+    auto const local_tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten2d(
+            local_idx, FeatureItems, FeatureItems);
+    Index const local_feature = local_tensor_idx.s1;
+    Index const local_pixel = local_tensor_idx.s0;
+
+    Index const pixel = pixel_block * TilePixels + local_pixel;
+    Index const feature =
+        (feature_block * FeatureItems + local_feature) * VectorWidth;
+    bool const valid_pixel = pixel < n_pixels_;
+
+    auto pw_filter_data = pw_filter_mem_.get_pointer();
+
+    DataType out_val{0};
+    for (Index dw_block = 0; dw_block < dw_features_;
+         dw_block += FeatureItems) {
+      Index const dw_feature = dw_block + local_feature;
+      local_[local_idx] = valid_pixel && dw_feature < dw_features_
+                              ? depthwise(pixel, dw_feature)
+                              : T{0};
+      item.barrier(cl::sycl::access::fence_space::local_space);
+
+      if (valid_pixel && feature < features_) {
+        Index const block_size = helpers::min(
+            static_cast<Index>(FeatureItems), dw_features_ - dw_block);
+        Index const local_offset = local_pixel * FeatureItems;
+        Index filter_offset = dw_block * features_ + feature;
+        for (Index k = 0; k < block_size; ++k) {
+          DataType fil_val = Load()(pw_filter_data, filter_offset);
+          out_val = helpers::math::mad(DataType{local_[local_offset + k]},
+                                       fil_val, out_val);
+          filter_offset += features_;
+        }
+      }
+      // All work-items must finish reading the local memory before the next
+      // block of depthwise values overwrites it.
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (valid_pixel && feature < features_) {
+      auto output_data = output_mem_.get_pointer();
+      Store()(output_data, pixel * features_ + feature,
+              conv2d::internal::apply_activation(out_val,
+                                                 pointwise_activation_));
+    }
+  }
+
+ private:
+  /** Compute a single depthwise output value, with its activation applied. */
+  T SNN_ALWAYS_INLINE depthwise(Index pixel, Index dw_feature) const {
+    auto input_data = input_mem_.get_pointer();
+    auto dw_filter_data = dw_filter_mem_.get_pointer();
+
+    auto const tensor_idx =
+        helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            pixel, p_.out_rows, p_.out_rows, p_.out_cols, p_.out_cols);
+    Index const col_idx = tensor_idx.s2;
+    Index const row_idx = tensor_idx.s1;
+    Index const batch_idx = tensor_idx.s0;
+    Index const channel = dw_feature / p_.channel_multiplier;
+
+    Index const rstart =
+        helpers::in_window_from_output(row_idx, p_.stride_rows, p_.pad_rows)
+            .window_start;
+    Index const cstart =
+        helpers::in_window_from_output(col_idx, p_.stride_cols, p_.pad_cols)
+            .window_start;
+
+    T value{0};
+    Index input_row_offset =
+        (batch_idx * p_.in_rows + rstart) * p_.in_cols * p_.channels + channel;
+    Index filter_row_offset = dw_feature;
+    for (Index row = rstart, i = 0; i < p_.window_rows;
+         row += p_.dilation_rows, ++i) {
+      if (row >= 0 && row < p_.in_rows) {
+        Index input_offset = input_row_offset + cstart * p_.channels;
+        Index filter_offset = filter_row_offset;
+        for (Index col = cstart, j = 0; j < p_.window_cols;
+             col += p_.dilation_cols, ++j) {
+          if (col >= 0 && col < p_.in_cols) {
+            T in_val = helpers::io::Load<T>()(input_data, input_offset);
+            T fil_val = helpers::io::Load<T>()(dw_filter_data, filter_offset);
+            value = helpers::math::mad(in_val, fil_val, value);
+          }
+          input_offset += p_.dilation_cols * p_.channels;
+          filter_offset += dw_features_;
+        }
+      }
+      input_row_offset += p_.dilation_rows * p_.in_cols * p_.channels;
+      filter_row_offset += p_.window_cols * dw_features_;
+    }
+    return conv2d::internal::apply_activation(value, depthwise_activation_);
+  }
+
+  Index const n_pixels_;
+  Index const n_feature_blocks_;
+  Index const dw_features_;
+  Index const features_;
+  DepthwiseConv2DParams const p_;
+  conv2d::Activation const depthwise_activation_;
+  conv2d::Activation const pointwise_activation_;
+  ReadMem<T const, IsUSM> const input_mem_;
+  ReadMem<T const, IsUSM> const dw_filter_mem_;
+  ReadMem<T const, IsUSM> const pw_filter_mem_;
+  LocalAccessor<T> local_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_DEPTHWISE_CONV2D_SEPARABLE_KERNELS_H_
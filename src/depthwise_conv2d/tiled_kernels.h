@@ -0,0 +1,194 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_DEPTHWISE_CONV2D_TILED_KERNELS_H_
+#define PORTDNN_SRC_DEPTHWISE_CONV2D_TILED_KERNELS_H_
+
+#include "portdnn/accessor_types.h"
+#include "portdnn/helpers/macros.h"
+
+#include "portdnn/depthwise_conv2d/params.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/register_tile.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+#include "src/helpers/window_index.h"
+
+#include "src/conv2d/tiled/tile_info.h"
+#include "src/conv2d/tiled/tiles.h"
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/**
+ * Forward depthwise convolution where each work item computes a strip of
+ * OutTileCols output columns in a single output row.
+ *
+ * The input columns needed by the strip are loaded once per window row into
+ * registers and shared between the overlapping windows of the strip. Each work
+ * item computes a vector of consecutive output features, which is either a
+ * vector of channels when the channel multiplier is 1, or a vector of
+ * multiples of a single channel, in which case the input value is broadcast
+ * across the vector.
+ *
+ * Dilated convolutions are supported by having each strip cover every
+ * dilation-th output column, so that the input columns required by the strip
+ * are also spaced by the dilation.
+ */
+template <typename T, typename Index, int ChannelVectorWidth,
+          int MultiplierVectorWidth, int OutTileCols, int WindowCols,
+          int Stride, bool IsUSM>
+struct DepthwiseConv2DTiled {
+  static_assert(ChannelVectorWidth == 1 || MultiplierVectorWidth == 1,
+                "Can only vectorise in either the channels or the channel "
+                "multiplier.");
+
+ private:
+  static constexpr int FeatureVectorWidth =
+      ChannelVectorWidth * MultiplierVectorWidth;
+  static constexpr int InputTileCols = (OutTileCols - 1) * Stride + WindowCols;
+  using Input =
+      conv2d::internal::tiled::InputRow<T, ChannelVectorWidth, InputTileCols>;
+  using InVecType = typename Input::VecType;
+  using OutVecType = typename helpers::VectorType<T, FeatureVectorWidth>::type;
+  using FilterRow = helpers::RegisterTile1D<OutVecType, WindowCols>;
+  using Output = helpers::RegisterTile1D<OutVecType, OutTileCols>;
+  using Load = typename helpers::io::Load<OutVecType>;
+  using Store = typename helpers::io::Store<OutVecType>;
+
+ public:
+  DepthwiseConv2DTiled(Index n_tile_cols, DepthwiseConv2DParams const& params,
+                       ReadMem<T const, IsUSM> const& input,
+                       ReadMem<T const, IsUSM> const& filter,
+                       WriteMem<T, IsUSM> const& output)
+      : n_tile_cols_{n_tile_cols},
+        n_feature_vectors_{params.channels * params.channel_multiplier /
+                           FeatureVectorWidth},
+        n_elems_{params.batch * params.out_rows * n_tile_cols_ *
+                 n_feature_vectors_},
+        features_{params.channels * params.channel_multiplier},
+        p_{params},
+        input_mem_{input},
+        filter_mem_{filter},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+
+    if (index < n_elems_) {
+      auto const input_data = input_mem_.get_pointer();
+      auto const filter_data = filter_mem_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten4d(
+              index, p_.out_rows, p_.out_rows, n_tile_cols_, n_tile_cols_,
+              n_feature_vectors_, n_feature_vectors_);
+      Index const feature = tensor_idx.s3 * FeatureVectorWidth;
+      Index const col_idx = conv2d::internal::tiled::get_tile_start(
+          tensor_idx.s2, OutTileCols, static_cast<Index>(p_.dilation_cols));
+      Index const row_idx = tensor_idx.s1;
+      Index const batch_idx = tensor_idx.s0;
+      Index const channel = feature / p_.channel_multiplier;
+
+      auto const col_window_struct =
+          helpers::in_window_from_output(col_idx, Stride, p_.pad_cols);
+      Index const cstart = col_window_struct.window_start;
+
+      auto const row_window_struct =
+          helpers::in_window_from_output(row_idx, p_.stride_rows, p_.pad_rows);
+      Index const rstart = row_window_struct.window_start;
+
+      Output out_tile{};
+
+      Index input_row_offset =
+          (batch_idx * p_.in_rows + rstart) * p_.in_cols * p_.channels +
+          channel;
+      Index filter_row_offset = feature;
+      for (Index row = rstart, i = 0; i < p_.window_rows;
+           row += p_.dilation_rows, ++i) {
+        if (row >= 0 && row < p_.in_rows) {
+          auto const input_tile = Input::load_input_row(
+              input_data, input_row_offset, cstart, p_.in_cols, p_.channels,
+              p_.dilation_cols);
+          FilterRow filter_tile;
+          Index filter_offset = filter_row_offset;
+          SNN_PRAGMA_UNROLL
+          for (int j = 0; j < WindowCols; ++j) {
+            filter_tile.data(j) = Load()(filter_data, filter_offset);
+            filter_offset += features_;
+          }
+          convolve_row(input_tile, filter_tile, out_tile);
+        }
+        input_row_offset += p_.dilation_rows * p_.in_cols * p_.channels;
+        filter_row_offset += WindowCols * features_;
+      }
+
+      auto output_data = output_mem_.get_pointer();
+      Index out_offset =
+          ((batch_idx * p_.out_rows + row_idx) * p_.out_cols + col_idx) *
+              features_ +
+          feature;
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < OutTileCols; ++i) {
+        if (col_idx + i * p_.dilation_cols < p_.out_cols) {
+          Store()(output_data, out_offset, out_tile.data(i));
+        }
+        out_offset += p_.dilation_cols * features_;
+      }
+    }
+  }
+
+ private:
+  void SNN_ALWAYS_INLINE convolve_row(Input const& input,
+                                      FilterRow const& filter,
+                                      Output& output) const {
+    SNN_PRAGMA_UNROLL
+    for (int out_col = 0; out_col < OutTileCols; ++out_col) {
+      SNN_PRAGMA_UNROLL
+      for (int filter_col = 0; filter_col < WindowCols; ++filter_col) {
+        output.data(out_col) = helpers::math::mad(
+            broadcast(input.data(out_col * Stride + filter_col)),
+            filter.data(filter_col), output.data(out_col));
+      }
+    }
+  }
+
+  /**
+   * Expand an input vector to the output vector width. When vectorising in
+   * the channel multiplier the input is a single value, which is shared by
+   * each multiple of the channel.
+   */
+  static OutVecType SNN_ALWAYS_INLINE broadcast(InVecType const& value) {
+    return OutVecType{value};
+  }
+
+  Index const n_tile_cols_;
+  Index const n_feature_vectors_;
+  Index const n_elems_;
+  Index const features_;
+  DepthwiseConv2DParams const p_;
+  ReadMem<T const, IsUSM> const input_mem_;
+  ReadMem<T const, IsUSM> const filter_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // PORTDNN_SRC_DEPTHWISE_CONV2D_TILED_KERNELS_H_
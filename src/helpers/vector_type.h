@@ -16,6 +16,8 @@
 #ifndef PORTDNN_SRC_HELPERS_VECTOR_TYPE_H_
 #define PORTDNN_SRC_HELPERS_VECTOR_TYPE_H_
 
+#include "portdnn/helpers/macros.h"
+
 #include <CL/sycl.hpp>
 
 namespace sycldnn {
@@ -30,6 +32,18 @@ template <typename T>
 struct VectorType<T, 1> {
   using type = T;
 };
+
+/** Convert a scalar value to the data type To. */
+template <typename To, typename From>
+inline SNN_ALWAYS_INLINE To convert_vector(From const& val) {
+  return static_cast<To>(val);
+}
+/** Convert each element of a SYCL vector to the data type To. */
+template <typename To, typename From, int Width>
+inline SNN_ALWAYS_INLINE cl::sycl::vec<To, Width> convert_vector(
+    cl::sycl::vec<From, Width> const& val) {
+  return val.template convert<To>();
+}
 }  // namespace helpers
 }  // namespace sycldnn
 #endif  // PORTDNN_SRC_HELPERS_VECTOR_TYPE_H_
@@ -146,6 +146,16 @@ load(cl::sycl::multi_ptr<T const, MULTI_PTR_TEMPLATE> input, Index ld) {
   return output;
 }
 
+template <typename To, typename T, int Rows, int Cols>
+static VectorBlock<To, Rows, Cols> SNN_ALWAYS_INLINE
+convert_block(VectorBlock<T, Rows, Cols> const& input) {
+  VectorBlock<To, Rows, Cols> output;
+  for (int row = 0; row < Rows; ++row) {
+    output.data(row) = helpers::convert_vector<To>(input.data(row));
+  }
+  return output;
+}
+
 template <typename T, int Rows, int Cols>
 static void SNN_ALWAYS_INLINE scalar_multiply(VectorBlock<T, Rows, Cols>& block,
                                               T val) {
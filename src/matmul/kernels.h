@@ -21,34 +21,79 @@
 
 #include "src/matmul/blocks.h"
 
+#include <array>
+#include <type_traits>
+
 namespace sycldnn {
 namespace matmul {
+/**
+ * Output operation which leaves the computed values unchanged.
+ *
+ * An output operation is applied to each row of a computed output block
+ * before it is stored, as op.apply(value, col, out_idx), where value holds
+ * consecutive columns of the output starting at column col, and out_idx is
+ * the index of its first element in the output tensor.
+ */
+struct IdentityOutputOp {
+  /** Return the value unchanged. */
+  template <typename DataType, typename Index>
+  DataType SNN_ALWAYS_INLINE apply(DataType value, Index /*col*/,
+                                   Index /*out_idx*/) const {
+    return value;
+  }
+};
+
+/**
+ * Matrix multiply kernel, computing a RowTile x ColTile block of the output in
+ * each work-item.
+ *
+ * The tensors are stored as T, while the products are accumulated in
+ * registers as ComputeT. The values are converted when they are loaded and
+ * stored, so a half precision matmul can keep float accumulators.
+ *
+ * The OutputOp is applied to the output block in registers just before it is
+ * stored, which lets callers fuse elementwise operations such as a bias and
+ * activation into the matrix multiply. A non-identity OutputOp requires
+ * ComputeT to match T.
+ */
 template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
-          int RowTile, int AccTile, int ColTile, bool CheckBounds, bool IsUSM>
+          int RowTile, int AccTile, int ColTile, bool CheckBounds, bool IsUSM,
+          typename ComputeT = T, typename OutputOp = IdentityOutputOp>
 struct MatmulKernel {
+  static_assert(std::is_same<OutputOp, IdentityOutputOp>::value ||
+                    std::is_same<ComputeT, T>::value,
+                "Output operations require ComputeT to match T.");
+
   MatmulKernel(ReadMem<T const, IsUSM> const& lhs,
                ReadMem<T const, IsUSM> const& rhs,
-               ReadWriteMem<T, IsUSM> const& output, MatmulParams const& params)
-      : lhs_{lhs}, rhs_{rhs}, output_{output}, params_{params} {}
+               ReadWriteMem<T, IsUSM> const& output, MatmulParams const& params,
+               OutputOp const& output_op = OutputOp{})
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        params_{params},
+        output_op_{output_op} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
     Index batch = item.get_global_id(0);
     Index row = item.get_global_id(1) * RowTile;
     Index col = item.get_global_id(2) * ColTile;
 
-    if (row < params_.m && col < params_.n) {
-      auto lhs_ptr = lhs_.get_pointer() + batch * params_.m * params_.k;
-      auto rhs_ptr = rhs_.get_pointer() + batch * params_.k * params_.n;
-      auto out_ptr = output_.get_pointer() + batch * params_.m * params_.n;
-
-      auto const lhs_ld = TransposeLHS ? params_.m : params_.k;
-      auto const lhs_step = (TransposeLHS ? params_.m : 1) * AccTile;
-      auto const rhs_ld = TransposeRHS ? params_.k : params_.n;
-      auto const rhs_step = (TransposeRHS ? 1 : params_.n) * AccTile;
-      auto const out_ld = params_.n;
+    // The batch range is rounded up to the work-group size, so may contain
+    // more work-items than there are matrices.
+    if (batch < params_.batches && row < params_.m && col < params_.n) {
+      auto lhs_ptr = lhs_.get_pointer() + batch * params_.lhs_batch_stride;
+      auto rhs_ptr = rhs_.get_pointer() + batch * params_.rhs_batch_stride;
+      auto out_ptr = output_.get_pointer() + batch * params_.out_batch_stride;
 
-      lhs_ptr += (TransposeLHS ? row : params_.k * row);
-      rhs_ptr += (TransposeRHS ? col * params_.k : col);
+      auto const lhs_ld = params_.lda;
+      auto const lhs_step = (TransposeLHS ? lhs_ld : 1) * AccTile;
+      auto const rhs_ld = params_.ldb;
+      auto const rhs_step = (TransposeRHS ? 1 : rhs_ld) * AccTile;
+      auto const out_ld = params_.ldc;
+
+      lhs_ptr += (TransposeLHS ? row : lhs_ld * row);
+      rhs_ptr += (TransposeRHS ? col * rhs_ld : col);
       out_ptr += out_ld * row + col;
 
       std::array<bool, RowTile> valid_row;
@@ -65,7 +110,7 @@ struct MatmulKernel {
       bool const internal_row_block = valid_row[RowTile - 1];
       bool const internal_col_block = valid_col[ColTile - 1];
 
-      auto out_block = VectorBlock<T, RowTile, ColTile>{};
+      auto out_block = VectorBlock<ComputeT, RowTile, ColTile>{};
       if (params_.beta != static_cast<T>(0)) {
         // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
         auto const_out_ptr =
@@ -73,9 +118,9 @@ struct MatmulKernel {
                                 cl::sycl::access::address_space::global_space>{
                 out_ptr.get()};
 
-        out_block = load_block<RowTile, ColTile>(const_out_ptr, params_.n,
-                                                 valid_row, valid_col);
-        scalar_multiply(out_block, params_.beta);
+        out_block = convert_block<ComputeT>(load_block<RowTile, ColTile>(
+            const_out_ptr, out_ld, valid_row, valid_col));
+        scalar_multiply(out_block, static_cast<ComputeT>(params_.beta));
       }
       Index acc_idx = 0;
 
@@ -85,7 +130,8 @@ struct MatmulKernel {
               load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld);
           auto rhs_block =
               load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld);
-          block_mmacc(lhs_block, rhs_block, out_block);
+          block_mmacc(convert_block<ComputeT>(lhs_block),
+                      convert_block<ComputeT>(rhs_block), out_block);
           lhs_ptr += lhs_step;
           rhs_ptr += rhs_step;
         }
@@ -98,7 +144,8 @@ struct MatmulKernel {
                   lhs_ptr, lhs_ld, valid_row, valid_acc);
               auto rhs_block = load<AccTile, ColTile, TransposeRHS>(
                   rhs_ptr, rhs_ld, valid_acc, valid_col);
-              block_mmacc(lhs_block, rhs_block, out_block);
+              block_mmacc(convert_block<ComputeT>(lhs_block),
+                          convert_block<ComputeT>(rhs_block), out_block);
               lhs_ptr += lhs_step;
               rhs_ptr += rhs_step;
             };
@@ -118,10 +165,584 @@ struct MatmulKernel {
         }
       }
 
+      if constexpr (!std::is_same<OutputOp, IdentityOutputOp>::value) {
+        Index const out_idx =
+            batch * params_.out_batch_stride + out_ld * row + col;
+        apply_output_op(out_block, col, out_idx, out_ld, valid_row, valid_col,
+                        internal_col_block);
+      }
+
+      auto const store_out_block = convert_block<T>(out_block);
+      (!CheckBounds || (internal_row_block && internal_col_block))
+          ? store_block<RowTile, ColTile>(store_out_block, out_ptr, out_ld)
+          : store_block<RowTile, ColTile>(store_out_block, out_ptr, out_ld,
+                                          valid_row, valid_col);
+    }
+  }
+
+ private:
+  /**
+   * Apply the output operation to the valid rows of the output block. Rows
+   * are passed to the operation as whole vectors unless they extend past the
+   * last column, in which case each valid element is passed separately.
+   */
+  void SNN_ALWAYS_INLINE apply_output_op(
+      VectorBlock<ComputeT, RowTile, ColTile>& block, Index col, Index out_idx,
+      Index out_ld, std::array<bool, RowTile> const& valid_row,
+      std::array<bool, ColTile> const& valid_col,
+      bool internal_col_block) const {
+    namespace vec_elem = helpers::vector_element;
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RowTile; ++i) {
+      if (CheckBounds && !valid_row[i]) {
+        continue;
+      }
+      Index const row_idx = out_idx + i * out_ld;
+      if (!CheckBounds || internal_col_block) {
+        block.data(i) = output_op_.apply(block.data(i), col, row_idx);
+      } else {
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < ColTile; ++j) {
+          if (valid_col[j]) {
+            vec_elem::set(block.data(i), j,
+                          output_op_.apply(vec_elem::get(block.data(i), j),
+                                           col + j, row_idx + j));
+          }
+        }
+      }
+    }
+  }
+
+  ReadMem<T const, IsUSM> lhs_;
+  ReadMem<T const, IsUSM> rhs_;
+  ReadWriteMem<T, IsUSM> output_;
+  MatmulParams params_;
+  OutputOp output_op_;
+};
+
+/**
+ * Matrix multiply kernel which stages panels of the LHS and RHS in local
+ * memory.
+ *
+ * Each work-group of WgRows x WgCols work-items computes a (WgRows * RowTile)
+ * x (WgCols * ColTile) block of the output, with each work-item computing a
+ * RowTile x ColTile block in registers as in MatmulKernel. The accumulation
+ * dimension is traversed KBlock values at a time: the work-group
+ * cooperatively loads the LHS and RHS panels for those values into local
+ * memory, so every element is read from global memory once per work-group
+ * rather than once per work-item.
+ *
+ * The K loop is double buffered. While the panels for one block are read from
+ * local memory, the next panels are loaded from global memory into registers
+ * and then written to the other half of local memory, so only a single
+ * barrier is needed for each block.
+ *
+ * The panels are stored in local memory with the accumulation dimension
+ * outermost, as [KBlock][WgRows * RowTile] and [KBlock][WgCols * ColTile].
+ * If CheckBounds is set, values outside the matrices are loaded as zero and
+ * only the valid part of the output block is written.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int WgRows, int WgCols, int KBlock,
+          bool CheckBounds, bool IsUSM, typename ComputeT = T>
+struct LocalMatmulKernel {
+  /** Number of output rows computed by each work-group. */
+  static constexpr int block_rows = WgRows * RowTile;
+  /** Number of output columns computed by each work-group. */
+  static constexpr int block_cols = WgCols * ColTile;
+  /** Number of work-items in each work-group. */
+  static constexpr int local_size = WgRows * WgCols;
+  /** Number of LHS values in each panel. */
+  static constexpr int lhs_panel_size = KBlock * block_rows;
+  /** Number of RHS values in each panel. */
+  static constexpr int rhs_panel_size = KBlock * block_cols;
+  /** Number of LHS values loaded by each work-item for each panel. */
+  static constexpr int lhs_loads = lhs_panel_size / local_size;
+  /** Number of RHS values loaded by each work-item for each panel. */
+  static constexpr int rhs_loads = rhs_panel_size / local_size;
+  /** Number of elements in each half of the double buffered local memory. */
+  static constexpr int buffer_size = lhs_panel_size + rhs_panel_size;
+  /** Total number of elements of local memory required by the kernel. */
+  static constexpr int local_mem_size = 2 * buffer_size;
+
+  static_assert(lhs_panel_size % local_size == 0,
+                "Each work-item must load the same number of LHS values.");
+  static_assert(rhs_panel_size % local_size == 0,
+                "Each work-item must load the same number of RHS values.");
+
+  LocalMatmulKernel(ReadMem<T const, IsUSM> const& lhs,
+                    ReadMem<T const, IsUSM> const& rhs,
+                    LocalAccessor<T> const& local,
+                    ReadWriteMem<T, IsUSM> const& output,
+                    MatmulParams const& params)
+      : lhs_{lhs},
+        rhs_{rhs},
+        local_{local},
+        output_{output},
+        params_{params} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const batch = item.get_global_id(0);
+    Index const local_row = item.get_local_id(1);
+    Index const local_col = item.get_local_id(2);
+    Index const local_idx = local_row * WgCols + local_col;
+    Index const block_row = item.get_group(1) * block_rows;
+    Index const block_col = item.get_group(2) * block_cols;
+    Index const row = block_row + local_row * RowTile;
+    Index const col = block_col + local_col * ColTile;
+
+    auto lhs_ptr = lhs_.get_pointer() + batch * params_.lhs_batch_stride;
+    auto rhs_ptr = rhs_.get_pointer() + batch * params_.rhs_batch_stride;
+    auto out_ptr = output_.get_pointer() + batch * params_.out_batch_stride;
+
+    std::array<T, lhs_loads> lhs_regs;
+    std::array<T, rhs_loads> rhs_regs;
+    load_panels(lhs_ptr, rhs_ptr, block_row, block_col, 0, local_idx,
+                lhs_regs, rhs_regs);
+    store_panels(0, local_idx, lhs_regs, rhs_regs);
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    using OutBlock = VectorBlock<ComputeT, RowTile, ColTile>;
+    using OutVector = typename OutBlock::VectorType;
+    namespace vec_elem = helpers::vector_element;
+    OutBlock out_block{};
+    Index const n_k_blocks = (params_.k + KBlock - 1) / KBlock;
+    for (Index k_block = 0; k_block < n_k_blocks; ++k_block) {
+      Index const buffer_offset = (k_block % 2) * buffer_size;
+      bool const has_next = k_block + 1 < n_k_blocks;
+      if (has_next) {
+        load_panels(lhs_ptr, rhs_ptr, block_row, block_col,
+                    (k_block + 1) * KBlock, local_idx, lhs_regs, rhs_regs);
+      }
+
+      Index const lhs_offset = buffer_offset + local_row * RowTile;
+      Index const rhs_offset =
+          buffer_offset + lhs_panel_size + local_col * ColTile;
+      SNN_PRAGMA_UNROLL
+      for (int kk = 0; kk < KBlock; ++kk) {
+        OutVector rhs_vec;
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < ColTile; ++j) {
+          vec_elem::set(rhs_vec, j,
+                        static_cast<ComputeT>(
+                            local_[rhs_offset + kk * block_cols + j]));
+        }
+        SNN_PRAGMA_UNROLL
+        for (int i = 0; i < RowTile; ++i) {
+          ComputeT const lhs_val =
+              static_cast<ComputeT>(local_[lhs_offset + kk * block_rows + i]);
+          out_block.data(i) = helpers::math::mad(
+              OutVector{lhs_val}, rhs_vec, out_block.data(i));
+        }
+      }
+
+      if (has_next) {
+        store_panels(buffer_offset == 0 ? buffer_size : 0, local_idx,
+                     lhs_regs, rhs_regs);
+      }
+      // The next panels must be visible, and all work-items must have
+      // finished reading the current panels before they are overwritten.
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (row < params_.m && col < params_.n) {
+      std::array<bool, RowTile> valid_row;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < params_.m;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < params_.n;
+      }
+      bool const internal_block =
+          valid_row[RowTile - 1] && valid_col[ColTile - 1];
+
+      auto const out_ld = params_.ldc;
+      out_ptr += out_ld * row + col;
+      if (params_.beta != static_cast<T>(0)) {
+        // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
+        auto const_out_ptr =
+            cl::sycl::multi_ptr<T const,
+                                cl::sycl::access::address_space::global_space>{
+                out_ptr.get()};
+        auto prev_block = convert_block<ComputeT>(load_block<RowTile, ColTile>(
+            const_out_ptr, out_ld, valid_row, valid_col));
+        scalar_multiply(prev_block, static_cast<ComputeT>(params_.beta));
+        for (int i = 0; i < RowTile; ++i) {
+          out_block.data(i) += prev_block.data(i);
+        }
+      }
+
+      auto const store_out_block = convert_block<T>(out_block);
+      (!CheckBounds || internal_block)
+          ? store_block<RowTile, ColTile>(store_out_block, out_ptr, out_ld)
+          : store_block<RowTile, ColTile>(store_out_block, out_ptr, out_ld,
+                                          valid_row, valid_col);
+    }
+  }
+
+ private:
+  /**
+   * Load the LHS and RHS panels starting at k_start from global memory into
+   * registers. Consecutive work-items read consecutive addresses, whichever
+   * dimension of the matrices is contiguous.
+   */
+  template <typename LhsPointer, typename RhsPointer>
+  void SNN_ALWAYS_INLINE load_panels(LhsPointer lhs_ptr, RhsPointer rhs_ptr,
+                                     Index block_row, Index block_col,
+                                     Index k_start, Index local_idx,
+                                     std::array<T, lhs_loads>& lhs_regs,
+                                     std::array<T, rhs_loads>& rhs_regs) const {
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < lhs_loads; ++i) {
+      Index const idx = local_idx + i * local_size;
+      Index const lhs_row =
+          block_row + (TransposeLHS ? idx % block_rows : idx / KBlock);
+      Index const lhs_acc =
+          k_start + (TransposeLHS ? idx / block_rows : idx % KBlock);
+      bool const valid =
+          !CheckBounds || (lhs_row < params_.m && lhs_acc < params_.k);
+      lhs_regs[i] = valid ? lhs_ptr[TransposeLHS
+                                        ? lhs_acc * params_.lda + lhs_row
+                                        : lhs_row * params_.lda + lhs_acc]
+                          : static_cast<T>(0);
+    }
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < rhs_loads; ++i) {
+      Index const idx = local_idx + i * local_size;
+      Index const rhs_col =
+          block_col + (TransposeRHS ? idx / KBlock : idx % block_cols);
+      Index const rhs_acc =
+          k_start + (TransposeRHS ? idx % KBlock : idx / block_cols);
+      bool const valid =
+          !CheckBounds || (rhs_col < params_.n && rhs_acc < params_.k);
+      rhs_regs[i] = valid ? rhs_ptr[TransposeRHS
+                                        ? rhs_col * params_.ldb + rhs_acc
+                                        : rhs_acc * params_.ldb + rhs_col]
+                          : static_cast<T>(0);
+    }
+  }
+
+  /**
+   * Write the panels held in registers to the half of local memory starting
+   * at buffer_offset, in the layout [KBlock][rows] and [KBlock][cols].
+   */
+  void SNN_ALWAYS_INLINE
+  store_panels(Index buffer_offset, Index local_idx,
+               std::array<T, lhs_loads> const& lhs_regs,
+               std::array<T, rhs_loads> const& rhs_regs) const {
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < lhs_loads; ++i) {
+      Index const idx = local_idx + i * local_size;
+      Index const lhs_row = TransposeLHS ? idx % block_rows : idx / KBlock;
+      Index const lhs_acc = TransposeLHS ? idx / block_rows : idx % KBlock;
+      local_[buffer_offset + lhs_acc * block_rows + lhs_row] = lhs_regs[i];
+    }
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < rhs_loads; ++i) {
+      Index const idx = local_idx + i * local_size;
+      Index const rhs_col = TransposeRHS ? idx / KBlock : idx % block_cols;
+      Index const rhs_acc = TransposeRHS ? idx % KBlock : idx / block_cols;
+      local_[buffer_offset + lhs_panel_size + rhs_acc * block_cols + rhs_col] =
+          rhs_regs[i];
+    }
+  }
+
+  ReadMem<T const, IsUSM> lhs_;
+  ReadMem<T const, IsUSM> rhs_;
+  LocalAccessor<T> local_;
+  ReadWriteMem<T, IsUSM> output_;
+  MatmulParams params_;
+};
+
+/**
+ * Matrix multiply kernel which computes the products for one slice of the
+ * accumulation dimension, writing the partial sums to a workspace.
+ *
+ * The accumulation dimension is split into n_splits slices of split_size
+ * values, and the first dimension of the range covers every slice of every
+ * batch. The partial sums are stored as ComputeT in the layout
+ * [split][batch][m][n], and are added together by SplitKReduceKernel.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, bool CheckBounds, bool IsUSM,
+          typename ComputeT = T>
+struct SplitKMatmulKernel {
+  SplitKMatmulKernel(ReadMem<T const, IsUSM> const& lhs,
+                     ReadMem<T const, IsUSM> const& rhs,
+                     WriteMem<ComputeT, IsUSM> const& partial,
+                     MatmulParams const& params, Index n_splits,
+                     Index split_size)
+      : lhs_{lhs},
+        rhs_{rhs},
+        partial_{partial},
+        params_{params},
+        n_splits_{n_splits},
+        split_size_{split_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const split = item.get_global_id(0) % n_splits_;
+    Index const batch = item.get_global_id(0) / n_splits_;
+    Index row = item.get_global_id(1) * RowTile;
+    Index col = item.get_global_id(2) * ColTile;
+
+    if (batch < params_.batches && row < params_.m && col < params_.n) {
+      Index const k_start = split * split_size_;
+      Index const split_end = k_start + split_size_;
+      Index const k_end = split_end < params_.k ? split_end : params_.k;
+
+      auto lhs_ptr = lhs_.get_pointer() + batch * params_.lhs_batch_stride;
+      auto rhs_ptr = rhs_.get_pointer() + batch * params_.rhs_batch_stride;
+      auto out_ptr = partial_.get_pointer() +
+                     (split * params_.batches + batch) * params_.m * params_.n;
+
+      auto const lhs_ld = params_.lda;
+      auto const lhs_step = (TransposeLHS ? lhs_ld : 1) * AccTile;
+      auto const rhs_ld = params_.ldb;
+      auto const rhs_step = (TransposeRHS ? 1 : rhs_ld) * AccTile;
+      auto const out_ld = params_.n;
+
+      lhs_ptr +=
+          (TransposeLHS ? row + k_start * lhs_ld : lhs_ld * row + k_start);
+      rhs_ptr +=
+          (TransposeRHS ? col * rhs_ld + k_start : col + k_start * rhs_ld);
+      out_ptr += out_ld * row + col;
+
+      std::array<bool, RowTile> valid_row;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < params_.m;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < params_.n;
+      }
+      bool const internal_row_block = valid_row[RowTile - 1];
+      bool const internal_col_block = valid_col[ColTile - 1];
+
+      auto out_block = VectorBlock<ComputeT, RowTile, ColTile>{};
+      Index acc_idx = k_start;
+
+      if (!CheckBounds || (internal_row_block && internal_col_block)) {
+        for (; acc_idx < k_end - AccTile + 1; acc_idx += AccTile) {
+          auto lhs_block =
+              load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld);
+          auto rhs_block =
+              load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld);
+          block_mmacc(convert_block<ComputeT>(lhs_block),
+                      convert_block<ComputeT>(rhs_block), out_block);
+          lhs_ptr += lhs_step;
+          rhs_ptr += rhs_step;
+        }
+      }
+
+      if (CheckBounds) {
+        auto accumulate_block =
+            [&](std::array<bool, AccTile> const& valid_acc) {
+              auto lhs_block = load<RowTile, AccTile, TransposeLHS>(
+                  lhs_ptr, lhs_ld, valid_row, valid_acc);
+              auto rhs_block = load<AccTile, ColTile, TransposeRHS>(
+                  rhs_ptr, rhs_ld, valid_acc, valid_col);
+              block_mmacc(convert_block<ComputeT>(lhs_block),
+                          convert_block<ComputeT>(rhs_block), out_block);
+              lhs_ptr += lhs_step;
+              rhs_ptr += rhs_step;
+            };
+        for (; acc_idx < k_end - AccTile + 1; acc_idx += AccTile) {
+          std::array<bool, AccTile> valid_acc;
+          for (int i = 0; i < AccTile; ++i) {
+            valid_acc[i] = true;
+          }
+          accumulate_block(valid_acc);
+        }
+        if (acc_idx < k_end) {
+          std::array<bool, AccTile> valid_acc;
+          for (int i = 0; i < AccTile; ++i) {
+            valid_acc[i] = acc_idx + i < k_end;
+          }
+          accumulate_block(valid_acc);
+        }
+      }
+
       (!CheckBounds || (internal_row_block && internal_col_block))
           ? store_block<RowTile, ColTile>(out_block, out_ptr, out_ld)
-          : store_block<RowTile, ColTile>(out_block, out_ptr, out_ld, valid_row,
-                                          valid_col);
+          : store_block<RowTile, ColTile>(out_block, out_ptr, out_ld,
+                                          valid_row, valid_col);
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> lhs_;
+  ReadMem<T const, IsUSM> rhs_;
+  WriteMem<ComputeT, IsUSM> partial_;
+  MatmulParams params_;
+  Index n_splits_;
+  Index split_size_;
+};
+
+/**
+ * Kernel to add together the partial sums written by SplitKMatmulKernel for
+ * each output value, adding the previous output scaled by beta.
+ */
+template <typename T, typename Index, bool IsUSM, typename ComputeT = T>
+struct SplitKReduceKernel {
+  SplitKReduceKernel(ReadMem<ComputeT const, IsUSM> const& partial,
+                     ReadWriteMem<T, IsUSM> const& output,
+                     MatmulParams const& params, Index n_splits)
+      : partial_{partial},
+        output_{output},
+        params_{params},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    Index const matrix_size = params_.m * params_.n;
+    Index const output_size = params_.batches * matrix_size;
+    Index const batch = idx / matrix_size;
+    Index const row = (idx % matrix_size) / params_.n;
+    Index const col = idx % params_.n;
+    Index const out_idx =
+        batch * params_.out_batch_stride + row * params_.ldc + col;
+    auto partial_ptr = partial_.get_pointer();
+    auto out_ptr = output_.get_pointer();
+
+    ComputeT sum = static_cast<ComputeT>(0);
+    if (params_.beta != 0.f) {
+      sum = static_cast<ComputeT>(params_.beta) *
+            static_cast<ComputeT>(out_ptr[out_idx]);
+    }
+    for (Index split = 0; split < n_splits_; ++split) {
+      sum += partial_ptr[split * output_size + idx];
+    }
+    out_ptr[out_idx] = static_cast<T>(sum);
+  }
+
+ private:
+  ReadMem<ComputeT const, IsUSM> partial_;
+  ReadWriteMem<T, IsUSM> output_;
+  MatmulParams params_;
+  Index n_splits_;
+};
+
+/**
+ * Matrix multiply kernel for tensors in the interleaved batch format, where
+ * the batch is the fastest moving dimension of every tensor.
+ *
+ * Each work-item computes a RowTile x ColTile block of the output for
+ * BatchTile consecutive batches. As those batches are contiguous in memory,
+ * every value is loaded and stored as a vector across the batches, and the
+ * products are computed on those vectors.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int BatchTile, bool CheckBounds,
+          bool IsUSM, typename ComputeT = T>
+struct InterleavedMatmulKernel {
+  InterleavedMatmulKernel(ReadMem<T const, IsUSM> const& lhs,
+                          ReadMem<T const, IsUSM> const& rhs,
+                          ReadWriteMem<T, IsUSM> const& output,
+                          MatmulParams const& params)
+      : lhs_{lhs}, rhs_{rhs}, output_{output}, params_{params} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<3> item) const {
+    using DataVector = typename helpers::VectorType<T, BatchTile>::type;
+    using AccVector = typename helpers::VectorType<ComputeT, BatchTile>::type;
+    namespace vec_elem = helpers::vector_element;
+
+    Index const row = item.get_id(0) * RowTile;
+    Index const col = item.get_id(1) * ColTile;
+    Index const batch = item.get_id(2) * BatchTile;
+    Index const n_batches = params_.batches;
+
+    auto lhs_ptr = lhs_.get_pointer() + batch;
+    auto rhs_ptr = rhs_.get_pointer() + batch;
+    auto out_ptr = output_.get_pointer() + batch;
+    // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
+    auto const_out_ptr =
+        cl::sycl::multi_ptr<T const,
+                            cl::sycl::access::address_space::global_space>{
+            out_ptr.get()};
+
+    bool const full_batch = !CheckBounds || batch + BatchTile <= n_batches;
+    // Load the values for each batch at the given matrix offset.
+    auto load_batches = [&](auto ptr, Index offset) {
+      DataVector val;
+      if (full_batch) {
+        val = helpers::io::Load<DataVector>()(ptr, offset);
+      } else {
+        for (int i = 0; i < BatchTile; ++i) {
+          vec_elem::set(val, i,
+                        batch + i < n_batches ? *(ptr + offset + i)
+                                              : static_cast<T>(0));
+        }
+      }
+      return helpers::convert_vector<ComputeT>(val);
+    };
+
+    std::array<bool, RowTile> valid_row;
+    for (int i = 0; i < RowTile; ++i) {
+      valid_row[i] = !CheckBounds || row + i < params_.m;
+    }
+    std::array<bool, ColTile> valid_col;
+    for (int i = 0; i < ColTile; ++i) {
+      valid_col[i] = !CheckBounds || col + i < params_.n;
+    }
+
+    std::array<std::array<AccVector, ColTile>, RowTile> out_block;
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RowTile; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        out_block[i][j] = AccVector{static_cast<ComputeT>(0)};
+      }
+    }
+
+    for (Index acc = 0; acc < params_.k; ++acc) {
+      std::array<AccVector, RowTile> lhs_vals;
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < RowTile; ++i) {
+        Index const lhs_idx = TransposeLHS ? acc * params_.m + row + i
+                                           : (row + i) * params_.k + acc;
+        lhs_vals[i] = valid_row[i] ? load_batches(lhs_ptr, lhs_idx * n_batches)
+                                   : AccVector{static_cast<ComputeT>(0)};
+      }
+      std::array<AccVector, ColTile> rhs_vals;
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        Index const rhs_idx = TransposeRHS ? (col + j) * params_.k + acc
+                                           : acc * params_.n + col + j;
+        rhs_vals[j] = valid_col[j] ? load_batches(rhs_ptr, rhs_idx * n_batches)
+                                   : AccVector{static_cast<ComputeT>(0)};
+      }
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < RowTile; ++i) {
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < ColTile; ++j) {
+          out_block[i][j] =
+              helpers::math::mad(lhs_vals[i], rhs_vals[j], out_block[i][j]);
+        }
+      }
+    }
+
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RowTile; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        if (valid_row[i] && valid_col[j]) {
+          Index const offset = ((row + i) * params_.n + col + j) * n_batches;
+          AccVector result = out_block[i][j];
+          if (params_.beta != 0.f) {
+            result += static_cast<ComputeT>(params_.beta) *
+                      load_batches(const_out_ptr, offset);
+          }
+          auto const out_val = helpers::convert_vector<T>(result);
+          if (full_batch) {
+            helpers::io::Store<DataVector>()(out_ptr, offset, out_val);
+          } else {
+            for (int b = 0; b < BatchTile && batch + b < n_batches; ++b) {
+              *(out_ptr + offset + b) = vec_elem::get(out_val, b);
+            }
+          }
+        }
+      }
     }
   }
 
@@ -19,6 +19,12 @@
 #include "portdnn/mem_object.h"
 
 #include "src/matmul/queue_kernel.h"
+#include "src/matmul/tables/arm_gpu.h"
+#include "src/matmul/tables/intel_cpu.h"
+#include "src/matmul/tables/intel_gpu.h"
+#include "src/matmul/tile_table.h"
+
+#include <string>
 
 namespace sycldnn {
 namespace matmul {
@@ -26,8 +32,9 @@ namespace internal {
 namespace {
 
 // Launch the kernel specified by the template parameters.
-template <typename T, bool TransposeLHS, bool TransposeRHS, int RowTile,
-          int AccTile, int ColTile, template <typename> class MemObj>
+template <typename T, typename ComputeT, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile,
+          template <typename> class MemObj>
 SNNStatus launch_with_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
                             MemObj<T>& output, MatmulParams const& params,
                             cl::sycl::queue& queue, size_t wg_rows,
@@ -36,57 +43,235 @@ SNNStatus launch_with_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
   auto kernel = ((params.m % RowTile == 0) && (params.k % AccTile == 0) &&
                  (params.n % ColTile == 0))
                     ? queue_kernel<T, int, TransposeLHS, TransposeRHS, RowTile,
-                                   AccTile, ColTile, false, MemObj>
+                                   AccTile, ColTile, false, MemObj, ComputeT>
                     : queue_kernel<T, int, TransposeLHS, TransposeRHS, RowTile,
-                                   AccTile, ColTile, true, MemObj>;
+                                   AccTile, ColTile, true, MemObj, ComputeT>;
   return kernel(lhs, rhs, output, params, queue, wg_rows, wg_cols, wg_batch,
                 events);
 }
 
+// Launch the local memory kernel specified by the template parameters.
+template <typename T, typename ComputeT, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int WgRows, int WgCols, int KBlock,
+          template <typename> class MemObj>
+SNNStatus launch_with_local_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                                  MemObj<T>& output,
+                                  MatmulParams const& params,
+                                  cl::sycl::queue& queue,
+                                  const std::vector<cl::sycl::event>& events) {
+  auto kernel =
+      ((params.m % (RowTile * WgRows) == 0) && (params.k % KBlock == 0) &&
+       (params.n % (ColTile * WgCols) == 0))
+          ? queue_local_kernel<T, int, TransposeLHS, TransposeRHS, RowTile,
+                               ColTile, WgRows, WgCols, KBlock, false, MemObj,
+                               ComputeT>
+          : queue_local_kernel<T, int, TransposeLHS, TransposeRHS, RowTile,
+                               ColTile, WgRows, WgCols, KBlock, true, MemObj,
+                               ComputeT>;
+  return kernel(lhs, rhs, output, params, queue, events);
+}
+
+// Launch the split-K kernel specified by the template parameters.
+template <typename T, typename ComputeT, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile,
+          template <typename> class MemObj>
+SNNStatus launch_split_k(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                         MemObj<T>& output, MemObj<ComputeT>& workspace,
+                         MatmulParams const& params, int n_splits,
+                         cl::sycl::queue& queue, size_t wg_rows,
+                         size_t wg_cols, size_t wg_batch,
+                         const std::vector<cl::sycl::event>& events) {
+  auto kernel = ((params.m % RowTile == 0) && (params.k % AccTile == 0) &&
+                 (params.n % ColTile == 0))
+                    ? queue_split_k_kernel<T, int, TransposeLHS, TransposeRHS,
+                                           RowTile, AccTile, ColTile, false,
+                                           MemObj, ComputeT>
+                    : queue_split_k_kernel<T, int, TransposeLHS, TransposeRHS,
+                                           RowTile, AccTile, ColTile, true,
+                                           MemObj, ComputeT>;
+  return kernel(lhs, rhs, output, workspace, params, n_splits, queue, wg_rows,
+                wg_cols, wg_batch, events);
+}
+
+// Launch the interleaved batch kernel specified by the template parameters.
+template <typename T, typename ComputeT, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int BatchTile,
+          template <typename> class MemObj>
+SNNStatus launch_interleaved(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                             MemObj<T>& output, MatmulParams const& params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events) {
+  auto kernel = ((params.m % RowTile == 0) && (params.n % ColTile == 0) &&
+                 (params.batches % BatchTile == 0))
+                    ? queue_interleaved_kernel<T, int, TransposeLHS,
+                                               TransposeRHS, RowTile, ColTile,
+                                               BatchTile, false, MemObj,
+                                               ComputeT>
+                    : queue_interleaved_kernel<T, int, TransposeLHS,
+                                               TransposeRHS, RowTile, ColTile,
+                                               BatchTile, true, MemObj,
+                                               ComputeT>;
+  return kernel(lhs, rhs, output, params, queue, events);
+}
+
+// Check whether the device can run the local memory kernel. Devices without
+// dedicated local memory emulate it in global memory, so staging the panels
+// gains nothing over the register tiled kernel.
+template <int WgRows, int WgCols>
+bool can_use_local_kernel(cl::sycl::device const& device) {
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() !=
+      cl::sycl::info::local_mem_type::local) {
+    return false;
+  }
+  size_t const max_wg_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  return max_wg_size >= static_cast<size_t>(WgRows * WgCols);
+}
+
+// Get the tile table generated for the device, or an empty table if there is
+// none for this device.
+//
+// The tables checked in under src/matmul/tables are placeholders generated
+// from no benchmark results, so every device currently falls back to
+// default_tile_config(). Run bench/internal/gen_matmul_tile_table.py on the
+// tiled_matmul benchmark results of a device to replace its table.
+TileTable get_tile_table(cl::sycl::device const& device) {
+  auto vendor = device.get_info<cl::sycl::info::device::vendor>();
+  bool is_intel = vendor.find("Intel(R) Corporation") != std::string::npos;
+  bool is_arm = vendor.find("ARM") != std::string::npos;
+
+  if (is_intel && device.is_cpu()) {
+    return intel_cpu::tile_table;
+  } else if (is_intel && device.is_gpu()) {
+    return intel_gpu::tile_table;
+  } else if (is_arm && device.is_gpu()) {
+    return arm_gpu::tile_table;
+  }
+  return TileTable{nullptr, 0};
+}
+
+// Choose the tile configuration from the device's table, falling back to the
+// default heuristics if the table has no choice for these parameters.
+TileConfig select_tile_config(MatmulParams const& params,
+                              cl::sycl::device const& device,
+                              bool transpose_lhs, bool transpose_rhs) {
+  auto config =
+      evaluate(get_tile_table(device), params, transpose_lhs, transpose_rhs);
+  if (config == TileConfig::NotSet) {
+    config = default_tile_config(params);
+  }
+  if (config == TileConfig::Local && !can_use_local_kernel<8, 8>(device)) {
+    config = TileConfig::Tiles444;
+  }
+  return config;
+}
+
 }  // namespace
 
 // Launch the matrix multiply kernel for the passed parameters.
-template <typename T, bool TransposeLHS, bool TransposeRHS,
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename ComputeT,
           template <typename> class MemObj>
 SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs, MemObj<T>& output,
                  MatmulParams const& params, cl::sycl::queue& queue,
                  const std::vector<cl::sycl::event>& events) {
-  return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4, MemObj>(
-      lhs, rhs, output, params, queue, 8, 4, 1, events);
+  // The tile sizes should match those generated in src/matmul/CMakeLists.txt
+  // and those in bench/internal/gen_matmul_tile_table.py
+  if (params.batch_type == BatchFormat::INTERLEAVED) {
+    if (params.n < 4) {
+      return launch_interleaved<T, ComputeT, TransposeLHS, TransposeRHS, 4, 1,
+                                4, MemObj>(lhs, rhs, output, params, queue,
+                                           events);
+    }
+    return launch_interleaved<T, ComputeT, TransposeLHS, TransposeRHS, 4, 4, 4,
+                              MemObj>(lhs, rhs, output, params, queue, events);
+  }
+  auto config = select_tile_config(params, queue.get_device(), TransposeLHS,
+                                   TransposeRHS);
+  switch (config) {
+    case TileConfig::SkinnyRows:
+      return launch_with_tiles<T, ComputeT, TransposeLHS, TransposeRHS, 1, 8,
+                               4, MemObj>(lhs, rhs, output, params, queue, 1,
+                                          64, 1, events);
+    case TileConfig::SkinnyCols:
+      return launch_with_tiles<T, ComputeT, TransposeLHS, TransposeRHS, 4, 8,
+                               1, MemObj>(lhs, rhs, output, params, queue, 64,
+                                          1, 1, events);
+    case TileConfig::SmallBatched:
+      return launch_with_tiles<T, ComputeT, TransposeLHS, TransposeRHS, 2, 4,
+                               4, MemObj>(lhs, rhs, output, params, queue, 4,
+                                          8, 2, events);
+    case TileConfig::Local:
+      return launch_with_local_tiles<T, ComputeT, TransposeLHS, TransposeRHS,
+                                     4, 4, 8, 8, 16, MemObj>(
+          lhs, rhs, output, params, queue, events);
+    case TileConfig::Tiles444:
+    case TileConfig::NotSet:
+    default:
+      return launch_with_tiles<T, ComputeT, TransposeLHS, TransposeRHS, 4, 4,
+                               4, MemObj>(lhs, rhs, output, params, queue, 8,
+                                          4, 1, events);
+  }
+}
+
+// Launch the matrix multiply kernel for the passed parameters, splitting the
+// accumulation dimension if the workspace can hold the partial sums.
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename ComputeT,
+          template <typename> class MemObj>
+SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs, MemObj<T>& output,
+                 MemObj<ComputeT>& workspace, MatmulParams const& params,
+                 cl::sycl::queue& queue,
+                 const std::vector<cl::sycl::event>& events) {
+  size_t const workspace_size = split_k_workspace_size(params);
+  if (workspace_size > 0 && workspace.get_extent() >= workspace_size) {
+    // The tile sizes should match split_k_acc_tile and those generated in
+    // src/matmul/CMakeLists.txt
+    return launch_split_k<T, ComputeT, TransposeLHS, TransposeRHS, 4,
+                          split_k_acc_tile, 4, MemObj>(
+        lhs, rhs, output, workspace, params, split_k_factor(params), queue, 4,
+        4, 4, events);
+  }
+  return launch<T, TransposeLHS, TransposeRHS, ComputeT>(lhs, rhs, output,
+                                                         params, queue, events);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, MEMOBJ)            \
-  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS, MEMOBJ>( \
-      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,   \
-      MEMOBJ<DTYPE> & output, MatmulParams const& params,          \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, TLHS, TRHS, MEMOBJ)             \
+  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS, CTYPE, MEMOBJ>(  \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,           \
+      MEMOBJ<DTYPE> & output, MatmulParams const& params,                  \
+      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events); \
+  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS, CTYPE, MEMOBJ>(  \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,           \
+      MEMOBJ<DTYPE> & output, MEMOBJ<CTYPE> & workspace,                   \
+      MatmulParams const& params, cl::sycl::queue& queue,                  \
+      const std::vector<cl::sycl::event>& events);
 
 #ifdef SNN_ENABLE_USM
-#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS)          \
-  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject) \
-  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, USMMemObject)
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, TLHS, TRHS)          \
+  INSTANTIATE_LAUNCHER(DTYPE, CTYPE, TLHS, TRHS, BufferMemObject) \
+  INSTANTIATE_LAUNCHER(DTYPE, CTYPE, TLHS, TRHS, USMMemObject)
 #else
-#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS) \
-  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject)
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, TLHS, TRHS) \
+  INSTANTIATE_LAUNCHER(DTYPE, CTYPE, TLHS, TRHS, BufferMemObject)
 #endif  // SNN_ENABLE_USM
 
-#define INSTANTIATE_FOR_TYPE(DTYPE)          \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, true, true)  \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, false, true) \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, true, false) \
-  INSTANTIATE_FOR_MEMOBJ(DTYPE, false, false)
+#define INSTANTIATE_FOR_TYPES(DTYPE, CTYPE)         \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, true, true)  \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, false, true) \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, true, false) \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, CTYPE, false, false)
 
-INSTANTIATE_FOR_TYPE(float);
+INSTANTIATE_FOR_TYPES(float, float);
 
 #ifdef SNN_USE_DOUBLE
-INSTANTIATE_FOR_TYPE(double);
+INSTANTIATE_FOR_TYPES(double, double);
 #endif  // SNN_USE_DOUBLE
 
 #ifdef SNN_USE_HALF
-INSTANTIATE_FOR_TYPE(cl::sycl::half);
+INSTANTIATE_FOR_TYPES(cl::sycl::half, cl::sycl::half);
+INSTANTIATE_FOR_TYPES(cl::sycl::half, float);
 #endif  // SNN_USE_HALF
 
-#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_FOR_TYPES
 #undef INSTANTIATE_FOR_MEMOBJ
 #undef INSTANTIATE_LAUNCHER
 
@@ -25,16 +25,64 @@ namespace sycldnn {
 namespace matmul {
 namespace internal {
 
-/** Add a matrix multiply kernel to the provided SYCL queue. */
+/**
+ * Add a matrix multiply kernel to the provided SYCL queue. The kernel
+ * accumulates in ComputeT, which can be wider than the data type T.
+ */
 template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
           int RowTile, int AccTile, int ColTile, bool CheckBounds,
-          template <typename> class MemObj>
+          template <typename> class MemObj, typename ComputeT = T>
 SNNStatus queue_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
                        MemObj<T>& output, MatmulParams const& params,
                        cl::sycl::queue& queue, size_t wg_row, size_t wg_col,
                        size_t wg_batch,
                        const std::vector<cl::sycl::event>& events);
 
+/**
+ * Add a matrix multiply kernel which stages the LHS and RHS in local memory
+ * to the provided SYCL queue. Each work-group of WgRows x WgCols work-items
+ * computes a block of the output, loading KBlock values of the accumulation
+ * dimension into local memory at a time.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int WgRows, int WgCols, int KBlock,
+          bool CheckBounds, template <typename> class MemObj,
+          typename ComputeT = T>
+SNNStatus queue_local_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                             MemObj<T>& output, MatmulParams const& params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events);
+
+/**
+ * Add a split-K matrix multiply to the provided SYCL queue. The accumulation
+ * dimension is split into n_splits slices, with the partial sums for each
+ * slice written to the workspace and then added together by a second kernel.
+ * The workspace must hold batches * m * n values for each slice used.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, bool CheckBounds,
+          template <typename> class MemObj, typename ComputeT = T>
+SNNStatus queue_split_k_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                               MemObj<T>& output, MemObj<ComputeT>& workspace,
+                               MatmulParams const& params, int n_splits,
+                               cl::sycl::queue& queue, size_t wg_row,
+                               size_t wg_col, size_t wg_batch,
+                               const std::vector<cl::sycl::event>& events);
+
+/**
+ * Add a matrix multiply kernel for tensors in the interleaved batch format to
+ * the provided SYCL queue. Each work-item computes a RowTile x ColTile block
+ * of the output for BatchTile batches at a time.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int BatchTile, bool CheckBounds,
+          template <typename> class MemObj, typename ComputeT = T>
+SNNStatus queue_interleaved_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                                   MemObj<T>& output,
+                                   MatmulParams const& params,
+                                   cl::sycl::queue& queue,
+                                   const std::vector<cl::sycl::event>& events);
+
 }  // namespace internal
 }  // namespace matmul
 }  // namespace sycldnn
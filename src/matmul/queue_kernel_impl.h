@@ -16,6 +16,7 @@
 #ifndef PORTDNN_SRC_MATMUL_QUEUE_KERNEL_IMPL_H_
 #define PORTDNN_SRC_MATMUL_QUEUE_KERNEL_IMPL_H_
 
+#include "portdnn/accessor_types.h"
 #include "portdnn/matmul/params.h"
 #include "portdnn/mem_object.h"
 #include "portdnn/status.h"
@@ -31,7 +32,7 @@ namespace internal {
 
 template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
           int RowTile, int AccTile, int ColTile, bool CheckBounds,
-          template <typename> class MemObj>
+          template <typename> class MemObj, typename ComputeT>
 SNNStatus queue_kernel(MemObj<T const>& lhs_mem, MemObj<T const>& rhs_mem,
                        MemObj<T>& output_mem, MatmulParams const& params,
                        cl::sycl::queue& queue, size_t wg_row, size_t wg_col,
@@ -53,8 +54,9 @@ SNNStatus queue_kernel(MemObj<T const>& lhs_mem, MemObj<T const>& rhs_mem,
     auto rhs = rhs_mem.read_mem(cgh);
     auto output = output_mem.read_write_mem(cgh);
 
-    using Functor = MatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile,
-                                 AccTile, ColTile, CheckBounds, is_usm>;
+    using Functor =
+        MatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile, AccTile,
+                     ColTile, CheckBounds, is_usm, ComputeT>;
 
     Functor functor{lhs, rhs, output, params};
 
@@ -70,6 +72,153 @@ SNNStatus queue_kernel(MemObj<T const>& lhs_mem, MemObj<T const>& rhs_mem,
   return {event, StatusCode::OK};
 }
 
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int WgRows, int WgCols, int KBlock,
+          bool CheckBounds, template <typename> class MemObj,
+          typename ComputeT>
+SNNStatus queue_local_kernel(MemObj<T const>& lhs_mem,
+                             MemObj<T const>& rhs_mem, MemObj<T>& output_mem,
+                             MatmulParams const& params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor =
+      LocalMatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile, ColTile,
+                        WgRows, WgCols, KBlock, CheckBounds, is_usm, ComputeT>;
+
+  // Every work-item in a work-group takes part in loading the panels, so the
+  // work-groups exactly cover the output blocks.
+  size_t const n_row_threads =
+      helpers::round_ratio_up_above_zero(params.m, Functor::block_rows) *
+      WgRows;
+  size_t const n_col_threads =
+      helpers::round_ratio_up_above_zero(params.n, Functor::block_cols) *
+      WgCols;
+  size_t const n_batch_threads = params.batches;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto rhs = rhs_mem.read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+
+    LocalAccessor<T> local_access{
+        cl::sycl::range<1>{static_cast<size_t>(Functor::local_mem_size)}, cgh};
+
+    Functor functor{lhs, rhs, local_access, output, params};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<3>{
+            cl::sycl::range<3>{n_batch_threads, n_row_threads, n_col_threads},
+            cl::sycl::range<3>{1, WgRows, WgCols},
+        },
+        functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, bool CheckBounds,
+          template <typename> class MemObj, typename ComputeT>
+SNNStatus queue_split_k_kernel(MemObj<T const>& lhs_mem,
+                               MemObj<T const>& rhs_mem, MemObj<T>& output_mem,
+                               MemObj<ComputeT>& partial_mem,
+                               MatmulParams const& params, int n_splits,
+                               cl::sycl::queue& queue, size_t wg_row,
+                               size_t wg_col, size_t wg_batch,
+                               const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  // Each slice holds a multiple of AccTile values, so only the last slice can
+  // be ragged. Rounding the slices up can leave fewer slices than requested.
+  Index const split_size = helpers::round_up_to_nearest_multiple(
+      helpers::round_ratio_up_above_zero(params.k, n_splits), AccTile);
+  Index const n_used_splits =
+      helpers::round_ratio_up_above_zero(params.k, split_size);
+
+  Index const output_size_row = helpers::round_ratio_up(params.m, RowTile);
+  Index const output_size_col = helpers::round_ratio_up(params.n, ColTile);
+  size_t const n_row_threads =
+      helpers::round_up_to_nearest_multiple(output_size_row, wg_row);
+  size_t const n_col_threads =
+      helpers::round_up_to_nearest_multiple(output_size_col, wg_col);
+  size_t const n_batch_threads = helpers::round_up_to_nearest_multiple(
+      params.batches * n_used_splits, wg_batch);
+
+  size_t const output_size =
+      static_cast<size_t>(params.batches) * params.m * params.n;
+  if (partial_mem.get_extent() < output_size * n_used_splits) {
+    return StatusCode::InvalidParameter;
+  }
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto rhs = rhs_mem.read_mem(cgh);
+    auto partial = partial_mem.write_mem(cgh);
+
+    using Functor =
+        SplitKMatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile,
+                           AccTile, ColTile, CheckBounds, is_usm, ComputeT>;
+
+    Functor functor{lhs, rhs, partial, params, n_used_splits, split_size};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<3>{
+            cl::sycl::range<3>{n_batch_threads, n_row_threads, n_col_threads},
+            cl::sycl::range<3>{std::min(wg_batch, n_batch_threads),
+                               std::min(wg_row, n_row_threads),
+                               std::min(wg_col, n_col_threads)},
+        },
+        functor);
+  });
+
+  event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(event);
+    auto partial = partial_mem.as_const().read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+
+    using Functor = SplitKReduceKernel<T, Index, is_usm, ComputeT>;
+
+    Functor functor{partial, output, params, n_used_splits};
+
+    cgh.parallel_for(cl::sycl::range<1>{output_size}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int BatchTile, bool CheckBounds,
+          template <typename> class MemObj, typename ComputeT>
+SNNStatus queue_interleaved_kernel(
+    MemObj<T const>& lhs_mem, MemObj<T const>& rhs_mem, MemObj<T>& output_mem,
+    MatmulParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  size_t const n_row_threads = helpers::round_ratio_up(params.m, RowTile);
+  size_t const n_col_threads = helpers::round_ratio_up(params.n, ColTile);
+  size_t const n_batch_threads =
+      helpers::round_ratio_up(params.batches, BatchTile);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto rhs = rhs_mem.read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+
+    using Functor =
+        InterleavedMatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile,
+                                ColTile, BatchTile, CheckBounds, is_usm,
+                                ComputeT>;
+
+    Functor functor{lhs, rhs, output, params};
+
+    cgh.parallel_for(
+        cl::sycl::range<3>{n_row_threads, n_col_threads, n_batch_threads},
+        functor);
+  });
+  return {event, StatusCode::OK};
+}
+
 }  // namespace internal
 }  // namespace matmul
 }  // namespace sycldnn
@@ -0,0 +1,39 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_MATMUL_TABLES_INTEL_CPU_H_
+#define PORTDNN_SRC_MATMUL_TABLES_INTEL_CPU_H_
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by gen_matmul_tile_table.py
+// from 0 benchmarked matrix multiplies.
+
+#include "src/matmul/tile_table.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+namespace intel_cpu {
+
+inline constexpr TileNode tile_nodes[] = {
+    {TileFeature::Leaf, 0, 0, 0, TileConfig::NotSet},
+};
+inline constexpr TileTable tile_table{tile_nodes, 1};
+
+}  // namespace intel_cpu
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // PORTDNN_SRC_MATMUL_TABLES_INTEL_CPU_H_
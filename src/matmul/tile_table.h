@@ -0,0 +1,168 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PORTDNN_SRC_MATMUL_TILE_TABLE_H_
+#define PORTDNN_SRC_MATMUL_TILE_TABLE_H_
+
+/**
+ * \file
+ * Contains the dispatch tables used to choose the tile configuration of the
+ * matmul kernels from tables generated from benchmark results.
+ */
+#include "portdnn/internal/matmul/split_k.h"
+#include "portdnn/matmul/params.h"
+
+#include <stddef.h>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * The tile configurations which are instantiated for the matmul kernels. The
+ * tile and work-group sizes of each are set in src/matmul/launch.cc.
+ */
+enum class TileConfig {
+  /** No configuration is chosen, so the default heuristics are used. */
+  NotSet,
+  /** 4x4x4 register tiles in 8x4x1 work-groups. */
+  Tiles444,
+  /** 1x8x4 register tiles in 1x64x1 work-groups, for very few rows. */
+  SkinnyRows,
+  /** 4x8x1 register tiles in 64x1x1 work-groups, for very few columns. */
+  SkinnyCols,
+  /** 2x4x4 register tiles in 4x8x2 work-groups, for small batched matrices. */
+  SmallBatched,
+  /** The local memory kernel, on devices with dedicated local memory. */
+  Local,
+};
+
+/** The matmul parameter compared against a threshold in a table node. */
+enum class TileFeature {
+  /** The node is a leaf, holding the chosen configuration. */
+  Leaf,
+  /** The number of rows in the output. */
+  M,
+  /** The size of the accumulation dimension. */
+  K,
+  /** The number of columns in the output. */
+  N,
+  /** The number of matrices in the batch. */
+  Batch,
+  /** One if the left hand matrix is transposed, otherwise zero. */
+  TransposeLHS,
+  /** One if the right hand matrix is transposed, otherwise zero. */
+  TransposeRHS,
+};
+
+/**
+ * A node in a tile table. Inner nodes branch to the child at index less_equal
+ * if the feature is less than or equal to the threshold, and to the child at
+ * index greater otherwise. Leaf nodes hold the configuration.
+ */
+struct TileNode {
+  /** The feature to compare, or TileFeature::Leaf. */
+  TileFeature feature;
+  /** The threshold to compare the feature against. */
+  int threshold;
+  /** Index of the child to use if the feature is at most the threshold. */
+  int less_equal;
+  /** Index of the child to use if the feature exceeds the threshold. */
+  int greater;
+  /** The configuration chosen at a leaf. */
+  TileConfig config;
+};
+
+/** A tile table stored as an array of nodes with the root at index 0. */
+struct TileTable {
+  /** Pointer to the nodes of the table. */
+  TileNode const* nodes;
+  /** The number of nodes in the table. */
+  size_t size;
+};
+
+/** Get the value of a tile feature for the given parameters. */
+inline int get_feature(TileFeature feature, MatmulParams const& params,
+                       bool transpose_lhs, bool transpose_rhs) {
+  switch (feature) {
+    case TileFeature::M:
+      return params.m;
+    case TileFeature::K:
+      return params.k;
+    case TileFeature::N:
+      return params.n;
+    case TileFeature::Batch:
+      return params.batches;
+    case TileFeature::TransposeLHS:
+      return transpose_lhs ? 1 : 0;
+    case TileFeature::TransposeRHS:
+      return transpose_rhs ? 1 : 0;
+    case TileFeature::Leaf:
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Walk the tile table for the given parameters.
+ * \return Returns the configuration at the reached leaf, or
+ *         TileConfig::NotSet if the table is empty or malformed.
+ */
+inline TileConfig evaluate(TileTable const& table, MatmulParams const& params,
+                           bool transpose_lhs, bool transpose_rhs) {
+  size_t index = 0;
+  // A well formed table reaches a leaf in fewer steps than it has nodes.
+  for (size_t step = 0; step < table.size && index < table.size; ++step) {
+    TileNode const& node = table.nodes[index];
+    if (node.feature == TileFeature::Leaf) {
+      return node.config;
+    }
+    bool const go_left =
+        get_feature(node.feature, params, transpose_lhs, transpose_rhs) <=
+        node.threshold;
+    index = static_cast<size_t>(go_left ? node.less_equal : node.greater);
+  }
+  return TileConfig::NotSet;
+}
+
+/**
+ * Choose a tile configuration for devices without a table, or for shapes
+ * where the table holds no data.
+ *
+ * Fully connected layers with a small batch have very few rows or columns,
+ * so most of a 4x4 tile would be wasted. The batched matrix multiplies in
+ * Winograd convolutions have many small matrices, so spreading work-groups
+ * over the batch keeps the device busy.
+ */
+inline TileConfig default_tile_config(MatmulParams const& params) {
+  if (params.m <= 2) {
+    return TileConfig::SkinnyRows;
+  }
+  if (params.n <= 2) {
+    return TileConfig::SkinnyCols;
+  }
+  if (params.batches >= 4 && params.m <= 64 && params.n <= 64) {
+    return TileConfig::SmallBatched;
+  }
+  if (params.m >= 32 && params.n >= 32) {
+    return TileConfig::Local;
+  }
+  return TileConfig::Tiles444;
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // PORTDNN_SRC_MATMUL_TILE_TABLE_H_
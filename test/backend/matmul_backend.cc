@@ -241,3 +241,20 @@ TYPED_TEST(Matmul, WithOneNTlhsTrhs) {
   std::vector<DataType> expected = {22, 28};
   this->template test_nonsquare_matmul<true, true>(lhs, rhs, expected, 2, 1, 3);
 }
+TYPED_TEST(Matmul, LongAccumulationSplitK) {
+  // The reduction dimension is long enough for the SNN matmul provider to
+  // split it across work-groups using an internally allocated workspace.
+  using DataType = typename TypeParam::SecondType;
+  int const m = 2;
+  int const n = 2;
+  int const k = 1024;
+  std::vector<DataType> lhs(m * k, DataType{1});
+  std::vector<DataType> rhs(k * n);
+  for (int i = 0; i < k; ++i) {
+    rhs[i * n] = DataType{1};
+    rhs[i * n + 1] = DataType{2};
+  }
+  std::vector<DataType> expected = {1024, 2048, 1024, 2048};
+  this->template test_nonsquare_matmul<false, false>(lhs, rhs, expected, m, n,
+                                                     k);
+}
@@ -20,6 +20,7 @@
 #include "portdnn/padding_mode.h"
 #include "test/gen/iota_initialised_data.h"
 
+#include <limits>
 #include <type_traits>
 
 using namespace sycldnn;
@@ -160,3 +161,48 @@ TEST(Conv2DWorskpaceSize, Im2colVGGLayer1Workspace) {
   auto constexpr filbk_tile_size = 224u * 224u;
   EXPECT_LE(32u * filbk_n_tiles * filbk_tile_size, filbk_workspace);
 }
+
+TEST(Conv2DWorskpaceSize, Im2colWithinLimit) {
+  SNNHandle handle;
+  SNNCreate(handle);
+  auto params = get_params(3, 1, 56, 64, 64, 8, sycldnn::PaddingMode::SAME);
+  TensorDescriptor xDesc, yDesc;
+  FilterDescriptor wDesc;
+  ConvolutionDescriptor convDesc;
+  snnParamsToDesc(xDesc, yDesc, wDesc, convDesc, params);
+  size_t full_workspace{};
+  auto full_algo = conv2d::Algorithm::Im2col;
+  ASSERT_EQ(StatusCode::OK,
+            getConvolutionForwardWorkspaceSize(
+                handle, xDesc, wDesc, convDesc, yDesc, &full_algo,
+                std::numeric_limits<size_t>::max(), &full_workspace));
+  EXPECT_EQ(conv2d::Algorithm::Im2col, full_algo);
+
+  // Half of the full workspace only fits a smaller minibatch.
+  size_t const limit = full_workspace / 2;
+  size_t limited_workspace{};
+  auto limited_algo = conv2d::Algorithm::Im2col;
+  ASSERT_EQ(StatusCode::OK, getConvolutionForwardWorkspaceSize(
+                                handle, xDesc, wDesc, convDesc, yDesc,
+                                &limited_algo, limit, &limited_workspace));
+  EXPECT_EQ(conv2d::Algorithm::Im2col, limited_algo);
+  EXPECT_LT(0u, limited_workspace);
+  EXPECT_GE(limit, limited_workspace);
+}
+
+TEST(Conv2DWorskpaceSize, Im2colFallsBackWithoutWorkspace) {
+  SNNHandle handle;
+  SNNCreate(handle);
+  auto params = get_params(3, 1, 56, 64, 64, 8, sycldnn::PaddingMode::SAME);
+  TensorDescriptor xDesc, yDesc;
+  FilterDescriptor wDesc;
+  ConvolutionDescriptor convDesc;
+  snnParamsToDesc(xDesc, yDesc, wDesc, convDesc, params);
+  size_t workspace{};
+  auto algo = conv2d::Algorithm::Im2col;
+  ASSERT_EQ(StatusCode::OK,
+            getConvolutionForwardWorkspaceSize(handle, xDesc, wDesc, convDesc,
+                                               yDesc, &algo, 0u, &workspace));
+  EXPECT_NE(conv2d::Algorithm::Im2col, algo);
+  EXPECT_EQ(0u, workspace);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/selector/autotune_cache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace {
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 16;
+  params.features = 32;
+  params.batch = 2;
+  params.in_rows = 28;
+  params.in_cols = 28;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.out_rows = 28 / stride;
+  params.out_cols = 28 / stride;
+  params.pad_rows = window / 2;
+  params.pad_cols = window / 2;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  return params;
+}
+
+std::string get_key(sycldnn::conv2d::Conv2DParams const& params) {
+  return sycldnn::conv2d::AutotuneCache::make_key(
+      "Some Vendor/Some Device/1.0",
+      sycldnn::conv2d::conv_type_name<sycldnn::conv2d::conv_type::Forward>(),
+      "float", params);
+}
+
+}  // namespace
+
+TEST(Conv2DAutotuneCache, KeyContainsNoWhitespace) {
+  auto key = get_key(get_params(3, 1));
+  EXPECT_EQ(std::string::npos, key.find(' '));
+}
+
+TEST(Conv2DAutotuneCache, DifferentParamsGiveDifferentKeys) {
+  EXPECT_NE(get_key(get_params(3, 1)), get_key(get_params(3, 2)));
+  EXPECT_NE(get_key(get_params(3, 1)), get_key(get_params(5, 1)));
+}
+
+TEST(Conv2DAutotuneCache, MissingEntryIsNotSupported) {
+  sycldnn::conv2d::AutotuneCache cache;
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            cache.lookup(get_key(get_params(3, 1))));
+}
+
+TEST(Conv2DAutotuneCache, SaveAndLoadRoundTrip) {
+  std::string path = "conv2d_autotune_cache_round_trip.txt";
+  auto key_3x3 = get_key(get_params(3, 1));
+  auto key_5x5 = get_key(get_params(5, 2));
+  {
+    sycldnn::conv2d::AutotuneCache cache;
+    cache.insert(key_3x3, sycldnn::conv2d::Algorithm::WinogradLarge);
+    cache.insert(key_5x5, sycldnn::conv2d::Algorithm::Im2col);
+    ASSERT_TRUE(cache.save(path));
+  }
+  sycldnn::conv2d::AutotuneCache loaded;
+  ASSERT_TRUE(loaded.load(path));
+  EXPECT_EQ(2u, loaded.size());
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::WinogradLarge, loaded.lookup(key_3x3));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Im2col, loaded.lookup(key_5x5));
+  std::remove(path.c_str());
+}
+
+TEST(Conv2DAutotuneCache, SaveReplacesExistingFile) {
+  std::string path = "conv2d_autotune_cache_replace.txt";
+  auto key_3x3 = get_key(get_params(3, 1));
+  auto key_5x5 = get_key(get_params(5, 2));
+  {
+    sycldnn::conv2d::AutotuneCache cache;
+    cache.insert(key_3x3, sycldnn::conv2d::Algorithm::WinogradLarge);
+    ASSERT_TRUE(cache.save(path));
+  }
+  {
+    sycldnn::conv2d::AutotuneCache cache;
+    cache.insert(key_5x5, sycldnn::conv2d::Algorithm::Im2col);
+    ASSERT_TRUE(cache.save(path));
+  }
+  sycldnn::conv2d::AutotuneCache loaded;
+  ASSERT_TRUE(loaded.load(path));
+  EXPECT_EQ(1u, loaded.size());
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported, loaded.lookup(key_3x3));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Im2col, loaded.lookup(key_5x5));
+  std::remove(path.c_str());
+}
+
+TEST(Conv2DAutotuneCache, SaveToMissingDirectoryFails) {
+  sycldnn::conv2d::AutotuneCache cache;
+  cache.insert(get_key(get_params(3, 1)), sycldnn::conv2d::Algorithm::Direct);
+  EXPECT_FALSE(cache.save("missing_autotune_dir/conv2d_autotune_cache.txt"));
+}
+
+TEST(Conv2DAutotuneCache, IgnoresFileWithDifferentVersion) {
+  std::string path = "conv2d_autotune_cache_old_version.txt";
+  auto key = get_key(get_params(3, 1));
+  {
+    std::ofstream file{path};
+    file << "portdnn-conv2d-autotune "
+         << sycldnn::conv2d::AutotuneCache::version + 1 << '\n'
+         << key << ' '
+         << static_cast<int>(sycldnn::conv2d::Algorithm::Direct) << '\n';
+  }
+  sycldnn::conv2d::AutotuneCache cache;
+  EXPECT_FALSE(cache.load(path));
+  EXPECT_EQ(0u, cache.size());
+  std::remove(path.c_str());
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/launch.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/selector/autotune_selector.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/test_backend_types.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+template <typename Backend>
+struct AutotuneSelectorFixture : public BackendTestFixture<Backend> {
+  using DataType = float;
+  using Selector = sycldnn::conv2d::AutotuneSelector<DataType, Backend>;
+
+ protected:
+  /** A 3x3 convolution with SAME padding, small enough to tune quickly. */
+  static sycldnn::conv2d::Conv2DParams get_params() {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 3;
+    params.features = 4;
+    params.batch = 2;
+    params.in_rows = 6;
+    params.in_cols = 6;
+    params.window_rows = 3;
+    params.window_cols = 3;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 6;
+    params.out_cols = 6;
+    params.pad_rows = 1;
+    params.pad_cols = 1;
+    params.dilation_rows = 1;
+    params.dilation_cols = 1;
+    return params;
+  }
+
+  /**
+   * Run a forward convolution using the given selector and check the output
+   * against a naive convolution computed on the host.
+   */
+  void check_forward(sycldnn::conv2d::Conv2DParams const& params,
+                     sycldnn::conv2d::Selector& selector) {
+    using ConvType = sycldnn::conv2d::conv_type::Forward;
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+
+    std::vector<DataType> input(sizes.input_size);
+    std::vector<DataType> filter(sizes.filter_size);
+    std::vector<DataType> output(sizes.output_size, 0);
+    for (size_t i = 0; i < input.size(); ++i) {
+      input[i] = static_cast<DataType>(i % 5) - 2;
+    }
+    for (size_t i = 0; i < filter.size(); ++i) {
+      filter[i] = static_cast<DataType>(i % 3) - 1;
+    }
+
+    std::vector<DataType> expected(sizes.output_size, 0);
+    for (int b = 0; b < params.batch; ++b) {
+      for (int row = 0; row < params.out_rows; ++row) {
+        for (int col = 0; col < params.out_cols; ++col) {
+          for (int f = 0; f < params.features; ++f) {
+            DataType sum = 0;
+            for (int w_row = 0; w_row < params.window_rows; ++w_row) {
+              for (int w_col = 0; w_col < params.window_cols; ++w_col) {
+                int const in_row = row + w_row - params.pad_rows;
+                int const in_col = col + w_col - params.pad_cols;
+                if (in_row < 0 || in_row >= params.in_rows || in_col < 0 ||
+                    in_col >= params.in_cols) {
+                  continue;
+                }
+                for (int c = 0; c < params.channels; ++c) {
+                  int const in_idx =
+                      ((b * params.in_rows + in_row) * params.in_cols +
+                       in_col) *
+                          params.channels +
+                      c;
+                  int const fil_idx =
+                      ((w_row * params.window_cols + w_col) * params.channels +
+                       c) *
+                          params.features +
+                      f;
+                  sum += input[in_idx] * filter[fil_idx];
+                }
+              }
+            }
+            int const out_idx =
+                ((b * params.out_rows + row) * params.out_cols + col) *
+                    params.features +
+                f;
+            expected[out_idx] = sum;
+          }
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+
+    auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    auto workspace_gpu =
+        backend.template allocate<DataType>(workspace_size.recommended_size);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, fil_gpu, out_gpu, params, selector, backend, workspace_gpu,
+        workspace_size.recommended_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL_EPS(expected[i], output[i], 10u, 1e-4f);
+    }
+  }
+};
+
+template <typename Backend>
+using AutotuneSelectorTest = AutotuneSelectorFixture<Backend>;
+
+TYPED_TEST_SUITE(AutotuneSelectorTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+TYPED_TEST(AutotuneSelectorTest, SelectedAlgorithmGivesCorrectOutput) {
+  using Selector = typename TestFixture::Selector;
+  auto params = this->get_params();
+  Selector selector{this->provider_.get_backend()};
+
+  auto algo = selector.select_forward(params);
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported, algo);
+  EXPECT_EQ(1u, selector.n_tuned());
+  this->check_forward(params, selector);
+}
+
+TYPED_TEST(AutotuneSelectorTest, SecondSelectionUsesCache) {
+  using Selector = typename TestFixture::Selector;
+  auto params = this->get_params();
+  Selector selector{this->provider_.get_backend()};
+
+  auto algo = selector.select_forward(params);
+  ASSERT_EQ(1u, selector.n_tuned());
+  EXPECT_EQ(1u, selector.cache().size());
+
+  EXPECT_EQ(algo, selector.select_forward(params));
+  EXPECT_EQ(1u, selector.n_tuned());
+}
+
+TYPED_TEST(AutotuneSelectorTest, ReloadedCacheGivesSameSelection) {
+  using Selector = typename TestFixture::Selector;
+  std::string path = "conv2d_autotune_selector_reload.txt";
+  std::remove(path.c_str());
+  SNN_ON_SCOPE_EXIT { std::remove(path.c_str()); };
+  auto params = this->get_params();
+
+  sycldnn::conv2d::Algorithm algo;
+  {
+    Selector selector{this->provider_.get_backend(), path};
+    algo = selector.select_forward(params);
+    ASSERT_EQ(1u, selector.n_tuned());
+  }
+  Selector reloaded{this->provider_.get_backend(), path};
+  EXPECT_EQ(1u, reloaded.cache().size());
+  EXPECT_EQ(algo, reloaded.select_forward(params));
+  EXPECT_EQ(0u, reloaded.n_tuned());
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+
+#include "src/conv2d/selector/decision_tree.h"
+
+namespace {
+
+using sycldnn::conv2d::Algorithm;
+using sycldnn::conv2d::internal::DecisionFeature;
+using sycldnn::conv2d::internal::DecisionNode;
+using sycldnn::conv2d::internal::DecisionTree;
+
+sycldnn::conv2d::Conv2DParams get_params(int channels, int window,
+                                         int stride) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = channels;
+  params.features = 32;
+  params.batch = 1;
+  params.in_rows = 28;
+  params.in_cols = 28;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.out_rows = 28 / stride;
+  params.out_cols = 28 / stride;
+  params.pad_rows = window / 2;
+  params.pad_cols = window / 2;
+  return params;
+}
+
+// Matmul for 1x1 windows, otherwise Direct for few channels and WinogradLarge
+// for many channels.
+constexpr DecisionNode nodes[] = {
+    {DecisionFeature::WindowRows, 1, 1, 2, Algorithm::NotSupported},
+    {DecisionFeature::Leaf, 0, 0, 0, Algorithm::Matmul},
+    {DecisionFeature::Channels, 16, 3, 4, Algorithm::NotSupported},
+    {DecisionFeature::Leaf, 0, 0, 0, Algorithm::Direct},
+    {DecisionFeature::Leaf, 0, 0, 0, Algorithm::WinogradLarge},
+};
+constexpr DecisionTree tree{nodes, 5};
+
+}  // namespace
+
+TEST(Conv2DDecisionTree, FollowsBranchesToLeaves) {
+  EXPECT_EQ(Algorithm::Matmul,
+            sycldnn::conv2d::internal::evaluate(tree, get_params(64, 1, 1)));
+  EXPECT_EQ(Algorithm::Direct,
+            sycldnn::conv2d::internal::evaluate(tree, get_params(16, 3, 1)));
+  EXPECT_EQ(Algorithm::WinogradLarge,
+            sycldnn::conv2d::internal::evaluate(tree, get_params(17, 3, 1)));
+}
+
+TEST(Conv2DDecisionTree, SplitsOnDilation) {
+  static constexpr DecisionNode dilation_nodes[] = {
+      {DecisionFeature::DilationRows, 1, 1, 2, Algorithm::NotSupported},
+      {DecisionFeature::Leaf, 0, 0, 0, Algorithm::Winograd},
+      {DecisionFeature::Leaf, 0, 0, 0, Algorithm::Direct},
+  };
+  constexpr DecisionTree dilation_tree{dilation_nodes, 3};
+  EXPECT_EQ(Algorithm::Winograd, sycldnn::conv2d::internal::evaluate(
+                                     dilation_tree, get_params(64, 3, 1)));
+  auto dilated = get_params(64, 3, 1);
+  dilated.dilation_rows = 2;
+  EXPECT_EQ(Algorithm::Direct,
+            sycldnn::conv2d::internal::evaluate(dilation_tree, dilated));
+}
+
+TEST(Conv2DDecisionTree, MalformedTreeIsNotSupported) {
+  static constexpr DecisionNode cycle[] = {
+      {DecisionFeature::Channels, 16, 0, 0, Algorithm::NotSupported},
+  };
+  constexpr DecisionTree cyclic_tree{cycle, 1};
+  EXPECT_EQ(Algorithm::NotSupported, sycldnn::conv2d::internal::evaluate(
+                                         cyclic_tree, get_params(16, 3, 1)));
+  static constexpr DecisionNode out_of_range[] = {
+      {DecisionFeature::Channels, 16, 3, 3, Algorithm::NotSupported},
+  };
+  constexpr DecisionTree bad_index_tree{out_of_range, 1};
+  EXPECT_EQ(Algorithm::NotSupported,
+            sycldnn::conv2d::internal::evaluate(bad_index_tree,
+                                                get_params(16, 3, 1)));
+}
+
+TEST(Conv2DDecisionTree, ChecksAlgorithmSupport) {
+  using Forward = sycldnn::conv2d::conv_type::Forward;
+  using sycldnn::conv2d::internal::algorithm_supports;
+  EXPECT_TRUE(algorithm_supports<Forward>(Algorithm::WinogradLarge,
+                                          get_params(64, 3, 1)));
+  EXPECT_FALSE(algorithm_supports<Forward>(Algorithm::WinogradLarge,
+                                           get_params(64, 3, 2)));
+  EXPECT_FALSE(
+      algorithm_supports<Forward>(Algorithm::Matmul, get_params(64, 3, 1)));
+  EXPECT_FALSE(algorithm_supports<Forward>(Algorithm::NotSupported,
+                                           get_params(64, 1, 1)));
+
+  auto grouped = get_params(64, 3, 1);
+  grouped.groups = 2;
+  EXPECT_FALSE(algorithm_supports<Forward>(Algorithm::Direct, grouped));
+  EXPECT_TRUE(algorithm_supports<Forward>(Algorithm::Im2col, grouped));
+
+  auto dilated = get_params(64, 3, 1);
+  dilated.dilation_rows = 2;
+  dilated.dilation_cols = 2;
+  EXPECT_TRUE(algorithm_supports<Forward>(Algorithm::Direct, dilated));
+  EXPECT_TRUE(algorithm_supports<Forward>(Algorithm::Tiled, dilated));
+  EXPECT_FALSE(algorithm_supports<Forward>(Algorithm::Winograd, dilated));
+}
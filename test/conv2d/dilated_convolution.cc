@@ -0,0 +1,189 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/params.h"
+
+#include "portdnn/helpers/padding.h"
+
+#include "test/conv2d/convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_tuple4.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Tuple>
+using DilatedConvolutionTest = ConvolutionFixture<Tuple>;
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::DefaultBackendTypes;
+using DataFormats = sycldnn::types::DataFormatTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using DataFormatBackendTypePairs =
+    sycldnn::types::CartesianProduct<BackendTypePairs, DataFormats>::type;
+using TestTuple4 =
+    sycldnn::types::NestedPairsToTuple4<DataFormatBackendTypePairs>::type;
+
+using GTestTypeTuple4s = sycldnn::types::ToGTestTypes<TestTuple4>::type;
+TYPED_TEST_SUITE(DilatedConvolutionTest, GTestTypeTuple4s);
+
+/**
+ * Get the parameters for a square 3x3 convolution with dilation 2, so that
+ * the window spans 5x5 elements of the input.
+ */
+sycldnn::conv2d::Conv2DParams get_dilated_params(int size, int channels,
+                                                 int features, int stride,
+                                                 sycldnn::PaddingMode padding) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = channels;
+  params.features = features;
+  params.batch = 1;
+  params.in_rows = size;
+  params.in_cols = size;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  return sycldnn::helpers::add_padding_to(params, padding);
+}
+// The expected values are computed by a naive dilated convolution, with the
+// input and filter tensors set to `1, 2, 3,...` as in the fixture.
+TYPED_TEST(DilatedConvolutionTest, ForwardStride1Valid7x7x2x2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {15087., 15690., 15735., 16374., 16383., 17058.,
+                               19623., 20478., 20271., 21162., 20919., 21846.,
+                               24159., 25266., 24807., 25950., 25455., 26634.};
+  auto params = get_dilated_params(7, 2, 2, 1, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(DilatedConvolutionTest, ForwardStride1Same7x7x1x1) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {296., 324., 461., 500., 539., 332., 356., 492.,
+                               520., 734., 773., 812., 500., 524., 699., 732.,
+                               1029., 1074., 1119., 684., 711., 930., 963.,
+                               1344., 1389., 1434., 873., 900., 1161., 1194.,
+                               1659., 1704., 1749., 1062., 1089., 524., 540.,
+                               722., 743., 764., 440., 452., 636., 652., 869.,
+                               890., 911., 524., 536.};
+  auto params = get_dilated_params(7, 1, 1, 1, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(DilatedConvolutionTest, ForwardStride2Same9x9x1x2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {684., 728., 1042., 1114., 1186., 1270., 1330.,
+                               1426., 860., 928., 1638., 1758., 2373., 2562.,
+                               2535., 2742., 2697., 2922., 1686., 1842., 2718.,
+                               2946., 3831., 4182., 3993., 4362., 4155., 4542.,
+                               2550., 2814., 3798., 4134., 5289., 5802., 5451.,
+                               5982., 5613., 6162., 3414., 3786., 1932., 2192.,
+                               2554., 2950., 2626., 3034., 2698., 3118., 1532.,
+                               1816.};
+  auto params = get_dilated_params(9, 1, 2, 2, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(DilatedConvolutionTest, InputBackpropStride1Valid7x7x2x2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {5., 11., 11., 25., 34., 62., 39., 53., 90., 118.,
+                               67., 81., 105., 127., 23., 53., 29., 67., 118.,
+                               194., 105., 143., 270., 346., 181., 219., 219.,
+                               265., 82., 142., 142., 218., 404., 556., 294.,
+                               370., 708., 860., 446., 522., 570., 662., 203.,
+                               233., 257., 295., 574., 650., 333., 371., 726.,
+                               802., 409., 447., 495., 541., 442., 502., 598.,
+                               674., 1316., 1468., 750., 826., 1620., 1772.,
+                               902., 978., 1122., 1214., 383., 413., 485., 523.,
+                               1030., 1106., 561., 599., 1182., 1258., 637.,
+                               675., 771., 817., 689., 743., 791., 853., 1690.,
+                               1814., 915., 977., 1938., 2062., 1039., 1101.,
+                               1173., 1243.};
+  auto params = get_dilated_params(7, 2, 2, 1, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(DilatedConvolutionTest, InputBackpropStride1Same7x7x1x1) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {64., 76., 139., 160., 181., 148., 164., 148.,
+                               160., 286., 307., 328., 260., 276., 261., 288.,
+                               501., 546., 591., 456., 489., 450., 477., 816.,
+                               861., 906., 687., 720., 639., 666., 1131., 1176.,
+                               1221., 918., 951., 676., 700., 1138., 1177.,
+                               1216., 880., 908., 844., 868., 1411., 1450.,
+                               1489., 1076., 1104.};
+  auto params = get_dilated_params(7, 1, 1, 1, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(DilatedConvolutionTest, InputBackpropStride2Same9x9x1x2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {204., 0., 454., 0., 610., 0., 766., 0., 684., 0.,
+                               0., 0., 0., 0., 0., 0., 0., 0., 786., 0., 1545.,
+                               0., 1887., 0., 2229., 0., 1842., 0., 0., 0., 0.,
+                               0., 0., 0., 0., 0., 1806., 0., 3255., 0., 3597.,
+                               0., 3939., 0., 3102., 0., 0., 0., 0., 0., 0., 0.,
+                               0., 0., 2826., 0., 4965., 0., 5307., 0., 5649.,
+                               0., 4362., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+                               3324., 0., 5566., 0., 5866., 0., 6166., 0.,
+                               4572.};
+  auto params = get_dilated_params(9, 1, 2, 2, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(DilatedConvolutionTest, FilterBackpropStride1Valid7x7x2x2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {1905., 2058., 1986., 2148., 2229., 2418., 2310.,
+                               2508., 2553., 2778., 2634., 2868., 4173., 4578.,
+                               4254., 4668., 4497., 4938., 4578., 5028., 4821.,
+                               5298., 4902., 5388., 6441., 7098., 6522., 7188.,
+                               6765., 7458., 6846., 7548., 7089., 7818., 7170.,
+                               7908.};
+  auto params = get_dilated_params(7, 2, 2, 1, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(DilatedConvolutionTest, FilterBackpropStride1Same7x7x1x1) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {16525., 23730., 17225., 28770., 40425., 28770.,
+                               17225., 23730., 16525.};
+  auto params = get_dilated_params(7, 1, 1, 1, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(DilatedConvolutionTest, FilterBackpropStride2Same9x9x1x2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {19056., 19552., 23860., 24500., 18992., 19520.,
+                               28100., 28900., 34825., 35850., 27460., 28300.,
+                               20144., 20928., 24660., 25660., 19184., 20000.};
+  auto params = get_dilated_params(9, 1, 2, 2, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
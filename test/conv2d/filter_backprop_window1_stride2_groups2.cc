@@ -0,0 +1,1160 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow1Stride2Groups2 =
+    GroupWindowStrideTest<Triple, 1, 2, 2>;
+TYPED_TEST_SUITE(FilterBackpropWindow1Stride2Groups2, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x3x3x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 3, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x3x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 3, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x3x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x3x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 3, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x3x4x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 4, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x4x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 4, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x3x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x4x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 4, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 3, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x3x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 3, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 3, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x3x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 3, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 24.};
+  const std::array<int, 4> in_shape = {{1, 3, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x3x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 3, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x4x3x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 3, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x3x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 3, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x4x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x3x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 3, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x4x4x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x4x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x4x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x4x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x4x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x4x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x4x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x6x3x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 3, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x3x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 3, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x6x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x3x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 3, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x6x4x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x4x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x6x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x4x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 12., 6., 12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x6x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {9., 18., 9., 18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {9., 18., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED1x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {9., 18., 9., 18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {9., 36.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED1x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {9., 18., 9., 18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x3x3x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 3, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x3x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 3, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x3x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x3x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 3, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x3x4x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 4, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x4x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 4, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x3x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x4x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 4, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 3, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x3x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 3, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 3, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x3x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 3, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 72.};
+  const std::array<int, 4> in_shape = {{3, 3, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x3x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 3, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x4x3x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 3, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x3x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 3, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x4x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x3x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 3, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x4x4x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x4x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x4x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x4x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 24., 12., 24.,
+                                         24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x4x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x4x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x4x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x6x3x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 3, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x3x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 3, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x6x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x3x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 3, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x3x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 3, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x6x4x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x4x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x6x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x4x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x4x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 36., 18., 36.,
+                                         36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x6x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {27., 54.,  27., 54.,
+                                         54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {27., 54., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, VALIDHWCFSTRIDED3x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {27., 54.,  27., 54.,
+                                         54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {27., 108.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow1Stride2Groups2, SAMEHWCFSTRIDED3x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {27., 54.,  27., 54.,
+                                         54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
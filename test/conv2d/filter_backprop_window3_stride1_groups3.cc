@@ -0,0 +1,1703 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow3Stride1Groups3 =
+    GroupWindowStrideTest<Triple, 3, 1, 3>;
+TYPED_TEST_SUITE(FilterBackpropWindow3Stride1Groups3, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 15., 30., 12., 24., 18., 36., 18., 36., 18., 36., 15., 30.,
+      12., 24., 15., 30., 16., 32., 20., 40., 16., 32., 24., 48., 24., 48.,
+      24., 48., 20., 40., 16., 32., 20., 40., 12., 24., 15., 30., 12., 24.,
+      18., 36., 18., 36., 18., 36., 15., 30., 12., 24., 15., 30.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x4x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 18., 18., 30., 30., 30., 18., 18., 18., 24., 24., 24., 40., 40.,
+      40., 24., 24., 24., 18., 18., 18., 30., 30., 30., 18., 18., 18.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 22., 44., 23., 46., 22., 44., 18., 36.,
+      18., 36., 18., 36., 24., 48., 24., 48., 24., 48., 30., 60., 30., 60.,
+      30., 60., 24., 48., 24., 48., 24., 48., 18., 36., 18., 36., 18., 36.,
+      23., 46., 22., 44., 23., 46., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x5x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 32., 32., 32., 50., 50.,
+      50., 32., 32., 32., 30., 30., 30., 30., 30., 30., 30., 30., 30.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 15., 30.,
+      15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 20., 40., 20., 40., 20., 40., 40., 80.,
+      40., 80., 40., 80., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      21., 42., 24., 48., 21., 42., 27., 54., 27., 54., 27., 54., 24., 48.,
+      21., 42., 24., 48., 28., 56., 32., 64., 28., 56., 36., 72., 36., 72.,
+      36., 72., 32., 64., 28., 56., 32., 64., 21., 42., 24., 48., 21., 42.,
+      27., 54., 27., 54., 27., 54., 24., 48., 21., 42., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 30., 30., 45., 45., 45., 30., 30., 30., 40., 40., 40., 60., 60.,
+      60., 40., 40., 40., 30., 30., 30., 45., 45., 45., 30., 30., 30.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 15., 30., 15., 30.,
+      15., 30., 30., 60., 30., 60., 30., 60., 20., 40., 20., 40., 20., 40.,
+      40., 80., 40., 80., 40., 80., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 20., 40., 20., 40., 20., 40., 40., 80., 40., 80.,
+      40., 80., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 15., 30.,
+      15., 30., 15., 30., 30., 60., 30., 60., 30., 60.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 20., 40., 16., 32., 24., 48., 24., 48., 24., 48., 20., 40.,
+      16., 32., 20., 40., 20., 40., 25., 50., 20., 40., 30., 60., 30., 60.,
+      30., 60., 25., 50., 20., 40., 25., 50., 16., 32., 20., 40., 16., 32.,
+      24., 48., 24., 48., 24., 48., 20., 40., 16., 32., 20., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x4x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 24., 24., 40., 40., 40., 24., 24., 24., 30., 30., 30., 50., 50.,
+      50., 30., 30., 30., 24., 24., 24., 40., 40., 40., 24., 24., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 15., 30., 15., 30., 15., 30.,
+      30., 60., 30., 60., 30., 60., 20., 40., 20., 40., 20., 40., 40., 80.,
+      40., 80., 40., 80., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60.,
+      30., 60., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28.,
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 30., 60., 30., 60., 30., 60., 24., 48.,
+      24., 48., 24., 48., 30., 60., 30., 60., 30., 60., 37., 74., 38., 76.,
+      37., 74., 30., 60., 30., 60., 30., 60., 24., 48., 24., 48., 24., 48.,
+      30., 60., 30., 60., 30., 60., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x5x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 61., 64.,
+      61., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32.,  16., 32.,  16., 32., 32., 64., 32., 64., 32., 64., 20., 40.,
+      20., 40.,  20., 40.,  40., 80., 40., 80., 40., 80., 16., 32., 16., 32.,
+      16., 32.,  32., 64.,  32., 64., 32., 64., 20., 40., 20., 40., 20., 40.,
+      40., 80.,  40., 80.,  40., 80., 25., 50., 25., 50., 25., 50., 50., 100.,
+      50., 100., 50., 100., 20., 40., 20., 40., 20., 40., 40., 80., 40., 80.,
+      40., 80.,  16., 32.,  16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      20., 40.,  20., 40.,  20., 40., 40., 80., 40., 80., 40., 80., 16., 32.,
+      16., 32.,  16., 32.,  32., 64., 32., 64., 32., 64.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      28., 56., 32., 64., 28., 56., 36., 72., 36., 72., 36., 72., 32., 64.,
+      28., 56., 32., 64., 35., 70., 40., 80., 35., 70., 45., 90., 45., 90.,
+      45., 90., 40., 80., 35., 70., 40., 80., 28., 56., 32., 64., 28., 56.,
+      36., 72., 36., 72., 36., 72., 32., 64., 28., 56., 32., 64.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 40., 40., 40., 50., 50., 50., 75., 75.,
+      75., 50., 50., 50., 40., 40., 40., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 40.,  20., 40.,  20., 40.,  40., 80., 40., 80., 40., 80.,  24., 48.,
+      24., 48.,  24., 48.,  48., 96.,  48., 96., 48., 96., 20., 40.,  20., 40.,
+      20., 40.,  40., 80.,  40., 80.,  40., 80., 25., 50., 25., 50.,  25., 50.,
+      50., 100., 50., 100., 50., 100., 30., 60., 30., 60., 30., 60.,  60., 120.,
+      60., 120., 60., 120., 25., 50.,  25., 50., 25., 50., 50., 100., 50., 100.,
+      50., 100., 20., 40.,  20., 40.,  20., 40., 40., 80., 40., 80.,  40., 80.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96., 48., 96., 48., 96.,  20., 40.,
+      20., 40.,  20., 40.,  40., 80.,  40., 80., 40., 80.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 40., 25., 50., 20., 40., 30., 60., 30., 60., 30., 60., 25., 50.,
+      20., 40., 25., 50., 24., 48., 30., 60., 24., 48., 36., 72., 36., 72.,
+      36., 72., 30., 60., 24., 48., 30., 60., 20., 40., 25., 50., 20., 40.,
+      30., 60., 30., 60., 30., 60., 25., 50., 20., 40., 25., 50.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x4x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 30., 30., 50., 50., 50., 30., 30., 30., 36., 36., 36., 60., 60.,
+      60., 36., 36., 36., 30., 30., 30., 50., 50., 50., 30., 30., 30.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 20., 40.,
+      20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 15., 30., 15., 30.,
+      15., 30., 30., 60., 30., 60., 30., 60., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60.,
+      20., 40., 20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 15., 30.,
+      15., 30., 15., 30., 30., 60., 30., 60., 30., 60.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60., 30., 60., 30., 60., 37., 74., 38., 76., 37., 74., 30., 60.,
+      30., 60., 30., 60., 36., 72., 36., 72., 36., 72., 45., 90., 45., 90.,
+      45., 90., 36., 72., 36., 72., 36., 72., 30., 60., 30., 60., 30., 60.,
+      38., 76., 37., 74., 38., 76., 30., 60., 30., 60., 30., 60.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x5x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      50., 50., 50., 50., 50., 50., 50., 50., 50., 48., 48., 48., 75., 75.,
+      75., 48., 48., 48., 50., 50., 50., 50., 50., 50., 50., 50., 50.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35., 70.,  40., 80., 35., 70., 45., 90., 45., 90., 45., 90.,  40., 80.,
+      35., 70.,  40., 80., 42., 84., 48., 96., 42., 84., 54., 108., 54., 108.,
+      54., 108., 48., 96., 42., 84., 48., 96., 35., 70., 40., 80.,  35., 70.,
+      45., 90.,  45., 90., 45., 90., 40., 80., 35., 70., 40., 80.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      50., 50., 50., 75., 75., 75., 50., 50., 50., 60., 60., 60., 90., 90.,
+      90., 60., 60., 60., 50., 50., 50., 75., 75., 75., 50., 50., 50.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36.,  72.,  45.,  90.,  36., 72.,  54., 108., 54., 108., 54.,
+      108., 45.,  90.,  36.,  72., 45.,  90., 48.,  96., 60.,  120.,
+      48.,  96.,  72.,  144., 72., 144., 72., 144., 60., 120., 48.,
+      96.,  60.,  120., 36.,  72., 45.,  90., 36.,  72., 54.,  108.,
+      54.,  108., 54.,  108., 45., 90.,  36., 72.,  45., 90.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x4x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54.,  54., 54., 90., 90., 90., 54., 54., 54., 72., 72., 72., 120., 120.,
+      120., 72., 72., 72., 54., 54., 54., 90., 90., 90., 54., 54., 54.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54.,  108., 54.,  108., 54.,  108., 66.,  132., 69.,  138., 66.,
+      132., 54.,  108., 54.,  108., 54.,  108., 72.,  144., 72.,  144.,
+      72.,  144., 90.,  180., 90.,  180., 90.,  180., 72.,  144., 72.,
+      144., 72.,  144., 54.,  108., 54.,  108., 54.,  108., 69.,  138.,
+      66.,  132., 69.,  138., 54.,  108., 54.,  108., 54.,  108.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x5x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90., 90., 90., 90., 90., 90., 90., 90., 96., 96., 96., 150., 150.,
+      150., 96., 96., 96., 90., 90., 90., 90., 90., 90., 90., 90., 90.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      63.,  126., 72.,  144., 63.,  126., 81.,  162., 81.,  162., 81.,
+      162., 72.,  144., 63.,  126., 72.,  144., 84.,  168., 96.,  192.,
+      84.,  168., 108., 216., 108., 216., 108., 216., 96.,  192., 84.,
+      168., 96.,  192., 63.,  126., 72.,  144., 63.,  126., 81.,  162.,
+      81.,  162., 81.,  162., 72.,  144., 63.,  126., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  135., 135., 135., 90.,  90.,  90.,
+      120., 120., 120., 180., 180., 180., 120., 120., 120.,
+      90.,  90.,  90.,  135., 135., 135., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      54., 108., 54., 108., 54., 108., 108., 216., 108., 216., 108., 216.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      72., 144., 72., 144., 72., 144., 144., 288., 144., 288., 144., 288.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      54., 108., 54., 108., 54., 108., 108., 216., 108., 216., 108., 216.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48.,  96.,  60.,  120., 48., 96.,  72.,  144., 72.,  144., 72.,
+      144., 60.,  120., 48.,  96., 60.,  120., 60.,  120., 75.,  150.,
+      60.,  120., 90.,  180., 90., 180., 90.,  180., 75.,  150., 60.,
+      120., 75.,  150., 48.,  96., 60.,  120., 48.,  96.,  72.,  144.,
+      72.,  144., 72.,  144., 60., 120., 48.,  96.,  60.,  120.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x4x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72., 72., 72., 120., 120., 120., 72., 72., 72.,
+      90., 90., 90., 150., 150., 150., 90., 90., 90.,
+      72., 72., 72., 120., 120., 120., 72., 72., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82.,
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72.,  144., 72.,  144., 72.,  144., 90.,  180., 90.,  180., 90.,
+      180., 72.,  144., 72.,  144., 72.,  144., 90.,  180., 90.,  180.,
+      90.,  180., 112., 224., 113., 226., 112., 224., 90.,  180., 90.,
+      180., 90.,  180., 72.,  144., 72.,  144., 72.,  144., 90.,  180.,
+      90.,  180., 90.,  180., 72.,  144., 72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x5x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      120., 120., 120., 186., 189., 186., 120., 120., 120.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      75., 150., 75., 150., 75., 150., 150., 300., 150., 300., 150., 300.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      84.,  168., 96.,  192., 84.,  168., 108., 216., 108., 216., 108.,
+      216., 96.,  192., 84.,  168., 96.,  192., 105., 210., 120., 240.,
+      105., 210., 135., 270., 135., 270., 135., 270., 120., 240., 105.,
+      210., 120., 240., 84.,  168., 96.,  192., 84.,  168., 108., 216.,
+      108., 216., 108., 216., 96.,  192., 84.,  168., 96.,  192.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      120., 120., 120., 180., 180., 180., 120., 120., 120.,
+      150., 150., 150., 225., 225., 225., 150., 150., 150.,
+      120., 120., 120., 180., 180., 180., 120., 120., 120.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      72., 144., 72., 144., 72., 144., 144., 288., 144., 288., 144., 288.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      75., 150., 75., 150., 75., 150., 150., 300., 150., 300., 150., 300.,
+      90., 180., 90., 180., 90., 180., 180., 360., 180., 360., 180., 360.,
+      75., 150., 75., 150., 75., 150., 150., 300., 150., 300., 150., 300.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      72., 144., 72., 144., 72., 144., 144., 288., 144., 288., 144., 288.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60.,  120., 75.,  150., 60.,  120., 90.,  180., 90.,  180., 90.,
+      180., 75.,  150., 60.,  120., 75.,  150., 72.,  144., 90.,  180.,
+      72.,  144., 108., 216., 108., 216., 108., 216., 90.,  180., 72.,
+      144., 90.,  180., 60.,  120., 75.,  150., 60.,  120., 90.,  180.,
+      90.,  180., 90.,  180., 75.,  150., 60.,  120., 75.,  150.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x4x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  150., 150., 150., 90.,  90.,  90.,
+      108., 108., 108., 180., 180., 180., 108., 108., 108.,
+      90.,  90.,  90.,  150., 150., 150., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x4x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      54., 108., 54., 108., 54., 108., 108., 216., 108., 216., 108., 216.,
+      72., 144., 72., 144., 72., 144., 144., 288., 144., 288., 144., 288.,
+      54., 108., 54., 108., 54., 108., 108., 216., 108., 216., 108., 216.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      45., 90.,  45., 90.,  45., 90.,  90.,  180., 90.,  180., 90.,  180.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 111., 222., 114., 228., 111.,
+      222., 90.,  180., 90.,  180., 90.,  180., 108., 216., 108., 216.,
+      108., 216., 135., 270., 135., 270., 135., 270., 108., 216., 108.,
+      216., 108., 216., 90.,  180., 90.,  180., 90.,  180., 114., 228.,
+      111., 222., 114., 228., 90.,  180., 90.,  180., 90.,  180.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x5x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      144., 144., 144., 225., 225., 225., 144., 144., 144.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x5x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      75., 150., 75., 150., 75., 150., 150., 300., 150., 300., 150., 300.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      72., 144., 72., 144., 72., 144., 144., 288., 144., 288., 144., 288.,
+      90., 180., 90., 180., 90., 180., 180., 360., 180., 360., 180., 360.,
+      72., 144., 72., 144., 72., 144., 144., 288., 144., 288., 144., 288.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.,
+      75., 150., 75., 150., 75., 150., 150., 300., 150., 300., 150., 300.,
+      60., 120., 60., 120., 60., 120., 120., 240., 120., 240., 120., 240.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 210., 120., 240., 105., 210., 135., 270., 135., 270., 135.,
+      270., 120., 240., 105., 210., 120., 240., 126., 252., 144., 288.,
+      126., 252., 162., 324., 162., 324., 162., 324., 144., 288., 126.,
+      252., 144., 288., 105., 210., 120., 240., 105., 210., 135., 270.,
+      135., 270., 135., 270., 120., 240., 105., 210., 120., 240.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      150., 150., 150., 225., 225., 225., 150., 150., 150.,
+      180., 180., 180., 270., 270., 270., 180., 180., 180.,
+      150., 150., 150., 225., 225., 225., 150., 150., 150.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
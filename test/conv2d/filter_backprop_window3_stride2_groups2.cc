@@ -0,0 +1,1504 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow3Stride2Groups2 =
+    GroupWindowStrideTest<Triple, 3, 2, 2>;
+TYPED_TEST_SUITE(FilterBackpropWindow3Stride2Groups2, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  8.,  16., 6., 12., 12., 24., 4., 8.,  8.,  16.,
+      6., 12., 12., 24., 9., 18., 18., 36., 6., 12., 12., 24.,
+      4., 8.,  8.,  16., 6., 12., 12., 24., 4., 8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x5x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {4., 16., 6., 24., 4., 16.,
+                                         6., 24., 9., 36., 6., 24.,
+                                         4., 16., 6., 24., 4., 16.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 9.,  18., 9., 18., 18., 36., 18., 36., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6., 12., 12., 24., 6., 12., 12., 24., 4., 8.,  8.,  16.,
+      9., 18., 18., 36., 9., 18., 18., 36., 6., 12., 12., 24.,
+      6., 12., 12., 24., 6., 12., 12., 24., 4., 8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 24., 6., 24., 4., 16.,
+                                         9., 36., 9., 36., 6., 24.,
+                                         6., 24., 6., 24., 4., 16.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 4.,  8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 16., 32., 8.,  16., 16., 32., 6., 12., 12., 24.,
+      12., 24., 24., 48., 12., 24., 24., 48., 9., 18., 18., 36.,
+      8.,  16., 16., 32., 8.,  16., 16., 32., 6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x8x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {8.,  32., 8.,  32., 6., 24.,
+                                         12., 48., 12., 48., 9., 36.,
+                                         8.,  32., 8.,  32., 6., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6., 12., 12., 24., 9., 18., 18., 36., 6., 12., 12., 24.,
+      6., 12., 12., 24., 9., 18., 18., 36., 6., 12., 12., 24.,
+      4., 8.,  8.,  16., 6., 12., 12., 24., 4., 8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x5x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {6., 24., 9., 36., 6., 24.,
+                                         6., 24., 9., 36., 6., 24.,
+                                         4., 16., 6., 24., 4., 16.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 9.,  18., 9.,  18., 18., 36., 18., 36., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 4.,  8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9., 18., 18., 36., 9., 18., 18., 36., 6., 12., 12., 24.,
+      9., 18., 18., 36., 9., 18., 18., 36., 6., 12., 12., 24.,
+      6., 12., 12., 24., 6., 12., 12., 24., 4., 8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  8., 16., 8.,  16., 4.,  8.,  4.,  8., 8., 16., 8.,
+      16., 4.,  8.,  4.,  8., 8.,  16., 8.,  16., 4.,  8.,  4., 8., 8.,  16.,
+      8.,  16., 4.,  8.,  4., 8.,  8.,  16., 8.,  16., 4.,  8., 4., 8.,  8.,
+      16., 8.,  16., 4.,  8., 4.,  8.,  8.,  16., 8.,  16., 4., 8., 4.,  8.,
+      8.,  16., 8.,  16., 4., 8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {9., 36., 9., 36., 6., 24.,
+                                         9., 36., 9., 36., 6., 24.,
+                                         6., 24., 6., 24., 4., 16.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 6.,  12., 6.,  12., 12., 24., 12., 24., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 4.,  8.,  4.,  8.,  8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 12., 24., 24., 48., 9., 18., 18., 36.,
+      12., 24., 24., 48., 12., 24., 24., 48., 9., 18., 18., 36.,
+      8.,  16., 16., 32., 8.,  16., 16., 32., 6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x8x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48., 12., 48., 9., 36.,
+                                         12., 48., 12., 48., 9., 36.,
+                                         8.,  32., 8.,  32., 6., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 9.,  18., 9.,  18., 18., 36., 18., 36., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8., 16., 16., 32., 12., 24., 24., 48., 8., 16., 16., 32.,
+      8., 16., 16., 32., 12., 24., 24., 48., 8., 16., 16., 32.,
+      6., 12., 12., 24., 9.,  18., 18., 36., 6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x5x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {8., 32., 12., 48., 8., 32.,
+                                         8., 32., 12., 48., 8., 32.,
+                                         6., 24., 9.,  36., 6., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 16., 32., 16., 32., 12., 24., 12., 24., 24., 48., 24.,
+      48., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 12., 24., 12., 24., 24., 48., 24., 48., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 6.,  12., 6.,  12., 12., 24., 12., 24., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 12., 24., 24., 48., 8., 16., 16., 32.,
+      12., 24., 24., 48., 12., 24., 24., 48., 8., 16., 16., 32.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 6., 12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48., 12., 48., 8., 32.,
+                                         12., 48., 12., 48., 8., 32.,
+                                         9.,  36., 9.,  36., 6., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 8.,  16., 8.,  16., 16., 32., 16., 32., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48.,
+      16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48.,
+      12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x8x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {16., 64., 16., 64., 12., 48.,
+                                         16., 64., 16., 64., 12., 48.,
+                                         12., 48., 12., 48., 9.,  36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 12., 24., 12., 24., 24., 48., 24., 48., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 9.,  18., 9.,  18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 18., 36., 36., 72.,  12., 24., 24., 48.,
+      18., 36., 36., 72., 27., 54., 54., 108., 18., 36., 36., 72.,
+      12., 24., 24., 48., 18., 36., 36., 72.,  12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x5x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {12., 48., 18., 72.,  12., 48.,
+                                         18., 72., 27., 108., 18., 72.,
+                                         12., 48., 18., 72.,  12., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24.,  12., 24.,  24., 48., 24., 48., 18., 36., 18., 36.,
+      36., 72.,  36., 72.,  12., 24., 12., 24., 24., 48., 24., 48.,
+      18., 36.,  18., 36.,  36., 72., 36., 72., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36., 18., 36., 36., 72., 36., 72.,
+      12., 24.,  12., 24.,  24., 48., 24., 48., 18., 36., 18., 36.,
+      36., 72.,  36., 72.,  12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 36., 72.,  18., 36., 36., 72.,  12., 24., 24., 48.,
+      27., 54., 54., 108., 27., 54., 54., 108., 18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 72.,  18., 72.,  12., 48.,
+                                         27., 108., 27., 108., 18., 72.,
+                                         18., 72.,  18., 72.,  12., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  18., 36.,  36., 72.,  36., 72.,  18., 36., 18., 36.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  24., 48., 24., 48.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  36., 72., 36., 72.,
+      18., 36.,  18., 36.,  36., 72.,  36., 72.,  18., 36., 18., 36.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 48., 96.,  24., 48., 48., 96.,  18., 36., 36., 72.,
+      36., 72., 72., 144., 36., 72., 72., 144., 27., 54., 54., 108.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x8x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {24., 96.,  24., 96.,  18., 72.,
+                                         36., 144., 36., 144., 27., 108.,
+                                         24., 96.,  24., 96.,  18., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48.,  24., 48.,  48., 96.,  48., 96.,  24., 48.,  24., 48.,
+      48., 96.,  48., 96.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      24., 48.,  24., 48.,  48., 96.,  48., 96.,  24., 48.,  24., 48.,
+      48., 96.,  48., 96.,  18., 36.,  18., 36.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 36., 72., 27., 54., 54., 108., 18., 36., 36., 72.,
+      18., 36., 36., 72., 27., 54., 54., 108., 18., 36., 36., 72.,
+      12., 24., 24., 48., 18., 36., 36., 72.,  12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x5x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {18., 72., 27., 108., 18., 72.,
+                                         18., 72., 27., 108., 18., 72.,
+                                         12., 48., 18., 72.,  12., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  18., 36.,  36., 72., 36., 72., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36.,  18., 36.,  36., 72., 36., 72., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36., 18., 36., 36., 72., 36., 72.,
+      12., 24.,  12., 24.,  24., 48., 24., 48., 18., 36., 18., 36.,
+      36., 72.,  36., 72.,  12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 54., 108., 27., 54., 54., 108., 18., 36., 36., 72.,
+      27., 54., 54., 108., 27., 54., 54., 108., 18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {27., 108., 27., 108., 18., 72.,
+                                         27., 108., 27., 108., 18., 72.,
+                                         18., 72.,  18., 72.,  12., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  36., 72., 36., 72.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  36., 72., 36., 72.,
+      18., 36.,  18., 36.,  36., 72.,  36., 72.,  18., 36., 18., 36.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 72., 144., 36., 72., 72., 144., 27., 54., 54., 108.,
+      36., 72., 72., 144., 36., 72., 72., 144., 27., 54., 54., 108.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x8x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {36., 144., 36., 144., 27., 108.,
+                                         36., 144., 36., 144., 27., 108.,
+                                         24., 96.,  24., 96.,  18., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      24., 48.,  24., 48.,  48., 96.,  48., 96.,  24., 48.,  24., 48.,
+      48., 96.,  48., 96.,  18., 36.,  18., 36.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 48., 96., 36., 72., 72., 144., 24., 48., 48., 96.,
+      24., 48., 48., 96., 36., 72., 72., 144., 24., 48., 48., 96.,
+      18., 36., 36., 72., 27., 54., 54., 108., 18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x5x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {24., 96., 36., 144., 24., 96.,
+                                         24., 96., 36., 144., 24., 96.,
+                                         18., 72., 27., 108., 18., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x5x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48.,  24., 48.,  48., 96., 48., 96., 36., 72., 36., 72.,
+      72., 144., 72., 144., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48.,  24., 48.,  48., 96., 48., 96., 36., 72., 36., 72.,
+      72., 144., 72., 144., 24., 48., 24., 48., 48., 96., 48., 96.,
+      18., 36.,  18., 36.,  36., 72., 36., 72., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 72., 144., 36., 72., 72., 144., 24., 48., 48., 96.,
+      36., 72., 72., 144., 36., 72., 72., 144., 24., 48., 48., 96.,
+      27., 54., 54., 108., 27., 54., 54., 108., 18., 36., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x6x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {36., 144., 36., 144., 24., 96.,
+                                         36., 144., 36., 144., 24., 96.,
+                                         27., 108., 27., 108., 18., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x6x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72., 36., 72.,
+      72., 144., 72., 144., 24., 48.,  24., 48.,  48., 96., 48., 96.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72., 36., 72.,
+      72., 144., 72., 144., 24., 48.,  24., 48.,  48., 96., 48., 96.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54., 27., 54.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96., 96., 192., 48., 96., 96., 192., 36., 72., 72., 144.,
+      48., 96., 96., 192., 48., 96., 96., 192., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 27., 54., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x8x2x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {48., 192., 48., 192., 36., 144.,
+                                         48., 192., 48., 192., 36., 144.,
+                                         36., 144., 36., 144., 27., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 2}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
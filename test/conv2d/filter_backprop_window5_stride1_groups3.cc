@@ -0,0 +1,2734 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow5Stride1Groups3 =
+    GroupWindowStrideTest<Triple, 5, 1, 3>;
+TYPED_TEST_SUITE(FilterBackpropWindow5Stride1Groups3, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48.,  24., 48.,  28., 56.,  32., 64., 28., 56., 36., 72.,
+      36., 72., 36., 72.,  32., 64.,  28., 56.,  32., 64., 24., 48., 24., 48.,
+      24., 48., 30., 60.,  30., 60.,  30., 60.,  35., 70., 40., 80., 35., 70.,
+      45., 90., 45., 90.,  45., 90.,  40., 80.,  35., 70., 40., 80., 30., 60.,
+      30., 60., 30., 60.,  36., 72.,  36., 72.,  36., 72., 42., 84., 48., 96.,
+      42., 84., 54., 108., 54., 108., 54., 108., 48., 96., 42., 84., 48., 96.,
+      36., 72., 36., 72.,  36., 72.,  30., 60.,  30., 60., 30., 60., 35., 70.,
+      40., 80., 35., 70.,  45., 90.,  45., 90.,  45., 90., 40., 80., 35., 70.,
+      40., 80., 30., 60.,  30., 60.,  30., 60.,  24., 48., 24., 48., 24., 48.,
+      28., 56., 32., 64.,  28., 56.,  36., 72.,  36., 72., 36., 72., 32., 64.,
+      28., 56., 32., 64.,  24., 48.,  24., 48.,  24., 48.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 50., 50., 50., 50., 50., 50., 75., 75., 75., 50., 50.,
+      50., 50., 50., 50., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 50., 50., 50., 50., 50., 50., 75.,
+      75., 75., 50., 50., 50., 50., 50., 50., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 16., 32., 32., 64.,  32., 64.,  32., 64.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      16., 32., 16., 32., 16., 32., 32., 64.,  32., 64.,  32., 64.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      16., 32., 16., 32., 16., 32., 32., 64.,  32., 64.,  32., 64.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      16., 32., 16., 32., 16., 32., 32., 64.,  32., 64.,  32., 64.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60.,  30.,  60.,  30.,  60.,  36.,  72., 36.,  72., 36.,  72., 42.,
+      84., 42.,  84.,  42.,  84.,  36.,  72.,  36., 72.,  36., 72.,  30., 60.,
+      30., 60.,  30.,  60.,  37.,  74.,  38.,  76., 37.,  74., 45.,  90., 45.,
+      90., 45.,  90.,  52.,  104., 53.,  106., 52., 104., 45., 90.,  45., 90.,
+      45., 90.,  37.,  74.,  38.,  76.,  37.,  74., 45.,  90., 45.,  90., 45.,
+      90., 54.,  108., 54.,  108., 54.,  108., 63., 126., 63., 126., 63., 126.,
+      54., 108., 54.,  108., 54.,  108., 45.,  90., 45.,  90., 45.,  90., 38.,
+      76., 37.,  74.,  38.,  76.,  45.,  90.,  45., 90.,  45., 90.,  53., 106.,
+      52., 104., 53.,  106., 45.,  90.,  45.,  90., 45.,  90., 38.,  76., 37.,
+      74., 38.,  76.,  30.,  60.,  30.,  60.,  30., 60.,  36., 72.,  36., 72.,
+      36., 72.,  42.,  84.,  42.,  84.,  42.,  84., 36.,  72., 36.,  72., 36.,
+      72., 30.,  60.,  30.,  60.,  30.,  60.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x7x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      50., 50., 50., 48., 48., 48., 70., 70., 70., 48., 48.,  48.,  50.,
+      50., 50., 50., 50., 50., 75., 75., 75., 70., 70., 70.,  75.,  75.,
+      75., 50., 50., 50., 75., 75., 75., 72., 72., 72., 105., 105., 105.,
+      72., 72., 72., 75., 75., 75., 50., 50., 50., 75., 75.,  75.,  70.,
+      70., 70., 75., 75., 75., 50., 50., 50., 50., 50., 50.,  48.,  48.,
+      48., 70., 70., 70., 48., 48., 48., 50., 50., 50.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  40., 80.,  44., 88.,  40., 80.,
+      48., 96.,  48., 96.,  48., 96.,  44., 88.,  40., 80.,  44., 88.,
+      36., 72.,  36., 72.,  36., 72.,  45., 90.,  45., 90.,  45., 90.,
+      50., 100., 55., 110., 50., 100., 60., 120., 60., 120., 60., 120.,
+      55., 110., 50., 100., 55., 110., 45., 90.,  45., 90.,  45., 90.,
+      54., 108., 54., 108., 54., 108., 60., 120., 66., 132., 60., 120.,
+      72., 144., 72., 144., 72., 144., 66., 132., 60., 120., 66., 132.,
+      54., 108., 54., 108., 54., 108., 45., 90.,  45., 90.,  45., 90.,
+      50., 100., 55., 110., 50., 100., 60., 120., 60., 120., 60., 120.,
+      55., 110., 50., 100., 55., 110., 45., 90.,  45., 90.,  45., 90.,
+      36., 72.,  36., 72.,  36., 72.,  40., 80.,  44., 88.,  40., 80.,
+      48., 96.,  48., 96.,  48., 96.,  44., 88.,  40., 80.,  44., 88.,
+      36., 72.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x8x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60.,  60.,  60., 56., 56., 56., 80., 80., 80.,  56.,  56.,  56.,  60.,
+      60.,  60.,  75., 75., 75., 70., 70., 70., 100., 100., 100., 70.,  70.,
+      70.,  75.,  75., 75., 90., 90., 90., 84., 84.,  84.,  120., 120., 120.,
+      84.,  84.,  84., 90., 90., 90., 75., 75., 75.,  70.,  70.,  70.,  100.,
+      100., 100., 70., 70., 70., 75., 75., 75., 60.,  60.,  60.,  56.,  56.,
+      56.,  80.,  80., 80., 56., 56., 56., 60., 60.,  60.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      32., 64., 32., 64., 32., 64., 64., 128., 64., 128., 64., 128.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      40., 80., 40., 80., 40., 80., 80., 160., 80., 160., 80., 160.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      40., 80., 40., 80., 40., 80., 80., 160., 80., 160., 80., 160.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      32., 64., 32., 64., 32., 64., 64., 128., 64., 128., 64., 128.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60.,  30., 60.,  30.,  60.,  35.,  70., 40.,  80., 35.,  70., 45.,
+      90., 45.,  90., 45.,  90.,  40.,  80.,  35., 70.,  40., 80.,  30., 60.,
+      30., 60.,  30., 60.,  36.,  72.,  36.,  72., 36.,  72., 42.,  84., 48.,
+      96., 42.,  84., 54.,  108., 54.,  108., 54., 108., 48., 96.,  42., 84.,
+      48., 96.,  36., 72.,  36.,  72.,  36.,  72., 42.,  84., 42.,  84., 42.,
+      84., 49.,  98., 56.,  112., 49.,  98.,  63., 126., 63., 126., 63., 126.,
+      56., 112., 49., 98.,  56.,  112., 42.,  84., 42.,  84., 42.,  84., 36.,
+      72., 36.,  72., 36.,  72.,  42.,  84.,  48., 96.,  42., 84.,  54., 108.,
+      54., 108., 54., 108., 48.,  96.,  42.,  84., 48.,  96., 36.,  72., 36.,
+      72., 36.,  72., 30.,  60.,  30.,  60.,  30., 60.,  35., 70.,  40., 80.,
+      35., 70.,  45., 90.,  45.,  90.,  45.,  90., 40.,  80., 35.,  70., 40.,
+      80., 30.,  60., 30.,  60.,  30.,  60.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      50., 50., 50., 50., 50., 50., 75., 75., 75., 50., 50.,  50.,  50.,
+      50., 50., 60., 60., 60., 60., 60., 60., 90., 90., 90.,  60.,  60.,
+      60., 60., 60., 60., 70., 70., 70., 70., 70., 70., 105., 105., 105.,
+      70., 70., 70., 70., 70., 70., 60., 60., 60., 60., 60.,  60.,  90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 50., 50., 50.,  50.,  50.,
+      50., 75., 75., 75., 50., 50., 50., 50., 50., 50.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      20., 40., 20., 40., 20., 40., 40., 80.,  40., 80.,  40., 80.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28.,
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28.,
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28.,
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28.,
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26.,
+      14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28., 13., 26.,
+      13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28., 14., 28.,
+      13., 26., 13., 26., 14., 28., 14., 28., 13., 26., 13., 26., 14., 28.,
+      14., 28., 13., 26., 13., 26.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      37., 74.,  38., 76.,  37., 74.,  45., 90.,  45., 90.,  45., 90.,
+      52., 104., 53., 106., 52., 104., 45., 90.,  45., 90.,  45., 90.,
+      37., 74.,  38., 76.,  37., 74.,  45., 90.,  45., 90.,  45., 90.,
+      54., 108., 54., 108., 54., 108., 63., 126., 63., 126., 63., 126.,
+      54., 108., 54., 108., 54., 108., 45., 90.,  45., 90.,  45., 90.,
+      52., 104., 53., 106., 52., 104., 63., 126., 63., 126., 63., 126.,
+      73., 146., 74., 148., 73., 146., 63., 126., 63., 126., 63., 126.,
+      52., 104., 53., 106., 52., 104., 45., 90.,  45., 90.,  45., 90.,
+      54., 108., 54., 108., 54., 108., 63., 126., 63., 126., 63., 126.,
+      54., 108., 54., 108., 54., 108., 45., 90.,  45., 90.,  45., 90.,
+      37., 74.,  38., 76.,  37., 74.,  45., 90.,  45., 90.,  45., 90.,
+      52., 104., 53., 106., 52., 104., 45., 90.,  45., 90.,  45., 90.,
+      37., 74.,  38., 76.,  37., 74.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x7x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      61., 64., 61., 60., 60., 60., 86., 89., 86., 60., 60.,  60.,  61.,
+      64., 61., 60., 60., 60., 90., 90., 90., 84., 84., 84.,  90.,  90.,
+      90., 60., 60., 60., 86., 89., 86., 84., 84., 84., 121., 124., 121.,
+      84., 84., 84., 86., 89., 86., 60., 60., 60., 90., 90.,  90.,  84.,
+      84., 84., 90., 90., 90., 60., 60., 60., 61., 64., 61.,  60.,  60.,
+      60., 86., 89., 86., 60., 60., 60., 61., 64., 61.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      49., 98., 49., 98., 49., 98., 98., 196., 98., 196., 98., 196.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      25., 50., 25., 50., 25., 50., 50., 100., 50., 100., 50., 100.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45., 90.,  45., 90.,  45., 90.,  50., 100., 55., 110., 50., 100.,
+      60., 120., 60., 120., 60., 120., 55., 110., 50., 100., 55., 110.,
+      45., 90.,  45., 90.,  45., 90.,  54., 108., 54., 108., 54., 108.,
+      60., 120., 66., 132., 60., 120., 72., 144., 72., 144., 72., 144.,
+      66., 132., 60., 120., 66., 132., 54., 108., 54., 108., 54., 108.,
+      63., 126., 63., 126., 63., 126., 70., 140., 77., 154., 70., 140.,
+      84., 168., 84., 168., 84., 168., 77., 154., 70., 140., 77., 154.,
+      63., 126., 63., 126., 63., 126., 54., 108., 54., 108., 54., 108.,
+      60., 120., 66., 132., 60., 120., 72., 144., 72., 144., 72., 144.,
+      66., 132., 60., 120., 66., 132., 54., 108., 54., 108., 54., 108.,
+      45., 90.,  45., 90.,  45., 90.,  50., 100., 55., 110., 50., 100.,
+      60., 120., 60., 120., 60., 120., 55., 110., 50., 100., 55., 110.,
+      45., 90.,  45., 90.,  45., 90.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x8x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  75.,  75.,  70.,  70.,  70.,  100., 100., 100., 70.,  70.,
+      70.,  75.,  75.,  75.,  90.,  90.,  90.,  84.,  84.,  84.,  120.,
+      120., 120., 84.,  84.,  84.,  90.,  90.,  90.,  105., 105., 105.,
+      98.,  98.,  98.,  140., 140., 140., 98.,  98.,  98.,  105., 105.,
+      105., 90.,  90.,  90.,  84.,  84.,  84.,  120., 120., 120., 84.,
+      84.,  84.,  90.,  90.,  90.,  75.,  75.,  75.,  70.,  70.,  70.,
+      100., 100., 100., 70.,  70.,  70.,  75.,  75.,  75.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      40., 80.,  40., 80.,  40., 80.,  80.,  160., 80.,  160., 80.,  160.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      56., 112., 56., 112., 56., 112., 112., 224., 112., 224., 112., 224.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      40., 80.,  40., 80.,  40., 80.,  80.,  160., 80.,  160., 80.,  160.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  42., 84.,  48., 96.,  42., 84.,
+      54., 108., 54., 108., 54., 108., 48., 96.,  42., 84.,  48., 96.,
+      36., 72.,  36., 72.,  36., 72.,  42., 84.,  42., 84.,  42., 84.,
+      49., 98.,  56., 112., 49., 98.,  63., 126., 63., 126., 63., 126.,
+      56., 112., 49., 98.,  56., 112., 42., 84.,  42., 84.,  42., 84.,
+      48., 96.,  48., 96.,  48., 96.,  56., 112., 64., 128., 56., 112.,
+      72., 144., 72., 144., 72., 144., 64., 128., 56., 112., 64., 128.,
+      48., 96.,  48., 96.,  48., 96.,  42., 84.,  42., 84.,  42., 84.,
+      49., 98.,  56., 112., 49., 98.,  63., 126., 63., 126., 63., 126.,
+      56., 112., 49., 98.,  56., 112., 42., 84.,  42., 84.,  42., 84.,
+      36., 72.,  36., 72.,  36., 72.,  42., 84.,  48., 96.,  42., 84.,
+      54., 108., 54., 108., 54., 108., 48., 96.,  42., 84.,  48., 96.,
+      36., 72.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60.,  60.,  60., 60., 60., 60., 90., 90., 90.,  60.,  60.,  60.,  60.,
+      60.,  60.,  70., 70., 70., 70., 70., 70., 105., 105., 105., 70.,  70.,
+      70.,  70.,  70., 70., 80., 80., 80., 80., 80.,  80.,  120., 120., 120.,
+      80.,  80.,  80., 80., 80., 80., 70., 70., 70.,  70.,  70.,  70.,  105.,
+      105., 105., 70., 70., 70., 70., 70., 70., 60.,  60.,  60.,  60.,  60.,
+      60.,  90.,  90., 90., 60., 60., 60., 60., 60.,  60.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      32., 64., 32., 64., 32., 64., 64., 128., 64., 128., 64., 128.,
+      40., 80., 40., 80., 40., 80., 80., 160., 80., 160., 80., 160.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      40., 80., 40., 80., 40., 80., 80., 160., 80., 160., 80., 160.,
+      32., 64., 32., 64., 32., 64., 64., 128., 64., 128., 64., 128.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      42., 84., 42., 84., 42., 84., 84., 168., 84., 168., 84., 168.,
+      35., 70., 35., 70., 35., 70., 70., 140., 70., 140., 70., 140.,
+      28., 56., 28., 56., 28., 56., 56., 112., 56., 112., 56., 112.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      30., 60., 30., 60., 30., 60., 60., 120., 60., 120., 60., 120.,
+      24., 48., 24., 48., 24., 48., 48., 96.,  48., 96.,  48., 96.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45., 90.,  45., 90.,  45., 90.,  54., 108., 54., 108., 54., 108.,
+      63., 126., 63., 126., 63., 126., 54., 108., 54., 108., 54., 108.,
+      45., 90.,  45., 90.,  45., 90.,  52., 104., 53., 106., 52., 104.,
+      63., 126., 63., 126., 63., 126., 73., 146., 74., 148., 73., 146.,
+      63., 126., 63., 126., 63., 126., 52., 104., 53., 106., 52., 104.,
+      60., 120., 60., 120., 60., 120., 72., 144., 72., 144., 72., 144.,
+      84., 168., 84., 168., 84., 168., 72., 144., 72., 144., 72., 144.,
+      60., 120., 60., 120., 60., 120., 53., 106., 52., 104., 53., 106.,
+      63., 126., 63., 126., 63., 126., 74., 148., 73., 146., 74., 148.,
+      63., 126., 63., 126., 63., 126., 53., 106., 52., 104., 53., 106.,
+      45., 90.,  45., 90.,  45., 90.,  54., 108., 54., 108., 54., 108.,
+      63., 126., 63., 126., 63., 126., 54., 108., 54., 108., 54., 108.,
+      45., 90.,  45., 90.,  45., 90.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x7x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  75.,  75.,  72.,  72.,  72.,  105., 105., 105., 72.,  72.,
+      72.,  75.,  75.,  75.,  70.,  70.,  70.,  105., 105., 105., 98.,
+      98.,  98.,  105., 105., 105., 70.,  70.,  70.,  100., 100., 100.,
+      96.,  96.,  96.,  140., 140., 140., 96.,  96.,  96.,  100., 100.,
+      100., 70.,  70.,  70.,  105., 105., 105., 98.,  98.,  98.,  105.,
+      105., 105., 70.,  70.,  70.,  75.,  75.,  75.,  72.,  72.,  72.,
+      105., 105., 105., 72.,  72.,  72.,  75.,  75.,  75.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      40., 80.,  40., 80.,  40., 80.,  80.,  160., 80.,  160., 80.,  160.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      56., 112., 56., 112., 56., 112., 112., 224., 112., 224., 112., 224.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      40., 80.,  40., 80.,  40., 80.,  80.,  160., 80.,  160., 80.,  160.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      35., 70.,  35., 70.,  35., 70.,  70.,  140., 70.,  140., 70.,  140.,
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      30., 60.,  30., 60.,  30., 60.,  60.,  120., 60.,  120., 60.,  120.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54., 108., 54., 108., 54., 108., 60., 120., 66., 132., 60., 120.,
+      72., 144., 72., 144., 72., 144., 66., 132., 60., 120., 66., 132.,
+      54., 108., 54., 108., 54., 108., 63., 126., 63., 126., 63., 126.,
+      70., 140., 77., 154., 70., 140., 84., 168., 84., 168., 84., 168.,
+      77., 154., 70., 140., 77., 154., 63., 126., 63., 126., 63., 126.,
+      72., 144., 72., 144., 72., 144., 80., 160., 88., 176., 80., 160.,
+      96., 192., 96., 192., 96., 192., 88., 176., 80., 160., 88., 176.,
+      72., 144., 72., 144., 72., 144., 63., 126., 63., 126., 63., 126.,
+      70., 140., 77., 154., 70., 140., 84., 168., 84., 168., 84., 168.,
+      77., 154., 70., 140., 77., 154., 63., 126., 63., 126., 63., 126.,
+      54., 108., 54., 108., 54., 108., 60., 120., 66., 132., 60., 120.,
+      72., 144., 72., 144., 72., 144., 66., 132., 60., 120., 66., 132.,
+      54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x8x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  84.,  84.,  84.,  120., 120., 120., 84.,  84.,
+      84.,  90.,  90.,  90.,  105., 105., 105., 98.,  98.,  98.,  140.,
+      140., 140., 98.,  98.,  98.,  105., 105., 105., 120., 120., 120.,
+      112., 112., 112., 160., 160., 160., 112., 112., 112., 120., 120.,
+      120., 105., 105., 105., 98.,  98.,  98.,  140., 140., 140., 98.,
+      98.,  98.,  105., 105., 105., 90.,  90.,  90.,  84.,  84.,  84.,
+      120., 120., 120., 84.,  84.,  84.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      56., 112., 56., 112., 56., 112., 112., 224., 112., 224., 112., 224.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      56., 112., 56., 112., 56., 112., 112., 224., 112., 224., 112., 224.,
+      64., 128., 64., 128., 64., 128., 128., 256., 128., 256., 128., 256.,
+      56., 112., 56., 112., 56., 112., 112., 224., 112., 224., 112., 224.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      56., 112., 56., 112., 56., 112., 112., 224., 112., 224., 112., 224.,
+      49., 98.,  49., 98.,  49., 98.,  98.,  196., 98.,  196., 98.,  196.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      48., 96.,  48., 96.,  48., 96.,  96.,  192., 96.,  192., 96.,  192.,
+      42., 84.,  42., 84.,  42., 84.,  84.,  168., 84.,  168., 84.,  168.,
+      36., 72.,  36., 72.,  36., 72.,  72.,  144., 72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72.,  144., 72.,  144., 72.,  144., 84.,  168., 96.,  192., 84.,  168.,
+      108., 216., 108., 216., 108., 216., 96.,  192., 84.,  168., 96.,  192.,
+      72.,  144., 72.,  144., 72.,  144., 90.,  180., 90.,  180., 90.,  180.,
+      105., 210., 120., 240., 105., 210., 135., 270., 135., 270., 135., 270.,
+      120., 240., 105., 210., 120., 240., 90.,  180., 90.,  180., 90.,  180.,
+      108., 216., 108., 216., 108., 216., 126., 252., 144., 288., 126., 252.,
+      162., 324., 162., 324., 162., 324., 144., 288., 126., 252., 144., 288.,
+      108., 216., 108., 216., 108., 216., 90.,  180., 90.,  180., 90.,  180.,
+      105., 210., 120., 240., 105., 210., 135., 270., 135., 270., 135., 270.,
+      120., 240., 105., 210., 120., 240., 90.,  180., 90.,  180., 90.,  180.,
+      72.,  144., 72.,  144., 72.,  144., 84.,  168., 96.,  192., 84.,  168.,
+      108., 216., 108., 216., 108., 216., 96.,  192., 84.,  168., 96.,  192.,
+      72.,  144., 72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      120., 120., 120., 120., 120., 120., 180., 180., 180., 120., 120.,
+      120., 120., 120., 120., 150., 150., 150., 150., 150., 150., 225.,
+      225., 225., 150., 150., 150., 150., 150., 150., 180., 180., 180.,
+      180., 180., 180., 270., 270., 270., 180., 180., 180., 180., 180.,
+      180., 150., 150., 150., 150., 150., 150., 225., 225., 225., 150.,
+      150., 150., 150., 150., 150., 120., 120., 120., 120., 120., 120.,
+      180., 180., 180., 120., 120., 120., 120., 120., 120.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 108., 216., 108., 216., 108., 216.,
+      126., 252., 126., 252., 126., 252., 108., 216., 108., 216., 108., 216.,
+      90.,  180., 90.,  180., 90.,  180., 111., 222., 114., 228., 111., 222.,
+      135., 270., 135., 270., 135., 270., 156., 312., 159., 318., 156., 312.,
+      135., 270., 135., 270., 135., 270., 111., 222., 114., 228., 111., 222.,
+      135., 270., 135., 270., 135., 270., 162., 324., 162., 324., 162., 324.,
+      189., 378., 189., 378., 189., 378., 162., 324., 162., 324., 162., 324.,
+      135., 270., 135., 270., 135., 270., 114., 228., 111., 222., 114., 228.,
+      135., 270., 135., 270., 135., 270., 159., 318., 156., 312., 159., 318.,
+      135., 270., 135., 270., 135., 270., 114., 228., 111., 222., 114., 228.,
+      90.,  180., 90.,  180., 90.,  180., 108., 216., 108., 216., 108., 216.,
+      126., 252., 126., 252., 126., 252., 108., 216., 108., 216., 108., 216.,
+      90.,  180., 90.,  180., 90.,  180.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x7x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      150., 150., 150., 144., 144., 144., 210., 210., 210., 144., 144.,
+      144., 150., 150., 150., 150., 150., 150., 225., 225., 225., 210.,
+      210., 210., 225., 225., 225., 150., 150., 150., 225., 225., 225.,
+      216., 216., 216., 315., 315., 315., 216., 216., 216., 225., 225.,
+      225., 150., 150., 150., 225., 225., 225., 210., 210., 210., 225.,
+      225., 225., 150., 150., 150., 150., 150., 150., 144., 144., 144.,
+      210., 210., 210., 144., 144., 144., 150., 150., 150.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      108., 216., 108., 216., 108., 216., 120., 240., 132., 264., 120., 240.,
+      144., 288., 144., 288., 144., 288., 132., 264., 120., 240., 132., 264.,
+      108., 216., 108., 216., 108., 216., 135., 270., 135., 270., 135., 270.,
+      150., 300., 165., 330., 150., 300., 180., 360., 180., 360., 180., 360.,
+      165., 330., 150., 300., 165., 330., 135., 270., 135., 270., 135., 270.,
+      162., 324., 162., 324., 162., 324., 180., 360., 198., 396., 180., 360.,
+      216., 432., 216., 432., 216., 432., 198., 396., 180., 360., 198., 396.,
+      162., 324., 162., 324., 162., 324., 135., 270., 135., 270., 135., 270.,
+      150., 300., 165., 330., 150., 300., 180., 360., 180., 360., 180., 360.,
+      165., 330., 150., 300., 165., 330., 135., 270., 135., 270., 135., 270.,
+      108., 216., 108., 216., 108., 216., 120., 240., 132., 264., 120., 240.,
+      144., 288., 144., 288., 144., 288., 132., 264., 120., 240., 132., 264.,
+      108., 216., 108., 216., 108., 216.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x8x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      180., 180., 180., 168., 168., 168., 240., 240., 240., 168., 168.,
+      168., 180., 180., 180., 225., 225., 225., 210., 210., 210., 300.,
+      300., 300., 210., 210., 210., 225., 225., 225., 270., 270., 270.,
+      252., 252., 252., 360., 360., 360., 252., 252., 252., 270., 270.,
+      270., 225., 225., 225., 210., 210., 210., 300., 300., 300., 210.,
+      210., 210., 225., 225., 225., 180., 180., 180., 168., 168., 168.,
+      240., 240., 240., 168., 168., 168., 180., 180., 180.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      96.,  192., 96.,  192., 96.,  192., 192., 384., 192., 384., 192., 384.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      96.,  192., 96.,  192., 96.,  192., 192., 384., 192., 384., 192., 384.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 105., 210., 120., 240., 105., 210.,
+      135., 270., 135., 270., 135., 270., 120., 240., 105., 210., 120., 240.,
+      90.,  180., 90.,  180., 90.,  180., 108., 216., 108., 216., 108., 216.,
+      126., 252., 144., 288., 126., 252., 162., 324., 162., 324., 162., 324.,
+      144., 288., 126., 252., 144., 288., 108., 216., 108., 216., 108., 216.,
+      126., 252., 126., 252., 126., 252., 147., 294., 168., 336., 147., 294.,
+      189., 378., 189., 378., 189., 378., 168., 336., 147., 294., 168., 336.,
+      126., 252., 126., 252., 126., 252., 108., 216., 108., 216., 108., 216.,
+      126., 252., 144., 288., 126., 252., 162., 324., 162., 324., 162., 324.,
+      144., 288., 126., 252., 144., 288., 108., 216., 108., 216., 108., 216.,
+      90.,  180., 90.,  180., 90.,  180., 105., 210., 120., 240., 105., 210.,
+      135., 270., 135., 270., 135., 270., 120., 240., 105., 210., 120., 240.,
+      90.,  180., 90.,  180., 90.,  180.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      150., 150., 150., 150., 150., 150., 225., 225., 225., 150., 150.,
+      150., 150., 150., 150., 180., 180., 180., 180., 180., 180., 270.,
+      270., 270., 180., 180., 180., 180., 180., 180., 210., 210., 210.,
+      210., 210., 210., 315., 315., 315., 210., 210., 210., 210., 210.,
+      210., 180., 180., 180., 180., 180., 180., 270., 270., 270., 180.,
+      180., 180., 180., 180., 180., 150., 150., 150., 150., 150., 150.,
+      225., 225., 225., 150., 150., 150., 150., 150., 150.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82.,
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82.,
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82.,
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82.,
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80.,
+      41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82., 40., 80.,
+      40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82., 41., 82.,
+      40., 80., 40., 80., 41., 82., 41., 82., 40., 80., 40., 80., 41., 82.,
+      41., 82., 40., 80., 40., 80.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      112., 224., 113., 226., 112., 224., 135., 270., 135., 270., 135., 270.,
+      157., 314., 158., 316., 157., 314., 135., 270., 135., 270., 135., 270.,
+      112., 224., 113., 226., 112., 224., 135., 270., 135., 270., 135., 270.,
+      162., 324., 162., 324., 162., 324., 189., 378., 189., 378., 189., 378.,
+      162., 324., 162., 324., 162., 324., 135., 270., 135., 270., 135., 270.,
+      157., 314., 158., 316., 157., 314., 189., 378., 189., 378., 189., 378.,
+      220., 440., 221., 442., 220., 440., 189., 378., 189., 378., 189., 378.,
+      157., 314., 158., 316., 157., 314., 135., 270., 135., 270., 135., 270.,
+      162., 324., 162., 324., 162., 324., 189., 378., 189., 378., 189., 378.,
+      162., 324., 162., 324., 162., 324., 135., 270., 135., 270., 135., 270.,
+      112., 224., 113., 226., 112., 224., 135., 270., 135., 270., 135., 270.,
+      157., 314., 158., 316., 157., 314., 135., 270., 135., 270., 135., 270.,
+      112., 224., 113., 226., 112., 224.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.,
+      27., 54., 27., 54., 27., 54., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x7x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      186., 189., 186., 180., 180., 180., 261., 264., 261., 180., 180.,
+      180., 186., 189., 186., 180., 180., 180., 270., 270., 270., 252.,
+      252., 252., 270., 270., 270., 180., 180., 180., 261., 264., 261.,
+      252., 252., 252., 366., 369., 366., 252., 252., 252., 261., 264.,
+      261., 180., 180., 180., 270., 270., 270., 252., 252., 252., 270.,
+      270., 270., 180., 180., 180., 186., 189., 186., 180., 180., 180.,
+      261., 264., 261., 180., 180., 180., 186., 189., 186.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      135., 270., 135., 270., 135., 270., 150., 300., 165., 330., 150., 300.,
+      180., 360., 180., 360., 180., 360., 165., 330., 150., 300., 165., 330.,
+      135., 270., 135., 270., 135., 270., 162., 324., 162., 324., 162., 324.,
+      180., 360., 198., 396., 180., 360., 216., 432., 216., 432., 216., 432.,
+      198., 396., 180., 360., 198., 396., 162., 324., 162., 324., 162., 324.,
+      189., 378., 189., 378., 189., 378., 210., 420., 231., 462., 210., 420.,
+      252., 504., 252., 504., 252., 504., 231., 462., 210., 420., 231., 462.,
+      189., 378., 189., 378., 189., 378., 162., 324., 162., 324., 162., 324.,
+      180., 360., 198., 396., 180., 360., 216., 432., 216., 432., 216., 432.,
+      198., 396., 180., 360., 198., 396., 162., 324., 162., 324., 162., 324.,
+      135., 270., 135., 270., 135., 270., 150., 300., 165., 330., 150., 300.,
+      180., 360., 180., 360., 180., 360., 165., 330., 150., 300., 165., 330.,
+      135., 270., 135., 270., 135., 270.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x8x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      225., 225., 225., 210., 210., 210., 300., 300., 300., 210., 210.,
+      210., 225., 225., 225., 270., 270., 270., 252., 252., 252., 360.,
+      360., 360., 252., 252., 252., 270., 270., 270., 315., 315., 315.,
+      294., 294., 294., 420., 420., 420., 294., 294., 294., 315., 315.,
+      315., 270., 270., 270., 252., 252., 252., 360., 360., 360., 252.,
+      252., 252., 270., 270., 270., 225., 225., 225., 210., 210., 210.,
+      300., 300., 300., 210., 210., 210., 225., 225., 225.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72., 36., 72.,
+      36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      108., 216., 108., 216., 108., 216., 126., 252., 144., 288., 126., 252.,
+      162., 324., 162., 324., 162., 324., 144., 288., 126., 252., 144., 288.,
+      108., 216., 108., 216., 108., 216., 126., 252., 126., 252., 126., 252.,
+      147., 294., 168., 336., 147., 294., 189., 378., 189., 378., 189., 378.,
+      168., 336., 147., 294., 168., 336., 126., 252., 126., 252., 126., 252.,
+      144., 288., 144., 288., 144., 288., 168., 336., 192., 384., 168., 336.,
+      216., 432., 216., 432., 216., 432., 192., 384., 168., 336., 192., 384.,
+      144., 288., 144., 288., 144., 288., 126., 252., 126., 252., 126., 252.,
+      147., 294., 168., 336., 147., 294., 189., 378., 189., 378., 189., 378.,
+      168., 336., 147., 294., 168., 336., 126., 252., 126., 252., 126., 252.,
+      108., 216., 108., 216., 108., 216., 126., 252., 144., 288., 126., 252.,
+      162., 324., 162., 324., 162., 324., 144., 288., 126., 252., 144., 288.,
+      108., 216., 108., 216., 108., 216.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x6x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      180., 180., 180., 180., 180., 180., 270., 270., 270., 180., 180.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 315.,
+      315., 315., 210., 210., 210., 210., 210., 210., 240., 240., 240.,
+      240., 240., 240., 360., 360., 360., 240., 240., 240., 240., 240.,
+      240., 210., 210., 210., 210., 210., 210., 315., 315., 315., 210.,
+      210., 210., 210., 210., 210., 180., 180., 180., 180., 180., 180.,
+      270., 270., 270., 180., 180., 180., 180., 180., 180.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x6x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      96.,  192., 96.,  192., 96.,  192., 192., 384., 192., 384., 192., 384.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      96.,  192., 96.,  192., 96.,  192., 192., 384., 192., 384., 192., 384.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      84.,  168., 84.,  168., 84.,  168., 168., 336., 168., 336., 168., 336.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      135., 270., 135., 270., 135., 270., 162., 324., 162., 324., 162., 324.,
+      189., 378., 189., 378., 189., 378., 162., 324., 162., 324., 162., 324.,
+      135., 270., 135., 270., 135., 270., 156., 312., 159., 318., 156., 312.,
+      189., 378., 189., 378., 189., 378., 219., 438., 222., 444., 219., 438.,
+      189., 378., 189., 378., 189., 378., 156., 312., 159., 318., 156., 312.,
+      180., 360., 180., 360., 180., 360., 216., 432., 216., 432., 216., 432.,
+      252., 504., 252., 504., 252., 504., 216., 432., 216., 432., 216., 432.,
+      180., 360., 180., 360., 180., 360., 159., 318., 156., 312., 159., 318.,
+      189., 378., 189., 378., 189., 378., 222., 444., 219., 438., 222., 444.,
+      189., 378., 189., 378., 189., 378., 159., 318., 156., 312., 159., 318.,
+      135., 270., 135., 270., 135., 270., 162., 324., 162., 324., 162., 324.,
+      189., 378., 189., 378., 189., 378., 162., 324., 162., 324., 162., 324.,
+      135., 270., 135., 270., 135., 270.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.,
+      36., 72., 36., 72., 36., 72., 72., 144., 72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x7x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      225., 225., 225., 216., 216., 216., 315., 315., 315., 216., 216.,
+      216., 225., 225., 225., 210., 210., 210., 315., 315., 315., 294.,
+      294., 294., 315., 315., 315., 210., 210., 210., 300., 300., 300.,
+      288., 288., 288., 420., 420., 420., 288., 288., 288., 300., 300.,
+      300., 210., 210., 210., 315., 315., 315., 294., 294., 294., 315.,
+      315., 315., 210., 210., 210., 225., 225., 225., 216., 216., 216.,
+      315., 315., 315., 216., 216., 216., 225., 225., 225.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x7x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      168., 336., 168., 336., 168., 336., 336., 672., 336., 672., 336., 672.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      120., 240., 120., 240., 120., 240., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      162., 324., 162., 324., 162., 324., 180., 360., 198., 396., 180., 360.,
+      216., 432., 216., 432., 216., 432., 198., 396., 180., 360., 198., 396.,
+      162., 324., 162., 324., 162., 324., 189., 378., 189., 378., 189., 378.,
+      210., 420., 231., 462., 210., 420., 252., 504., 252., 504., 252., 504.,
+      231., 462., 210., 420., 231., 462., 189., 378., 189., 378., 189., 378.,
+      216., 432., 216., 432., 216., 432., 240., 480., 264., 528., 240., 480.,
+      288., 576., 288., 576., 288., 576., 264., 528., 240., 480., 264., 528.,
+      216., 432., 216., 432., 216., 432., 189., 378., 189., 378., 189., 378.,
+      210., 420., 231., 462., 210., 420., 252., 504., 252., 504., 252., 504.,
+      231., 462., 210., 420., 231., 462., 189., 378., 189., 378., 189., 378.,
+      162., 324., 162., 324., 162., 324., 180., 360., 198., 396., 180., 360.,
+      216., 432., 216., 432., 216., 432., 198., 396., 180., 360., 198., 396.,
+      162., 324., 162., 324., 162., 324.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.,
+      48., 96., 48., 96., 48., 96., 96., 192., 96., 192., 96., 192.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x8x3x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      270., 270., 270., 252., 252., 252., 360., 360., 360., 252., 252.,
+      252., 270., 270., 270., 315., 315., 315., 294., 294., 294., 420.,
+      420., 420., 294., 294., 294., 315., 315., 315., 360., 360., 360.,
+      336., 336., 336., 480., 480., 480., 336., 336., 336., 360., 360.,
+      360., 315., 315., 315., 294., 294., 294., 420., 420., 420., 294.,
+      294., 294., 315., 315., 315., 270., 270., 270., 252., 252., 252.,
+      360., 360., 360., 252., 252., 252., 270., 270., 270.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 3}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x8x6x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      168., 336., 168., 336., 168., 336., 336., 672., 336., 672., 336., 672.,
+      192., 384., 192., 384., 192., 384., 384., 768., 384., 768., 384., 768.,
+      168., 336., 168., 336., 168., 336., 336., 672., 336., 672., 336., 672.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 216., 432., 216., 432., 216., 432.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 6}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
@@ -0,0 +1,3082 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow5Stride2Groups4 =
+    GroupWindowStrideTest<Triple, 5, 2, 4>;
+TYPED_TEST_SUITE(FilterBackpropWindow5Stride2Groups4, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48.,
+      12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 16., 32., 32., 64., 16., 32., 32., 64., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48.,
+      12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x7x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48.,
+      12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12.,
+      48., 12., 48., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48.,
+      12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 16., 32.,
+      32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 12., 24., 24., 48., 15., 30., 30., 60., 15., 30., 30.,
+      60., 15., 30., 30., 60., 15., 30., 30., 60., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12.,
+      24., 24., 48., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60.,
+      15., 30., 30., 60., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 16., 32., 32., 64., 16., 32., 32., 64., 20., 40.,
+      40., 80., 20., 40., 40., 80., 20., 40., 40., 80., 20., 40., 40., 80., 16.,
+      32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64.,
+      12., 24., 24., 48., 12., 24., 24., 48., 15., 30., 30., 60., 15., 30., 30.,
+      60., 15., 30., 30., 60., 15., 30., 30., 60., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12.,
+      24., 24., 48., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60.,
+      15., 30., 30., 60., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 48., 12., 48., 15., 60., 15., 60., 15., 60., 15., 60., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 15., 60., 15., 60., 15., 60.,
+      15., 60., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 20.,
+      80., 20., 80., 20., 80., 20., 80., 16., 64., 16., 64., 16., 64., 16., 64.,
+      12., 48., 12., 48., 15., 60., 15., 60., 15., 60., 15., 60., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 15., 60., 15., 60., 15., 60.,
+      15., 60., 12., 48., 12., 48., 12., 48., 12., 48.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60.,
+      30., 60., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30.,
+      60., 30., 60., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 15., 30., 15., 30., 15., 30., 15., 30., 30.,
+      60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15., 30., 15., 30.,
+      30., 60., 30., 60., 30., 60., 30., 60., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16.,
+      32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 20., 40., 20., 40.,
+      20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 20., 40., 20.,
+      40., 20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 16., 32.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16.,
+      32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60.,
+      30., 60., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30.,
+      60., 30., 60., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 15., 30., 15., 30., 15., 30., 15., 30., 30.,
+      60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15., 30., 15., 30.,
+      30., 60., 30., 60., 30., 60., 30., 60., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 16., 32., 32., 64.,
+      16., 32., 32., 64., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 16., 32., 32., 64., 16., 32., 32., 64., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48.,
+      12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x7x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64.,
+      16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48.,
+      12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12.,
+      24., 24., 48., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64.,
+      16., 32., 32., 64., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 16., 32.,
+      32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 16., 32., 32.,
+      64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 12., 24., 24., 48., 15., 30., 30., 60., 15., 30., 30.,
+      60., 15., 30., 30., 60., 15., 30., 30., 60., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 16., 32., 32., 64., 16.,
+      32., 32., 64., 20., 40., 40., 80., 20., 40., 40., 80., 20., 40., 40., 80.,
+      20., 40., 40., 80., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32.,
+      64., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 20., 40.,
+      40., 80., 20., 40., 40., 80., 20., 40., 40., 80., 20., 40., 40., 80., 16.,
+      32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64.,
+      12., 24., 24., 48., 12., 24., 24., 48., 15., 30., 30., 60., 15., 30., 30.,
+      60., 15., 30., 30., 60., 15., 30., 30., 60., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12.,
+      24., 24., 48., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60.,
+      15., 30., 30., 60., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 48., 12., 48., 15., 60., 15., 60., 15., 60., 15., 60., 12., 48., 12.,
+      48., 12., 48., 12., 48., 16., 64., 16., 64., 20., 80., 20., 80., 20., 80.,
+      20., 80., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 20.,
+      80., 20., 80., 20., 80., 20., 80., 16., 64., 16., 64., 16., 64., 16., 64.,
+      12., 48., 12., 48., 15., 60., 15., 60., 15., 60., 15., 60., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 15., 60., 15., 60., 15., 60.,
+      15., 60., 12., 48., 12., 48., 12., 48., 12., 48.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60.,
+      30., 60., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30.,
+      60., 30., 60., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 32., 64., 20., 40., 20., 40., 20., 40., 20., 40., 40.,
+      80., 40., 80., 40., 80., 40., 80., 20., 40., 20., 40., 20., 40., 20., 40.,
+      40., 80., 40., 80., 40., 80., 40., 80., 16., 32., 16., 32., 16., 32., 16.,
+      32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16.,
+      32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 20., 40., 20., 40.,
+      20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 20., 40., 20.,
+      40., 20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 16., 32.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16.,
+      32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60.,
+      30., 60., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30.,
+      60., 30., 60., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 15., 30., 15., 30., 15., 30., 15., 30., 30.,
+      60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15., 30., 15., 30.,
+      30., 60., 30., 60., 30., 60., 30., 60., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 15., 30., 30., 60., 15.,
+      30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60., 20., 40., 40., 80.,
+      20., 40., 40., 80., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30.,
+      60., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30.,
+      30., 60., 15., 30., 30., 60., 20., 40., 40., 80., 20., 40., 40., 80., 15.,
+      30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 16., 32., 32., 64.,
+      16., 32., 32., 64., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x7x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 12., 48., 12.,
+      48., 12., 48., 12., 48., 15., 60., 15., 60., 15., 60., 15., 60., 20., 80.,
+      20., 80., 15., 60., 15., 60., 15., 60., 15., 60., 15., 60., 15., 60., 15.,
+      60., 15., 60., 20., 80., 20., 80., 15., 60., 15., 60., 15., 60., 15., 60.,
+      12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64.,
+      16., 64., 12., 48., 12., 48., 12., 48., 12., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60.,
+      30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15., 30., 15., 30., 30.,
+      60., 30., 60., 30., 60., 30., 60., 20., 40., 20., 40., 20., 40., 20., 40.,
+      40., 80., 40., 80., 40., 80., 40., 80., 15., 30., 15., 30., 15., 30., 15.,
+      30., 30., 60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15., 30.,
+      15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15.,
+      30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30.,
+      15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 20., 40., 20.,
+      40., 20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 15., 30.,
+      15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 15.,
+      30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 24., 48., 12., 24., 24., 48., 16., 32., 32., 64., 16., 32., 32.,
+      64., 16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 15., 30., 30., 60., 15.,
+      30., 30., 60., 20., 40., 40., 80., 20., 40., 40., 80., 20., 40., 40., 80.,
+      20., 40., 40., 80., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30.,
+      60., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60., 20., 40.,
+      40., 80., 20., 40., 40., 80., 20., 40., 40., 80., 20., 40., 40., 80., 15.,
+      30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60., 15., 30., 30., 60.,
+      12., 24., 24., 48., 12., 24., 24., 48., 16., 32., 32., 64., 16., 32., 32.,
+      64., 16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12.,
+      24., 24., 48., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64.,
+      16., 32., 32., 64., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12.,
+      48., 12., 48., 12., 48., 15., 60., 15., 60., 20., 80., 20., 80., 20., 80.,
+      20., 80., 15., 60., 15., 60., 15., 60., 15., 60., 15., 60., 15., 60., 20.,
+      80., 20., 80., 20., 80., 20., 80., 15., 60., 15., 60., 15., 60., 15., 60.,
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 12., 48., 12., 48., 12., 48., 12., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 15., 30., 15., 30., 15., 30., 15., 30., 30., 60.,
+      30., 60., 30., 60., 30., 60., 20., 40., 20., 40., 20., 40., 20., 40., 40.,
+      80., 40., 80., 40., 80., 40., 80., 20., 40., 20., 40., 20., 40., 20., 40.,
+      40., 80., 40., 80., 40., 80., 40., 80., 15., 30., 15., 30., 15., 30., 15.,
+      30., 30., 60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15., 30.,
+      15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 15., 30., 15., 30., 15.,
+      30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 20., 40., 20., 40.,
+      20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 20., 40., 20.,
+      40., 20., 40., 20., 40., 40., 80., 40., 80., 40., 80., 40., 80., 15., 30.,
+      15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60., 15.,
+      30., 15., 30., 15., 30., 15., 30., 30., 60., 30., 60., 30., 60., 30., 60.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 16., 32., 32.,
+      64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16.,  32., 32., 64.,  16.,  32., 32., 64.,  20.,  40., 40., 80.,  20.,
+      40.,  40., 80., 20.,  40.,  40., 80., 20.,  40.,  40., 80., 16.,  32.,
+      32.,  64., 16., 32.,  32.,  64., 16., 32.,  32.,  64., 16., 32.,  32.,
+      64.,  20., 40., 40.,  80.,  20., 40., 40.,  80.,  25., 50., 50.,  100.,
+      25.,  50., 50., 100., 25.,  50., 50., 100., 25.,  50., 50., 100., 20.,
+      40.,  40., 80., 20.,  40.,  40., 80., 20.,  40.,  40., 80., 20.,  40.,
+      40.,  80., 20., 40.,  40.,  80., 20., 40.,  40.,  80., 25., 50.,  50.,
+      100., 25., 50., 50.,  100., 25., 50., 50.,  100., 25., 50., 50.,  100.,
+      20.,  40., 40., 80.,  20.,  40., 40., 80.,  20.,  40., 40., 80.,  20.,
+      40.,  40., 80., 16.,  32.,  32., 64., 16.,  32.,  32., 64., 20.,  40.,
+      40.,  80., 20., 40.,  40.,  80., 20., 40.,  40.,  80., 20., 40.,  40.,
+      80.,  16., 32., 32.,  64.,  16., 32., 32.,  64.,  16., 32., 32.,  64.,
+      16.,  32., 32., 64.,  16.,  32., 32., 64.,  16.,  32., 32., 64.,  20.,
+      40.,  40., 80., 20.,  40.,  40., 80., 20.,  40.,  40., 80., 20.,  40.,
+      40.,  80., 16., 32.,  32.,  64., 16., 32.,  32.,  64., 16., 32.,  32.,
+      64.,  16., 32., 32.,  64.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 64.,  16., 64.,  20., 80.,  20.,  80., 20.,  80., 20.,  80., 16.,
+      64., 16.,  64., 16.,  64., 16.,  64.,  20., 80.,  20., 80.,  25., 100.,
+      25., 100., 25., 100., 25., 100., 20.,  80., 20.,  80., 20.,  80., 20.,
+      80., 20.,  80., 20.,  80., 25.,  100., 25., 100., 25., 100., 25., 100.,
+      20., 80.,  20., 80.,  20., 80.,  20.,  80., 16.,  64., 16.,  64., 20.,
+      80., 20.,  80., 20.,  80., 20.,  80.,  16., 64.,  16., 64.,  16., 64.,
+      16., 64.,  16., 64.,  16., 64.,  20.,  80., 20.,  80., 20.,  80., 20.,
+      80., 16.,  64., 16.,  64., 16.,  64.,  16., 64.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32.,  16., 32.,  16.,  32.,  16.,  32.,  32.,  64.,  32.,  64., 32.,
+      64., 32.,  64., 20.,  40.,  20.,  40.,  20.,  40.,  20.,  40.,  40., 80.,
+      40., 80.,  40., 80.,  40.,  80.,  20.,  40.,  20.,  40.,  20.,  40., 20.,
+      40., 40.,  80., 40.,  80.,  40.,  80.,  40.,  80.,  16.,  32.,  16., 32.,
+      16., 32.,  16., 32.,  32.,  64.,  32.,  64.,  32.,  64.,  32.,  64., 16.,
+      32., 16.,  32., 16.,  32.,  16.,  32.,  32.,  64.,  32.,  64.,  32., 64.,
+      32., 64.,  20., 40.,  20.,  40.,  20.,  40.,  20.,  40.,  40.,  80., 40.,
+      80., 40.,  80., 40.,  80.,  25.,  50.,  25.,  50.,  25.,  50.,  25., 50.,
+      50., 100., 50., 100., 50.,  100., 50.,  100., 25.,  50.,  25.,  50., 25.,
+      50., 25.,  50., 50.,  100., 50.,  100., 50.,  100., 50.,  100., 20., 40.,
+      20., 40.,  20., 40.,  20.,  40.,  40.,  80.,  40.,  80.,  40.,  80., 40.,
+      80., 20.,  40., 20.,  40.,  20.,  40.,  20.,  40.,  40.,  80.,  40., 80.,
+      40., 80.,  40., 80.,  20.,  40.,  20.,  40.,  20.,  40.,  20.,  40., 40.,
+      80., 40.,  80., 40.,  80.,  40.,  80.,  25.,  50.,  25.,  50.,  25., 50.,
+      25., 50.,  50., 100., 50.,  100., 50.,  100., 50.,  100., 25.,  50., 25.,
+      50., 25.,  50., 25.,  50.,  50.,  100., 50.,  100., 50.,  100., 50., 100.,
+      20., 40.,  20., 40.,  20.,  40.,  20.,  40.,  40.,  80.,  40.,  80., 40.,
+      80., 40.,  80., 20.,  40.,  20.,  40.,  20.,  40.,  20.,  40.,  40., 80.,
+      40., 80.,  40., 80.,  40.,  80.,  16.,  32.,  16.,  32.,  16.,  32., 16.,
+      32., 32.,  64., 32.,  64.,  32.,  64.,  32.,  64.,  20.,  40.,  20., 40.,
+      20., 40.,  20., 40.,  40.,  80.,  40.,  80.,  40.,  80.,  40.,  80., 20.,
+      40., 20.,  40., 20.,  40.,  20.,  40.,  40.,  80.,  40.,  80.,  40., 80.,
+      40., 80.,  16., 32.,  16.,  32.,  16.,  32.,  16.,  32.,  32.,  64., 32.,
+      64., 32.,  64., 32.,  64.,  16.,  32.,  16.,  32.,  16.,  32.,  16., 32.,
+      32., 64.,  32., 64.,  32.,  64.,  32.,  64.,  16.,  32.,  16.,  32., 16.,
+      32., 16.,  32., 32.,  64.,  32.,  64.,  32.,  64.,  32.,  64.,  20., 40.,
+      20., 40.,  20., 40.,  20.,  40.,  40.,  80.,  40.,  80.,  40.,  80., 40.,
+      80., 20.,  40., 20.,  40.,  20.,  40.,  20.,  40.,  40.,  80.,  40., 80.,
+      40., 80.,  40., 80.,  16.,  32.,  16.,  32.,  16.,  32.,  16.,  32., 32.,
+      64., 32.,  64., 32.,  64.,  32.,  64.,  16.,  32.,  16.,  32.,  16., 32.,
+      16., 32.,  32., 64.,  32.,  64.,  32.,  64.,  32.,  64.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      48., 96., 96., 192., 48., 96., 96., 192., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x7x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 108., 27., 108., 27., 108., 27., 108., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 27., 108., 27., 108.,
+      27., 108., 27., 108., 36., 144., 36., 144., 27., 108., 27., 108.,
+      27., 108., 27., 108., 36., 144., 36., 144., 36., 144., 36., 144.,
+      48., 192., 48., 192., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 27., 108., 27., 108.,
+      27., 108., 27., 108., 36., 144., 36., 144., 27., 108., 27., 108.,
+      27., 108., 27., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 48., 96., 96., 192., 48., 96., 96., 192.,
+      48., 96., 96., 192., 48., 96., 96., 192., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 108., 27., 108., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 27., 108., 27., 108.,
+      36., 144., 36., 144., 36., 144., 36., 144., 27., 108., 27., 108.,
+      27., 108., 27., 108., 36., 144., 36., 144., 48., 192., 48., 192.,
+      48., 192., 48., 192., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 27., 108., 27., 108.,
+      36., 144., 36., 144., 36., 144., 36., 144., 27., 108., 27., 108.,
+      27., 108., 27., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 144., 36., 144., 45., 180., 45., 180., 45., 180., 45., 180.,
+      36., 144., 36., 144., 36., 144., 36., 144., 36., 144., 36., 144.,
+      45., 180., 45., 180., 45., 180., 45., 180., 36., 144., 36., 144.,
+      36., 144., 36., 144., 48., 192., 48., 192., 60., 240., 60., 240.,
+      60., 240., 60., 240., 48., 192., 48., 192., 48., 192., 48., 192.,
+      36., 144., 36., 144., 45., 180., 45., 180., 45., 180., 45., 180.,
+      36., 144., 36., 144., 36., 144., 36., 144., 36., 144., 36., 144.,
+      45., 180., 45., 180., 45., 180., 45., 180., 36., 144., 36., 144.,
+      36., 144., 36., 144.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 48., 96., 96., 192.,
+      48., 96., 96., 192., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      48., 96., 96., 192., 48., 96., 96., 192., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x7x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 108., 27., 108., 27., 108., 27., 108., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 36., 144., 36., 144.,
+      36., 144., 36., 144., 48., 192., 48., 192., 36., 144., 36., 144.,
+      36., 144., 36., 144., 36., 144., 36., 144., 36., 144., 36., 144.,
+      48., 192., 48., 192., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 27., 108., 27., 108.,
+      27., 108., 27., 108., 36., 144., 36., 144., 27., 108., 27., 108.,
+      27., 108., 27., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 36., 72., 72., 144., 36., 72., 72., 144.,
+      48., 96., 96., 192., 48., 96., 96., 192., 48., 96., 96., 192.,
+      48., 96., 96., 192., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 48., 96., 96., 192., 48., 96., 96., 192.,
+      48., 96., 96., 192., 48., 96., 96., 192., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 108., 27., 108., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 36., 144., 36., 144.,
+      48., 192., 48., 192., 48., 192., 48., 192., 36., 144., 36., 144.,
+      36., 144., 36., 144., 36., 144., 36., 144., 48., 192., 48., 192.,
+      48., 192., 48., 192., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 36., 144., 36., 144., 36., 144., 36., 144.,
+      27., 108., 27., 108., 27., 108., 27., 108., 27., 108., 27., 108.,
+      36., 144., 36., 144., 36., 144., 36., 144., 27., 108., 27., 108.,
+      27., 108., 27., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 144., 36., 144., 45., 180., 45., 180., 45., 180., 45., 180.,
+      36., 144., 36., 144., 36., 144., 36., 144., 48., 192., 48., 192.,
+      60., 240., 60., 240., 60., 240., 60., 240., 48., 192., 48., 192.,
+      48., 192., 48., 192., 48., 192., 48., 192., 60., 240., 60., 240.,
+      60., 240., 60., 240., 48., 192., 48., 192., 48., 192., 48., 192.,
+      36., 144., 36., 144., 45., 180., 45., 180., 45., 180., 45., 180.,
+      36., 144., 36., 144., 36., 144., 36., 144., 36., 144., 36., 144.,
+      45., 180., 45., 180., 45., 180., 45., 180., 36., 144., 36., 144.,
+      36., 144., 36., 144.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 60., 120., 120., 240.,
+      60., 120., 120., 240., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      60., 120., 120., 240., 60., 120., 120., 240., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x7x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 144., 36., 144., 36., 144., 36., 144., 48., 192., 48., 192.,
+      36., 144., 36., 144., 36., 144., 36., 144., 45., 180., 45., 180.,
+      45., 180., 45., 180., 60., 240., 60., 240., 45., 180., 45., 180.,
+      45., 180., 45., 180., 45., 180., 45., 180., 45., 180., 45., 180.,
+      60., 240., 60., 240., 45., 180., 45., 180., 45., 180., 45., 180.,
+      36., 144., 36., 144., 36., 144., 36., 144., 48., 192., 48., 192.,
+      36., 144., 36., 144., 36., 144., 36., 144., 36., 144., 36., 144.,
+      36., 144., 36., 144., 48., 192., 48., 192., 36., 144., 36., 144.,
+      36., 144., 36., 144.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x7x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 144., 36., 144., 48., 192., 48., 192., 48., 192., 48., 192.,
+      36., 144., 36., 144., 36., 144., 36., 144., 45., 180., 45., 180.,
+      60., 240., 60., 240., 60., 240., 60., 240., 45., 180., 45., 180.,
+      45., 180., 45., 180., 45., 180., 45., 180., 60., 240., 60., 240.,
+      60., 240., 60., 240., 45., 180., 45., 180., 45., 180., 45., 180.,
+      36., 144., 36., 144., 48., 192., 48., 192., 48., 192., 48., 192.,
+      36., 144., 36., 144., 36., 144., 36., 144., 36., 144., 36., 144.,
+      48., 192., 48., 192., 48., 192., 48., 192., 36., 144., 36., 144.,
+      36., 144., 36., 144.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 60., 120., 120., 240., 60., 120., 120., 240.,
+      75., 150., 150., 300., 75., 150., 150., 300., 75., 150., 150., 300.,
+      75., 150., 150., 300., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 75., 150., 150., 300., 75., 150., 150., 300.,
+      75., 150., 150., 300., 75., 150., 150., 300., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 60., 120., 120., 240.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      60., 120., 120., 240., 60., 120., 120., 240., 60., 120., 120., 240.,
+      60., 120., 120., 240., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 192., 48., 192., 60., 240., 60., 240., 60., 240., 60., 240.,
+      48., 192., 48., 192., 48., 192., 48., 192., 60., 240., 60., 240.,
+      75., 300., 75., 300., 75., 300., 75., 300., 60., 240., 60., 240.,
+      60., 240., 60., 240., 60., 240., 60., 240., 75., 300., 75., 300.,
+      75., 300., 75., 300., 60., 240., 60., 240., 60., 240., 60., 240.,
+      48., 192., 48., 192., 60., 240., 60., 240., 60., 240., 60., 240.,
+      48., 192., 48., 192., 48., 192., 48., 192., 48., 192., 48., 192.,
+      60., 240., 60., 240., 60., 240., 60., 240., 48., 192., 48., 192.,
+      48., 192., 48., 192.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      75.,  150., 75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300.,
+      150., 300., 150., 300., 75.,  150., 75.,  150., 75.,  150., 75.,  150.,
+      150., 300., 150., 300., 150., 300., 150., 300., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 75.,  150., 75.,  150.,
+      75.,  150., 75.,  150., 150., 300., 150., 300., 150., 300., 150., 300.,
+      75.,  150., 75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300.,
+      150., 300., 150., 300., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
@@ -0,0 +1,5251 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow7Stride1Groups4 =
+    GroupWindowStrideTest<Triple, 7, 1, 4>;
+TYPED_TEST_SUITE(FilterBackpropWindow7Stride1Groups4, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      25., 50.,  50.,  100., 25., 50.,  50.,  100., 30., 60.,  60.,  120.,
+      30., 60.,  60.,  120., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      40., 80.,  80.,  160., 40., 80.,  80.,  160., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 30., 60.,  60.,  120., 30., 60.,  60.,  120.,
+      25., 50.,  50.,  100., 25., 50.,  50.,  100., 30., 60.,  60.,  120.,
+      30., 60.,  60.,  120., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 30., 60.,  60.,  120.,
+      30., 60.,  60.,  120., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      40., 80.,  80.,  160., 40., 80.,  80.,  160., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 56., 112., 112., 224., 56., 112., 112., 224.,
+      64., 128., 128., 256., 64., 128., 128., 256., 56., 112., 112., 224.,
+      56., 112., 112., 224., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      40., 80.,  80.,  160., 40., 80.,  80.,  160., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 30., 60.,  60.,  120., 30., 60.,  60.,  120.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 30., 60.,  60.,  120., 30., 60.,  60.,  120.,
+      25., 50.,  50.,  100., 25., 50.,  50.,  100., 30., 60.,  60.,  120.,
+      30., 60.,  60.,  120., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      40., 80.,  80.,  160., 40., 80.,  80.,  160., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 30., 60.,  60.,  120., 30., 60.,  60.,  120.,
+      25., 50.,  50.,  100., 25., 50.,  50.,  100.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8., 4., 8., 4., 8., 4., 8., 8., 16., 8., 16., 8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      25., 100., 25., 100., 30., 120., 30., 120., 35., 140., 35., 140.,
+      40., 160., 40., 160., 35., 140., 35., 140., 30., 120., 30., 120.,
+      25., 100., 25., 100., 30., 120., 30., 120., 36., 144., 36., 144.,
+      42., 168., 42., 168., 48., 192., 48., 192., 42., 168., 42., 168.,
+      36., 144., 36., 144., 30., 120., 30., 120., 35., 140., 35., 140.,
+      42., 168., 42., 168., 49., 196., 49., 196., 56., 224., 56., 224.,
+      49., 196., 49., 196., 42., 168., 42., 168., 35., 140., 35., 140.,
+      40., 160., 40., 160., 48., 192., 48., 192., 56., 224., 56., 224.,
+      64., 256., 64., 256., 56., 224., 56., 224., 48., 192., 48., 192.,
+      40., 160., 40., 160., 35., 140., 35., 140., 42., 168., 42., 168.,
+      49., 196., 49., 196., 56., 224., 56., 224., 49., 196., 49., 196.,
+      42., 168., 42., 168., 35., 140., 35., 140., 30., 120., 30., 120.,
+      36., 144., 36., 144., 42., 168., 42., 168., 48., 192., 48., 192.,
+      42., 168., 42., 168., 36., 144., 36., 144., 30., 120., 30., 120.,
+      25., 100., 25., 100., 30., 120., 30., 120., 35., 140., 35., 140.,
+      40., 160., 40., 160., 35., 140., 35., 140., 30., 120., 30., 120.,
+      25., 100., 25., 100.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      25.,  50.,  25.,  50.,  25.,  50.,  25.,  50.,  50.,  100., 50.,  100.,
+      50.,  100., 50.,  100., 30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,  80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 30.,  60.,  30.,  60.,
+      30.,  60.,  30.,  60.,  60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      25.,  50.,  25.,  50.,  25.,  50.,  25.,  50.,  50.,  100., 50.,  100.,
+      50.,  100., 50.,  100., 30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,  80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,  80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 30.,  60.,  30.,  60.,
+      30.,  60.,  30.,  60.,  60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 30.,  60.,  30.,  60.,
+      30.,  60.,  30.,  60.,  60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      25.,  50.,  25.,  50.,  25.,  50.,  25.,  50.,  50.,  100., 50.,  100.,
+      50.,  100., 50.,  100., 30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,  80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 30.,  60.,  30.,  60.,
+      30.,  60.,  30.,  60.,  60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      25.,  50.,  25.,  50.,  25.,  50.,  25.,  50.,  50.,  100., 50.,  100.,
+      50.,  100., 50.,  100.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60.,  60.,  120., 30., 60.,  60.,  120., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      30., 60.,  60.,  120., 30., 60.,  60.,  120., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 54., 108., 108., 216.,
+      54., 108., 108., 216., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 56., 112., 112., 224.,
+      56., 112., 112., 224., 63., 126., 126., 252., 63., 126., 126., 252.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 56., 112., 112., 224.,
+      56., 112., 112., 224., 64., 128., 128., 256., 64., 128., 128., 256.,
+      72., 144., 144., 288., 72., 144., 144., 288., 64., 128., 128., 256.,
+      64., 128., 128., 256., 56., 112., 112., 224., 56., 112., 112., 224.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 63., 126., 126., 252.,
+      63., 126., 126., 252., 56., 112., 112., 224., 56., 112., 112., 224.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 54., 108., 108., 216., 54., 108., 108., 216.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      30., 60.,  60.,  120., 30., 60.,  60.,  120., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      30., 60.,  60.,  120., 30., 60.,  60.,  120.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x9x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 120., 30., 120., 35., 140., 35., 140., 40., 160., 40., 160.,
+      45., 180., 45., 180., 40., 160., 40., 160., 35., 140., 35., 140.,
+      30., 120., 30., 120., 36., 144., 36., 144., 42., 168., 42., 168.,
+      48., 192., 48., 192., 54., 216., 54., 216., 48., 192., 48., 192.,
+      42., 168., 42., 168., 36., 144., 36., 144., 42., 168., 42., 168.,
+      49., 196., 49., 196., 56., 224., 56., 224., 63., 252., 63., 252.,
+      56., 224., 56., 224., 49., 196., 49., 196., 42., 168., 42., 168.,
+      48., 192., 48., 192., 56., 224., 56., 224., 64., 256., 64., 256.,
+      72., 288., 72., 288., 64., 256., 64., 256., 56., 224., 56., 224.,
+      48., 192., 48., 192., 42., 168., 42., 168., 49., 196., 49., 196.,
+      56., 224., 56., 224., 63., 252., 63., 252., 56., 224., 56., 224.,
+      49., 196., 49., 196., 42., 168., 42., 168., 36., 144., 36., 144.,
+      42., 168., 42., 168., 48., 192., 48., 192., 54., 216., 54., 216.,
+      48., 192., 48., 192., 42., 168., 42., 168., 36., 144., 36., 144.,
+      30., 120., 30., 120., 35., 140., 35., 140., 40., 160., 40., 160.,
+      45., 180., 45., 180., 40., 160., 40., 160., 35., 140., 35., 140.,
+      30., 120., 30., 120.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35., 70.,  70.,  140., 35., 70.,  70.,  140., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      50., 100., 100., 200., 50., 100., 100., 200., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      35., 70.,  70.,  140., 35., 70.,  70.,  140., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      54., 108., 108., 216., 54., 108., 108., 216., 60., 120., 120., 240.,
+      60., 120., 120., 240., 54., 108., 108., 216., 54., 108., 108., 216.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 63., 126., 126., 252.,
+      63., 126., 126., 252., 70., 140., 140., 280., 70., 140., 140., 280.,
+      63., 126., 126., 252., 63., 126., 126., 252., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 64., 128., 128., 256.,
+      64., 128., 128., 256., 72., 144., 144., 288., 72., 144., 144., 288.,
+      80., 160., 160., 320., 80., 160., 160., 320., 72., 144., 144., 288.,
+      72., 144., 144., 288., 64., 128., 128., 256., 64., 128., 128., 256.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      63., 126., 126., 252., 63., 126., 126., 252., 70., 140., 140., 280.,
+      70., 140., 140., 280., 63., 126., 126., 252., 63., 126., 126., 252.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 54., 108., 108., 216.,
+      54., 108., 108., 216., 60., 120., 120., 240., 60., 120., 120., 240.,
+      54., 108., 108., 216., 54., 108., 108., 216., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      35., 70.,  70.,  140., 35., 70.,  70.,  140., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      50., 100., 100., 200., 50., 100., 100., 200., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      35., 70.,  70.,  140., 35., 70.,  70.,  140.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35., 140., 35., 140., 40., 160., 40., 160., 45., 180., 45., 180.,
+      50., 200., 50., 200., 45., 180., 45., 180., 40., 160., 40., 160.,
+      35., 140., 35., 140., 42., 168., 42., 168., 48., 192., 48., 192.,
+      54., 216., 54., 216., 60., 240., 60., 240., 54., 216., 54., 216.,
+      48., 192., 48., 192., 42., 168., 42., 168., 49., 196., 49., 196.,
+      56., 224., 56., 224., 63., 252., 63., 252., 70., 280., 70., 280.,
+      63., 252., 63., 252., 56., 224., 56., 224., 49., 196., 49., 196.,
+      56., 224., 56., 224., 64., 256., 64., 256., 72., 288., 72., 288.,
+      80., 320., 80., 320., 72., 288., 72., 288., 64., 256., 64., 256.,
+      56., 224., 56., 224., 49., 196., 49., 196., 56., 224., 56., 224.,
+      63., 252., 63., 252., 70., 280., 70., 280., 63., 252., 63., 252.,
+      56., 224., 56., 224., 49., 196., 49., 196., 42., 168., 42., 168.,
+      48., 192., 48., 192., 54., 216., 54., 216., 60., 240., 60., 240.,
+      54., 216., 54., 216., 48., 192., 48., 192., 42., 168., 42., 168.,
+      35., 140., 35., 140., 40., 160., 40., 160., 45., 180., 45., 180.,
+      50., 200., 50., 200., 45., 180., 45., 180., 40., 160., 40., 160.,
+      35., 140., 35., 140.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      50.,  100., 50.,  100., 50.,  100., 50.,  100., 100., 200., 100., 200.,
+      100., 200., 100., 200., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 140., 280., 140., 280., 140., 280., 140., 280.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 160., 320., 160., 320.,
+      160., 320., 160., 320., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      140., 280., 140., 280., 140., 280., 140., 280., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      50.,  100., 50.,  100., 50.,  100., 50.,  100., 100., 200., 100., 200.,
+      100., 200., 100., 200., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 60.,  60.,  120., 30., 60.,  60.,  120., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      30., 60.,  60.,  120., 30., 60.,  60.,  120., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 35., 70.,  70.,  140.,
+      35., 70.,  70.,  140., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 56., 112., 112., 224.,
+      56., 112., 112., 224., 64., 128., 128., 256., 64., 128., 128., 256.,
+      56., 112., 112., 224., 56., 112., 112., 224., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 54., 108., 108., 216.,
+      54., 108., 108., 216., 63., 126., 126., 252., 63., 126., 126., 252.,
+      72., 144., 144., 288., 72., 144., 144., 288., 63., 126., 126., 252.,
+      63., 126., 126., 252., 54., 108., 108., 216., 54., 108., 108., 216.,
+      45., 90.,  90.,  180., 45., 90.,  90.,  180., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      56., 112., 112., 224., 56., 112., 112., 224., 64., 128., 128., 256.,
+      64., 128., 128., 256., 56., 112., 112., 224., 56., 112., 112., 224.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 35., 70.,  70.,  140., 35., 70.,  70.,  140.,
+      30., 60.,  60.,  120., 30., 60.,  60.,  120., 36., 72.,  72.,  144.,
+      36., 72.,  72.,  144., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 36., 72.,  72.,  144., 36., 72.,  72.,  144.,
+      30., 60.,  60.,  120., 30., 60.,  60.,  120.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12.,
+      24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12.,
+      24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24.,
+      12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 120., 30., 120., 36., 144., 36., 144., 42., 168., 42., 168.,
+      48., 192., 48., 192., 42., 168., 42., 168., 36., 144., 36., 144.,
+      30., 120., 30., 120., 35., 140., 35., 140., 42., 168., 42., 168.,
+      49., 196., 49., 196., 56., 224., 56., 224., 49., 196., 49., 196.,
+      42., 168., 42., 168., 35., 140., 35., 140., 40., 160., 40., 160.,
+      48., 192., 48., 192., 56., 224., 56., 224., 64., 256., 64., 256.,
+      56., 224., 56., 224., 48., 192., 48., 192., 40., 160., 40., 160.,
+      45., 180., 45., 180., 54., 216., 54., 216., 63., 252., 63., 252.,
+      72., 288., 72., 288., 63., 252., 63., 252., 54., 216., 54., 216.,
+      45., 180., 45., 180., 40., 160., 40., 160., 48., 192., 48., 192.,
+      56., 224., 56., 224., 64., 256., 64., 256., 56., 224., 56., 224.,
+      48., 192., 48., 192., 40., 160., 40., 160., 35., 140., 35., 140.,
+      42., 168., 42., 168., 49., 196., 49., 196., 56., 224., 56., 224.,
+      49., 196., 49., 196., 42., 168., 42., 168., 35., 140., 35., 140.,
+      30., 120., 30., 120., 36., 144., 36., 144., 42., 168., 42., 168.,
+      48., 192., 48., 192., 42., 168., 42., 168., 36., 144., 36., 144.,
+      30., 120., 30., 120.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,  90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 35.,  70.,  35.,  70.,
+      35.,  70.,  35.,  70.,  70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 36.,  72.,  36.,  72.,
+      36.,  72.,  36.,  72.,  72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      30.,  60.,  30.,  60.,  30.,  60.,  30.,  60.,  60.,  120., 60.,  120.,
+      60.,  120., 60.,  120.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      54., 108., 108., 216., 54., 108., 108., 216., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 63., 126., 126., 252.,
+      63., 126., 126., 252., 56., 112., 112., 224., 56., 112., 112., 224.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      56., 112., 112., 224., 56., 112., 112., 224., 64., 128., 128., 256.,
+      64., 128., 128., 256., 72., 144., 144., 288., 72., 144., 144., 288.,
+      64., 128., 128., 256., 64., 128., 128., 256., 56., 112., 112., 224.,
+      56., 112., 112., 224., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      54., 108., 108., 216., 54., 108., 108., 216., 63., 126., 126., 252.,
+      63., 126., 126., 252., 72., 144., 144., 288., 72., 144., 144., 288.,
+      81., 162., 162., 324., 81., 162., 162., 324., 72., 144., 144., 288.,
+      72., 144., 144., 288., 63., 126., 126., 252., 63., 126., 126., 252.,
+      54., 108., 108., 216., 54., 108., 108., 216., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 56., 112., 112., 224., 56., 112., 112., 224.,
+      64., 128., 128., 256., 64., 128., 128., 256., 72., 144., 144., 288.,
+      72., 144., 144., 288., 64., 128., 128., 256., 64., 128., 128., 256.,
+      56., 112., 112., 224., 56., 112., 112., 224., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      49., 98.,  98.,  196., 49., 98.,  98.,  196., 56., 112., 112., 224.,
+      56., 112., 112., 224., 63., 126., 126., 252., 63., 126., 126., 252.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      54., 108., 108., 216., 54., 108., 108., 216., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      36., 72.,  72.,  144., 36., 72.,  72.,  144.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36.,
+      18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18.,
+      36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18.,
+      36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36.,
+      18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36.,
+      18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x9x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 144., 36., 144., 42., 168., 42., 168., 48., 192., 48., 192.,
+      54., 216., 54., 216., 48., 192., 48., 192., 42., 168., 42., 168.,
+      36., 144., 36., 144., 42., 168., 42., 168., 49., 196., 49., 196.,
+      56., 224., 56., 224., 63., 252., 63., 252., 56., 224., 56., 224.,
+      49., 196., 49., 196., 42., 168., 42., 168., 48., 192., 48., 192.,
+      56., 224., 56., 224., 64., 256., 64., 256., 72., 288., 72., 288.,
+      64., 256., 64., 256., 56., 224., 56., 224., 48., 192., 48., 192.,
+      54., 216., 54., 216., 63., 252., 63., 252., 72., 288., 72., 288.,
+      81., 324., 81., 324., 72., 288., 72., 288., 63., 252., 63., 252.,
+      54., 216., 54., 216., 48., 192., 48., 192., 56., 224., 56., 224.,
+      64., 256., 64., 256., 72., 288., 72., 288., 64., 256., 64., 256.,
+      56., 224., 56., 224., 48., 192., 48., 192., 42., 168., 42., 168.,
+      49., 196., 49., 196., 56., 224., 56., 224., 63., 252., 63., 252.,
+      56., 224., 56., 224., 49., 196., 49., 196., 42., 168., 42., 168.,
+      36., 144., 36., 144., 42., 168., 42., 168., 48., 192., 48., 192.,
+      54., 216., 54., 216., 48., 192., 48., 192., 42., 168., 42., 168.,
+      36., 144., 36., 144.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      81.,  162., 81.,  162., 81.,  162., 81.,  162., 162., 324., 162., 324.,
+      162., 324., 162., 324., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  144., 72.,  144.,
+      72.,  144., 72.,  144.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 54., 108., 108., 216., 54., 108., 108., 216.,
+      60., 120., 120., 240., 60., 120., 120., 240., 54., 108., 108., 216.,
+      54., 108., 108., 216., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      63., 126., 126., 252., 63., 126., 126., 252., 70., 140., 140., 280.,
+      70., 140., 140., 280., 63., 126., 126., 252., 63., 126., 126., 252.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      64., 128., 128., 256., 64., 128., 128., 256., 72., 144., 144., 288.,
+      72., 144., 144., 288., 80., 160., 160., 320., 80., 160., 160., 320.,
+      72., 144., 144., 288., 72., 144., 144., 288., 64., 128., 128., 256.,
+      64., 128., 128., 256., 56., 112., 112., 224., 56., 112., 112., 224.,
+      63., 126., 126., 252., 63., 126., 126., 252., 72., 144., 144., 288.,
+      72., 144., 144., 288., 81., 162., 162., 324., 81., 162., 162., 324.,
+      90., 180., 180., 360., 90., 180., 180., 360., 81., 162., 162., 324.,
+      81., 162., 162., 324., 72., 144., 144., 288., 72., 144., 144., 288.,
+      63., 126., 126., 252., 63., 126., 126., 252., 56., 112., 112., 224.,
+      56., 112., 112., 224., 64., 128., 128., 256., 64., 128., 128., 256.,
+      72., 144., 144., 288., 72., 144., 144., 288., 80., 160., 160., 320.,
+      80., 160., 160., 320., 72., 144., 144., 288., 72., 144., 144., 288.,
+      64., 128., 128., 256., 64., 128., 128., 256., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 63., 126., 126., 252.,
+      63., 126., 126., 252., 70., 140., 140., 280., 70., 140., 140., 280.,
+      63., 126., 126., 252., 63., 126., 126., 252., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 54., 108., 108., 216., 54., 108., 108., 216.,
+      60., 120., 120., 240., 60., 120., 120., 240., 54., 108., 108., 216.,
+      54., 108., 108., 216., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      42., 168., 42., 168., 48., 192., 48., 192., 54., 216., 54., 216.,
+      60., 240., 60., 240., 54., 216., 54., 216., 48., 192., 48., 192.,
+      42., 168., 42., 168., 49., 196., 49., 196., 56., 224., 56., 224.,
+      63., 252., 63., 252., 70., 280., 70., 280., 63., 252., 63., 252.,
+      56., 224., 56., 224., 49., 196., 49., 196., 56., 224., 56., 224.,
+      64., 256., 64., 256., 72., 288., 72., 288., 80., 320., 80., 320.,
+      72., 288., 72., 288., 64., 256., 64., 256., 56., 224., 56., 224.,
+      63., 252., 63., 252., 72., 288., 72., 288., 81., 324., 81., 324.,
+      90., 360., 90., 360., 81., 324., 81., 324., 72., 288., 72., 288.,
+      63., 252., 63., 252., 56., 224., 56., 224., 64., 256., 64., 256.,
+      72., 288., 72., 288., 80., 320., 80., 320., 72., 288., 72., 288.,
+      64., 256., 64., 256., 56., 224., 56., 224., 49., 196., 49., 196.,
+      56., 224., 56., 224., 63., 252., 63., 252., 70., 280., 70., 280.,
+      63., 252., 63., 252., 56., 224., 56., 224., 49., 196., 49., 196.,
+      42., 168., 42., 168., 48., 192., 48., 192., 54., 216., 54., 216.,
+      60., 240., 60., 240., 54., 216., 54., 216., 48., 192., 48., 192.,
+      42., 168., 42., 168.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      140., 280., 140., 280., 140., 280., 140., 280., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 160., 320., 160., 320., 160., 320., 160., 320.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 81.,  162., 81.,  162.,
+      81.,  162., 81.,  162., 162., 324., 162., 324., 162., 324., 162., 324.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 81.,  162., 81.,  162., 81.,  162., 81.,  162.,
+      162., 324., 162., 324., 162., 324., 162., 324., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      160., 320., 160., 320., 160., 320., 160., 320., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 140., 280., 140., 280., 140., 280., 140., 280.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35., 70.,  70.,  140., 35., 70.,  70.,  140., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      35., 70.,  70.,  140., 35., 70.,  70.,  140., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      56., 112., 112., 224., 56., 112., 112., 224., 64., 128., 128., 256.,
+      64., 128., 128., 256., 56., 112., 112., 224., 56., 112., 112., 224.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 40., 80.,  80.,  160.,
+      40., 80.,  80.,  160., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      54., 108., 108., 216., 54., 108., 108., 216., 63., 126., 126., 252.,
+      63., 126., 126., 252., 72., 144., 144., 288., 72., 144., 144., 288.,
+      63., 126., 126., 252., 63., 126., 126., 252., 54., 108., 108., 216.,
+      54., 108., 108., 216., 45., 90.,  90.,  180., 45., 90.,  90.,  180.,
+      50., 100., 100., 200., 50., 100., 100., 200., 60., 120., 120., 240.,
+      60., 120., 120., 240., 70., 140., 140., 280., 70., 140., 140., 280.,
+      80., 160., 160., 320., 80., 160., 160., 320., 70., 140., 140., 280.,
+      70., 140., 140., 280., 60., 120., 120., 240., 60., 120., 120., 240.,
+      50., 100., 100., 200., 50., 100., 100., 200., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 54., 108., 108., 216., 54., 108., 108., 216.,
+      63., 126., 126., 252., 63., 126., 126., 252., 72., 144., 144., 288.,
+      72., 144., 144., 288., 63., 126., 126., 252., 63., 126., 126., 252.,
+      54., 108., 108., 216., 54., 108., 108., 216., 45., 90.,  90.,  180.,
+      45., 90.,  90.,  180., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      48., 96.,  96.,  192., 48., 96.,  96.,  192., 56., 112., 112., 224.,
+      56., 112., 112., 224., 64., 128., 128., 256., 64., 128., 128., 256.,
+      56., 112., 112., 224., 56., 112., 112., 224., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 40., 80.,  80.,  160., 40., 80.,  80.,  160.,
+      35., 70.,  70.,  140., 35., 70.,  70.,  140., 42., 84.,  84.,  168.,
+      42., 84.,  84.,  168., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      56., 112., 112., 224., 56., 112., 112., 224., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 42., 84.,  84.,  168., 42., 84.,  84.,  168.,
+      35., 70.,  70.,  140., 35., 70.,  70.,  140.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32.,
+      16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16.,
+      32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,
+      16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16.,
+      8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16.,
+      8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16.,
+      8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 8.,
+      16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16.,
+      32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32.,
+      16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32.,
+      16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35., 140., 35., 140., 42., 168., 42., 168., 49., 196., 49., 196.,
+      56., 224., 56., 224., 49., 196., 49., 196., 42., 168., 42., 168.,
+      35., 140., 35., 140., 40., 160., 40., 160., 48., 192., 48., 192.,
+      56., 224., 56., 224., 64., 256., 64., 256., 56., 224., 56., 224.,
+      48., 192., 48., 192., 40., 160., 40., 160., 45., 180., 45., 180.,
+      54., 216., 54., 216., 63., 252., 63., 252., 72., 288., 72., 288.,
+      63., 252., 63., 252., 54., 216., 54., 216., 45., 180., 45., 180.,
+      50., 200., 50., 200., 60., 240., 60., 240., 70., 280., 70., 280.,
+      80., 320., 80., 320., 70., 280., 70., 280., 60., 240., 60., 240.,
+      50., 200., 50., 200., 45., 180., 45., 180., 54., 216., 54., 216.,
+      63., 252., 63., 252., 72., 288., 72., 288., 63., 252., 63., 252.,
+      54., 216., 54., 216., 45., 180., 45., 180., 40., 160., 40., 160.,
+      48., 192., 48., 192., 56., 224., 56., 224., 64., 256., 64., 256.,
+      56., 224., 56., 224., 48., 192., 48., 192., 40., 160., 40., 160.,
+      35., 140., 35., 140., 42., 168., 42., 168., 49., 196., 49., 196.,
+      56., 224., 56., 224., 49., 196., 49., 196., 42., 168., 42., 168.,
+      35., 140., 35., 140.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 40.,  80.,  40.,  80.,  40.,  80.,  40.,  80.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 45.,  90.,  45.,  90.,
+      45.,  90.,  45.,  90.,  90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      50.,  100., 50.,  100., 50.,  100., 50.,  100., 100., 200., 100., 200.,
+      100., 200., 100., 200., 60.,  120., 60.,  120., 60.,  120., 60.,  120.,
+      120., 240., 120., 240., 120., 240., 120., 240., 70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 140., 280., 140., 280., 140., 280., 140., 280.,
+      80.,  160., 80.,  160., 80.,  160., 80.,  160., 160., 320., 160., 320.,
+      160., 320., 160., 320., 70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      140., 280., 140., 280., 140., 280., 140., 280., 60.,  120., 60.,  120.,
+      60.,  120., 60.,  120., 120., 240., 120., 240., 120., 240., 120., 240.,
+      50.,  100., 50.,  100., 50.,  100., 50.,  100., 100., 200., 100., 200.,
+      100., 200., 100., 200., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 108., 216., 108., 216.,
+      108., 216., 108., 216., 45.,  90.,  45.,  90.,  45.,  90.,  45.,  90.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,  96.,  192., 96.,  192.,
+      96.,  192., 96.,  192., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 40.,  80.,  40.,  80.,
+      40.,  80.,  40.,  80.,  80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,
+      84.,  168., 84.,  168., 84.,  168., 84.,  168., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 42.,  84.,  42.,  84.,
+      42.,  84.,  42.,  84.,  84.,  168., 84.,  168., 84.,  168., 84.,  168.,
+      35.,  70.,  35.,  70.,  35.,  70.,  35.,  70.,  70.,  140., 70.,  140.,
+      70.,  140., 70.,  140.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      63., 126., 126., 252., 63., 126., 126., 252., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 56., 112., 112., 224., 56., 112., 112., 224.,
+      64., 128., 128., 256., 64., 128., 128., 256., 72., 144., 144., 288.,
+      72., 144., 144., 288., 64., 128., 128., 256., 64., 128., 128., 256.,
+      56., 112., 112., 224., 56., 112., 112., 224., 48., 96.,  96.,  192.,
+      48., 96.,  96.,  192., 54., 108., 108., 216., 54., 108., 108., 216.,
+      63., 126., 126., 252., 63., 126., 126., 252., 72., 144., 144., 288.,
+      72., 144., 144., 288., 81., 162., 162., 324., 81., 162., 162., 324.,
+      72., 144., 144., 288., 72., 144., 144., 288., 63., 126., 126., 252.,
+      63., 126., 126., 252., 54., 108., 108., 216., 54., 108., 108., 216.,
+      60., 120., 120., 240., 60., 120., 120., 240., 70., 140., 140., 280.,
+      70., 140., 140., 280., 80., 160., 160., 320., 80., 160., 160., 320.,
+      90., 180., 180., 360., 90., 180., 180., 360., 80., 160., 160., 320.,
+      80., 160., 160., 320., 70., 140., 140., 280., 70., 140., 140., 280.,
+      60., 120., 120., 240., 60., 120., 120., 240., 54., 108., 108., 216.,
+      54., 108., 108., 216., 63., 126., 126., 252., 63., 126., 126., 252.,
+      72., 144., 144., 288., 72., 144., 144., 288., 81., 162., 162., 324.,
+      81., 162., 162., 324., 72., 144., 144., 288., 72., 144., 144., 288.,
+      63., 126., 126., 252., 63., 126., 126., 252., 54., 108., 108., 216.,
+      54., 108., 108., 216., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      56., 112., 112., 224., 56., 112., 112., 224., 64., 128., 128., 256.,
+      64., 128., 128., 256., 72., 144., 144., 288., 72., 144., 144., 288.,
+      64., 128., 128., 256., 64., 128., 128., 256., 56., 112., 112., 224.,
+      56., 112., 112., 224., 48., 96.,  96.,  192., 48., 96.,  96.,  192.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168., 49., 98.,  98.,  196.,
+      49., 98.,  98.,  196., 56., 112., 112., 224., 56., 112., 112., 224.,
+      63., 126., 126., 252., 63., 126., 126., 252., 56., 112., 112., 224.,
+      56., 112., 112., 224., 49., 98.,  98.,  196., 49., 98.,  98.,  196.,
+      42., 84.,  84.,  168., 42., 84.,  84.,  168.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x9x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      42., 168., 42., 168., 49., 196., 49., 196., 56., 224., 56., 224.,
+      63., 252., 63., 252., 56., 224., 56., 224., 49., 196., 49., 196.,
+      42., 168., 42., 168., 48., 192., 48., 192., 56., 224., 56., 224.,
+      64., 256., 64., 256., 72., 288., 72., 288., 64., 256., 64., 256.,
+      56., 224., 56., 224., 48., 192., 48., 192., 54., 216., 54., 216.,
+      63., 252., 63., 252., 72., 288., 72., 288., 81., 324., 81., 324.,
+      72., 288., 72., 288., 63., 252., 63., 252., 54., 216., 54., 216.,
+      60., 240., 60., 240., 70., 280., 70., 280., 80., 320., 80., 320.,
+      90., 360., 90., 360., 80., 320., 80., 320., 70., 280., 70., 280.,
+      60., 240., 60., 240., 54., 216., 54., 216., 63., 252., 63., 252.,
+      72., 288., 72., 288., 81., 324., 81., 324., 72., 288., 72., 288.,
+      63., 252., 63., 252., 54., 216., 54., 216., 48., 192., 48., 192.,
+      56., 224., 56., 224., 64., 256., 64., 256., 72., 288., 72., 288.,
+      64., 256., 64., 256., 56., 224., 56., 224., 48., 192., 48., 192.,
+      42., 168., 42., 168., 49., 196., 49., 196., 56., 224., 56., 224.,
+      63., 252., 63., 252., 56., 224., 56., 224., 49., 196., 49., 196.,
+      42., 168., 42., 168.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 48.,  96.,  48.,  96.,  48.,  96.,  48.,  96.,
+      96.,  192., 96.,  192., 96.,  192., 96.,  192., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 81.,  162., 81.,  162.,
+      81.,  162., 81.,  162., 162., 324., 162., 324., 162., 324., 162., 324.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 108., 216., 108., 216., 108., 216., 108., 216.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 70.,  140., 70.,  140., 70.,  140., 70.,  140.,
+      140., 280., 140., 280., 140., 280., 140., 280., 80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 160., 320., 160., 320., 160., 320., 160., 320.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      160., 320., 160., 320., 160., 320., 160., 320., 70.,  140., 70.,  140.,
+      70.,  140., 70.,  140., 140., 280., 140., 280., 140., 280., 140., 280.,
+      60.,  120., 60.,  120., 60.,  120., 60.,  120., 120., 240., 120., 240.,
+      120., 240., 120., 240., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 81.,  162., 81.,  162., 81.,  162., 81.,  162.,
+      162., 324., 162., 324., 162., 324., 162., 324., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      108., 216., 108., 216., 108., 216., 108., 216., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      56.,  112., 56.,  112., 56.,  112., 56.,  112., 112., 224., 112., 224.,
+      112., 224., 112., 224., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 48.,  96.,  48.,  96.,
+      48.,  96.,  48.,  96.,  96.,  192., 96.,  192., 96.,  192., 96.,  192.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168., 49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,
+      98.,  196., 98.,  196., 98.,  196., 98.,  196., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      63.,  126., 63.,  126., 63.,  126., 63.,  126., 126., 252., 126., 252.,
+      126., 252., 126., 252., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 49.,  98.,  49.,  98.,
+      49.,  98.,  49.,  98.,  98.,  196., 98.,  196., 98.,  196., 98.,  196.,
+      42.,  84.,  42.,  84.,  42.,  84.,  42.,  84.,  84.,  168., 84.,  168.,
+      84.,  168., 84.,  168.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16.,
+      32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32.,
+      16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16.,
+      32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64.,
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16.,
+      32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32.,
+      16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16.,
+      32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64.,
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16.,
+      32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32.,
+      16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16.,
+      32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64.,
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16.,
+      32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32.,
+      16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16.,
+      32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64.,
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16.,
+      32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32.,
+      16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16.,
+      32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64.,
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16.,
+      32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32.,
+      16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16.,
+      32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64.,
+      16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64., 32.,
+      64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32., 64.,
+      32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32., 32.,
+      64., 32., 64., 16., 32., 16., 32., 32., 64., 32., 64., 16., 32., 16., 32.,
+      32., 64., 32., 64.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      49.,  98.,  98.,  196., 49.,  98.,  98.,  196., 56., 112., 112., 224.,
+      56.,  112., 112., 224., 63.,  126., 126., 252., 63., 126., 126., 252.,
+      70.,  140., 140., 280., 70.,  140., 140., 280., 63., 126., 126., 252.,
+      63.,  126., 126., 252., 56.,  112., 112., 224., 56., 112., 112., 224.,
+      49.,  98.,  98.,  196., 49.,  98.,  98.,  196., 56., 112., 112., 224.,
+      56.,  112., 112., 224., 64.,  128., 128., 256., 64., 128., 128., 256.,
+      72.,  144., 144., 288., 72.,  144., 144., 288., 80., 160., 160., 320.,
+      80.,  160., 160., 320., 72.,  144., 144., 288., 72., 144., 144., 288.,
+      64.,  128., 128., 256., 64.,  128., 128., 256., 56., 112., 112., 224.,
+      56.,  112., 112., 224., 63.,  126., 126., 252., 63., 126., 126., 252.,
+      72.,  144., 144., 288., 72.,  144., 144., 288., 81., 162., 162., 324.,
+      81.,  162., 162., 324., 90.,  180., 180., 360., 90., 180., 180., 360.,
+      81.,  162., 162., 324., 81.,  162., 162., 324., 72., 144., 144., 288.,
+      72.,  144., 144., 288., 63.,  126., 126., 252., 63., 126., 126., 252.,
+      70.,  140., 140., 280., 70.,  140., 140., 280., 80., 160., 160., 320.,
+      80.,  160., 160., 320., 90.,  180., 180., 360., 90., 180., 180., 360.,
+      100., 200., 200., 400., 100., 200., 200., 400., 90., 180., 180., 360.,
+      90.,  180., 180., 360., 80.,  160., 160., 320., 80., 160., 160., 320.,
+      70.,  140., 140., 280., 70.,  140., 140., 280., 63., 126., 126., 252.,
+      63.,  126., 126., 252., 72.,  144., 144., 288., 72., 144., 144., 288.,
+      81.,  162., 162., 324., 81.,  162., 162., 324., 90., 180., 180., 360.,
+      90.,  180., 180., 360., 81.,  162., 162., 324., 81., 162., 162., 324.,
+      72.,  144., 144., 288., 72.,  144., 144., 288., 63., 126., 126., 252.,
+      63.,  126., 126., 252., 56.,  112., 112., 224., 56., 112., 112., 224.,
+      64.,  128., 128., 256., 64.,  128., 128., 256., 72., 144., 144., 288.,
+      72.,  144., 144., 288., 80.,  160., 160., 320., 80., 160., 160., 320.,
+      72.,  144., 144., 288., 72.,  144., 144., 288., 64., 128., 128., 256.,
+      64.,  128., 128., 256., 56.,  112., 112., 224., 56., 112., 112., 224.,
+      49.,  98.,  98.,  196., 49.,  98.,  98.,  196., 56., 112., 112., 224.,
+      56.,  112., 112., 224., 63.,  126., 126., 252., 63., 126., 126., 252.,
+      70.,  140., 140., 280., 70.,  140., 140., 280., 63., 126., 126., 252.,
+      63.,  126., 126., 252., 56.,  112., 112., 224., 56., 112., 112., 224.,
+      49.,  98.,  98.,  196., 49.,  98.,  98.,  196.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32.,
+      64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32.,
+      64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32.,
+      64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16.,
+      32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16.,
+      32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16.,
+      32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32.,
+      64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32.,
+      64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32.,
+      64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16.,
+      32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16.,
+      32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16.,
+      32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32.,
+      64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32.,
+      64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64.,
+      32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32.,
+      64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32., 16.,
+      32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16., 32.,
+      16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16.,
+      32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32.,
+      16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32.,
+      16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 16.,
+      32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32.,
+      64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64.,
+      32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64.,
+      32., 64., 32., 64.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      49.,  196., 49.,  196., 56., 224., 56., 224., 63., 252., 63., 252.,
+      70.,  280., 70.,  280., 63., 252., 63., 252., 56., 224., 56., 224.,
+      49.,  196., 49.,  196., 56., 224., 56., 224., 64., 256., 64., 256.,
+      72.,  288., 72.,  288., 80., 320., 80., 320., 72., 288., 72., 288.,
+      64.,  256., 64.,  256., 56., 224., 56., 224., 63., 252., 63., 252.,
+      72.,  288., 72.,  288., 81., 324., 81., 324., 90., 360., 90., 360.,
+      81.,  324., 81.,  324., 72., 288., 72., 288., 63., 252., 63., 252.,
+      70.,  280., 70.,  280., 80., 320., 80., 320., 90., 360., 90., 360.,
+      100., 400., 100., 400., 90., 360., 90., 360., 80., 320., 80., 320.,
+      70.,  280., 70.,  280., 63., 252., 63., 252., 72., 288., 72., 288.,
+      81.,  324., 81.,  324., 90., 360., 90., 360., 81., 324., 81., 324.,
+      72.,  288., 72.,  288., 63., 252., 63., 252., 56., 224., 56., 224.,
+      64.,  256., 64.,  256., 72., 288., 72., 288., 80., 320., 80., 320.,
+      72.,  288., 72.,  288., 64., 256., 64., 256., 56., 224., 56., 224.,
+      49.,  196., 49.,  196., 56., 224., 56., 224., 63., 252., 63., 252.,
+      70.,  280., 70.,  280., 63., 252., 63., 252., 56., 224., 56., 224.,
+      49.,  196., 49.,  196.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 140., 280., 140., 280.,
+      140., 280., 140., 280., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 64.,  128., 64.,  128.,
+      64.,  128., 64.,  128., 128., 256., 128., 256., 128., 256., 128., 256.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      160., 320., 160., 320., 160., 320., 160., 320., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 81.,  162., 81.,  162., 81.,  162., 81.,  162.,
+      162., 324., 162., 324., 162., 324., 162., 324., 90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360., 180., 360.,
+      81.,  162., 81.,  162., 81.,  162., 81.,  162., 162., 324., 162., 324.,
+      162., 324., 162., 324., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 140., 280., 140., 280.,
+      140., 280., 140., 280., 80.,  160., 80.,  160., 80.,  160., 80.,  160.,
+      160., 320., 160., 320., 160., 320., 160., 320., 90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360., 180., 360.,
+      100., 200., 100., 200., 100., 200., 100., 200., 200., 400., 200., 400.,
+      200., 400., 200., 400., 90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      180., 360., 180., 360., 180., 360., 180., 360., 80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 160., 320., 160., 320., 160., 320., 160., 320.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 140., 280., 140., 280.,
+      140., 280., 140., 280., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 144., 288., 144., 288., 144., 288., 144., 288.,
+      81.,  162., 81.,  162., 81.,  162., 81.,  162., 162., 324., 162., 324.,
+      162., 324., 162., 324., 90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      180., 360., 180., 360., 180., 360., 180., 360., 81.,  162., 81.,  162.,
+      81.,  162., 81.,  162., 162., 324., 162., 324., 162., 324., 162., 324.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      64.,  128., 64.,  128., 64.,  128., 64.,  128., 128., 256., 128., 256.,
+      128., 256., 128., 256., 72.,  144., 72.,  144., 72.,  144., 72.,  144.,
+      144., 288., 144., 288., 144., 288., 144., 288., 80.,  160., 80.,  160.,
+      80.,  160., 80.,  160., 160., 320., 160., 320., 160., 320., 160., 320.,
+      72.,  144., 72.,  144., 72.,  144., 72.,  144., 144., 288., 144., 288.,
+      144., 288., 144., 288., 64.,  128., 64.,  128., 64.,  128., 64.,  128.,
+      128., 256., 128., 256., 128., 256., 128., 256., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196., 56.,  112., 56.,  112., 56.,  112., 56.,  112.,
+      112., 224., 112., 224., 112., 224., 112., 224., 63.,  126., 63.,  126.,
+      63.,  126., 63.,  126., 126., 252., 126., 252., 126., 252., 126., 252.,
+      70.,  140., 70.,  140., 70.,  140., 70.,  140., 140., 280., 140., 280.,
+      140., 280., 140., 280., 63.,  126., 63.,  126., 63.,  126., 63.,  126.,
+      126., 252., 126., 252., 126., 252., 126., 252., 56.,  112., 56.,  112.,
+      56.,  112., 56.,  112., 112., 224., 112., 224., 112., 224., 112., 224.,
+      49.,  98.,  49.,  98.,  49.,  98.,  49.,  98.,  98.,  196., 98.,  196.,
+      98.,  196., 98.,  196.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  150., 150., 300., 75.,  150., 150., 300., 90.,  180., 180., 360.,
+      90.,  180., 180., 360., 105., 210., 210., 420., 105., 210., 210., 420.,
+      120., 240., 240., 480., 120., 240., 240., 480., 105., 210., 210., 420.,
+      105., 210., 210., 420., 90.,  180., 180., 360., 90.,  180., 180., 360.,
+      75.,  150., 150., 300., 75.,  150., 150., 300., 90.,  180., 180., 360.,
+      90.,  180., 180., 360., 108., 216., 216., 432., 108., 216., 216., 432.,
+      126., 252., 252., 504., 126., 252., 252., 504., 144., 288., 288., 576.,
+      144., 288., 288., 576., 126., 252., 252., 504., 126., 252., 252., 504.,
+      108., 216., 216., 432., 108., 216., 216., 432., 90.,  180., 180., 360.,
+      90.,  180., 180., 360., 105., 210., 210., 420., 105., 210., 210., 420.,
+      126., 252., 252., 504., 126., 252., 252., 504., 147., 294., 294., 588.,
+      147., 294., 294., 588., 168., 336., 336., 672., 168., 336., 336., 672.,
+      147., 294., 294., 588., 147., 294., 294., 588., 126., 252., 252., 504.,
+      126., 252., 252., 504., 105., 210., 210., 420., 105., 210., 210., 420.,
+      120., 240., 240., 480., 120., 240., 240., 480., 144., 288., 288., 576.,
+      144., 288., 288., 576., 168., 336., 336., 672., 168., 336., 336., 672.,
+      192., 384., 384., 768., 192., 384., 384., 768., 168., 336., 336., 672.,
+      168., 336., 336., 672., 144., 288., 288., 576., 144., 288., 288., 576.,
+      120., 240., 240., 480., 120., 240., 240., 480., 105., 210., 210., 420.,
+      105., 210., 210., 420., 126., 252., 252., 504., 126., 252., 252., 504.,
+      147., 294., 294., 588., 147., 294., 294., 588., 168., 336., 336., 672.,
+      168., 336., 336., 672., 147., 294., 294., 588., 147., 294., 294., 588.,
+      126., 252., 252., 504., 126., 252., 252., 504., 105., 210., 210., 420.,
+      105., 210., 210., 420., 90.,  180., 180., 360., 90.,  180., 180., 360.,
+      108., 216., 216., 432., 108., 216., 216., 432., 126., 252., 252., 504.,
+      126., 252., 252., 504., 144., 288., 288., 576., 144., 288., 288., 576.,
+      126., 252., 252., 504., 126., 252., 252., 504., 108., 216., 216., 432.,
+      108., 216., 216., 432., 90.,  180., 180., 360., 90.,  180., 180., 360.,
+      75.,  150., 150., 300., 75.,  150., 150., 300., 90.,  180., 180., 360.,
+      90.,  180., 180., 360., 105., 210., 210., 420., 105., 210., 210., 420.,
+      120., 240., 240., 480., 120., 240., 240., 480., 105., 210., 210., 420.,
+      105., 210., 210., 420., 90.,  180., 180., 360., 90.,  180., 180., 360.,
+      75.,  150., 150., 300., 75.,  150., 150., 300.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48.,
+      24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12.,
+      24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24.,
+      12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24.,
+      12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 12.,
+      24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48.,
+      24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48.,
+      24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  300., 75.,  300., 90.,  360., 90.,  360., 105., 420., 105., 420.,
+      120., 480., 120., 480., 105., 420., 105., 420., 90.,  360., 90.,  360.,
+      75.,  300., 75.,  300., 90.,  360., 90.,  360., 108., 432., 108., 432.,
+      126., 504., 126., 504., 144., 576., 144., 576., 126., 504., 126., 504.,
+      108., 432., 108., 432., 90.,  360., 90.,  360., 105., 420., 105., 420.,
+      126., 504., 126., 504., 147., 588., 147., 588., 168., 672., 168., 672.,
+      147., 588., 147., 588., 126., 504., 126., 504., 105., 420., 105., 420.,
+      120., 480., 120., 480., 144., 576., 144., 576., 168., 672., 168., 672.,
+      192., 768., 192., 768., 168., 672., 168., 672., 144., 576., 144., 576.,
+      120., 480., 120., 480., 105., 420., 105., 420., 126., 504., 126., 504.,
+      147., 588., 147., 588., 168., 672., 168., 672., 147., 588., 147., 588.,
+      126., 504., 126., 504., 105., 420., 105., 420., 90.,  360., 90.,  360.,
+      108., 432., 108., 432., 126., 504., 126., 504., 144., 576., 144., 576.,
+      126., 504., 126., 504., 108., 432., 108., 432., 90.,  360., 90.,  360.,
+      75.,  300., 75.,  300., 90.,  360., 90.,  360., 105., 420., 105., 420.,
+      120., 480., 120., 480., 105., 420., 105., 420., 90.,  360., 90.,  360.,
+      75.,  300., 75.,  300.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      75.,  150., 75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300.,
+      150., 300., 150., 300., 90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      180., 360., 180., 360., 180., 360., 180., 360., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 120., 240., 240., 480., 240., 480.,
+      240., 480., 240., 480., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300.,
+      150., 300., 150., 300., 90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      180., 360., 180., 360., 180., 360., 180., 360., 108., 216., 108., 216.,
+      108., 216., 108., 216., 216., 432., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 108., 216., 216., 432., 216., 432.,
+      216., 432., 216., 432., 90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      180., 360., 180., 360., 180., 360., 180., 360., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 120., 240., 240., 480., 240., 480.,
+      240., 480., 240., 480., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      192., 384., 192., 384., 192., 384., 192., 384., 384., 768., 384., 768.,
+      384., 768., 384., 768., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      120., 240., 120., 240., 120., 240., 120., 240., 240., 480., 240., 480.,
+      240., 480., 240., 480., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360., 180., 360.,
+      108., 216., 108., 216., 108., 216., 108., 216., 216., 432., 216., 432.,
+      216., 432., 216., 432., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 108., 216., 108., 216., 108., 216., 108., 216.,
+      216., 432., 216., 432., 216., 432., 216., 432., 90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300.,
+      150., 300., 150., 300., 90.,  180., 90.,  180., 90.,  180., 90.,  180.,
+      180., 360., 180., 360., 180., 360., 180., 360., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      120., 240., 120., 240., 120., 240., 120., 240., 240., 480., 240., 480.,
+      240., 480., 240., 480., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 90.,  180., 90.,  180.,
+      90.,  180., 90.,  180., 180., 360., 180., 360., 180., 360., 180., 360.,
+      75.,  150., 75.,  150., 75.,  150., 75.,  150., 150., 300., 150., 300.,
+      150., 300., 150., 300.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 180., 360., 90.,  180., 180., 360., 105., 210., 210., 420.,
+      105., 210., 210., 420., 120., 240., 240., 480., 120., 240., 240., 480.,
+      135., 270., 270., 540., 135., 270., 270., 540., 120., 240., 240., 480.,
+      120., 240., 240., 480., 105., 210., 210., 420., 105., 210., 210., 420.,
+      90.,  180., 180., 360., 90.,  180., 180., 360., 108., 216., 216., 432.,
+      108., 216., 216., 432., 126., 252., 252., 504., 126., 252., 252., 504.,
+      144., 288., 288., 576., 144., 288., 288., 576., 162., 324., 324., 648.,
+      162., 324., 324., 648., 144., 288., 288., 576., 144., 288., 288., 576.,
+      126., 252., 252., 504., 126., 252., 252., 504., 108., 216., 216., 432.,
+      108., 216., 216., 432., 126., 252., 252., 504., 126., 252., 252., 504.,
+      147., 294., 294., 588., 147., 294., 294., 588., 168., 336., 336., 672.,
+      168., 336., 336., 672., 189., 378., 378., 756., 189., 378., 378., 756.,
+      168., 336., 336., 672., 168., 336., 336., 672., 147., 294., 294., 588.,
+      147., 294., 294., 588., 126., 252., 252., 504., 126., 252., 252., 504.,
+      144., 288., 288., 576., 144., 288., 288., 576., 168., 336., 336., 672.,
+      168., 336., 336., 672., 192., 384., 384., 768., 192., 384., 384., 768.,
+      216., 432., 432., 864., 216., 432., 432., 864., 192., 384., 384., 768.,
+      192., 384., 384., 768., 168., 336., 336., 672., 168., 336., 336., 672.,
+      144., 288., 288., 576., 144., 288., 288., 576., 126., 252., 252., 504.,
+      126., 252., 252., 504., 147., 294., 294., 588., 147., 294., 294., 588.,
+      168., 336., 336., 672., 168., 336., 336., 672., 189., 378., 378., 756.,
+      189., 378., 378., 756., 168., 336., 336., 672., 168., 336., 336., 672.,
+      147., 294., 294., 588., 147., 294., 294., 588., 126., 252., 252., 504.,
+      126., 252., 252., 504., 108., 216., 216., 432., 108., 216., 216., 432.,
+      126., 252., 252., 504., 126., 252., 252., 504., 144., 288., 288., 576.,
+      144., 288., 288., 576., 162., 324., 324., 648., 162., 324., 324., 648.,
+      144., 288., 288., 576., 144., 288., 288., 576., 126., 252., 252., 504.,
+      126., 252., 252., 504., 108., 216., 216., 432., 108., 216., 216., 432.,
+      90.,  180., 180., 360., 90.,  180., 180., 360., 105., 210., 210., 420.,
+      105., 210., 210., 420., 120., 240., 240., 480., 120., 240., 240., 480.,
+      135., 270., 270., 540., 135., 270., 270., 540., 120., 240., 240., 480.,
+      120., 240., 240., 480., 105., 210., 210., 420., 105., 210., 210., 420.,
+      90.,  180., 180., 360., 90.,  180., 180., 360.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x9x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  360., 90.,  360., 105., 420., 105., 420., 120., 480., 120., 480.,
+      135., 540., 135., 540., 120., 480., 120., 480., 105., 420., 105., 420.,
+      90.,  360., 90.,  360., 108., 432., 108., 432., 126., 504., 126., 504.,
+      144., 576., 144., 576., 162., 648., 162., 648., 144., 576., 144., 576.,
+      126., 504., 126., 504., 108., 432., 108., 432., 126., 504., 126., 504.,
+      147., 588., 147., 588., 168., 672., 168., 672., 189., 756., 189., 756.,
+      168., 672., 168., 672., 147., 588., 147., 588., 126., 504., 126., 504.,
+      144., 576., 144., 576., 168., 672., 168., 672., 192., 768., 192., 768.,
+      216., 864., 216., 864., 192., 768., 192., 768., 168., 672., 168., 672.,
+      144., 576., 144., 576., 126., 504., 126., 504., 147., 588., 147., 588.,
+      168., 672., 168., 672., 189., 756., 189., 756., 168., 672., 168., 672.,
+      147., 588., 147., 588., 126., 504., 126., 504., 108., 432., 108., 432.,
+      126., 504., 126., 504., 144., 576., 144., 576., 162., 648., 162., 648.,
+      144., 576., 144., 576., 126., 504., 126., 504., 108., 432., 108., 432.,
+      90.,  360., 90.,  360., 105., 420., 105., 420., 120., 480., 120., 480.,
+      135., 540., 135., 540., 120., 480., 120., 480., 105., 420., 105., 420.,
+      90.,  360., 90.,  360.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      135., 270., 135., 270., 135., 270., 135., 270., 270., 540., 270., 540.,
+      270., 540., 270., 540., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 108., 216., 108., 216., 108., 216., 108., 216.,
+      216., 432., 216., 432., 216., 432., 216., 432., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 162., 324., 162., 324., 162., 324., 162., 324.,
+      324., 648., 324., 648., 324., 648., 324., 648., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 108., 216., 108., 216., 108., 216., 108., 216.,
+      216., 432., 216., 432., 216., 432., 216., 432., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 189., 378., 189., 378.,
+      189., 378., 189., 378., 378., 756., 378., 756., 378., 756., 378., 756.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 192., 384., 192., 384.,
+      192., 384., 192., 384., 384., 768., 384., 768., 384., 768., 384., 768.,
+      216., 432., 216., 432., 216., 432., 216., 432., 432., 864., 432., 864.,
+      432., 864., 432., 864., 192., 384., 192., 384., 192., 384., 192., 384.,
+      384., 768., 384., 768., 384., 768., 384., 768., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 189., 378., 189., 378., 189., 378., 189., 378.,
+      378., 756., 378., 756., 378., 756., 378., 756., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 108., 216., 108., 216.,
+      108., 216., 108., 216., 216., 432., 216., 432., 216., 432., 216., 432.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 162., 324., 162., 324.,
+      162., 324., 162., 324., 324., 648., 324., 648., 324., 648., 324., 648.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 108., 216., 108., 216.,
+      108., 216., 108., 216., 216., 432., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      135., 270., 135., 270., 135., 270., 135., 270., 270., 540., 270., 540.,
+      270., 540., 270., 540., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 210., 210., 420., 105., 210., 210., 420., 120., 240., 240., 480.,
+      120., 240., 240., 480., 135., 270., 270., 540., 135., 270., 270., 540.,
+      150., 300., 300., 600., 150., 300., 300., 600., 135., 270., 270., 540.,
+      135., 270., 270., 540., 120., 240., 240., 480., 120., 240., 240., 480.,
+      105., 210., 210., 420., 105., 210., 210., 420., 126., 252., 252., 504.,
+      126., 252., 252., 504., 144., 288., 288., 576., 144., 288., 288., 576.,
+      162., 324., 324., 648., 162., 324., 324., 648., 180., 360., 360., 720.,
+      180., 360., 360., 720., 162., 324., 324., 648., 162., 324., 324., 648.,
+      144., 288., 288., 576., 144., 288., 288., 576., 126., 252., 252., 504.,
+      126., 252., 252., 504., 147., 294., 294., 588., 147., 294., 294., 588.,
+      168., 336., 336., 672., 168., 336., 336., 672., 189., 378., 378., 756.,
+      189., 378., 378., 756., 210., 420., 420., 840., 210., 420., 420., 840.,
+      189., 378., 378., 756., 189., 378., 378., 756., 168., 336., 336., 672.,
+      168., 336., 336., 672., 147., 294., 294., 588., 147., 294., 294., 588.,
+      168., 336., 336., 672., 168., 336., 336., 672., 192., 384., 384., 768.,
+      192., 384., 384., 768., 216., 432., 432., 864., 216., 432., 432., 864.,
+      240., 480., 480., 960., 240., 480., 480., 960., 216., 432., 432., 864.,
+      216., 432., 432., 864., 192., 384., 384., 768., 192., 384., 384., 768.,
+      168., 336., 336., 672., 168., 336., 336., 672., 147., 294., 294., 588.,
+      147., 294., 294., 588., 168., 336., 336., 672., 168., 336., 336., 672.,
+      189., 378., 378., 756., 189., 378., 378., 756., 210., 420., 420., 840.,
+      210., 420., 420., 840., 189., 378., 378., 756., 189., 378., 378., 756.,
+      168., 336., 336., 672., 168., 336., 336., 672., 147., 294., 294., 588.,
+      147., 294., 294., 588., 126., 252., 252., 504., 126., 252., 252., 504.,
+      144., 288., 288., 576., 144., 288., 288., 576., 162., 324., 324., 648.,
+      162., 324., 324., 648., 180., 360., 360., 720., 180., 360., 360., 720.,
+      162., 324., 324., 648., 162., 324., 324., 648., 144., 288., 288., 576.,
+      144., 288., 288., 576., 126., 252., 252., 504., 126., 252., 252., 504.,
+      105., 210., 210., 420., 105., 210., 210., 420., 120., 240., 240., 480.,
+      120., 240., 240., 480., 135., 270., 270., 540., 135., 270., 270., 540.,
+      150., 300., 300., 600., 150., 300., 300., 600., 135., 270., 270., 540.,
+      135., 270., 270., 540., 120., 240., 240., 480., 120., 240., 240., 480.,
+      105., 210., 210., 420., 105., 210., 210., 420.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48.,
+      96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48.,
+      96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24.,
+      48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24.,
+      48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24.,
+      48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24.,
+      48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48.,
+      96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48.,
+      96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24.,
+      48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24.,
+      48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24.,
+      48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24.,
+      48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48.,
+      96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48.,
+      96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24.,
+      48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24.,
+      48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24.,
+      48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24.,
+      48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 420., 105., 420., 120., 480., 120., 480., 135., 540., 135., 540.,
+      150., 600., 150., 600., 135., 540., 135., 540., 120., 480., 120., 480.,
+      105., 420., 105., 420., 126., 504., 126., 504., 144., 576., 144., 576.,
+      162., 648., 162., 648., 180., 720., 180., 720., 162., 648., 162., 648.,
+      144., 576., 144., 576., 126., 504., 126., 504., 147., 588., 147., 588.,
+      168., 672., 168., 672., 189., 756., 189., 756., 210., 840., 210., 840.,
+      189., 756., 189., 756., 168., 672., 168., 672., 147., 588., 147., 588.,
+      168., 672., 168., 672., 192., 768., 192., 768., 216., 864., 216., 864.,
+      240., 960., 240., 960., 216., 864., 216., 864., 192., 768., 192., 768.,
+      168., 672., 168., 672., 147., 588., 147., 588., 168., 672., 168., 672.,
+      189., 756., 189., 756., 210., 840., 210., 840., 189., 756., 189., 756.,
+      168., 672., 168., 672., 147., 588., 147., 588., 126., 504., 126., 504.,
+      144., 576., 144., 576., 162., 648., 162., 648., 180., 720., 180., 720.,
+      162., 648., 162., 648., 144., 576., 144., 576., 126., 504., 126., 504.,
+      105., 420., 105., 420., 120., 480., 120., 480., 135., 540., 135., 540.,
+      150., 600., 150., 600., 135., 540., 135., 540., 120., 480., 120., 480.,
+      105., 420., 105., 420.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 135., 270., 135., 270.,
+      135., 270., 135., 270., 270., 540., 270., 540., 270., 540., 270., 540.,
+      150., 300., 150., 300., 150., 300., 150., 300., 300., 600., 300., 600.,
+      300., 600., 300., 600., 135., 270., 135., 270., 135., 270., 135., 270.,
+      270., 540., 270., 540., 270., 540., 270., 540., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 180., 360., 180., 360., 180., 360., 180., 360.,
+      360., 720., 360., 720., 360., 720., 360., 720., 162., 324., 162., 324.,
+      162., 324., 162., 324., 324., 648., 324., 648., 324., 648., 324., 648.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 189., 378., 189., 378., 189., 378., 189., 378.,
+      378., 756., 378., 756., 378., 756., 378., 756., 210., 420., 210., 420.,
+      210., 420., 210., 420., 420., 840., 420., 840., 420., 840., 420., 840.,
+      189., 378., 189., 378., 189., 378., 189., 378., 378., 756., 378., 756.,
+      378., 756., 378., 756., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 192., 384., 192., 384., 192., 384., 192., 384.,
+      384., 768., 384., 768., 384., 768., 384., 768., 216., 432., 216., 432.,
+      216., 432., 216., 432., 432., 864., 432., 864., 432., 864., 432., 864.,
+      240., 480., 240., 480., 240., 480., 240., 480., 480., 960., 480., 960.,
+      480., 960., 480., 960., 216., 432., 216., 432., 216., 432., 216., 432.,
+      432., 864., 432., 864., 432., 864., 432., 864., 192., 384., 192., 384.,
+      192., 384., 192., 384., 384., 768., 384., 768., 384., 768., 384., 768.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      189., 378., 189., 378., 189., 378., 189., 378., 378., 756., 378., 756.,
+      378., 756., 378., 756., 210., 420., 210., 420., 210., 420., 210., 420.,
+      420., 840., 420., 840., 420., 840., 420., 840., 189., 378., 189., 378.,
+      189., 378., 189., 378., 378., 756., 378., 756., 378., 756., 378., 756.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 162., 324., 162., 324., 162., 324., 162., 324.,
+      324., 648., 324., 648., 324., 648., 324., 648., 180., 360., 180., 360.,
+      180., 360., 180., 360., 360., 720., 360., 720., 360., 720., 360., 720.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 135., 270., 135., 270.,
+      135., 270., 135., 270., 270., 540., 270., 540., 270., 540., 270., 540.,
+      150., 300., 150., 300., 150., 300., 150., 300., 300., 600., 300., 600.,
+      300., 600., 300., 600., 135., 270., 135., 270., 135., 270., 135., 270.,
+      270., 540., 270., 540., 270., 540., 270., 540., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18.,
+      36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36.,
+      18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18.,
+      36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72.,
+      18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72., 36.,
+      72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36., 72.,
+      36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36., 36.,
+      72., 36., 72., 18., 36., 18., 36., 36., 72., 36., 72., 18., 36., 18., 36.,
+      36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 180., 360., 90.,  180., 180., 360., 108., 216., 216., 432.,
+      108., 216., 216., 432., 126., 252., 252., 504., 126., 252., 252., 504.,
+      144., 288., 288., 576., 144., 288., 288., 576., 126., 252., 252., 504.,
+      126., 252., 252., 504., 108., 216., 216., 432., 108., 216., 216., 432.,
+      90.,  180., 180., 360., 90.,  180., 180., 360., 105., 210., 210., 420.,
+      105., 210., 210., 420., 126., 252., 252., 504., 126., 252., 252., 504.,
+      147., 294., 294., 588., 147., 294., 294., 588., 168., 336., 336., 672.,
+      168., 336., 336., 672., 147., 294., 294., 588., 147., 294., 294., 588.,
+      126., 252., 252., 504., 126., 252., 252., 504., 105., 210., 210., 420.,
+      105., 210., 210., 420., 120., 240., 240., 480., 120., 240., 240., 480.,
+      144., 288., 288., 576., 144., 288., 288., 576., 168., 336., 336., 672.,
+      168., 336., 336., 672., 192., 384., 384., 768., 192., 384., 384., 768.,
+      168., 336., 336., 672., 168., 336., 336., 672., 144., 288., 288., 576.,
+      144., 288., 288., 576., 120., 240., 240., 480., 120., 240., 240., 480.,
+      135., 270., 270., 540., 135., 270., 270., 540., 162., 324., 324., 648.,
+      162., 324., 324., 648., 189., 378., 378., 756., 189., 378., 378., 756.,
+      216., 432., 432., 864., 216., 432., 432., 864., 189., 378., 378., 756.,
+      189., 378., 378., 756., 162., 324., 324., 648., 162., 324., 324., 648.,
+      135., 270., 270., 540., 135., 270., 270., 540., 120., 240., 240., 480.,
+      120., 240., 240., 480., 144., 288., 288., 576., 144., 288., 288., 576.,
+      168., 336., 336., 672., 168., 336., 336., 672., 192., 384., 384., 768.,
+      192., 384., 384., 768., 168., 336., 336., 672., 168., 336., 336., 672.,
+      144., 288., 288., 576., 144., 288., 288., 576., 120., 240., 240., 480.,
+      120., 240., 240., 480., 105., 210., 210., 420., 105., 210., 210., 420.,
+      126., 252., 252., 504., 126., 252., 252., 504., 147., 294., 294., 588.,
+      147., 294., 294., 588., 168., 336., 336., 672., 168., 336., 336., 672.,
+      147., 294., 294., 588., 147., 294., 294., 588., 126., 252., 252., 504.,
+      126., 252., 252., 504., 105., 210., 210., 420., 105., 210., 210., 420.,
+      90.,  180., 180., 360., 90.,  180., 180., 360., 108., 216., 216., 432.,
+      108., 216., 216., 432., 126., 252., 252., 504., 126., 252., 252., 504.,
+      144., 288., 288., 576., 144., 288., 288., 576., 126., 252., 252., 504.,
+      126., 252., 252., 504., 108., 216., 216., 432., 108., 216., 216., 432.,
+      90.,  180., 180., 360., 90.,  180., 180., 360.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36.,
+      72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72.,
+      36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36.,
+      72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36., 18.,
+      36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18., 36.,
+      18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36., 18.,
+      36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18., 36.,
+      18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18., 36.,
+      18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72., 18.,
+      36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36., 72.,
+      18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72., 36.,
+      72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36., 72.,
+      36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72., 36.,
+      72., 36., 72., 18., 36., 18., 36., 18., 36., 18., 36., 36., 72., 36., 72.,
+      36., 72., 36., 72.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  360., 90.,  360., 108., 432., 108., 432., 126., 504., 126., 504.,
+      144., 576., 144., 576., 126., 504., 126., 504., 108., 432., 108., 432.,
+      90.,  360., 90.,  360., 105., 420., 105., 420., 126., 504., 126., 504.,
+      147., 588., 147., 588., 168., 672., 168., 672., 147., 588., 147., 588.,
+      126., 504., 126., 504., 105., 420., 105., 420., 120., 480., 120., 480.,
+      144., 576., 144., 576., 168., 672., 168., 672., 192., 768., 192., 768.,
+      168., 672., 168., 672., 144., 576., 144., 576., 120., 480., 120., 480.,
+      135., 540., 135., 540., 162., 648., 162., 648., 189., 756., 189., 756.,
+      216., 864., 216., 864., 189., 756., 189., 756., 162., 648., 162., 648.,
+      135., 540., 135., 540., 120., 480., 120., 480., 144., 576., 144., 576.,
+      168., 672., 168., 672., 192., 768., 192., 768., 168., 672., 168., 672.,
+      144., 576., 144., 576., 120., 480., 120., 480., 105., 420., 105., 420.,
+      126., 504., 126., 504., 147., 588., 147., 588., 168., 672., 168., 672.,
+      147., 588., 147., 588., 126., 504., 126., 504., 105., 420., 105., 420.,
+      90.,  360., 90.,  360., 108., 432., 108., 432., 126., 504., 126., 504.,
+      144., 576., 144., 576., 126., 504., 126., 504., 108., 432., 108., 432.,
+      90.,  360., 90.,  360.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 108., 216., 108., 216., 108., 216., 108., 216.,
+      216., 432., 216., 432., 216., 432., 216., 432., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 108., 216., 108., 216.,
+      108., 216., 108., 216., 216., 432., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 105., 210., 105., 210., 105., 210., 105., 210.,
+      210., 420., 210., 420., 210., 420., 210., 420., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 192., 384., 192., 384.,
+      192., 384., 192., 384., 384., 768., 384., 768., 384., 768., 384., 768.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      135., 270., 135., 270., 135., 270., 135., 270., 270., 540., 270., 540.,
+      270., 540., 270., 540., 162., 324., 162., 324., 162., 324., 162., 324.,
+      324., 648., 324., 648., 324., 648., 324., 648., 189., 378., 189., 378.,
+      189., 378., 189., 378., 378., 756., 378., 756., 378., 756., 378., 756.,
+      216., 432., 216., 432., 216., 432., 216., 432., 432., 864., 432., 864.,
+      432., 864., 432., 864., 189., 378., 189., 378., 189., 378., 189., 378.,
+      378., 756., 378., 756., 378., 756., 378., 756., 162., 324., 162., 324.,
+      162., 324., 162., 324., 324., 648., 324., 648., 324., 648., 324., 648.,
+      135., 270., 135., 270., 135., 270., 135., 270., 270., 540., 270., 540.,
+      270., 540., 270., 540., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 192., 384., 192., 384., 192., 384., 192., 384.,
+      384., 768., 384., 768., 384., 768., 384., 768., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      126., 252., 126., 252., 126., 252., 126., 252., 252., 504., 252., 504.,
+      252., 504., 252., 504., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 105., 210., 105., 210.,
+      105., 210., 105., 210., 210., 420., 210., 420., 210., 420., 210., 420.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360., 108., 216., 108., 216., 108., 216., 108., 216.,
+      216., 432., 216., 432., 216., 432., 216., 432., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 108., 216., 108., 216.,
+      108., 216., 108., 216., 216., 432., 216., 432., 216., 432., 216., 432.,
+      90.,  180., 90.,  180., 90.,  180., 90.,  180., 180., 360., 180., 360.,
+      180., 360., 180., 360.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  54., 108., 54., 108.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 27., 54.,  27., 54.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      108., 216., 216., 432., 108., 216., 216., 432., 126., 252., 252., 504.,
+      126., 252., 252., 504., 144., 288., 288., 576., 144., 288., 288., 576.,
+      162., 324., 324., 648., 162., 324., 324., 648., 144., 288., 288., 576.,
+      144., 288., 288., 576., 126., 252., 252., 504., 126., 252., 252., 504.,
+      108., 216., 216., 432., 108., 216., 216., 432., 126., 252., 252., 504.,
+      126., 252., 252., 504., 147., 294., 294., 588., 147., 294., 294., 588.,
+      168., 336., 336., 672., 168., 336., 336., 672., 189., 378., 378., 756.,
+      189., 378., 378., 756., 168., 336., 336., 672., 168., 336., 336., 672.,
+      147., 294., 294., 588., 147., 294., 294., 588., 126., 252., 252., 504.,
+      126., 252., 252., 504., 144., 288., 288., 576., 144., 288., 288., 576.,
+      168., 336., 336., 672., 168., 336., 336., 672., 192., 384., 384., 768.,
+      192., 384., 384., 768., 216., 432., 432., 864., 216., 432., 432., 864.,
+      192., 384., 384., 768., 192., 384., 384., 768., 168., 336., 336., 672.,
+      168., 336., 336., 672., 144., 288., 288., 576., 144., 288., 288., 576.,
+      162., 324., 324., 648., 162., 324., 324., 648., 189., 378., 378., 756.,
+      189., 378., 378., 756., 216., 432., 432., 864., 216., 432., 432., 864.,
+      243., 486., 486., 972., 243., 486., 486., 972., 216., 432., 432., 864.,
+      216., 432., 432., 864., 189., 378., 378., 756., 189., 378., 378., 756.,
+      162., 324., 324., 648., 162., 324., 324., 648., 144., 288., 288., 576.,
+      144., 288., 288., 576., 168., 336., 336., 672., 168., 336., 336., 672.,
+      192., 384., 384., 768., 192., 384., 384., 768., 216., 432., 432., 864.,
+      216., 432., 432., 864., 192., 384., 384., 768., 192., 384., 384., 768.,
+      168., 336., 336., 672., 168., 336., 336., 672., 144., 288., 288., 576.,
+      144., 288., 288., 576., 126., 252., 252., 504., 126., 252., 252., 504.,
+      147., 294., 294., 588., 147., 294., 294., 588., 168., 336., 336., 672.,
+      168., 336., 336., 672., 189., 378., 378., 756., 189., 378., 378., 756.,
+      168., 336., 336., 672., 168., 336., 336., 672., 147., 294., 294., 588.,
+      147., 294., 294., 588., 126., 252., 252., 504., 126., 252., 252., 504.,
+      108., 216., 216., 432., 108., 216., 216., 432., 126., 252., 252., 504.,
+      126., 252., 252., 504., 144., 288., 288., 576., 144., 288., 288., 576.,
+      162., 324., 324., 648., 162., 324., 324., 648., 144., 288., 288., 576.,
+      144., 288., 288., 576., 126., 252., 252., 504., 126., 252., 252., 504.,
+      108., 216., 216., 432., 108., 216., 216., 432.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108.,
+      54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x9x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      108., 432., 108., 432., 126., 504., 126., 504., 144., 576., 144., 576.,
+      162., 648., 162., 648., 144., 576., 144., 576., 126., 504., 126., 504.,
+      108., 432., 108., 432., 126., 504., 126., 504., 147., 588., 147., 588.,
+      168., 672., 168., 672., 189., 756., 189., 756., 168., 672., 168., 672.,
+      147., 588., 147., 588., 126., 504., 126., 504., 144., 576., 144., 576.,
+      168., 672., 168., 672., 192., 768., 192., 768., 216., 864., 216., 864.,
+      192., 768., 192., 768., 168., 672., 168., 672., 144., 576., 144., 576.,
+      162., 648., 162., 648., 189., 756., 189., 756., 216., 864., 216., 864.,
+      243., 972., 243., 972., 216., 864., 216., 864., 189., 756., 189., 756.,
+      162., 648., 162., 648., 144., 576., 144., 576., 168., 672., 168., 672.,
+      192., 768., 192., 768., 216., 864., 216., 864., 192., 768., 192., 768.,
+      168., 672., 168., 672., 144., 576., 144., 576., 126., 504., 126., 504.,
+      147., 588., 147., 588., 168., 672., 168., 672., 189., 756., 189., 756.,
+      168., 672., 168., 672., 147., 588., 147., 588., 126., 504., 126., 504.,
+      108., 432., 108., 432., 126., 504., 126., 504., 144., 576., 144., 576.,
+      162., 648., 162., 648., 144., 576., 144., 576., 126., 504., 126., 504.,
+      108., 432., 108., 432.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      108., 216., 108., 216., 108., 216., 108., 216., 216., 432., 216., 432.,
+      216., 432., 216., 432., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 108., 216., 216., 432., 216., 432.,
+      216., 432., 216., 432., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 189., 378., 189., 378., 189., 378., 189., 378.,
+      378., 756., 378., 756., 378., 756., 378., 756., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 192., 384., 192., 384., 192., 384., 192., 384.,
+      384., 768., 384., 768., 384., 768., 384., 768., 216., 432., 216., 432.,
+      216., 432., 216., 432., 432., 864., 432., 864., 432., 864., 432., 864.,
+      192., 384., 192., 384., 192., 384., 192., 384., 384., 768., 384., 768.,
+      384., 768., 384., 768., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 189., 378., 189., 378., 189., 378., 189., 378.,
+      378., 756., 378., 756., 378., 756., 378., 756., 216., 432., 216., 432.,
+      216., 432., 216., 432., 432., 864., 432., 864., 432., 864., 432., 864.,
+      243., 486., 243., 486., 243., 486., 243., 486., 486., 972., 486., 972.,
+      486., 972., 486., 972., 216., 432., 216., 432., 216., 432., 216., 432.,
+      432., 864., 432., 864., 432., 864., 432., 864., 189., 378., 189., 378.,
+      189., 378., 189., 378., 378., 756., 378., 756., 378., 756., 378., 756.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      192., 384., 192., 384., 192., 384., 192., 384., 384., 768., 384., 768.,
+      384., 768., 384., 768., 216., 432., 216., 432., 216., 432., 216., 432.,
+      432., 864., 432., 864., 432., 864., 432., 864., 192., 384., 192., 384.,
+      192., 384., 192., 384., 384., 768., 384., 768., 384., 768., 384., 768.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      147., 294., 147., 294., 147., 294., 147., 294., 294., 588., 294., 588.,
+      294., 588., 294., 588., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 189., 378., 189., 378.,
+      189., 378., 189., 378., 378., 756., 378., 756., 378., 756., 378., 756.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 108., 216., 216., 432., 216., 432.,
+      216., 432., 216., 432., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      108., 216., 108., 216., 108., 216., 108., 216., 216., 432., 216., 432.,
+      216., 432., 216., 432.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      126., 252., 252., 504.,  126., 252., 252., 504.,  144., 288., 288., 576.,
+      144., 288., 288., 576.,  162., 324., 324., 648.,  162., 324., 324., 648.,
+      180., 360., 360., 720.,  180., 360., 360., 720.,  162., 324., 324., 648.,
+      162., 324., 324., 648.,  144., 288., 288., 576.,  144., 288., 288., 576.,
+      126., 252., 252., 504.,  126., 252., 252., 504.,  147., 294., 294., 588.,
+      147., 294., 294., 588.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  210., 420., 420., 840.,
+      210., 420., 420., 840.,  189., 378., 378., 756.,  189., 378., 378., 756.,
+      168., 336., 336., 672.,  168., 336., 336., 672.,  147., 294., 294., 588.,
+      147., 294., 294., 588.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      192., 384., 384., 768.,  192., 384., 384., 768.,  216., 432., 432., 864.,
+      216., 432., 432., 864.,  240., 480., 480., 960.,  240., 480., 480., 960.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  192., 384., 384., 768.,
+      192., 384., 384., 768.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  216., 432., 432., 864.,
+      216., 432., 432., 864.,  243., 486., 486., 972.,  243., 486., 486., 972.,
+      270., 540., 540., 1080., 270., 540., 540., 1080., 243., 486., 486., 972.,
+      243., 486., 486., 972.,  216., 432., 432., 864.,  216., 432., 432., 864.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  192., 384., 384., 768.,  192., 384., 384., 768.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  240., 480., 480., 960.,
+      240., 480., 480., 960.,  216., 432., 432., 864.,  216., 432., 432., 864.,
+      192., 384., 384., 768.,  192., 384., 384., 768.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  147., 294., 294., 588.,  147., 294., 294., 588.,
+      168., 336., 336., 672.,  168., 336., 336., 672.,  189., 378., 378., 756.,
+      189., 378., 378., 756.,  210., 420., 420., 840.,  210., 420., 420., 840.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  147., 294., 294., 588.,  147., 294., 294., 588.,
+      126., 252., 252., 504.,  126., 252., 252., 504.,  144., 288., 288., 576.,
+      144., 288., 288., 576.,  162., 324., 324., 648.,  162., 324., 324., 648.,
+      180., 360., 360., 720.,  180., 360., 360., 720.,  162., 324., 324., 648.,
+      162., 324., 324., 648.,  144., 288., 288., 576.,  144., 288., 288., 576.,
+      126., 252., 252., 504.,  126., 252., 252., 504.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      126., 504.,  126., 504.,  144., 576., 144., 576., 162., 648., 162., 648.,
+      180., 720.,  180., 720.,  162., 648., 162., 648., 144., 576., 144., 576.,
+      126., 504.,  126., 504.,  147., 588., 147., 588., 168., 672., 168., 672.,
+      189., 756.,  189., 756.,  210., 840., 210., 840., 189., 756., 189., 756.,
+      168., 672.,  168., 672.,  147., 588., 147., 588., 168., 672., 168., 672.,
+      192., 768.,  192., 768.,  216., 864., 216., 864., 240., 960., 240., 960.,
+      216., 864.,  216., 864.,  192., 768., 192., 768., 168., 672., 168., 672.,
+      189., 756.,  189., 756.,  216., 864., 216., 864., 243., 972., 243., 972.,
+      270., 1080., 270., 1080., 243., 972., 243., 972., 216., 864., 216., 864.,
+      189., 756.,  189., 756.,  168., 672., 168., 672., 192., 768., 192., 768.,
+      216., 864.,  216., 864.,  240., 960., 240., 960., 216., 864., 216., 864.,
+      192., 768.,  192., 768.,  168., 672., 168., 672., 147., 588., 147., 588.,
+      168., 672.,  168., 672.,  189., 756., 189., 756., 210., 840., 210., 840.,
+      189., 756.,  189., 756.,  168., 672., 168., 672., 147., 588., 147., 588.,
+      126., 504.,  126., 504.,  144., 576., 144., 576., 162., 648., 162., 648.,
+      180., 720.,  180., 720.,  162., 648., 162., 648., 144., 576., 144., 576.,
+      126., 504.,  126., 504.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      126., 252.,  126., 252.,  126., 252., 126., 252., 252.,  504., 252.,
+      504., 252.,  504., 252.,  504., 144., 288., 144., 288.,  144., 288.,
+      144., 288.,  288., 576.,  288., 576., 288., 576., 288.,  576., 162.,
+      324., 162.,  324., 162.,  324., 162., 324., 324., 648.,  324., 648.,
+      324., 648.,  324., 648.,  180., 360., 180., 360., 180.,  360., 180.,
+      360., 360.,  720., 360.,  720., 360., 720., 360., 720.,  162., 324.,
+      162., 324.,  162., 324.,  162., 324., 324., 648., 324.,  648., 324.,
+      648., 324.,  648., 144.,  288., 144., 288., 144., 288.,  144., 288.,
+      288., 576.,  288., 576.,  288., 576., 288., 576., 126.,  252., 126.,
+      252., 126.,  252., 126.,  252., 252., 504., 252., 504.,  252., 504.,
+      252., 504.,  147., 294.,  147., 294., 147., 294., 147.,  294., 294.,
+      588., 294.,  588., 294.,  588., 294., 588., 168., 336.,  168., 336.,
+      168., 336.,  168., 336.,  336., 672., 336., 672., 336.,  672., 336.,
+      672., 189.,  378., 189.,  378., 189., 378., 189., 378.,  378., 756.,
+      378., 756.,  378., 756.,  378., 756., 210., 420., 210.,  420., 210.,
+      420., 210.,  420., 420.,  840., 420., 840., 420., 840.,  420., 840.,
+      189., 378.,  189., 378.,  189., 378., 189., 378., 378.,  756., 378.,
+      756., 378.,  756., 378.,  756., 168., 336., 168., 336.,  168., 336.,
+      168., 336.,  336., 672.,  336., 672., 336., 672., 336.,  672., 147.,
+      294., 147.,  294., 147.,  294., 147., 294., 294., 588.,  294., 588.,
+      294., 588.,  294., 588.,  168., 336., 168., 336., 168.,  336., 168.,
+      336., 336.,  672., 336.,  672., 336., 672., 336., 672.,  192., 384.,
+      192., 384.,  192., 384.,  192., 384., 384., 768., 384.,  768., 384.,
+      768., 384.,  768., 216.,  432., 216., 432., 216., 432.,  216., 432.,
+      432., 864.,  432., 864.,  432., 864., 432., 864., 240.,  480., 240.,
+      480., 240.,  480., 240.,  480., 480., 960., 480., 960.,  480., 960.,
+      480., 960.,  216., 432.,  216., 432., 216., 432., 216.,  432., 432.,
+      864., 432.,  864., 432.,  864., 432., 864., 192., 384.,  192., 384.,
+      192., 384.,  192., 384.,  384., 768., 384., 768., 384.,  768., 384.,
+      768., 168.,  336., 168.,  336., 168., 336., 168., 336.,  336., 672.,
+      336., 672.,  336., 672.,  336., 672., 189., 378., 189.,  378., 189.,
+      378., 189.,  378., 378.,  756., 378., 756., 378., 756.,  378., 756.,
+      216., 432.,  216., 432.,  216., 432., 216., 432., 432.,  864., 432.,
+      864., 432.,  864., 432.,  864., 243., 486., 243., 486.,  243., 486.,
+      243., 486.,  486., 972.,  486., 972., 486., 972., 486.,  972., 270.,
+      540., 270.,  540., 270.,  540., 270., 540., 540., 1080., 540., 1080.,
+      540., 1080., 540., 1080., 243., 486., 243., 486., 243.,  486., 243.,
+      486., 486.,  972., 486.,  972., 486., 972., 486., 972.,  216., 432.,
+      216., 432.,  216., 432.,  216., 432., 432., 864., 432.,  864., 432.,
+      864., 432.,  864., 189.,  378., 189., 378., 189., 378.,  189., 378.,
+      378., 756.,  378., 756.,  378., 756., 378., 756., 168.,  336., 168.,
+      336., 168.,  336., 168.,  336., 336., 672., 336., 672.,  336., 672.,
+      336., 672.,  192., 384.,  192., 384., 192., 384., 192.,  384., 384.,
+      768., 384.,  768., 384.,  768., 384., 768., 216., 432.,  216., 432.,
+      216., 432.,  216., 432.,  432., 864., 432., 864., 432.,  864., 432.,
+      864., 240.,  480., 240.,  480., 240., 480., 240., 480.,  480., 960.,
+      480., 960.,  480., 960.,  480., 960., 216., 432., 216.,  432., 216.,
+      432., 216.,  432., 432.,  864., 432., 864., 432., 864.,  432., 864.,
+      192., 384.,  192., 384.,  192., 384., 192., 384., 384.,  768., 384.,
+      768., 384.,  768., 384.,  768., 168., 336., 168., 336.,  168., 336.,
+      168., 336.,  336., 672.,  336., 672., 336., 672., 336.,  672., 147.,
+      294., 147.,  294., 147.,  294., 147., 294., 294., 588.,  294., 588.,
+      294., 588.,  294., 588.,  168., 336., 168., 336., 168.,  336., 168.,
+      336., 336.,  672., 336.,  672., 336., 672., 336., 672.,  189., 378.,
+      189., 378.,  189., 378.,  189., 378., 378., 756., 378.,  756., 378.,
+      756., 378.,  756., 210.,  420., 210., 420., 210., 420.,  210., 420.,
+      420., 840.,  420., 840.,  420., 840., 420., 840., 189.,  378., 189.,
+      378., 189.,  378., 189.,  378., 378., 756., 378., 756.,  378., 756.,
+      378., 756.,  168., 336.,  168., 336., 168., 336., 168.,  336., 336.,
+      672., 336.,  672., 336.,  672., 336., 672., 147., 294.,  147., 294.,
+      147., 294.,  147., 294.,  294., 588., 294., 588., 294.,  588., 294.,
+      588., 126.,  252., 126.,  252., 126., 252., 126., 252.,  252., 504.,
+      252., 504.,  252., 504.,  252., 504., 144., 288., 144.,  288., 144.,
+      288., 144.,  288., 288.,  576., 288., 576., 288., 576.,  288., 576.,
+      162., 324.,  162., 324.,  162., 324., 162., 324., 324.,  648., 324.,
+      648., 324.,  648., 324.,  648., 180., 360., 180., 360.,  180., 360.,
+      180., 360.,  360., 720.,  360., 720., 360., 720., 360.,  720., 162.,
+      324., 162.,  324., 162.,  324., 162., 324., 324., 648.,  324., 648.,
+      324., 648.,  324., 648.,  144., 288., 144., 288., 144.,  288., 144.,
+      288., 288.,  576., 288.,  576., 288., 576., 288., 576.,  126., 252.,
+      126., 252.,  126., 252.,  126., 252., 252., 504., 252.,  504., 252.,
+      504., 252.,  504.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24.,
+      48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48.,
+      24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24.,
+      48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96.,
+      24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96., 48.,
+      96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48., 96.,
+      48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48., 48.,
+      96., 48., 96., 24., 48., 24., 48., 48., 96., 48., 96., 24., 48., 24., 48.,
+      48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 210., 210., 420., 105., 210., 210., 420., 126., 252., 252., 504.,
+      126., 252., 252., 504., 147., 294., 294., 588., 147., 294., 294., 588.,
+      168., 336., 336., 672., 168., 336., 336., 672., 147., 294., 294., 588.,
+      147., 294., 294., 588., 126., 252., 252., 504., 126., 252., 252., 504.,
+      105., 210., 210., 420., 105., 210., 210., 420., 120., 240., 240., 480.,
+      120., 240., 240., 480., 144., 288., 288., 576., 144., 288., 288., 576.,
+      168., 336., 336., 672., 168., 336., 336., 672., 192., 384., 384., 768.,
+      192., 384., 384., 768., 168., 336., 336., 672., 168., 336., 336., 672.,
+      144., 288., 288., 576., 144., 288., 288., 576., 120., 240., 240., 480.,
+      120., 240., 240., 480., 135., 270., 270., 540., 135., 270., 270., 540.,
+      162., 324., 324., 648., 162., 324., 324., 648., 189., 378., 378., 756.,
+      189., 378., 378., 756., 216., 432., 432., 864., 216., 432., 432., 864.,
+      189., 378., 378., 756., 189., 378., 378., 756., 162., 324., 324., 648.,
+      162., 324., 324., 648., 135., 270., 270., 540., 135., 270., 270., 540.,
+      150., 300., 300., 600., 150., 300., 300., 600., 180., 360., 360., 720.,
+      180., 360., 360., 720., 210., 420., 420., 840., 210., 420., 420., 840.,
+      240., 480., 480., 960., 240., 480., 480., 960., 210., 420., 420., 840.,
+      210., 420., 420., 840., 180., 360., 360., 720., 180., 360., 360., 720.,
+      150., 300., 300., 600., 150., 300., 300., 600., 135., 270., 270., 540.,
+      135., 270., 270., 540., 162., 324., 324., 648., 162., 324., 324., 648.,
+      189., 378., 378., 756., 189., 378., 378., 756., 216., 432., 432., 864.,
+      216., 432., 432., 864., 189., 378., 378., 756., 189., 378., 378., 756.,
+      162., 324., 324., 648., 162., 324., 324., 648., 135., 270., 270., 540.,
+      135., 270., 270., 540., 120., 240., 240., 480., 120., 240., 240., 480.,
+      144., 288., 288., 576., 144., 288., 288., 576., 168., 336., 336., 672.,
+      168., 336., 336., 672., 192., 384., 384., 768., 192., 384., 384., 768.,
+      168., 336., 336., 672., 168., 336., 336., 672., 144., 288., 288., 576.,
+      144., 288., 288., 576., 120., 240., 240., 480., 120., 240., 240., 480.,
+      105., 210., 210., 420., 105., 210., 210., 420., 126., 252., 252., 504.,
+      126., 252., 252., 504., 147., 294., 294., 588., 147., 294., 294., 588.,
+      168., 336., 336., 672., 168., 336., 336., 672., 147., 294., 294., 588.,
+      147., 294., 294., 588., 126., 252., 252., 504., 126., 252., 252., 504.,
+      105., 210., 210., 420., 105., 210., 210., 420.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48.,
+      96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48.,
+      96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24.,
+      48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24.,
+      48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24.,
+      48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24.,
+      48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48.,
+      96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48.,
+      96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24.,
+      48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24.,
+      48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24.,
+      48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24.,
+      48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48.,
+      96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96.,
+      48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48.,
+      96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48.,
+      48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48., 24.,
+      48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24., 48.,
+      24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48., 24.,
+      48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24., 48.,
+      24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48., 24.,
+      48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24., 48.,
+      24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96., 24.,
+      48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48., 96.,
+      24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96., 48.,
+      96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48., 96.,
+      48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96., 48.,
+      96., 48., 96., 24., 48., 24., 48., 24., 48., 24., 48., 48., 96., 48., 96.,
+      48., 96., 48., 96.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x8x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 420., 105., 420., 126., 504., 126., 504., 147., 588., 147., 588.,
+      168., 672., 168., 672., 147., 588., 147., 588., 126., 504., 126., 504.,
+      105., 420., 105., 420., 120., 480., 120., 480., 144., 576., 144., 576.,
+      168., 672., 168., 672., 192., 768., 192., 768., 168., 672., 168., 672.,
+      144., 576., 144., 576., 120., 480., 120., 480., 135., 540., 135., 540.,
+      162., 648., 162., 648., 189., 756., 189., 756., 216., 864., 216., 864.,
+      189., 756., 189., 756., 162., 648., 162., 648., 135., 540., 135., 540.,
+      150., 600., 150., 600., 180., 720., 180., 720., 210., 840., 210., 840.,
+      240., 960., 240., 960., 210., 840., 210., 840., 180., 720., 180., 720.,
+      150., 600., 150., 600., 135., 540., 135., 540., 162., 648., 162., 648.,
+      189., 756., 189., 756., 216., 864., 216., 864., 189., 756., 189., 756.,
+      162., 648., 162., 648., 135., 540., 135., 540., 120., 480., 120., 480.,
+      144., 576., 144., 576., 168., 672., 168., 672., 192., 768., 192., 768.,
+      168., 672., 168., 672., 144., 576., 144., 576., 120., 480., 120., 480.,
+      105., 420., 105., 420., 126., 504., 126., 504., 147., 588., 147., 588.,
+      168., 672., 168., 672., 147., 588., 147., 588., 126., 504., 126., 504.,
+      105., 420., 105., 420.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 144., 288., 144., 288.,
+      144., 288., 144., 288., 288., 576., 288., 576., 288., 576., 288., 576.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 192., 384., 192., 384., 192., 384., 192., 384.,
+      384., 768., 384., 768., 384., 768., 384., 768., 168., 336., 168., 336.,
+      168., 336., 168., 336., 336., 672., 336., 672., 336., 672., 336., 672.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 120., 240., 120., 240., 120., 240., 120., 240.,
+      240., 480., 240., 480., 240., 480., 240., 480., 135., 270., 135., 270.,
+      135., 270., 135., 270., 270., 540., 270., 540., 270., 540., 270., 540.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 189., 378., 189., 378., 189., 378., 189., 378.,
+      378., 756., 378., 756., 378., 756., 378., 756., 216., 432., 216., 432.,
+      216., 432., 216., 432., 432., 864., 432., 864., 432., 864., 432., 864.,
+      189., 378., 189., 378., 189., 378., 189., 378., 378., 756., 378., 756.,
+      378., 756., 378., 756., 162., 324., 162., 324., 162., 324., 162., 324.,
+      324., 648., 324., 648., 324., 648., 324., 648., 135., 270., 135., 270.,
+      135., 270., 135., 270., 270., 540., 270., 540., 270., 540., 270., 540.,
+      150., 300., 150., 300., 150., 300., 150., 300., 300., 600., 300., 600.,
+      300., 600., 300., 600., 180., 360., 180., 360., 180., 360., 180., 360.,
+      360., 720., 360., 720., 360., 720., 360., 720., 210., 420., 210., 420.,
+      210., 420., 210., 420., 420., 840., 420., 840., 420., 840., 420., 840.,
+      240., 480., 240., 480., 240., 480., 240., 480., 480., 960., 480., 960.,
+      480., 960., 480., 960., 210., 420., 210., 420., 210., 420., 210., 420.,
+      420., 840., 420., 840., 420., 840., 420., 840., 180., 360., 180., 360.,
+      180., 360., 180., 360., 360., 720., 360., 720., 360., 720., 360., 720.,
+      150., 300., 150., 300., 150., 300., 150., 300., 300., 600., 300., 600.,
+      300., 600., 300., 600., 135., 270., 135., 270., 135., 270., 135., 270.,
+      270., 540., 270., 540., 270., 540., 270., 540., 162., 324., 162., 324.,
+      162., 324., 162., 324., 324., 648., 324., 648., 324., 648., 324., 648.,
+      189., 378., 189., 378., 189., 378., 189., 378., 378., 756., 378., 756.,
+      378., 756., 378., 756., 216., 432., 216., 432., 216., 432., 216., 432.,
+      432., 864., 432., 864., 432., 864., 432., 864., 189., 378., 189., 378.,
+      189., 378., 189., 378., 378., 756., 378., 756., 378., 756., 378., 756.,
+      162., 324., 162., 324., 162., 324., 162., 324., 324., 648., 324., 648.,
+      324., 648., 324., 648., 135., 270., 135., 270., 135., 270., 135., 270.,
+      270., 540., 270., 540., 270., 540., 270., 540., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      144., 288., 144., 288., 144., 288., 144., 288., 288., 576., 288., 576.,
+      288., 576., 288., 576., 168., 336., 168., 336., 168., 336., 168., 336.,
+      336., 672., 336., 672., 336., 672., 336., 672., 192., 384., 192., 384.,
+      192., 384., 192., 384., 384., 768., 384., 768., 384., 768., 384., 768.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 144., 288., 144., 288., 144., 288., 144., 288.,
+      288., 576., 288., 576., 288., 576., 288., 576., 120., 240., 120., 240.,
+      120., 240., 120., 240., 240., 480., 240., 480., 240., 480., 240., 480.,
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420., 126., 252., 126., 252., 126., 252., 126., 252.,
+      252., 504., 252., 504., 252., 504., 252., 504., 147., 294., 147., 294.,
+      147., 294., 147., 294., 294., 588., 294., 588., 294., 588., 294., 588.,
+      168., 336., 168., 336., 168., 336., 168., 336., 336., 672., 336., 672.,
+      336., 672., 336., 672., 147., 294., 147., 294., 147., 294., 147., 294.,
+      294., 588., 294., 588., 294., 588., 294., 588., 126., 252., 126., 252.,
+      126., 252., 126., 252., 252., 504., 252., 504., 252., 504., 252., 504.,
+      105., 210., 105., 210., 105., 210., 105., 210., 210., 420., 210., 420.,
+      210., 420., 210., 420.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  72., 144., 72., 144.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 36., 72.,  36., 72.,
+      72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      126., 252., 252., 504.,  126., 252., 252., 504.,  147., 294., 294., 588.,
+      147., 294., 294., 588.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  147., 294., 294., 588.,  147., 294., 294., 588.,
+      126., 252., 252., 504.,  126., 252., 252., 504.,  144., 288., 288., 576.,
+      144., 288., 288., 576.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      192., 384., 384., 768.,  192., 384., 384., 768.,  216., 432., 432., 864.,
+      216., 432., 432., 864.,  192., 384., 384., 768.,  192., 384., 384., 768.,
+      168., 336., 336., 672.,  168., 336., 336., 672.,  144., 288., 288., 576.,
+      144., 288., 288., 576.,  162., 324., 324., 648.,  162., 324., 324., 648.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  216., 432., 432., 864.,
+      216., 432., 432., 864.,  243., 486., 486., 972.,  243., 486., 486., 972.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  189., 378., 378., 756.,
+      189., 378., 378., 756.,  162., 324., 324., 648.,  162., 324., 324., 648.,
+      180., 360., 360., 720.,  180., 360., 360., 720.,  210., 420., 420., 840.,
+      210., 420., 420., 840.,  240., 480., 480., 960.,  240., 480., 480., 960.,
+      270., 540., 540., 1080., 270., 540., 540., 1080., 240., 480., 480., 960.,
+      240., 480., 480., 960.,  210., 420., 420., 840.,  210., 420., 420., 840.,
+      180., 360., 360., 720.,  180., 360., 360., 720.,  162., 324., 324., 648.,
+      162., 324., 324., 648.,  189., 378., 378., 756.,  189., 378., 378., 756.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  243., 486., 486., 972.,
+      243., 486., 486., 972.,  216., 432., 432., 864.,  216., 432., 432., 864.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  162., 324., 324., 648.,
+      162., 324., 324., 648.,  144., 288., 288., 576.,  144., 288., 288., 576.,
+      168., 336., 336., 672.,  168., 336., 336., 672.,  192., 384., 384., 768.,
+      192., 384., 384., 768.,  216., 432., 432., 864.,  216., 432., 432., 864.,
+      192., 384., 384., 768.,  192., 384., 384., 768.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  144., 288., 288., 576.,  144., 288., 288., 576.,
+      126., 252., 252., 504.,  126., 252., 252., 504.,  147., 294., 294., 588.,
+      147., 294., 294., 588.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      189., 378., 378., 756.,  189., 378., 378., 756.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  147., 294., 294., 588.,  147., 294., 294., 588.,
+      126., 252., 252., 504.,  126., 252., 252., 504.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144.,
+      72., 144., 72., 144.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x9x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      126., 504.,  126., 504.,  147., 588., 147., 588., 168., 672., 168., 672.,
+      189., 756.,  189., 756.,  168., 672., 168., 672., 147., 588., 147., 588.,
+      126., 504.,  126., 504.,  144., 576., 144., 576., 168., 672., 168., 672.,
+      192., 768.,  192., 768.,  216., 864., 216., 864., 192., 768., 192., 768.,
+      168., 672.,  168., 672.,  144., 576., 144., 576., 162., 648., 162., 648.,
+      189., 756.,  189., 756.,  216., 864., 216., 864., 243., 972., 243., 972.,
+      216., 864.,  216., 864.,  189., 756., 189., 756., 162., 648., 162., 648.,
+      180., 720.,  180., 720.,  210., 840., 210., 840., 240., 960., 240., 960.,
+      270., 1080., 270., 1080., 240., 960., 240., 960., 210., 840., 210., 840.,
+      180., 720.,  180., 720.,  162., 648., 162., 648., 189., 756., 189., 756.,
+      216., 864.,  216., 864.,  243., 972., 243., 972., 216., 864., 216., 864.,
+      189., 756.,  189., 756.,  162., 648., 162., 648., 144., 576., 144., 576.,
+      168., 672.,  168., 672.,  192., 768., 192., 768., 216., 864., 216., 864.,
+      192., 768.,  192., 768.,  168., 672., 168., 672., 144., 576., 144., 576.,
+      126., 504.,  126., 504.,  147., 588., 147., 588., 168., 672., 168., 672.,
+      189., 756.,  189., 756.,  168., 672., 168., 672., 147., 588., 147., 588.,
+      126., 504.,  126., 504.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x9x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      126., 252.,  126., 252.,  126., 252., 126., 252., 252.,  504., 252.,
+      504., 252.,  504., 252.,  504., 147., 294., 147., 294.,  147., 294.,
+      147., 294.,  294., 588.,  294., 588., 294., 588., 294.,  588., 168.,
+      336., 168.,  336., 168.,  336., 168., 336., 336., 672.,  336., 672.,
+      336., 672.,  336., 672.,  189., 378., 189., 378., 189.,  378., 189.,
+      378., 378.,  756., 378.,  756., 378., 756., 378., 756.,  168., 336.,
+      168., 336.,  168., 336.,  168., 336., 336., 672., 336.,  672., 336.,
+      672., 336.,  672., 147.,  294., 147., 294., 147., 294.,  147., 294.,
+      294., 588.,  294., 588.,  294., 588., 294., 588., 126.,  252., 126.,
+      252., 126.,  252., 126.,  252., 252., 504., 252., 504.,  252., 504.,
+      252., 504.,  144., 288.,  144., 288., 144., 288., 144.,  288., 288.,
+      576., 288.,  576., 288.,  576., 288., 576., 168., 336.,  168., 336.,
+      168., 336.,  168., 336.,  336., 672., 336., 672., 336.,  672., 336.,
+      672., 192.,  384., 192.,  384., 192., 384., 192., 384.,  384., 768.,
+      384., 768.,  384., 768.,  384., 768., 216., 432., 216.,  432., 216.,
+      432., 216.,  432., 432.,  864., 432., 864., 432., 864.,  432., 864.,
+      192., 384.,  192., 384.,  192., 384., 192., 384., 384.,  768., 384.,
+      768., 384.,  768., 384.,  768., 168., 336., 168., 336.,  168., 336.,
+      168., 336.,  336., 672.,  336., 672., 336., 672., 336.,  672., 144.,
+      288., 144.,  288., 144.,  288., 144., 288., 288., 576.,  288., 576.,
+      288., 576.,  288., 576.,  162., 324., 162., 324., 162.,  324., 162.,
+      324., 324.,  648., 324.,  648., 324., 648., 324., 648.,  189., 378.,
+      189., 378.,  189., 378.,  189., 378., 378., 756., 378.,  756., 378.,
+      756., 378.,  756., 216.,  432., 216., 432., 216., 432.,  216., 432.,
+      432., 864.,  432., 864.,  432., 864., 432., 864., 243.,  486., 243.,
+      486., 243.,  486., 243.,  486., 486., 972., 486., 972.,  486., 972.,
+      486., 972.,  216., 432.,  216., 432., 216., 432., 216.,  432., 432.,
+      864., 432.,  864., 432.,  864., 432., 864., 189., 378.,  189., 378.,
+      189., 378.,  189., 378.,  378., 756., 378., 756., 378.,  756., 378.,
+      756., 162.,  324., 162.,  324., 162., 324., 162., 324.,  324., 648.,
+      324., 648.,  324., 648.,  324., 648., 180., 360., 180.,  360., 180.,
+      360., 180.,  360., 360.,  720., 360., 720., 360., 720.,  360., 720.,
+      210., 420.,  210., 420.,  210., 420., 210., 420., 420.,  840., 420.,
+      840., 420.,  840., 420.,  840., 240., 480., 240., 480.,  240., 480.,
+      240., 480.,  480., 960.,  480., 960., 480., 960., 480.,  960., 270.,
+      540., 270.,  540., 270.,  540., 270., 540., 540., 1080., 540., 1080.,
+      540., 1080., 540., 1080., 240., 480., 240., 480., 240.,  480., 240.,
+      480., 480.,  960., 480.,  960., 480., 960., 480., 960.,  210., 420.,
+      210., 420.,  210., 420.,  210., 420., 420., 840., 420.,  840., 420.,
+      840., 420.,  840., 180.,  360., 180., 360., 180., 360.,  180., 360.,
+      360., 720.,  360., 720.,  360., 720., 360., 720., 162.,  324., 162.,
+      324., 162.,  324., 162.,  324., 324., 648., 324., 648.,  324., 648.,
+      324., 648.,  189., 378.,  189., 378., 189., 378., 189.,  378., 378.,
+      756., 378.,  756., 378.,  756., 378., 756., 216., 432.,  216., 432.,
+      216., 432.,  216., 432.,  432., 864., 432., 864., 432.,  864., 432.,
+      864., 243.,  486., 243.,  486., 243., 486., 243., 486.,  486., 972.,
+      486., 972.,  486., 972.,  486., 972., 216., 432., 216.,  432., 216.,
+      432., 216.,  432., 432.,  864., 432., 864., 432., 864.,  432., 864.,
+      189., 378.,  189., 378.,  189., 378., 189., 378., 378.,  756., 378.,
+      756., 378.,  756., 378.,  756., 162., 324., 162., 324.,  162., 324.,
+      162., 324.,  324., 648.,  324., 648., 324., 648., 324.,  648., 144.,
+      288., 144.,  288., 144.,  288., 144., 288., 288., 576.,  288., 576.,
+      288., 576.,  288., 576.,  168., 336., 168., 336., 168.,  336., 168.,
+      336., 336.,  672., 336.,  672., 336., 672., 336., 672.,  192., 384.,
+      192., 384.,  192., 384.,  192., 384., 384., 768., 384.,  768., 384.,
+      768., 384.,  768., 216.,  432., 216., 432., 216., 432.,  216., 432.,
+      432., 864.,  432., 864.,  432., 864., 432., 864., 192.,  384., 192.,
+      384., 192.,  384., 192.,  384., 384., 768., 384., 768.,  384., 768.,
+      384., 768.,  168., 336.,  168., 336., 168., 336., 168.,  336., 336.,
+      672., 336.,  672., 336.,  672., 336., 672., 144., 288.,  144., 288.,
+      144., 288.,  144., 288.,  288., 576., 288., 576., 288.,  576., 288.,
+      576., 126.,  252., 126.,  252., 126., 252., 126., 252.,  252., 504.,
+      252., 504.,  252., 504.,  252., 504., 147., 294., 147.,  294., 147.,
+      294., 147.,  294., 294.,  588., 294., 588., 294., 588.,  294., 588.,
+      168., 336.,  168., 336.,  168., 336., 168., 336., 336.,  672., 336.,
+      672., 336.,  672., 336.,  672., 189., 378., 189., 378.,  189., 378.,
+      189., 378.,  378., 756.,  378., 756., 378., 756., 378.,  756., 168.,
+      336., 168.,  336., 168.,  336., 168., 336., 336., 672.,  336., 672.,
+      336., 672.,  336., 672.,  147., 294., 147., 294., 147.,  294., 147.,
+      294., 294.,  588., 294.,  588., 294., 588., 294., 588.,  126., 252.,
+      126., 252.,  126., 252.,  126., 252., 252., 504., 252.,  504., 252.,
+      504., 252.,  504.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  96., 192., 96., 192.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 48., 96.,  48., 96.,
+      96., 192., 96., 192.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      147., 294., 294., 588.,  147., 294., 294., 588.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  189., 378., 378., 756.,  189., 378., 378., 756.,
+      210., 420., 420., 840.,  210., 420., 420., 840.,  189., 378., 378., 756.,
+      189., 378., 378., 756.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      147., 294., 294., 588.,  147., 294., 294., 588.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  192., 384., 384., 768.,  192., 384., 384., 768.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  240., 480., 480., 960.,
+      240., 480., 480., 960.,  216., 432., 432., 864.,  216., 432., 432., 864.,
+      192., 384., 384., 768.,  192., 384., 384., 768.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  189., 378., 378., 756.,  189., 378., 378., 756.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  243., 486., 486., 972.,
+      243., 486., 486., 972.,  270., 540., 540., 1080., 270., 540., 540., 1080.,
+      243., 486., 486., 972.,  243., 486., 486., 972.,  216., 432., 432., 864.,
+      216., 432., 432., 864.,  189., 378., 378., 756.,  189., 378., 378., 756.,
+      210., 420., 420., 840.,  210., 420., 420., 840.,  240., 480., 480., 960.,
+      240., 480., 480., 960.,  270., 540., 540., 1080., 270., 540., 540., 1080.,
+      300., 600., 600., 1200., 300., 600., 600., 1200., 270., 540., 540., 1080.,
+      270., 540., 540., 1080., 240., 480., 480., 960.,  240., 480., 480., 960.,
+      210., 420., 420., 840.,  210., 420., 420., 840.,  189., 378., 378., 756.,
+      189., 378., 378., 756.,  216., 432., 432., 864.,  216., 432., 432., 864.,
+      243., 486., 486., 972.,  243., 486., 486., 972.,  270., 540., 540., 1080.,
+      270., 540., 540., 1080., 243., 486., 486., 972.,  243., 486., 486., 972.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  189., 378., 378., 756.,
+      189., 378., 378., 756.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      192., 384., 384., 768.,  192., 384., 384., 768.,  216., 432., 432., 864.,
+      216., 432., 432., 864.,  240., 480., 480., 960.,  240., 480., 480., 960.,
+      216., 432., 432., 864.,  216., 432., 432., 864.,  192., 384., 384., 768.,
+      192., 384., 384., 768.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      147., 294., 294., 588.,  147., 294., 294., 588.,  168., 336., 336., 672.,
+      168., 336., 336., 672.,  189., 378., 378., 756.,  189., 378., 378., 756.,
+      210., 420., 420., 840.,  210., 420., 420., 840.,  189., 378., 378., 756.,
+      189., 378., 378., 756.,  168., 336., 336., 672.,  168., 336., 336., 672.,
+      147., 294., 294., 588.,  147., 294., 294., 588.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      96., 192., 96., 192., 96., 192., 96., 192., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192.,
+      96., 192., 96., 192.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x10x4x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      147.,  588., 147.,  588.,  168.,  672.,  168.,  672.,  189., 756.,  189.,
+      756.,  210., 840.,  210.,  840.,  189.,  756.,  189.,  756., 168.,  672.,
+      168.,  672., 147.,  588.,  147.,  588.,  168.,  672.,  168., 672.,  192.,
+      768.,  192., 768.,  216.,  864.,  216.,  864.,  240.,  960., 240.,  960.,
+      216.,  864., 216.,  864.,  192.,  768.,  192.,  768.,  168., 672.,  168.,
+      672.,  189., 756.,  189.,  756.,  216.,  864.,  216.,  864., 243.,  972.,
+      243.,  972., 270.,  1080., 270.,  1080., 243.,  972.,  243., 972.,  216.,
+      864.,  216., 864.,  189.,  756.,  189.,  756.,  210.,  840., 210.,  840.,
+      240.,  960., 240.,  960.,  270.,  1080., 270.,  1080., 300., 1200., 300.,
+      1200., 270., 1080., 270.,  1080., 240.,  960.,  240.,  960., 210.,  840.,
+      210.,  840., 189.,  756.,  189.,  756.,  216.,  864.,  216., 864.,  243.,
+      972.,  243., 972.,  270.,  1080., 270.,  1080., 243.,  972., 243.,  972.,
+      216.,  864., 216.,  864.,  189.,  756.,  189.,  756.,  168., 672.,  168.,
+      672.,  192., 768.,  192.,  768.,  216.,  864.,  216.,  864., 240.,  960.,
+      240.,  960., 216.,  864.,  216.,  864.,  192.,  768.,  192., 768.,  168.,
+      672.,  168., 672.,  147.,  588.,  147.,  588.,  168.,  672., 168.,  672.,
+      189.,  756., 189.,  756.,  210.,  840.,  210.,  840.,  189., 756.,  189.,
+      756.,  168., 672.,  168.,  672.,  147.,  588.,  147.,  588.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x10x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      147., 294.,  147., 294.,  147., 294.,  147., 294.,  294., 588.,
+      294., 588.,  294., 588.,  294., 588.,  168., 336.,  168., 336.,
+      168., 336.,  168., 336.,  336., 672.,  336., 672.,  336., 672.,
+      336., 672.,  189., 378.,  189., 378.,  189., 378.,  189., 378.,
+      378., 756.,  378., 756.,  378., 756.,  378., 756.,  210., 420.,
+      210., 420.,  210., 420.,  210., 420.,  420., 840.,  420., 840.,
+      420., 840.,  420., 840.,  189., 378.,  189., 378.,  189., 378.,
+      189., 378.,  378., 756.,  378., 756.,  378., 756.,  378., 756.,
+      168., 336.,  168., 336.,  168., 336.,  168., 336.,  336., 672.,
+      336., 672.,  336., 672.,  336., 672.,  147., 294.,  147., 294.,
+      147., 294.,  147., 294.,  294., 588.,  294., 588.,  294., 588.,
+      294., 588.,  168., 336.,  168., 336.,  168., 336.,  168., 336.,
+      336., 672.,  336., 672.,  336., 672.,  336., 672.,  192., 384.,
+      192., 384.,  192., 384.,  192., 384.,  384., 768.,  384., 768.,
+      384., 768.,  384., 768.,  216., 432.,  216., 432.,  216., 432.,
+      216., 432.,  432., 864.,  432., 864.,  432., 864.,  432., 864.,
+      240., 480.,  240., 480.,  240., 480.,  240., 480.,  480., 960.,
+      480., 960.,  480., 960.,  480., 960.,  216., 432.,  216., 432.,
+      216., 432.,  216., 432.,  432., 864.,  432., 864.,  432., 864.,
+      432., 864.,  192., 384.,  192., 384.,  192., 384.,  192., 384.,
+      384., 768.,  384., 768.,  384., 768.,  384., 768.,  168., 336.,
+      168., 336.,  168., 336.,  168., 336.,  336., 672.,  336., 672.,
+      336., 672.,  336., 672.,  189., 378.,  189., 378.,  189., 378.,
+      189., 378.,  378., 756.,  378., 756.,  378., 756.,  378., 756.,
+      216., 432.,  216., 432.,  216., 432.,  216., 432.,  432., 864.,
+      432., 864.,  432., 864.,  432., 864.,  243., 486.,  243., 486.,
+      243., 486.,  243., 486.,  486., 972.,  486., 972.,  486., 972.,
+      486., 972.,  270., 540.,  270., 540.,  270., 540.,  270., 540.,
+      540., 1080., 540., 1080., 540., 1080., 540., 1080., 243., 486.,
+      243., 486.,  243., 486.,  243., 486.,  486., 972.,  486., 972.,
+      486., 972.,  486., 972.,  216., 432.,  216., 432.,  216., 432.,
+      216., 432.,  432., 864.,  432., 864.,  432., 864.,  432., 864.,
+      189., 378.,  189., 378.,  189., 378.,  189., 378.,  378., 756.,
+      378., 756.,  378., 756.,  378., 756.,  210., 420.,  210., 420.,
+      210., 420.,  210., 420.,  420., 840.,  420., 840.,  420., 840.,
+      420., 840.,  240., 480.,  240., 480.,  240., 480.,  240., 480.,
+      480., 960.,  480., 960.,  480., 960.,  480., 960.,  270., 540.,
+      270., 540.,  270., 540.,  270., 540.,  540., 1080., 540., 1080.,
+      540., 1080., 540., 1080., 300., 600.,  300., 600.,  300., 600.,
+      300., 600.,  600., 1200., 600., 1200., 600., 1200., 600., 1200.,
+      270., 540.,  270., 540.,  270., 540.,  270., 540.,  540., 1080.,
+      540., 1080., 540., 1080., 540., 1080., 240., 480.,  240., 480.,
+      240., 480.,  240., 480.,  480., 960.,  480., 960.,  480., 960.,
+      480., 960.,  210., 420.,  210., 420.,  210., 420.,  210., 420.,
+      420., 840.,  420., 840.,  420., 840.,  420., 840.,  189., 378.,
+      189., 378.,  189., 378.,  189., 378.,  378., 756.,  378., 756.,
+      378., 756.,  378., 756.,  216., 432.,  216., 432.,  216., 432.,
+      216., 432.,  432., 864.,  432., 864.,  432., 864.,  432., 864.,
+      243., 486.,  243., 486.,  243., 486.,  243., 486.,  486., 972.,
+      486., 972.,  486., 972.,  486., 972.,  270., 540.,  270., 540.,
+      270., 540.,  270., 540.,  540., 1080., 540., 1080., 540., 1080.,
+      540., 1080., 243., 486.,  243., 486.,  243., 486.,  243., 486.,
+      486., 972.,  486., 972.,  486., 972.,  486., 972.,  216., 432.,
+      216., 432.,  216., 432.,  216., 432.,  432., 864.,  432., 864.,
+      432., 864.,  432., 864.,  189., 378.,  189., 378.,  189., 378.,
+      189., 378.,  378., 756.,  378., 756.,  378., 756.,  378., 756.,
+      168., 336.,  168., 336.,  168., 336.,  168., 336.,  336., 672.,
+      336., 672.,  336., 672.,  336., 672.,  192., 384.,  192., 384.,
+      192., 384.,  192., 384.,  384., 768.,  384., 768.,  384., 768.,
+      384., 768.,  216., 432.,  216., 432.,  216., 432.,  216., 432.,
+      432., 864.,  432., 864.,  432., 864.,  432., 864.,  240., 480.,
+      240., 480.,  240., 480.,  240., 480.,  480., 960.,  480., 960.,
+      480., 960.,  480., 960.,  216., 432.,  216., 432.,  216., 432.,
+      216., 432.,  432., 864.,  432., 864.,  432., 864.,  432., 864.,
+      192., 384.,  192., 384.,  192., 384.,  192., 384.,  384., 768.,
+      384., 768.,  384., 768.,  384., 768.,  168., 336.,  168., 336.,
+      168., 336.,  168., 336.,  336., 672.,  336., 672.,  336., 672.,
+      336., 672.,  147., 294.,  147., 294.,  147., 294.,  147., 294.,
+      294., 588.,  294., 588.,  294., 588.,  294., 588.,  168., 336.,
+      168., 336.,  168., 336.,  168., 336.,  336., 672.,  336., 672.,
+      336., 672.,  336., 672.,  189., 378.,  189., 378.,  189., 378.,
+      189., 378.,  378., 756.,  378., 756.,  378., 756.,  378., 756.,
+      210., 420.,  210., 420.,  210., 420.,  210., 420.,  420., 840.,
+      420., 840.,  420., 840.,  420., 840.,  189., 378.,  189., 378.,
+      189., 378.,  189., 378.,  378., 756.,  378., 756.,  378., 756.,
+      378., 756.,  168., 336.,  168., 336.,  168., 336.,  168., 336.,
+      336., 672.,  336., 672.,  336., 672.,  336., 672.,  147., 294.,
+      147., 294.,  147., 294.,  147., 294.,  294., 588.,  294., 588.,
+      294., 588.,  294., 588.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
@@ -0,0 +1,5751 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using FilterBackpropWindow7Stride4Groups5 =
+    GroupWindowStrideTest<Triple, 7, 4, 5>;
+TYPED_TEST_SUITE(FilterBackpropWindow7Stride4Groups5, GTestTypeTriples);
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x11x11x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8.};
+  const std::array<int, 4> in_shape = {{1, 11, 11, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x11x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,
+      8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.};
+  const std::array<int, 4> in_shape = {{1, 11, 11, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x11x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 11, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x11x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      13., 28., 13., 28., 13., 18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  26., 14., 26., 14., 26.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.};
+  const std::array<int, 4> in_shape = {{1, 11, 11, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 11, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x11x12x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.};
+  const std::array<int, 4> in_shape = {{1, 11, 12, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x12x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,
+      8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 11, 12, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x11x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 11, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x12x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 18., 9.,  18., 9.,  18.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 12., 6.,  12., 6.,  12.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12.};
+  const std::array<int, 4> in_shape = {{1, 11, 12, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 11, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x11x14x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.};
+  const std::array<int, 4> in_shape = {{1, 11, 14, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x14x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16.,
+      32., 8.,  16., 16., 32., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,
+      16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.};
+  const std::array<int, 4> in_shape = {{1, 11, 14, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x11x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 11, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x14x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 16., 10., 16., 10., 20., 8.,  20., 8.,  20., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 8.,  20., 8.,  20., 8.,  16., 10., 16., 10., 16.,
+      8.,  20., 8.,  20., 8.,  10., 16., 10., 16., 10., 20., 8.,  20., 8.,  20.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  20., 8.,  20., 8.,
+      16., 10., 16., 10., 16., 8.,  20., 8.,  20., 8.,  15., 24., 15., 24., 15.,
+      30., 12., 30., 12., 30., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 30., 12., 30., 12., 24., 15., 24., 15., 24., 12., 30., 12., 30., 12.,
+      15., 24., 15., 24., 15., 30., 12., 30., 12., 30., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 30., 12., 30., 12., 24., 15., 24., 15., 24.,
+      12., 30., 12., 30., 12., 15., 24., 15., 24., 15., 30., 12., 30., 12., 30.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 30., 12., 30., 12.,
+      24., 15., 24., 15., 24., 12., 30., 12., 30., 12., 10., 16., 10., 16., 10.,
+      20., 8.,  20., 8.,  20., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      8.,  20., 8.,  20., 8.,  16., 10., 16., 10., 16., 8.,  20., 8.,  20., 8.,
+      10., 16., 10., 16., 10., 20., 8.,  20., 8.,  20., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 8.,  20., 8.,  20., 8.,  16., 10., 16., 10., 16.,
+      8.,  20., 8.,  20., 8.};
+  const std::array<int, 4> in_shape = {{1, 11, 14, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x11x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 11, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x12x11x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8.};
+  const std::array<int, 4> in_shape = {{1, 12, 11, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x11x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,
+      8.,  8.,  16., 4.,  8.,  12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 8.,  16., 4.,  8.,  8.,
+      16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,
+      8.,  8.,  16., 4.,  8.,  12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 12, 11, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x12x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 12, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x11x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12.};
+  const std::array<int, 4> in_shape = {{1, 12, 11, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 12, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x12x12x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.};
+  const std::array<int, 4> in_shape = {{1, 12, 12, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x12x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,
+      8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16., 4.,  8.,
+      8.,  16., 4.,  8.,  8.,  16., 4.,  8.,  8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 12, 12, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x12x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 12, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x12x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 9.,  18., 9.,  18.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 12., 6.,  12., 6.,  12.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12.};
+  const std::array<int, 4> in_shape = {{1, 12, 12, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 4.,  8.,  4.,  8.,  4.,
+      8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  4.,  8.,  8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16.};
+  const std::array<int, 4> in_shape = {{1, 12, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x12x14x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.};
+  const std::array<int, 4> in_shape = {{1, 12, 14, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x14x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,
+      16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.};
+  const std::array<int, 4> in_shape = {{1, 12, 14, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x12x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 12, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x14x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 16., 10., 16., 10., 20., 8.,  20., 8.,  20., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 8.,  20., 8.,  20., 8.,  16., 10., 16., 10., 16.,
+      8.,  20., 8.,  20., 8.,  15., 24., 15., 24., 15., 30., 12., 30., 12., 30.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 30., 12., 30., 12.,
+      24., 15., 24., 15., 24., 12., 30., 12., 30., 12., 15., 24., 15., 24., 15.,
+      30., 12., 30., 12., 30., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 30., 12., 30., 12., 24., 15., 24., 15., 24., 12., 30., 12., 30., 12.,
+      15., 24., 15., 24., 15., 30., 12., 30., 12., 30., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 30., 12., 30., 12., 24., 15., 24., 15., 24.,
+      12., 30., 12., 30., 12., 15., 24., 15., 24., 15., 30., 12., 30., 12., 30.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 30., 12., 30., 12.,
+      24., 15., 24., 15., 24., 12., 30., 12., 30., 12., 10., 16., 10., 16., 10.,
+      20., 8.,  20., 8.,  20., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      8.,  20., 8.,  20., 8.,  16., 10., 16., 10., 16., 8.,  20., 8.,  20., 8.,
+      10., 16., 10., 16., 10., 20., 8.,  20., 8.,  20., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 8.,  20., 8.,  20., 8.,  16., 10., 16., 10., 16.,
+      8.,  20., 8.,  20., 8.};
+  const std::array<int, 4> in_shape = {{1, 12, 14, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x12x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 12, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x14x11x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8., 8., 16., 8., 16., 4., 8., 4., 8., 8., 16., 8., 16.,
+      4., 8., 4., 8.};
+  const std::array<int, 4> in_shape = {{1, 14, 11, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x11x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 16., 32., 8.,  16., 16.,
+      32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,
+      16., 16., 32., 8.,  16., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.};
+  const std::array<int, 4> in_shape = {{1, 14, 11, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x14x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 14, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x11x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14., 26., 14.,
+      28., 13., 28., 13., 28., 14., 26., 14., 26., 14., 18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      28., 13., 28., 13., 28., 14., 26., 14., 26., 14., 28., 13., 28., 13., 28.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.};
+  const std::array<int, 4> in_shape = {{1, 14, 11, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 14, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x14x12x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.};
+  const std::array<int, 4> in_shape = {{1, 14, 12, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x12x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 8.,  16., 16., 32., 8.,
+      16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 8.,  16., 16., 32., 8.,  16., 16., 32., 8.,  16.,
+      16., 32., 8.,  16., 16., 32., 8.,  16., 16., 32., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12.,
+      24., 6.,  12., 12., 24., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,
+      12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 6.,  12., 12., 24., 6.,  12., 12., 24., 6.,  12.,
+      12., 24., 6.,  12., 12., 24., 6.,  12., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 14, 12, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x14x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 14, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x12x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 9.,  18., 9.,  18., 14., 26., 14., 26., 14., 28., 13., 28., 13., 28.,
+      14., 26., 14., 26., 14., 28., 13., 28., 13., 28., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 9.,  18., 9.,  18., 14., 26., 14., 26., 14.,
+      28., 13., 28., 13., 28., 14., 26., 14., 26., 14., 28., 13., 28., 13., 28.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 24., 12., 24., 12., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 12., 24., 12., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 9.,  18., 9.,  18.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 13., 28., 13., 28., 13.,
+      26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 9.,  18., 9.,  18., 13., 28., 13., 28., 13., 26., 14., 26., 14., 26.,
+      13., 28., 13., 28., 13., 26., 14., 26., 14., 26., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18.};
+  const std::array<int, 4> in_shape = {{1, 14, 12, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 8.,  16., 8.,  16., 8.,
+      16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      8.,  16., 8.,  16., 8.,  16., 8.,  16., 8.,  16., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{1, 14, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x14x14x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.,  8., 16., 8., 16., 4., 8.,  4., 8.,  8., 16., 8., 16.,
+      4., 8.,  4., 8.};
+  const std::array<int, 4> in_shape = {{1, 14, 14, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x14x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 16., 32., 32., 64., 16.,
+      32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32., 32., 64.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 16., 32., 32., 64., 16., 32., 32., 64., 16., 32.,
+      32., 64., 16., 32., 32., 64., 16., 32., 32., 64., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24.,
+      48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 12., 24., 24., 48., 12.,
+      24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24., 24., 48.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18.,
+      36., 9.,  18., 18., 36., 12., 24., 24., 48., 12., 24., 24., 48., 12., 24.,
+      24., 48., 12., 24., 24., 48., 12., 24., 24., 48., 9.,  18., 18., 36., 9.,
+      18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18., 18., 36.,
+      9.,  18., 18., 36., 9.,  18., 18., 36., 9.,  18.};
+  const std::array<int, 4> in_shape = {{1, 14, 14, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED1x14x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16.,
+      8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,  4., 8.,  4., 8.,
+      4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16., 4., 8.,  4., 8.,
+      4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16., 8., 16., 8., 16.,
+      4., 8.,  4., 8.,  4., 8.,  4., 8.,  4., 8.,  8., 16., 8., 16., 8., 16.,
+      8., 16., 8., 16.};
+  const std::array<int, 4> in_shape = {{1, 14, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x14x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      15., 24., 15., 24., 15., 30., 12., 30., 12., 30., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 30., 12., 30., 12., 24., 15., 24., 15., 24.,
+      12., 30., 12., 30., 12., 15., 24., 15., 24., 15., 30., 12., 30., 12., 30.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 30., 12., 30., 12.,
+      24., 15., 24., 15., 24., 12., 30., 12., 30., 12., 20., 32., 20., 32., 20.,
+      40., 16., 40., 16., 40., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      16., 40., 16., 40., 16., 32., 20., 32., 20., 32., 16., 40., 16., 40., 16.,
+      20., 32., 20., 32., 20., 40., 16., 40., 16., 40., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 16., 40., 16., 40., 16., 32., 20., 32., 20., 32.,
+      16., 40., 16., 40., 16., 15., 24., 15., 24., 15., 30., 12., 30., 12., 30.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 30., 12., 30., 12.,
+      24., 15., 24., 15., 24., 12., 30., 12., 30., 12., 15., 24., 15., 24., 15.,
+      30., 12., 30., 12., 30., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 30., 12., 30., 12., 24., 15., 24., 15., 24., 12., 30., 12., 30., 12.,
+      15., 24., 15., 24., 15., 30., 12., 30., 12., 30., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 30., 12., 30., 12., 24., 15., 24., 15., 24.,
+      12., 30., 12., 30., 12.};
+  const std::array<int, 4> in_shape = {{1, 14, 14, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED1x14x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 16., 32., 16., 32., 16., 32., 16., 32., 16., 32.,
+      32., 64., 32., 64., 32., 64., 32., 64., 32., 64., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 32., 64.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 16., 32., 16., 32., 16.,
+      32., 16., 32., 16., 32., 32., 64., 32., 64., 32., 64., 32., 64., 32., 64.,
+      16., 32., 16., 32., 16., 32., 16., 32., 16., 32., 32., 64., 32., 64., 32.,
+      64., 32., 64., 32., 64., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{1, 14, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x11x11x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40.,
+      20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20.,
+      40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32.,
+      20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16.,
+      32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16., 32.,
+      16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40., 16.,
+      32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20., 40.,
+      16., 32., 16., 32., 20., 40., 20., 40., 16., 32., 16., 32., 20., 40., 20.,
+      40., 16., 32., 16., 32.};
+  const std::array<int, 4> in_shape = {{3, 11, 11, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x11x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20.,
+      40., 16., 32., 20., 40., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24.,
+      48., 30., 60., 24., 48., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40.,
+      16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20.,
+      40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24.,
+      48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60.,
+      16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20.,
+      40., 16., 32., 20., 40., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 36., 72., 45., 90., 36.,
+      72., 45., 90., 36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 45., 90.,
+      36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 30., 60., 24., 48., 30.,
+      60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24.,
+      48., 30., 60., 24., 48., 45., 90., 36., 72., 45., 90., 36., 72., 45., 90.,
+      36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 45.,
+      90., 36., 72., 45., 90., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24.,
+      48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60.,
+      36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 45.,
+      90., 36., 72., 45., 90., 36., 72., 45., 90., 36., 72., 45., 90., 36., 72.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24.,
+      48., 30., 60., 24., 48., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40.,
+      16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 30., 60., 24., 48., 30.,
+      60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 16., 32., 20., 40., 16.,
+      32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40.,
+      16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40., 16., 32., 20.,
+      40., 16., 32., 20., 40., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48.,
+      30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24., 48., 30., 60., 24.,
+      48., 30., 60., 24., 48., 20., 40., 16., 32., 20., 40., 16., 32., 20., 40.,
+      16., 32., 20., 40., 16., 32., 20., 40., 16., 32.};
+  const std::array<int, 4> in_shape = {{3, 11, 11, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x11x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 11, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x11x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 30., 24., 30., 24., 30., 24., 30., 24., 30., 36., 45., 36., 45., 36.,
+      45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 30., 24., 30., 24., 30.,
+      24., 30., 24., 30., 24., 30., 24., 30., 24., 30., 24., 30., 24., 30., 24.,
+      45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 45.,
+      24., 30., 24., 30., 24., 30., 24., 30., 24., 30., 36., 45., 36., 45., 36.,
+      45., 36., 45., 36., 45., 54., 69., 54., 69., 54., 66., 54., 66., 54., 66.,
+      54., 69., 54., 69., 54., 45., 36., 45., 36., 45., 36., 45., 36., 45., 36.,
+      45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 66., 54., 66., 54., 66.,
+      54., 69., 54., 69., 54., 66., 54., 66., 54., 66., 36., 45., 36., 45., 36.,
+      45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 45.,
+      54., 69., 54., 69., 54., 66., 54., 66., 54., 66., 54., 69., 54., 69., 54.,
+      45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 30., 24., 30., 24., 30.,
+      24., 30., 24., 30., 24., 45., 36., 45., 36., 45., 36., 45., 36., 45., 36.,
+      45., 36., 45., 36., 45., 24., 30., 24., 30., 24., 30., 24., 30., 24., 30.,
+      24., 30., 24., 30., 24., 30., 24., 30., 24., 30., 36., 45., 36., 45., 36.,
+      45., 36., 45., 36., 45., 36., 45., 36., 45., 36., 30., 24., 30., 24., 30.,
+      24., 30., 24., 30., 24.};
+  const std::array<int, 4> in_shape = {{3, 11, 11, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.};
+  const std::array<int, 4> in_shape = {{3, 11, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x11x12x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 11, 12, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x12x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  24., 48.,
+      12., 24.,  24., 48.,  12., 24.,  24., 48.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      12., 24.,  24., 48.,  12., 24.,  24., 48.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.};
+  const std::array<int, 4> in_shape = {{3, 11, 12, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x11x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 11, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x12x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 18., 36., 18., 36., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 36., 18., 36., 18., 36., 27., 54., 27., 54., 27.,
+      54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 54., 27., 54., 27., 54.,
+      40., 82., 40., 82., 40., 80., 41., 80., 41., 80., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      54., 27., 54., 27., 54., 40., 82., 40., 82., 40., 80., 41., 80., 41., 80.,
+      40., 82., 40., 82., 40., 80., 41., 80., 41., 80., 27., 54., 27., 54., 27.,
+      54., 27., 54., 27., 54., 54., 27., 54., 27., 54., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 40., 82., 40., 82., 40., 80., 41., 80., 41., 80.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 36., 18., 36., 18., 36.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27.,
+      54., 27., 54., 27., 54., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 18., 36., 18., 36., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{3, 11, 12, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.};
+  const std::array<int, 4> in_shape = {{3, 11, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x11x14x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 11, 14, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x14x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  24., 48.,  48., 96.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,
+      48., 96.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.};
+  const std::array<int, 4> in_shape = {{3, 11, 14, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x11x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 11, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x14x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30., 48.,  30., 48.,  30., 60.,  24., 60.,  24.,  60.,  36.,  72.,  36.,
+      72., 36.,  72., 36.,  72., 36.,  72., 24.,  60.,  24.,  60.,  24.,  48.,
+      30., 48.,  30., 48.,  24., 60.,  24., 60.,  24.,  30.,  48.,  30.,  48.,
+      30., 60.,  24., 60.,  24., 60.,  36., 72.,  36.,  72.,  36.,  72.,  36.,
+      72., 36.,  72., 24.,  60., 24.,  60., 24.,  48.,  30.,  48.,  30.,  48.,
+      24., 60.,  24., 60.,  24., 45.,  72., 45.,  72.,  45.,  90.,  36.,  90.,
+      36., 90.,  54., 108., 54., 108., 54., 108., 54.,  108., 54.,  108., 36.,
+      90., 36.,  90., 36.,  72., 45.,  72., 45.,  72.,  36.,  90.,  36.,  90.,
+      36., 45.,  72., 45.,  72., 45.,  90., 36.,  90.,  36.,  90.,  54.,  108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36.,  90.,  36.,  90.,  36.,
+      72., 45.,  72., 45.,  72., 36.,  90., 36.,  90.,  36.,  45.,  72.,  45.,
+      72., 45.,  90., 36.,  90., 36.,  90., 54.,  108., 54.,  108., 54.,  108.,
+      54., 108., 54., 108., 36., 90.,  36., 90.,  36.,  72.,  45.,  72.,  45.,
+      72., 36.,  90., 36.,  90., 36.,  30., 48.,  30.,  48.,  30.,  60.,  24.,
+      60., 24.,  60., 36.,  72., 36.,  72., 36.,  72.,  36.,  72.,  36.,  72.,
+      24., 60.,  24., 60.,  24., 48.,  30., 48.,  30.,  48.,  24.,  60.,  24.,
+      60., 24.,  30., 48.,  30., 48.,  30., 60.,  24.,  60.,  24.,  60.,  36.,
+      72., 36.,  72., 36.,  72., 36.,  72., 36.,  72.,  24.,  60.,  24.,  60.,
+      24., 48.,  30., 48.,  30., 48.,  24., 60.,  24.,  60.,  24.};
+  const std::array<int, 4> in_shape = {{3, 11, 14, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x11x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 11, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x12x11x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 12, 11, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x11x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48.,  12., 24., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  12., 24., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 24., 48.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 27., 54., 54., 108., 27., 54.,
+      54., 108., 27., 54., 54., 108., 18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  12., 24., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 24., 48.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.,
+      36., 72.,  12., 24., 24., 48.,  12., 24., 24., 48.,  12., 24.,
+      24., 48.,  12., 24., 24., 48.,  12., 24., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 11, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x12x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x11x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      40., 82., 40., 82., 40., 80., 41., 80., 41., 80., 40., 82., 40., 82., 40.,
+      54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 80., 41., 80., 41., 80., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 40., 82., 40., 82., 40., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27.,
+      80., 41., 80., 41., 80., 40., 82., 40., 82., 40., 80., 41., 80., 41., 80.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{3, 12, 11, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x12x12x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 12, 12, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x12x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  12., 24.,  24., 48.,  12., 24.,  24., 48.,  12., 24.,
+      24., 48.,  12., 24.,  24., 48.,  12., 24.,  24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 12, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x12x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x12x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 18., 36., 18., 36., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 54., 27., 54., 27., 54., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 40., 82., 40., 82., 40., 80., 41., 80., 41., 80.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 54., 27., 54., 27., 54.,
+      40., 82., 40., 82., 40., 80., 41., 80., 41., 80., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      54., 27., 54., 27., 54., 40., 82., 40., 82., 40., 80., 41., 80., 41., 80.,
+      40., 82., 40., 82., 40., 80., 41., 80., 41., 80., 27., 54., 27., 54., 27.,
+      54., 27., 54., 27., 54., 54., 27., 54., 27., 54., 40., 82., 40., 82., 40.,
+      80., 41., 80., 41., 80., 40., 82., 40., 82., 40., 80., 41., 80., 41., 80.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 36., 18., 36., 18., 36.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 27.,
+      54., 27., 54., 27., 54., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      36., 18., 36., 18., 36., 27., 54., 27., 54., 27., 54., 27., 54., 27., 54.,
+      27., 54., 27., 54., 27., 54., 27., 54., 27., 54., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36.};
+  const std::array<int, 4> in_shape = {{3, 12, 12, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  12., 24.,  12., 24.,
+      12., 24.,  12., 24.,  12., 24.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,
+      12., 24.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      12., 24.,  12., 24.,  12., 24.,  12., 24.,  12., 24.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x12x14x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 12, 14, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x14x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.};
+  const std::array<int, 4> in_shape = {{3, 12, 14, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x12x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 12, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x14x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      30.,  48.,  30.,  48.,  30.,  60.,  24.,  60.,  24.,  60.,  36.,  72.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  24.,  60.,  24.,  60.,
+      24.,  48.,  30.,  48.,  30.,  48.,  24.,  60.,  24.,  60.,  24.,  45.,
+      72.,  45.,  72.,  45.,  90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,
+      108., 54.,  108., 54.,  108., 54.,  108., 36.,  90.,  36.,  90.,  36.,
+      72.,  45.,  72.,  45.,  72.,  36.,  90.,  36.,  90.,  36.,  45.,  72.,
+      45.,  72.,  45.,  90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 54.,  108., 36.,  90.,  36.,  90.,  36.,  72.,
+      45.,  72.,  45.,  72.,  36.,  90.,  36.,  90.,  36.,  45.,  72.,  45.,
+      72.,  45.,  90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,  108., 54.,
+      108., 54.,  108., 54.,  108., 36.,  90.,  36.,  90.,  36.,  72.,  45.,
+      72.,  45.,  72.,  36.,  90.,  36.,  90.,  36.,  45.,  72.,  45.,  72.,
+      45.,  90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 36.,  90.,  36.,  90.,  36.,  72.,  45.,  72.,
+      45.,  72.,  36.,  90.,  36.,  90.,  36.,  30.,  48.,  30.,  48.,  30.,
+      60.,  24.,  60.,  24.,  60.,  36.,  72.,  36.,  72.,  36.,  72.,  36.,
+      72.,  36.,  72.,  24.,  60.,  24.,  60.,  24.,  48.,  30.,  48.,  30.,
+      48.,  24.,  60.,  24.,  60.,  24.,  30.,  48.,  30.,  48.,  30.,  60.,
+      24.,  60.,  24.,  60.,  36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,
+      36.,  72.,  24.,  60.,  24.,  60.,  24.,  48.,  30.,  48.,  30.,  48.,
+      24.,  60.,  24.,  60.,  24.};
+  const std::array<int, 4> in_shape = {{3, 12, 14, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x12x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 12, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x14x11x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 14, 11, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x11x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  24., 48., 48., 96.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  24., 48., 48., 96.,
+      24., 48., 48., 96.,  36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 48., 96.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  24., 48., 48., 96.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  24., 48., 48., 96.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  24., 48., 48., 96.,
+      24., 48., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 36., 72., 72., 144.,
+      36., 72., 72., 144., 36., 72., 72., 144., 24., 48., 48., 96.,
+      24., 48., 48., 96.,  24., 48., 48., 96.,  24., 48., 48., 96.,
+      24., 48., 48., 96.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 54., 108., 27., 54., 54., 108., 27., 54., 54., 108.,
+      27., 54., 36., 72.,  18., 36., 36., 72.,  18., 36., 36., 72.,
+      18., 36., 36., 72.,  18., 36., 36., 72.,  18., 36.};
+  const std::array<int, 4> in_shape = {{3, 14, 11, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x14x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 14, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x11x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  42., 78.,
+      42., 78.,  42., 84.,  39., 84.,  39., 84.,  42., 78.,  42., 78.,
+      42., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 84.,  39., 84.,
+      39., 84.,  42., 78.,  42., 78.,  42., 84.,  39., 84.,  39., 84.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 54., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  39., 84.,  39., 84.,  39., 78.,
+      42., 78.,  42., 78.,  39., 84.,  39., 84.,  39., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 78.,  42., 78.,  42., 78.,  39., 84.,
+      39., 84.,  39., 78.,  42., 78.,  42., 78.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  39., 84.,  39., 84.,  39., 78.,  42., 78.,
+      42., 78.,  39., 84.,  39., 84.,  39., 54.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27.};
+  const std::array<int, 4> in_shape = {{3, 14, 11, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x11x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 14, 11, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x14x12x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 14, 12, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x12x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  48., 96.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,
+      48., 96.,  24., 48.,  48., 96.,  48., 96.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  24., 48.,  48., 96.,  24., 48.,  48., 96.,
+      24., 48.,  48., 96.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.,  27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 18., 36.,  36., 72.,  18., 36.,  36., 72.,  18., 36.,
+      36., 72.,  18., 36.,  36., 72.,  18., 36.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 14, 12, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x14x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 14, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x12x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      54.,  27.,  54.,  27.,  54.,  42.,  78.,  42.,  78.,  42.,  84.,  39.,
+      84.,  39.,  84.,  42.,  78.,  42.,  78.,  42.,  84.,  39.,  84.,  39.,
+      84.,  27.,  54.,  27.,  54.,  27.,  54.,  27.,  54.,  27.,  54.,  54.,
+      27.,  54.,  27.,  54.,  42.,  78.,  42.,  78.,  42.,  84.,  39.,  84.,
+      39.,  84.,  42.,  78.,  42.,  78.,  42.,  84.,  39.,  84.,  39.,  84.,
+      27.,  54.,  27.,  54.,  27.,  54.,  27.,  54.,  27.,  54.,  72.,  36.,
+      72.,  36.,  72.,  54.,  108., 54.,  108., 54.,  108., 54.,  108., 54.,
+      108., 54.,  108., 54.,  108., 54.,  108., 54.,  108., 54.,  108., 36.,
+      72.,  36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  72.,  36.,  72.,
+      36.,  72.,  54.,  108., 54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 54.,  108., 36.,  72.,
+      36.,  72.,  36.,  72.,  36.,  72.,  36.,  72.,  54.,  27.,  54.,  27.,
+      54.,  39.,  84.,  39.,  84.,  39.,  78.,  42.,  78.,  42.,  78.,  39.,
+      84.,  39.,  84.,  39.,  78.,  42.,  78.,  42.,  78.,  27.,  54.,  27.,
+      54.,  27.,  54.,  27.,  54.,  27.,  54.,  54.,  27.,  54.,  27.,  54.,
+      39.,  84.,  39.,  84.,  39.,  78.,  42.,  78.,  42.,  78.,  39.,  84.,
+      39.,  84.,  39.,  78.,  42.,  78.,  42.,  78.,  27.,  54.,  27.,  54.,
+      27.,  54.,  27.,  54.,  27.,  54.,  54.,  27.,  54.,  27.,  54.,  39.,
+      84.,  39.,  84.,  39.,  78.,  42.,  78.,  42.,  78.,  39.,  84.,  39.,
+      84.,  39.,  78.,  42.,  78.,  42.,  78.,  27.,  54.,  27.,  54.,  27.,
+      54.,  27.,  54.,  27.,  54.};
+  const std::array<int, 4> in_shape = {{3, 14, 12, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x12x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 24., 48.,  24., 48.,
+      24., 48.,  24., 48.,  24., 48.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 24., 48.,  24., 48.,  24., 48.,  24., 48.,
+      24., 48.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      24., 48.,  24., 48.,  24., 48.,  24., 48.,  24., 48.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 18., 36.,  18., 36.,
+      18., 36.,  18., 36.,  18., 36.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 18., 36.,  18., 36.,  18., 36.,  18., 36.,
+      18., 36.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      18., 36.,  18., 36.,  18., 36.,  18., 36.,  18., 36.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.};
+  const std::array<int, 4> in_shape = {{3, 14, 12, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x14x14x5x20) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48.,
+      24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24.,
+      48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24.,
+      24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12.,
+      24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12., 24.,
+      12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48., 12.,
+      24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24., 48.,
+      12., 24., 12., 24., 24., 48., 24., 48., 12., 24., 12., 24., 24., 48., 24.,
+      48., 12., 24., 12., 24.};
+  const std::array<int, 4> in_shape = {{3, 14, 14, 5}};
+  const int features = 20;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x14x5x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 48., 96.,  96., 192., 48., 96.,  96., 192.,
+      48., 96.,  96., 192., 48., 96.,  96., 192., 48., 96.,  96., 192.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 48., 96.,  96., 192., 48., 96.,  96., 192., 48., 96.,
+      96., 192., 48., 96.,  96., 192., 48., 96.,  96., 192., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,
+      72., 144., 36., 72.,  72., 144., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 36., 72.,  72., 144., 36., 72.,  72., 144.,
+      36., 72.,  72., 144., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.,  54., 108.,
+      27., 54.,  54., 108., 27., 54.,  54., 108., 27., 54.};
+  const std::array<int, 4> in_shape = {{3, 14, 14, 5}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, VALIDHWCFSTRIDED3x14x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 24., 48., 24., 48., 24.,
+      48., 24., 48., 24., 48.};
+  const std::array<int, 4> in_shape = {{3, 14, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x14x5x5) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  72.,  45.,  72.,  45.,  90.,  36.,  90.,  36.,  90.,  54.,  108.,
+      54.,  108., 54.,  108., 54.,  108., 54.,  108., 36.,  90.,  36.,  90.,
+      36.,  72.,  45.,  72.,  45.,  72.,  36.,  90.,  36.,  90.,  36.,  45.,
+      72.,  45.,  72.,  45.,  90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,
+      108., 54.,  108., 54.,  108., 54.,  108., 36.,  90.,  36.,  90.,  36.,
+      72.,  45.,  72.,  45.,  72.,  36.,  90.,  36.,  90.,  36.,  60.,  96.,
+      60.,  96.,  60.,  120., 48.,  120., 48.,  120., 72.,  144., 72.,  144.,
+      72.,  144., 72.,  144., 72.,  144., 48.,  120., 48.,  120., 48.,  96.,
+      60.,  96.,  60.,  96.,  48.,  120., 48.,  120., 48.,  60.,  96.,  60.,
+      96.,  60.,  120., 48.,  120., 48.,  120., 72.,  144., 72.,  144., 72.,
+      144., 72.,  144., 72.,  144., 48.,  120., 48.,  120., 48.,  96.,  60.,
+      96.,  60.,  96.,  48.,  120., 48.,  120., 48.,  45.,  72.,  45.,  72.,
+      45.,  90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,  108., 54.,  108.,
+      54.,  108., 54.,  108., 36.,  90.,  36.,  90.,  36.,  72.,  45.,  72.,
+      45.,  72.,  36.,  90.,  36.,  90.,  36.,  45.,  72.,  45.,  72.,  45.,
+      90.,  36.,  90.,  36.,  90.,  54.,  108., 54.,  108., 54.,  108., 54.,
+      108., 54.,  108., 36.,  90.,  36.,  90.,  36.,  72.,  45.,  72.,  45.,
+      72.,  36.,  90.,  36.,  90.,  36.,  45.,  72.,  45.,  72.,  45.,  90.,
+      36.,  90.,  36.,  90.,  54.,  108., 54.,  108., 54.,  108., 54.,  108.,
+      54.,  108., 36.,  90.,  36.,  90.,  36.,  72.,  45.,  72.,  45.,  72.,
+      36.,  90.,  36.,  90.,  36.};
+  const std::array<int, 4> in_shape = {{3, 14, 14, 5}};
+  const int features = 5;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
+TYPED_TEST(FilterBackpropWindow7Stride4Groups5, SAMEHWCFSTRIDED3x14x14x10x10) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 48., 96.,  48., 96.,
+      48., 96.,  48., 96.,  48., 96.,  96., 192., 96., 192., 96., 192.,
+      96., 192., 96., 192., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  96., 192., 96., 192., 96., 192., 96., 192., 96., 192.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 48., 96.,  48., 96.,  48., 96.,  48., 96.,
+      48., 96.,  96., 192., 96., 192., 96., 192., 96., 192., 96., 192.,
+      48., 96.,  48., 96.,  48., 96.,  48., 96.,  48., 96.,  96., 192.,
+      96., 192., 96., 192., 96., 192., 96., 192., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 36., 72.,  36., 72.,
+      36., 72.,  36., 72.,  36., 72.,  72., 144., 72., 144., 72., 144.,
+      72., 144., 72., 144., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 36., 72.,  36., 72.,  36., 72.,  36., 72.,
+      36., 72.,  72., 144., 72., 144., 72., 144., 72., 144., 72., 144.,
+      36., 72.,  36., 72.,  36., 72.,  36., 72.,  36., 72.,  72., 144.,
+      72., 144., 72., 144., 72., 144., 72., 144., 27., 54.,  27., 54.,
+      27., 54.,  27., 54.,  27., 54.,  54., 108., 54., 108., 54., 108.,
+      54., 108., 54., 108., 27., 54.,  27., 54.,  27., 54.,  27., 54.,
+      27., 54.,  54., 108., 54., 108., 54., 108., 54., 108., 54., 108.,
+      27., 54.,  27., 54.,  27., 54.,  27., 54.,  27., 54.,  54., 108.,
+      54., 108., 54., 108., 54., 108., 54., 108.};
+  const std::array<int, 4> in_shape = {{3, 14, 14, 10}};
+  const int features = 10;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_filter_backprop_test(exp_out, in_shape, features, padding,
+                                 filter_format, group_format, max_input_val);
+}
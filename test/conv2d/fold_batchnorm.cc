@@ -0,0 +1,186 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/data_format.h"
+#include "portdnn/filter_format.h"
+#include "portdnn/status.h"
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/fold_batchnorm.h"
+#include "portdnn/conv2d/fold_batchnorm_params.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+
+#include <cmath>
+#include <vector>
+
+template <typename Backend>
+struct FoldBatchNormTest : public BackendTestFixture<Backend> {
+  using DataType = float;
+
+ protected:
+  /**
+   * Fold a batchnorm into a filter with the given format, and check the
+   * folded filter and bias against values computed on the host.
+   */
+  void test_fold(sycldnn::FilterFormat format, bool has_bias) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 3;
+    params.features = 5;
+    params.batch = 1;
+    params.in_rows = 4;
+    params.in_cols = 4;
+    params.window_rows = 3;
+    params.window_cols = 2;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 2;
+    params.out_cols = 3;
+    params.pad_rows = 0;
+    params.pad_cols = 0;
+    params.input_format = format == sycldnn::FilterFormat::FCHW
+                              ? sycldnn::DataFormat::NCHW
+                              : sycldnn::DataFormat::NHWC;
+    params.filter_format = format;
+
+    sycldnn::conv2d::FoldBatchNormParams fold_params;
+    fold_params.epsilon = 0.01f;
+    fold_params.has_bias = has_bias;
+
+    auto sizes =
+        sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(params);
+    std::vector<DataType> filter(sizes.filter_size);
+    for (size_t i = 0; i < filter.size(); ++i) {
+      filter[i] = static_cast<DataType>(i % 7) - 3.f;
+    }
+    size_t const n_features = params.features;
+    std::vector<DataType> bias(n_features);
+    std::vector<DataType> beta(n_features);
+    std::vector<DataType> gamma(n_features);
+    std::vector<DataType> mean(n_features);
+    std::vector<DataType> variance(n_features);
+    for (size_t f = 0; f < n_features; ++f) {
+      bias[f] = 0.5f * f - 1.f;
+      beta[f] = 0.25f * f;
+      gamma[f] = 1.f + 0.5f * f;
+      mean[f] = 2.f - 0.75f * f;
+      variance[f] = 0.5f + f;
+    }
+    std::vector<DataType> folded_filter(filter.size());
+    std::vector<DataType> folded_bias(n_features);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto bias_gpu = provider.get_initialised_device_memory(bias.size(), bias);
+    auto beta_gpu = provider.get_initialised_device_memory(beta.size(), beta);
+    auto gamma_gpu =
+        provider.get_initialised_device_memory(gamma.size(), gamma);
+    auto mean_gpu = provider.get_initialised_device_memory(mean.size(), mean);
+    auto var_gpu =
+        provider.get_initialised_device_memory(variance.size(), variance);
+    auto folded_fil_gpu = provider.get_initialised_device_memory(
+        folded_filter.size(), folded_filter);
+    auto folded_bias_gpu = provider.get_initialised_device_memory(
+        folded_bias.size(), folded_bias);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(beta_gpu);
+      provider.deallocate_ptr(gamma_gpu);
+      provider.deallocate_ptr(mean_gpu);
+      provider.deallocate_ptr(var_gpu);
+      provider.deallocate_ptr(folded_fil_gpu);
+      provider.deallocate_ptr(folded_bias_gpu);
+    };
+
+    auto status = sycldnn::conv2d::fold_batchnorm<DataType>(
+        fil_gpu, bias_gpu, beta_gpu, gamma_gpu, mean_gpu, var_gpu,
+        folded_fil_gpu, folded_bias_gpu, params, fold_params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(folded_filter.size(), folded_fil_gpu,
+                                      folded_filter);
+    provider.copy_device_data_to_host(folded_bias.size(), folded_bias_gpu,
+                                      folded_bias);
+
+    for (int f = 0; f < params.features; ++f) {
+      float const scale =
+          gamma[f] / std::sqrt(variance[f] + fold_params.epsilon);
+      float const conv_bias = has_bias ? bias[f] : 0.f;
+      SCOPED_TRACE("Feature: " + std::to_string(f));
+      EXPECT_FLOAT_EQ(beta[f] + (conv_bias - mean[f]) * scale,
+                      folded_bias[f]);
+      for (int c = 0; c < params.channels; ++c) {
+        for (int r = 0; r < params.window_rows; ++r) {
+          for (int s = 0; s < params.window_cols; ++s) {
+            size_t const idx = filter_index(params, f, c, r, s);
+            SCOPED_TRACE("Element: " + std::to_string(idx));
+            EXPECT_FLOAT_EQ(filter[idx] * scale, folded_filter[idx]);
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  /** Get the index of a filter element in the filter format of params. */
+  static size_t filter_index(sycldnn::conv2d::Conv2DParams const& p, int f,
+                             int c, int r, int s) {
+    switch (p.filter_format) {
+      case sycldnn::FilterFormat::FHWC:
+        return ((f * p.window_rows + r) * p.window_cols + s) * p.channels + c;
+      case sycldnn::FilterFormat::FCHW:
+        return ((f * p.channels + c) * p.window_rows + r) * p.window_cols + s;
+      case sycldnn::FilterFormat::HWCF:
+      default:
+        return ((r * p.window_cols + s) * p.channels + c) * p.features + f;
+    }
+  }
+};
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(FoldBatchNormTest, Backends);
+
+TYPED_TEST(FoldBatchNormTest, HWCF) {
+  this->test_fold(sycldnn::FilterFormat::HWCF, false);
+}
+TYPED_TEST(FoldBatchNormTest, HWCFWithBias) {
+  this->test_fold(sycldnn::FilterFormat::HWCF, true);
+}
+TYPED_TEST(FoldBatchNormTest, FHWC) {
+  this->test_fold(sycldnn::FilterFormat::FHWC, false);
+}
+TYPED_TEST(FoldBatchNormTest, FHWCWithBias) {
+  this->test_fold(sycldnn::FilterFormat::FHWC, true);
+}
+TYPED_TEST(FoldBatchNormTest, FCHW) {
+  this->test_fold(sycldnn::FilterFormat::FCHW, false);
+}
+TYPED_TEST(FoldBatchNormTest, FCHWWithBias) {
+  this->test_fold(sycldnn::FilterFormat::FCHW, true);
+}
@@ -0,0 +1,257 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/conv2d/launch.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/helpers/padding.h"
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/selector_list.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_tuple4.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+template <typename Tuple>
+struct FusedEpilogueTest : public BackendTestFixture<typename Tuple::T2> {
+  using SelectorType = typename Tuple::T0;
+  using DataType = typename Tuple::T1;
+  using Backend = typename Tuple::T2;
+  static constexpr sycldnn::DataFormat input_format = Tuple::T3::input_layout;
+  static constexpr sycldnn::FilterFormat filter_format =
+      Tuple::T3::filter_layout;
+
+ protected:
+  /**
+   * Run a forward convolution with the given epilogue, and check the result
+   * against the same convolution without an epilogue followed by applying the
+   * epilogue on the host.
+   */
+  void test_epilogue(sycldnn::conv2d::Conv2DParams params,
+                     sycldnn::conv2d::EpilogueParams const& epilogue_params) {
+    using ConvType = sycldnn::conv2d::conv_type::Forward;
+    params.input_format = input_format;
+    params.filter_format = filter_format;
+    SelectorType selector{};
+    if (selector.template select<ConvType>(params) ==
+        sycldnn::conv2d::Algorithm::NotSupported) {
+      GTEST_SKIP()
+          << "Skipping test because the implementation is not supported";
+    }
+
+    auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    DataType const max_val = static_cast<DataType>(10);
+    auto input = iota_initialised_data(conv_sizes.input_size, max_val);
+    auto filter = iota_initialised_data(conv_sizes.filter_size, max_val);
+    auto bias = iota_initialised_data<DataType>(params.features, max_val);
+    auto residual = iota_initialised_data(conv_sizes.output_size, max_val);
+    std::vector<DataType> conv_output(conv_sizes.output_size);
+    std::vector<DataType> fused_output(conv_sizes.output_size);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto bias_gpu = provider.get_initialised_device_memory(bias.size(), bias);
+    auto res_gpu =
+        provider.get_initialised_device_memory(residual.size(), residual);
+    auto conv_gpu = provider.get_initialised_device_memory(conv_output.size(),
+                                                           conv_output);
+    auto fused_gpu = provider.get_initialised_device_memory(
+        fused_output.size(), fused_output);
+    auto workspace_gpu =
+        backend.template allocate<DataType>(workspace_size.recommended_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(res_gpu);
+      provider.deallocate_ptr(conv_gpu);
+      provider.deallocate_ptr(fused_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    sycldnn::conv2d::Epilogue<DataType, Backend> epilogue;
+    epilogue.params = epilogue_params;
+    epilogue.bias = bias_gpu;
+    epilogue.residual = res_gpu;
+
+    auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, fil_gpu, conv_gpu, params, selector, backend, workspace_gpu,
+        workspace_size.recommended_size);
+    if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+      GTEST_SKIP() << "Skipping test because the selected convolution "
+                      "algorithm does not support the provided parameters.";
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, fil_gpu, fused_gpu, params, selector, backend, workspace_gpu,
+        workspace_size.recommended_size, epilogue);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(conv_output.size(), conv_gpu,
+                                      conv_output);
+    provider.copy_device_data_to_host(fused_output.size(), fused_gpu,
+                                      fused_output);
+
+    auto const n_pixels = static_cast<size_t>(params.out_rows) *
+                          static_cast<size_t>(params.out_cols);
+    for (size_t i = 0; i < conv_output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      size_t feature = input_format == sycldnn::DataFormat::NHWC
+                           ? i % params.features
+                           : (i / n_pixels) % params.features;
+      DataType expected = conv_output[i] *
+                          static_cast<DataType>(epilogue_params.output_scale);
+      if (epilogue_params.add_bias) {
+        expected += bias[feature];
+      }
+      if (epilogue_params.add_residual) {
+        expected += residual[i];
+      }
+      expected = apply_activation(expected, epilogue_params.activation);
+      SNN_ALMOST_EQUAL(expected, fused_output[i], 10u);
+    }
+  }
+
+ private:
+  static DataType apply_activation(DataType value,
+                                   sycldnn::conv2d::Activation activation) {
+    DataType const zero{0};
+    DataType const six{6};
+    switch (activation) {
+      case sycldnn::conv2d::Activation::Relu:
+        return std::max(value, zero);
+      case sycldnn::conv2d::Activation::Relu6:
+        return std::min(std::max(value, zero), six);
+      case sycldnn::conv2d::Activation::Tanh:
+        return static_cast<DataType>(std::tanh(static_cast<double>(value)));
+      case sycldnn::conv2d::Activation::None:
+      default:
+        return value;
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::DefaultBackendTypes;
+using DataFormats = sycldnn::types::DataFormatTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using DataFormatBackendTypePairs =
+    sycldnn::types::CartesianProduct<BackendTypePairs, DataFormats>::type;
+using TestTuple4 =
+    sycldnn::types::NestedPairsToTuple4<DataFormatBackendTypePairs>::type;
+
+using GTestTypeTuple4s = sycldnn::types::ToGTestTypes<TestTuple4>::type;
+TYPED_TEST_SUITE(FusedEpilogueTest, GTestTypeTuple4s);
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride, int features,
+                                         sycldnn::PaddingMode padding) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 3;
+  params.features = features;
+  params.batch = 2;
+  params.in_rows = 7;
+  params.in_cols = 6;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, padding);
+}
+
+sycldnn::conv2d::EpilogueParams get_epilogue(
+    bool bias, bool residual, sycldnn::conv2d::Activation activation,
+    float scale = 1.f) {
+  sycldnn::conv2d::EpilogueParams epilogue;
+  epilogue.add_bias = bias;
+  epilogue.add_residual = residual;
+  epilogue.activation = activation;
+  epilogue.output_scale = scale;
+  return epilogue;
+}
+
+TYPED_TEST(FusedEpilogueTest, BiasWindow3Stride1) {
+  this->test_epilogue(
+      get_params(3, 1, 4, sycldnn::PaddingMode::SAME),
+      get_epilogue(true, false, sycldnn::conv2d::Activation::None));
+}
+TYPED_TEST(FusedEpilogueTest, BiasReluWindow3Stride2) {
+  this->test_epilogue(
+      get_params(3, 2, 3, sycldnn::PaddingMode::VALID),
+      get_epilogue(true, false, sycldnn::conv2d::Activation::Relu, -1.f));
+}
+TYPED_TEST(FusedEpilogueTest, ResidualRelu6Window3Stride1) {
+  this->test_epilogue(
+      get_params(3, 1, 2, sycldnn::PaddingMode::SAME),
+      get_epilogue(false, true, sycldnn::conv2d::Activation::Relu6, 0.01f));
+}
+TYPED_TEST(FusedEpilogueTest, BiasResidualTanhWindow1Stride1) {
+  this->test_epilogue(
+      get_params(1, 1, 4, sycldnn::PaddingMode::VALID),
+      get_epilogue(true, true, sycldnn::conv2d::Activation::Tanh, 0.0625f));
+}
+TYPED_TEST(FusedEpilogueTest, BiasResidualReluWindow1Stride1) {
+  this->test_epilogue(
+      get_params(1, 1, 5, sycldnn::PaddingMode::VALID),
+      get_epilogue(true, true, sycldnn::conv2d::Activation::Relu, -0.5f));
+}
+TYPED_TEST(FusedEpilogueTest, BiasResidualReluWindow3Stride1Features9) {
+  // The features are not a multiple of the matmul tiles, so the epilogue is
+  // applied to partial output blocks when fused into the matmul.
+  this->test_epilogue(
+      get_params(3, 1, 9, sycldnn::PaddingMode::SAME),
+      get_epilogue(true, true, sycldnn::conv2d::Activation::Relu, 0.25f));
+}
+TYPED_TEST(FusedEpilogueTest, ScaleWindow5Stride1) {
+  this->test_epilogue(
+      get_params(5, 1, 2, sycldnn::PaddingMode::SAME),
+      get_epilogue(false, false, sycldnn::conv2d::Activation::None, 0.5f));
+}
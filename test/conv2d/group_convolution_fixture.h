@@ -16,6 +16,7 @@
 #ifndef PORTDNN_TEST_CONV2D_GROUPS_FIXTURE_H_
 #define PORTDNN_TEST_CONV2D_GROUPS_FIXTURE_H_
 #include <gtest/gtest.h>
+#include <type_traits>
 #include <vector>
 
 #include "portdnn/conv2d/launch.h"
@@ -37,16 +38,22 @@
 
 template <typename ConvType>
 struct transpose_helper {
-  // Transpose input data to \p params.input_format.
+  // Transpose input data to \p params.input_format. The input of the input
+  // backprop is the output gradient, so has the output shape.
   template <typename T>
   std::vector<T>& transpose_input(const sycldnn::conv2d::Conv2DParams& params,
                                   std::vector<T>& inputData,
                                   std::vector<T>& trInputData) {
     if (params.input_format == sycldnn::DataFormat::NHWC &&
         params.group_format == sycldnn::BatchFormat::INTERLEAVED) {
-      transpose(trInputData, inputData,
-                params.in_cols * params.in_rows * params.batch, params.groups,
-                params.channels / params.groups);
+      constexpr bool is_input_backprop =
+          std::is_same<ConvType,
+                       sycldnn::conv2d::conv_type::InputBackprop>::value;
+      int const pixels = is_input_backprop ? params.out_rows * params.out_cols
+                                           : params.in_rows * params.in_cols;
+      int const size = is_input_backprop ? params.features : params.channels;
+      transpose(trInputData, inputData, pixels * params.batch, params.groups,
+                size / params.groups);
       return trInputData;
     }
     return inputData;
@@ -213,6 +220,26 @@ struct GroupWindowStrideTest : public ConvolutionFixture<Tuple> {
         get_params(in_shape, features, padding, filter_format, group_format);
     test_forward(exp_out, params, max_val);
   }
+  void run_input_backprop_test(std::vector<DataType> const& exp_out,
+                               std::array<int, 4> const& in_shape, int features,
+                               sycldnn::PaddingMode padding,
+                               sycldnn::FilterFormat filter_format,
+                               sycldnn::BatchFormat group_format,
+                               DataType max_val) {
+    auto params =
+        get_params(in_shape, features, padding, filter_format, group_format);
+    test_input_backprop(exp_out, params, max_val);
+  }
+  void run_filter_backprop_test(std::vector<DataType> const& exp_out,
+                                std::array<int, 4> const& in_shape,
+                                int features, sycldnn::PaddingMode padding,
+                                sycldnn::FilterFormat filter_format,
+                                sycldnn::BatchFormat group_format,
+                                DataType max_val) {
+    auto params =
+        get_params(in_shape, features, padding, filter_format, group_format);
+    test_filter_backprop(exp_out, params, max_val);
+  }
 
  private:
   Conv2DParams get_params(std::array<int, 4> const& in_shape, int features,
@@ -243,5 +270,17 @@ struct GroupWindowStrideTest : public ConvolutionFixture<Tuple> {
     SCOPED_TRACE("Forward pass");
     this->template test_conv<Forward>(exp, params, max_val);
   }
+  void test_input_backprop(std::vector<DataType> const& exp,
+                           Conv2DParams const& params, DataType max_val) {
+    using sycldnn::conv2d::conv_type::InputBackprop;
+    SCOPED_TRACE("Input backprop pass");
+    this->template test_conv<InputBackprop>(exp, params, max_val);
+  }
+  void test_filter_backprop(std::vector<DataType> const& exp,
+                            Conv2DParams const& params, DataType max_val) {
+    using sycldnn::conv2d::conv_type::FilterBackprop;
+    SCOPED_TRACE("Filter backprop pass");
+    this->template test_conv<FilterBackprop>(exp, params, max_val);
+  }
 };
 #endif  // PORTDNN_TEST_CONV2D_GROUPS_FIXTURE_H_
@@ -0,0 +1,3366 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using InputBackpropWindow3Stride1Groups3 =
+    GroupWindowStrideTest<Triple, 3, 1, 3>;
+TYPED_TEST_SUITE(InputBackpropWindow3Stride1Groups3, GTestTypeTriples);
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x4x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x4x4x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x4x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 4, 4, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x5x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x4x5x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4., 1.,  2., 2.,  2., 3.,  6.,  3.,  6.,  3., 6.,  4., 10., 4.,
+      8.,  5., 8.,  3., 6.,  3., 6.,  3.,  6.,  1.,  4., 1.,  2., 2.,  2.,
+      3.,  6., 3.,  6., 3.,  6., 6.,  12., 6.,  12., 6., 12., 9., 18., 9.,
+      18., 9., 18., 6., 12., 6., 12., 6.,  12., 3.,  6., 3.,  6., 3.,  6.,
+      3.,  6., 3.,  6., 3.,  6., 6.,  12., 6.,  12., 6., 12., 9., 18., 9.,
+      18., 9., 18., 6., 12., 6., 12., 6.,  12., 3.,  6., 3.,  6., 3.,  6.,
+      2.,  2., 2.,  4., 1.,  4., 3.,  6.,  3.,  6.,  3., 6.,  5., 8.,  5.,
+      10., 4., 10., 3., 6.,  3., 6.,  3.,  6.,  2.,  2., 2.,  4., 1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x5x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40.};
+  const std::array<int, 4> in_shape = {{1, 4, 5, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x4x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x4x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x4x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 4, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x4x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x5x4x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6., 3.,
+      6., 3.,  6., 2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4., 4.,
+      6., 12., 6., 12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 4.,  4., 4.,
+      8., 2.,  8., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9., 18.,
+      9., 18., 9., 18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8., 2.,
+      4., 4.,  4., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6., 12.,
+      4., 4.,  4., 8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6., 3.,
+      6., 3.,  6., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x4x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 4, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x5x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x5x5x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2., 2.,  2., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3., 6.,  3., 6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6., 3.,  6., 6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6., 12., 6., 12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8., 5.,  8., 9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9., 18., 9., 18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6., 3.,  6., 6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6., 12., 6., 12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      1.,  4.,  1.,  2., 2.,  2., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3., 6.,  3., 6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x5x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x5x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x5x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x5x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x4x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x6x4x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x4x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 4, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x5x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x6x5x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x5x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED1x6x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED1x6x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      12., 30., 12., 24., 15., 24., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED1x6x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x4x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x4x4x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x4x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 4, 4, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x5x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x4x5x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  4., 10., 4., 8.,
+      5., 8.,  3., 6.,  3., 6.,  3., 6.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18.,
+      6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 6., 12.,
+      6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      3., 6.,  3., 6.,  3., 6.,  5., 8.,  5., 10., 4., 10., 3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  4., 10., 4., 8.,  5., 8.,  3., 6.,  3., 6.,  3., 6.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12.,
+      6., 12., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12.,
+      9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  3., 6.,  3., 6.,  3., 6.,  5., 8.,
+      5., 10., 4., 10., 3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  4., 10., 4., 8.,
+      5., 8.,  3., 6.,  3., 6.,  3., 6.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18.,
+      6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 6., 12.,
+      6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      3., 6.,  3., 6.,  3., 6.,  5., 8.,  5., 10., 4., 10., 3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x5x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 4, 5, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x4x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x4x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x4x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 4, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x4x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x5x4x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30.,
+      30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x4x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 5, 4, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x5x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x5x5x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x5x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x5x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x5x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x5x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x4x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x4x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x6x4x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x4x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x4x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 6, 4, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x5x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x5x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x6x5x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x5x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x5x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFSTRIDED3x6x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, VALIDHWCFINTERLEAVED3x6x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      12., 30., 12., 24., 15., 24., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      12., 30., 12., 24., 15., 24., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 15., 24., 15.,
+      30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 15., 24., 15.,
+      30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12.,
+      24., 15., 24., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride1Groups3, SAMEHWCFSTRIDED3x6x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
@@ -0,0 +1,3471 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using InputBackpropWindow3Stride2Groups2 =
+    GroupWindowStrideTest<Triple, 3, 2, 2>;
+TYPED_TEST_SUITE(InputBackpropWindow3Stride2Groups2, GTestTypeTriples);
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x5x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40.,
+      40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20.,
+      20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x5x5x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1., 4., 1., 4.,  1.,
+      4.,  1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1.,  4.,
+      1.,  4., 1., 4., 1., 4., 2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4.,
+      16., 2., 8., 2., 8., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1.,  4.,
+      2.,  8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4.,  1.,
+      4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x5x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 5, 5, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x6x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x5x6x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 2., 8., 2., 8., 2., 8.,
+      2., 8., 4., 16., 4., 16., 2., 8., 2., 8., 2., 8., 2., 8., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x6x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10.};
+  const std::array<int, 4> in_shape = {{1, 5, 6, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x5x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x5x8x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x5x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 5, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x5x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x6x5x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1., 4.,  1., 4.,  1., 4.,
+      1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,  1., 4.,  1., 4.,
+      1., 4., 1., 4., 2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8.,
+      2., 8., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4.,  2., 8.,  2., 8.,
+      1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8.,
+      2., 8., 1., 4., 1., 4., 1., 4., 1., 4., 0., 0., 0., 0.,  0., 0.,  0., 0.,
+      0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x5x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10.};
+  const std::array<int, 4> in_shape = {{1, 6, 5, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x6x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x6x6x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 2., 8., 2., 8., 2., 8.,
+      2., 8., 4., 16., 4., 16., 2., 8., 2., 8., 2., 8., 2., 8., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+      0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x6x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x6x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x6x8x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x6x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x5x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x8x5x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  2., 8., 2., 8., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x5x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 8, 5, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x6x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x8x6x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x6x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED1x8x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20.,
+      20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED1x8x8x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED1x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x5x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x5x5x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,  1., 4.,  1., 4.,  1.,
+      4.,  1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 2.,  8., 2.,  8., 1.,  4.,
+      1.,  4., 1., 4., 1., 4., 2., 8., 2., 8., 2., 8.,  2., 8.,  4., 16., 4.,
+      16., 2., 8., 2., 8., 2., 8., 2., 8., 1., 4., 1.,  4., 1.,  4., 1.,  4.,
+      2.,  8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4.,  1.,
+      4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1.,  4., 1.,  4., 1.,  4.,
+      1.,  4., 1., 4., 1., 4., 2., 8., 2., 8., 1., 4.,  1., 4.,  1., 4.,  1.,
+      4.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2.,  8., 1.,  4., 1.,  4.,
+      1.,  4., 1., 4., 2., 8., 2., 8., 2., 8., 2., 8.,  4., 16., 4., 16., 2.,
+      8.,  2., 8., 2., 8., 2., 8., 1., 4., 1., 4., 1.,  4., 1.,  4., 2.,  8.,
+      2.,  8., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4.,  1.,
+      4.,  2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1.,  4., 1.,  4., 1.,  4.,
+      1.,  4., 1., 4., 2., 8., 2., 8., 1., 4., 1., 4.,  1., 4.,  1., 4.,  1.,
+      4.,  1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1.,  4., 1.,  4., 1.,  4.,
+      1.,  4., 2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8.,  2.,
+      8.,  2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1.,  4., 2.,  8., 2.,  8.,
+      1.,  4., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4.,  2.,
+      8.,  2., 8., 1., 4., 1., 4., 1., 4., 1., 4.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x5x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 5, 5, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x6x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x5x6x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4., 1., 4., 1.,  4.,  2.,  8.,  2.,  8., 1., 4., 1., 4., 1.,
+      4., 1., 4., 0., 0., 0., 0.,  1.,  4.,  1.,  4.,  1., 4., 1., 4., 2., 8.,
+      2., 8., 1., 4., 1., 4., 1.,  4.,  1.,  4.,  0.,  0., 0., 0., 2., 8., 2.,
+      8., 2., 8., 2., 8., 4., 16., 4.,  16., 2.,  8.,  2., 8., 2., 8., 2., 8.,
+      0., 0., 0., 0., 1., 4., 1.,  4.,  1.,  4.,  1.,  4., 2., 8., 2., 8., 1.,
+      4., 1., 4., 1., 4., 1., 4.,  0.,  0.,  0.,  0.,  1., 4., 1., 4., 1., 4.,
+      1., 4., 2., 8., 2., 8., 1.,  4.,  1.,  4.,  1.,  4., 1., 4., 0., 0., 0.,
+      0., 1., 4., 1., 4., 1., 4.,  1.,  4.,  2.,  8.,  2., 8., 1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0.,  0.,  1.,  4.,  1.,  4., 1., 4., 1., 4., 2.,
+      8., 2., 8., 1., 4., 1., 4.,  1.,  4.,  1.,  4.,  0., 0., 0., 0., 2., 8.,
+      2., 8., 2., 8., 2., 8., 4.,  16., 4.,  16., 2.,  8., 2., 8., 2., 8., 2.,
+      8., 0., 0., 0., 0., 1., 4.,  1.,  4.,  1.,  4.,  1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4., 1., 4., 1.,  4.,  0.,  0.,  0.,  0., 1., 4., 1., 4., 1.,
+      4., 1., 4., 2., 8., 2., 8.,  1.,  4.,  1.,  4.,  1., 4., 1., 4., 0., 0.,
+      0., 0., 1., 4., 1., 4., 1.,  4.,  1.,  4.,  2.,  8., 2., 8., 1., 4., 1.,
+      4., 1., 4., 1., 4., 0., 0.,  0.,  0.,  1.,  4.,  1., 4., 1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1.,  4.,  1.,  4.,  1.,  4., 0., 0., 0., 0., 2.,
+      8., 2., 8., 2., 8., 2., 8.,  4.,  16., 4.,  16., 2., 8., 2., 8., 2., 8.,
+      2., 8., 0., 0., 0., 0., 1.,  4.,  1.,  4.,  1.,  4., 1., 4., 2., 8., 2.,
+      8., 1., 4., 1., 4., 1., 4.,  1.,  4.,  0.,  0.,  0., 0., 1., 4., 1., 4.,
+      1., 4., 1., 4., 2., 8., 2.,  8.,  1.,  4.,  1.,  4., 1., 4., 1., 4., 0.,
+      0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x6x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 5, 6, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x5x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x5x8x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,
+      5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x5x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 5, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x5x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x6x5x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4., 1., 4., 1., 4., 2., 8., 2., 8., 1., 4., 1., 4.,  1.,
+      4.,  1.,  4.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1.,  4.,
+      1.,  4.,  1.,  4., 1., 4., 2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4.,
+      16., 2.,  8.,  2., 8., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1.,  4.,
+      2.,  8.,  2.,  8., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4.,  1.,
+      4.,  1.,  4.,  2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4., 0.,  0.,
+      0.,  0.,  0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0.,
+      0.,  1.,  4.,  1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1., 4., 1.,  4.,
+      1.,  4.,  1.,  4., 1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,  1.,
+      4.,  1.,  4.,  1., 4., 1., 4., 2., 8., 2., 8., 2., 8., 2., 8., 4.,  16.,
+      4.,  16., 2.,  8., 2., 8., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1.,
+      4.,  2.,  8.,  2., 8., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 1.,  4.,
+      1.,  4.,  1.,  4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4.,  0.,
+      0.,  0.,  0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0.,
+      0.,  0.,  1.,  4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8., 1., 4.,  1.,
+      4.,  1.,  4.,  1., 4., 1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2.,  8.,
+      1.,  4.,  1.,  4., 1., 4., 1., 4., 2., 8., 2., 8., 2., 8., 2., 8.,  4.,
+      16., 4.,  16., 2., 8., 2., 8., 2., 8., 2., 8., 1., 4., 1., 4., 1.,  4.,
+      1.,  4.,  2.,  8., 2., 8., 1., 4., 1., 4., 1., 4., 1., 4., 1., 4.,  1.,
+      4.,  1.,  4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4., 1.,  4.,
+      0.,  0.,  0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0.,
+      0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x5x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 6, 5, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x6x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20.,
+      20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x6x6x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 2., 8., 2., 8., 2., 8.,
+      2., 8., 4., 16., 4., 16., 2., 8., 2., 8., 2., 8., 2., 8., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+      0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 2., 8., 2., 8., 2., 8.,
+      2., 8., 4., 16., 4., 16., 2., 8., 2., 8., 2., 8., 2., 8., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+      0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 2., 8., 2., 8., 2., 8.,
+      2., 8., 4., 16., 4., 16., 2., 8., 2., 8., 2., 8., 2., 8., 0., 0., 0., 0.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,
+      1., 4., 0., 0.,  0., 0.,  1., 4., 1., 4., 1., 4., 1., 4., 2., 8., 2., 8.,
+      1., 4., 1., 4.,  1., 4.,  1., 4., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,
+      0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x6x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x6x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20.,
+      20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20.,
+      20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40.,
+      40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x6x8x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x6x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x5x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x5x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x8x5x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  2., 8., 2., 8., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  2., 8., 2., 8., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4.,  1., 4.,  2., 8., 2., 8., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  2., 8., 2., 8.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x5x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x5x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 8, 5, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x6x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x6x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20.,
+      20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x8x6x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8., 2., 8., 2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      2., 8., 2., 8., 0., 0., 0., 0., 1., 4.,  1., 4.,  1., 4., 1., 4.,
+      2., 8., 2., 8., 1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4., 1., 4., 1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      1., 4., 1., 4., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0., 0., 0., 0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x6x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x6x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFSTRIDED3x8x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x8x2x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20.,
+      20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40.,
+      40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 10., 10., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40.,
+      40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 20.,
+      20., 40., 40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 10., 10.,
+      10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20., 40., 40.,
+      20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 20., 20., 20., 20., 40., 40., 20., 20.,
+      40., 40., 20., 20., 40., 40., 20., 20., 10., 10., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 2}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, VALIDHWCFINTERLEAVED3x8x8x4x2) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      2., 8.,  2., 8.,  2., 8., 2., 8., 4., 16., 4., 16., 2., 8., 2., 8.,
+      4., 16., 4., 16., 2., 8., 2., 8., 2., 8.,  2., 8.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      1., 4.,  1., 4.,  1., 4., 1., 4., 2., 8.,  2., 8.,  1., 4., 1., 4.,
+      2., 8.,  2., 8.,  1., 4., 1., 4., 1., 4.,  1., 4.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.,
+      0., 0.,  0., 0.,  0., 0., 0., 0., 0., 0.,  0., 0.,  0., 0., 0., 0.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 2;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x8x2x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10.,
+      10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20.,
+      20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,
+      10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10.,
+      10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,
+      5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10., 20., 20.,
+      10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,  5.,  10.,
+      10., 5.,  5.,  10., 10., 5.,  5.,  10., 10., 10., 10., 20., 20., 10., 10.,
+      20., 20., 10., 10., 20., 20., 10., 10., 5.,  5.,  5.,  5.,  10., 10., 5.,
+      5.,  10., 10., 5.,  5.,  10., 10., 5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 2}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow3Stride2Groups2, SAMEHWCFSTRIDED3x8x8x8x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
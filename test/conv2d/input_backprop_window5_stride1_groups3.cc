@@ -0,0 +1,5908 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using InputBackpropWindow5Stride1Groups3 =
+    GroupWindowStrideTest<Triple, 5, 1, 3>;
+TYPED_TEST_SUITE(InputBackpropWindow5Stride1Groups3, GTestTypeTriples);
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x6x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,
+      4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,
+      4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 6, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x7x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 160., 160., 160., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x6x7x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  4., 10., 4., 8.,
+      5., 8.,  4., 10., 4., 8.,  5., 8.,  4., 10., 4., 8.,  5., 8.,  3., 6.,
+      3., 6.,  3., 6.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,
+      6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12.,
+      6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12.,
+      6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  3., 6.,  3., 6.,  3., 6.,  5., 8.,
+      5., 10., 4., 10., 5., 8.,  5., 10., 4., 10., 5., 8.,  5., 10., 4., 10.,
+      3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x7x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 6, 7, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x6x8x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x6x8x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x6x8x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 6, 8, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x7x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,
+      6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,
+      6., 12., 3., 12., 2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 7, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x7x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 120., 120., 120.,
+      90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x7x7x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,
+      12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,
+      18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26.,
+      13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18.,
+      13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  3.,  6.,  3.,
+      6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,
+      45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x7x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x7x8x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x7x8x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,
+      18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15.,
+      30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x7x8x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x8x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,
+      6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 8.,  8.,  8.,  16., 4.,  16., 4.,  16., 4.,  8.,  8.,  8.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,
+      3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x7x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x8x7x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,
+      12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28.,
+      9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,
+      12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,
+      10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 100., 100., 100., 80.,  80.,  80.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x7x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED1x8x8x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED1x8x8x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,
+      18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,
+      12., 24., 12., 24., 12., 24., 16., 40., 16., 32., 20., 32., 24., 48., 24.,
+      48., 24., 48., 24., 48., 24., 48., 24., 48., 20., 32., 20., 40., 16., 40.,
+      12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16., 4.,  16., 4.,
+      8.,  8.,  8.,  12., 24., 12., 24., 12., 24., 16., 40., 16., 32., 20., 32.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 20., 32., 20.,
+      40., 16., 40., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12.,
+      24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED1x8x8x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x6x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,
+      4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,
+      4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,
+      4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,
+      4., 8.,  2., 8.,  2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,
+      2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,  4., 4.,  6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,  2., 8.,  2., 4.,
+      4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,
+      4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x7x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 160., 160., 160., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 160., 160., 160., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 160., 160., 160., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x6x7x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  4., 10., 4., 8.,
+      5., 8.,  4., 10., 4., 8.,  5., 8.,  4., 10., 4., 8.,  5., 8.,  3., 6.,
+      3., 6.,  3., 6.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,
+      6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12.,
+      6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12.,
+      6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  3., 6.,  3., 6.,  3., 6.,  5., 8.,
+      5., 10., 4., 10., 5., 8.,  5., 10., 4., 10., 5., 8.,  5., 10., 4., 10.,
+      3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,
+      2., 2.,  3., 6.,  3., 6.,  3., 6.,  4., 10., 4., 8.,  5., 8.,  4., 10.,
+      4., 8.,  5., 8.,  4., 10., 4., 8.,  5., 8.,  3., 6.,  3., 6.,  3., 6.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12.,
+      6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 12.,
+      6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.,  3., 6.,  3., 6.,  3., 6.,  5., 8.,  5., 10., 4., 10.,
+      5., 8.,  5., 10., 4., 10., 5., 8.,  5., 10., 4., 10., 3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  4., 10., 4., 8.,  5., 8.,  4., 10., 4., 8.,  5., 8.,
+      4., 10., 4., 8.,  5., 8.,  3., 6.,  3., 6.,  3., 6.,  1., 4.,  1., 2.,
+      2., 2.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 12., 6., 12., 6., 12.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12.,
+      6., 12., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 6., 12., 6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  6., 12., 6., 12., 6., 12., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 12.,
+      6., 12., 6., 12., 3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      3., 6.,  3., 6.,  3., 6.,  5., 8.,  5., 10., 4., 10., 5., 8.,  5., 10.,
+      4., 10., 5., 8.,  5., 10., 4., 10., 3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 100., 100., 100., 80.,  80.,  80.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x7x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 7, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x6x8x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x6x8x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x6x8x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 6, 8, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x7x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.,  2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,
+      6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,
+      6., 12., 3., 12., 2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 4., 4.,  4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,
+      2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,
+      4., 8.,  2., 8.,  3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,
+      6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12.,
+      2., 8.,  2., 4.,  4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,
+      4., 8.,  2., 8.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  2., 2.,  2., 4.,  1., 4.,  1., 4.,  1., 2.,  2., 2.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  2., 2.,  2., 4.,  1., 4.,  2., 8.,  2., 4.,
+      4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 6., 6.,
+      6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 6., 6.,  6., 12., 3., 12., 3., 12., 3., 6.,  6., 6.,  9., 18.,
+      9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18., 9., 18.,
+      9., 18., 9., 18., 9., 18., 6., 6.,  6., 12., 3., 12., 2., 8.,  2., 4.,
+      4., 4.,  6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 6., 12.,
+      6., 12., 6., 12., 6., 12., 6., 12., 6., 12., 4., 4.,  4., 8.,  2., 8.,
+      1., 4.,  1., 2.,  2., 2.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,
+      3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  3., 6.,  2., 2.,
+      2., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 7, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x7x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  120., 120., 120., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 160., 160., 160., 120., 120., 120., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 160., 160., 160., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 160., 160., 160., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 120., 120., 120., 160., 160., 160., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x7x7x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,
+      12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,
+      18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26.,
+      13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18.,
+      13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  3.,  6.,  3.,
+      6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,  2.,  2.,  2.,  4.,  1.,  4.,
+      3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,
+      10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,
+      12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,
+      6.,  3.,  6.,  5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18.,
+      14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28., 14., 26., 14.,
+      28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28.,
+      9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,
+      10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14., 28., 13., 28.,
+      14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28., 9.,  18., 9.,
+      18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,
+      6.,  3.,  6.,  5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 26., 14., 26.,
+      13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26., 9.,  18., 9.,
+      18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,
+      18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26.,
+      13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,
+      8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,
+      45.,  45.,  45.,  45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x7x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x7x8x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x7x8x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,
+      18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15.,
+      30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15.,
+      30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12.,
+      24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,
+      16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,
+      18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x7x8x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x6x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x6x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x8x6x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,
+      6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,
+      6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 8.,  8.,  8.,  16., 4.,  16., 4.,  16., 4.,  8.,  8.,  8.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,
+      3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16., 4.,  16., 4.,
+      8.,  8.,  8.,  12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,
+      16., 4.,  16., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,
+      6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16.,
+      4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24.,
+      8.,  8.,  8.,  16., 4.,  16., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,
+      8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x6x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x6x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 8, 6, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x7x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x7x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 120., 120., 120., 90.,  90.,  90.,  120., 120., 120.,
+      160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 120., 120., 120., 150., 150., 150., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 200., 200., 200., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 200., 200., 200., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 150., 150., 150., 120., 120., 120., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160.,
+      120., 120., 120., 90.,  90.,  90.,  120., 120., 120., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x8x7x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,
+      12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      9.,  18., 9.,  18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13.,
+      26., 14., 26., 13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 12., 24., 12.,
+      24., 12., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14.,
+      28., 13., 28., 14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28.,
+      9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,
+      12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,
+      3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,
+      10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,
+      4.,  10., 4.,  8.,  5.,  8.,  3.,  6.,  3.,  6.,  3.,  6.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,  18., 9.,  18., 13., 28., 13.,
+      26., 14., 26., 13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26.,
+      9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,
+      12., 6.,  12., 12., 24., 12., 24., 12., 24., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12.,
+      24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      12., 24., 12., 24., 12., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 12., 24., 12., 24., 12., 24.,
+      6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 9.,  18., 9.,
+      18., 9.,  18., 14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28.,
+      14., 26., 14., 28., 13., 28., 9.,  18., 9.,  18., 9.,  18., 5.,  8.,  5.,
+      10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  6.,  12., 6.,  12., 6.,  12.,
+      9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 6.,  12., 6.,  12., 6.,  12., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,  6.,  3.,  6.,  5.,  8.,  5.,
+      10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,
+      2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,
+      4.,  10., 4.,  8.,  5.,  8.,  4.,  10., 4.,  8.,  5.,  8.,  3.,  6.,  3.,
+      6.,  3.,  6.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  9.,  18., 9.,
+      18., 9.,  18., 13., 28., 13., 26., 14., 26., 13., 28., 13., 26., 14., 26.,
+      13., 28., 13., 26., 14., 26., 9.,  18., 9.,  18., 9.,  18., 4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24.,
+      18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 12., 24., 12., 24., 12., 24., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      12., 24., 12., 24., 12., 24., 6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,
+      10., 4.,  10., 9.,  18., 9.,  18., 9.,  18., 14., 26., 14., 28., 13., 28.,
+      14., 26., 14., 28., 13., 28., 14., 26., 14., 28., 13., 28., 9.,  18., 9.,
+      18., 9.,  18., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      6.,  12., 6.,  12., 6.,  12., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 9.,
+      18., 9.,  18., 9.,  18., 9.,  18., 9.,  18., 6.,  12., 6.,  12., 6.,  12.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  3.,  6.,  3.,
+      6.,  3.,  6.,  5.,  8.,  5.,  10., 4.,  10., 5.,  8.,  5.,  10., 4.,  10.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x7x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 100., 100., 100., 80.,  80.,  80.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 100., 100., 100., 80.,  80.,  80.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,
+      80.,  80.,  80.,  100., 100., 100., 100., 100., 100., 100., 100., 100.,
+      80.,  80.,  80.,  60.,  60.,  60.,  75.,  75.,  75.,  100., 100., 100.,
+      125., 125., 125., 125., 125., 125., 125., 125., 125., 100., 100., 100.,
+      75.,  75.,  75.,  75.,  75.,  75.,  100., 100., 100., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 100., 100., 100., 75.,  75.,  75.,  75.,  75.,  75.,
+      100., 100., 100., 125., 125., 125., 125., 125., 125., 125., 125., 125.,
+      100., 100., 100., 75.,  75.,  75.,  60.,  60.,  60.,  80.,  80.,  80.,
+      100., 100., 100., 100., 100., 100., 100., 100., 100., 80.,  80.,  80.,
+      60.,  60.,  60.,  45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x7x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFSTRIDED3x8x8x12x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 12}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x8x3x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      150., 150., 150., 200., 200., 200., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 200., 200., 200., 150., 150., 150.,
+      120., 120., 120., 160., 160., 160., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 160., 160., 160., 120., 120., 120.,
+      90.,  90.,  90.,  120., 120., 120., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 120., 120., 120., 90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 3}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, VALIDHWCFINTERLEAVED3x8x8x6x3) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,
+      18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36.,
+      18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,
+      18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,
+      12., 24., 12., 24., 12., 24., 16., 40., 16., 32., 20., 32., 24., 48., 24.,
+      48., 24., 48., 24., 48., 24., 48., 24., 48., 20., 32., 20., 40., 16., 40.,
+      12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16., 4.,  16., 4.,
+      8.,  8.,  8.,  12., 24., 12., 24., 12., 24., 16., 40., 16., 32., 20., 32.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 20., 32., 20.,
+      40., 16., 40., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12.,
+      24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12.,
+      8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24., 12., 24., 12.,
+      24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,  12., 6.,  12.,
+      4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,
+      6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12.,
+      6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,
+      6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18., 12., 30., 12.,
+      24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36., 18., 36.,
+      15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,
+      12., 3.,  12., 4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12., 24., 12., 24.,
+      16., 40., 16., 32., 20., 32., 24., 48., 24., 48., 24., 48., 24., 48., 24.,
+      48., 24., 48., 20., 32., 20., 40., 16., 40., 12., 24., 12., 24., 12., 24.,
+      8.,  8.,  8.,  16., 4.,  16., 4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12.,
+      24., 12., 24., 16., 40., 16., 32., 20., 32., 24., 48., 24., 48., 24., 48.,
+      24., 48., 24., 48., 24., 48., 20., 32., 20., 40., 16., 40., 12., 24., 12.,
+      24., 12., 24., 8.,  8.,  8.,  16., 4.,  16., 3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,
+      4.,  4.,  4.,  6.,  12., 6.,  12., 6.,  12., 8.,  20., 8.,  16., 10., 16.,
+      12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 12., 24., 10., 16., 10.,
+      20., 8.,  20., 6.,  12., 6.,  12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,
+      1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,
+      8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,  12.,
+      5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,
+      4.,  1.,  4.,  1.,  4.,  1.,  2.,  2.,  2.,  3.,  6.,  3.,  6.,  3.,  6.,
+      4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,  12., 6.,  12., 6.,  12., 6.,
+      12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10., 3.,  6.,  3.,  6.,  3.,  6.,
+      2.,  2.,  2.,  4.,  1.,  4.,  2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  3.,  12., 3.,  6.,  6.,  6.,
+      9.,  18., 9.,  18., 9.,  18., 12., 30., 12., 24., 15., 24., 18., 36., 18.,
+      36., 18., 36., 18., 36., 18., 36., 18., 36., 15., 24., 15., 30., 12., 30.,
+      9.,  18., 9.,  18., 9.,  18., 6.,  6.,  6.,  12., 3.,  12., 4.,  16., 4.,
+      8.,  8.,  8.,  12., 24., 12., 24., 12., 24., 16., 40., 16., 32., 20., 32.,
+      24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 20., 32., 20.,
+      40., 16., 40., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,  16., 4.,  16.,
+      4.,  16., 4.,  8.,  8.,  8.,  12., 24., 12., 24., 12., 24., 16., 40., 16.,
+      32., 20., 32., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48., 24., 48.,
+      20., 32., 20., 40., 16., 40., 12., 24., 12., 24., 12., 24., 8.,  8.,  8.,
+      16., 4.,  16., 3.,  12., 3.,  6.,  6.,  6.,  9.,  18., 9.,  18., 9.,  18.,
+      12., 30., 12., 24., 15., 24., 18., 36., 18., 36., 18., 36., 18., 36., 18.,
+      36., 18., 36., 15., 24., 15., 30., 12., 30., 9.,  18., 9.,  18., 9.,  18.,
+      6.,  6.,  6.,  12., 3.,  12., 2.,  8.,  2.,  4.,  4.,  4.,  6.,  12., 6.,
+      12., 6.,  12., 8.,  20., 8.,  16., 10., 16., 12., 24., 12., 24., 12., 24.,
+      12., 24., 12., 24., 12., 24., 10., 16., 10., 20., 8.,  20., 6.,  12., 6.,
+      12., 6.,  12., 4.,  4.,  4.,  8.,  2.,  8.,  1.,  4.,  1.,  2.,  2.,  2.,
+      3.,  6.,  3.,  6.,  3.,  6.,  4.,  10., 4.,  8.,  5.,  8.,  6.,  12., 6.,
+      12., 6.,  12., 6.,  12., 6.,  12., 6.,  12., 5.,  8.,  5.,  10., 4.,  10.,
+      3.,  6.,  3.,  6.,  3.,  6.,  2.,  2.,  2.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 6}};
+  const int features = 3;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x8x3x6) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      75.,  75.,  75.,  100., 100., 100., 125., 125., 125., 125., 125., 125.,
+      125., 125., 125., 125., 125., 125., 100., 100., 100., 75.,  75.,  75.,
+      60.,  60.,  60.,  80.,  80.,  80.,  100., 100., 100., 100., 100., 100.,
+      100., 100., 100., 100., 100., 100., 80.,  80.,  80.,  60.,  60.,  60.,
+      45.,  45.,  45.,  60.,  60.,  60.,  75.,  75.,  75.,  75.,  75.,  75.,
+      75.,  75.,  75.,  75.,  75.,  75.,  60.,  60.,  60.,  45.,  45.,  45.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 3}};
+  const int features = 6;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride1Groups3, SAMEHWCFSTRIDED3x8x8x12x12) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150., 150.,
+      120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120., 120.,
+      90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.,  90.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 12}};
+  const int features = 12;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
@@ -0,0 +1,9219 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using InputBackpropWindow5Stride2Groups4 =
+    GroupWindowStrideTest<Triple, 5, 2, 4>;
+TYPED_TEST_SUITE(InputBackpropWindow5Stride2Groups4, GTestTypeTriples);
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x7x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x7x7x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x7x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 7, 7, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x7x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 7, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x7x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x7x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x7x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 7, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x7x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x8x7x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10.,
+      10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x7x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 8, 7, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x8x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x8x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x8x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x8x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x7x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x10x7x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10.,
+      10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x7x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 10, 7, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30.,
+      30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED1x10x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED1x10x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4,
+           VALIDHWCFINTERLEAVED1x10x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED1x10x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x7x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x7x7x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x7x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 7, 7, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x7x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 7, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x7x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x7x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x7x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 7, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x7x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x8x7x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10.,
+      10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x7x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 8, 7, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60.,
+      60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x8x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30.,
+      30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x8x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x8x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15.,
+      10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x8x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x7x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x7x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x10x7x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x7x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x7x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 10, 7, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFINTERLEAVED3x10x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15.,
+      10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, VALIDHWCFSTRIDED3x10x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,
+      0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.,  0.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 90., 90.,
+      90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 60., 60., 60., 60., 90., 90., 90., 90., 60., 60.,
+      60., 60., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      40., 40., 40., 40., 60., 60., 60., 60., 40., 40., 40., 40., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4,
+           VALIDHWCFINTERLEAVED3x10x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,
+      0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.,  0., 0.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30.,
+      30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10., 10., 10.,
+      15., 15., 15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 10., 10., 10., 10., 15., 15., 15., 15., 10., 10.,
+      10., 10., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45.,
+      30., 30., 30., 30., 30., 30., 30., 30., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 45., 45.,
+      45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30., 30., 30.,
+      30., 30., 30., 30., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      45., 45., 45., 45., 30., 30., 30., 30., 45., 45., 45., 45., 30., 30.,
+      30., 30., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      20., 20., 20., 20., 30., 30., 30., 30., 20., 20., 20., 20., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow5Stride2Groups4, SAMEHWCFSTRIDED3x10x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 90., 90., 90., 90., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 90., 90., 90., 90., 90., 90.,
+      90., 90., 90., 90., 90., 90., 90., 90., 90., 90., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
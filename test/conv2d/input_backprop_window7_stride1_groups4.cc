@@ -0,0 +1,11586 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_grouped_conv2d_tests.py.
+// Results calculated using Tensorflow v2.8.0.
+
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include "test/conv2d/group_convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include <array>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::AllMatmulBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+
+template <typename Triple>
+using InputBackpropWindow7Stride1Groups4 =
+    GroupWindowStrideTest<Triple, 7, 1, 4>;
+TYPED_TEST_SUITE(InputBackpropWindow7Stride1Groups4, GTestTypeTriples);
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x8x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 8, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x9x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x8x9x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x9x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 8, 9, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x8x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x8x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x8x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 8, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x9x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 9, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x9x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x9x9x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x9x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 9, 9, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x9x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x9x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,
+      4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x9x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 9, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x10x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 10, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x9x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED1x10x9x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,
+      8.,  2.,  8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x9x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 10, 9, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED1x10x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4,
+           VALIDHWCFINTERLEAVED1x10x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48.,
+      12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48.,
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48.,
+      12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED1x10x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{1, 10, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x8x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 8, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x9x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x8x9x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x9x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 8, 9, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x8x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x8x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x8x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 8, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x9x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 9, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x9x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x9x9x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 4., 16., 4., 16., 4., 16., 4., 16.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      6., 24., 6., 24., 6., 24., 6., 24., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36., 9., 36.,
+      9., 36., 9., 36., 9., 36., 9., 36., 6., 24., 6., 24., 6., 24., 6., 24.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      4., 16., 4., 16., 4., 16., 4., 16., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12., 3., 12.,
+      3., 12., 3., 12., 3., 12., 3., 12., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x9x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 9, 9, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x9x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x9x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,
+      4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,
+      4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,
+      4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x9x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 9, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x8x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x8x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x10x8x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32., 8., 32.,
+      8., 32., 8., 32., 8., 32., 8., 32., 4., 16., 4., 16., 4., 16., 4., 16.,
+      3., 12., 3., 12., 3., 12., 3., 12., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24., 6., 24.,
+      6., 24., 6., 24., 6., 24., 6., 24., 3., 12., 3., 12., 3., 12., 3., 12.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16., 4., 16.,
+      4., 16., 4., 16., 4., 16., 4., 16., 2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      1., 4.,  1., 4.,  1., 4.,  1., 4.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,  2., 8.,
+      2., 8.,  2., 8.,  2., 8.,  2., 8.,  1., 4.,  1., 4.,  1., 4.,  1., 4.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x8x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x8x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 10, 8, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x9x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x9x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFINTERLEAVED3x10x9x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,
+      8.,  2.,  8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,
+      8.,  2.,  8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,
+      8.,  2.,  8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 9.,
+      36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,
+      2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x9x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x9x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 10, 9, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, VALIDHWCFSTRIDED3x10x10x16x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80.,
+      80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 80., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60., 60.,
+      60., 60., 60., 60., 60., 60., 60., 45., 45., 45., 45., 45., 45., 45., 45.,
+      45., 45., 45., 45., 45., 45., 45., 45., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 30., 30., 30.,
+      30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40., 40.,
+      40., 40., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30., 30.,
+      30., 30., 30., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  10., 10., 10., 10., 10., 10., 10., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 15., 15., 15., 15., 15., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20.,
+      20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 20., 15., 15., 15.,
+      15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 15., 10., 10.,
+      10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 10., 5.,
+      5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.,  5.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 16}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x10x4x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      160., 160., 160., 160., 200., 200., 200., 200., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      250., 250., 250., 250., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 250., 250., 250., 250., 200., 200., 200., 200.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 240., 240., 240., 240.,
+      300., 300., 300., 300., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 300., 300., 300., 300., 240., 240., 240., 240.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 160., 160., 160., 160., 200., 200., 200., 200.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 250., 250., 250., 250., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 250., 250., 250., 250.,
+      200., 200., 200., 200., 240., 240., 240., 240., 300., 300., 300., 300.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      300., 300., 300., 300., 240., 240., 240., 240., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 350., 350., 350., 350., 280., 280., 280., 280.,
+      240., 240., 240., 240., 300., 300., 300., 300., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 300., 300., 300., 300.,
+      240., 240., 240., 240., 200., 200., 200., 200., 250., 250., 250., 250.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      250., 250., 250., 250., 200., 200., 200., 200., 160., 160., 160., 160.,
+      200., 200., 200., 200., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 200., 200., 200., 200., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4,
+           VALIDHWCFINTERLEAVED3x10x10x8x4) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48.,
+      12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48.,
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48.,
+      12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,
+      1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,
+      8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,
+      4.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,
+      2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,
+      2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,
+      8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48.,
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48.,
+      12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,
+      12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,
+      24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12.,
+      2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,
+      8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  2.,  8.,
+      2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,
+      2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,
+      4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.,
+      2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 6.,  24., 6.,  24.,
+      6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 2.,  8.,  2.,
+      8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24.,
+      6.,  24., 6.,  24., 6.,  24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24.,
+      6.,  24., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48.,
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 12., 48., 12., 48., 12., 48., 12., 48., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 12., 48., 12., 48.,
+      12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48., 12., 48., 12., 48., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 12., 48., 12., 48.,
+      12., 48., 12., 48., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16.,
+      64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64., 16., 64.,
+      16., 64., 16., 64., 16., 64., 12., 48., 12., 48., 12., 48., 12., 48., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      3.,  12., 3.,  12., 3.,  12., 3.,  12., 6.,  24., 6.,  24., 6.,  24., 6.,
+      24., 9.,  36., 9.,  36., 9.,  36., 9.,  36., 12., 48., 12., 48., 12., 48.,
+      12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 12.,
+      48., 12., 48., 12., 48., 12., 48., 12., 48., 12., 48., 9.,  36., 9.,  36.,
+      9.,  36., 9.,  36., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 3.,  12., 3.,
+      12., 3.,  12., 3.,  12., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 8.,
+      32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32.,
+      8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,  32., 8.,
+      32., 6.,  24., 6.,  24., 6.,  24., 6.,  24., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,
+      4.,  1.,  4.,  2.,  8.,  2.,  8.,  2.,  8.,  2.,  8.,  3.,  12., 3.,  12.,
+      3.,  12., 3.,  12., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,
+      16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16., 4.,  16.,
+      4.,  16., 4.,  16., 4.,  16., 3.,  12., 3.,  12., 3.,  12., 3.,  12., 2.,
+      8.,  2.,  8.,  2.,  8.,  2.,  8.,  1.,  4.,  1.,  4.,  1.,  4.,  1.,  4.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 8}};
+  const int features = 4;
+  const auto padding = sycldnn::PaddingMode::VALID;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::INTERLEAVED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x10x4x8) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  100., 100., 100., 100., 120., 120., 120., 120.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 120., 120., 120., 120., 100., 100., 100., 100.,
+      80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      125., 125., 125., 125., 150., 150., 150., 150., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      150., 150., 150., 150., 125., 125., 125., 125., 100., 100., 100., 100.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 120., 120., 120., 120.,
+      150., 150., 150., 150., 180., 180., 180., 180., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      180., 180., 180., 180., 150., 150., 150., 150., 120., 120., 120., 120.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  100., 100., 100., 100.,
+      120., 120., 120., 120., 140., 140., 140., 140., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 120., 120., 120., 120.,
+      100., 100., 100., 100., 80.,  80.,  80.,  80.,  80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 125., 125., 125., 125., 150., 150., 150., 150.,
+      175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 150., 150., 150., 150., 125., 125., 125., 125.,
+      100., 100., 100., 100., 120., 120., 120., 120., 150., 150., 150., 150.,
+      180., 180., 180., 180., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 210., 210., 210., 210., 180., 180., 180., 180.,
+      150., 150., 150., 150., 120., 120., 120., 120., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      140., 140., 140., 140., 175., 175., 175., 175., 210., 210., 210., 210.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 210., 210., 210., 210., 175., 175., 175., 175.,
+      140., 140., 140., 140., 140., 140., 140., 140., 175., 175., 175., 175.,
+      210., 210., 210., 210., 245., 245., 245., 245., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 210., 210., 210., 210.,
+      175., 175., 175., 175., 140., 140., 140., 140., 140., 140., 140., 140.,
+      175., 175., 175., 175., 210., 210., 210., 210., 245., 245., 245., 245.,
+      245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245., 245.,
+      210., 210., 210., 210., 175., 175., 175., 175., 140., 140., 140., 140.,
+      120., 120., 120., 120., 150., 150., 150., 150., 180., 180., 180., 180.,
+      210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210., 210.,
+      210., 210., 210., 210., 180., 180., 180., 180., 150., 150., 150., 150.,
+      120., 120., 120., 120., 100., 100., 100., 100., 125., 125., 125., 125.,
+      150., 150., 150., 150., 175., 175., 175., 175., 175., 175., 175., 175.,
+      175., 175., 175., 175., 175., 175., 175., 175., 150., 150., 150., 150.,
+      125., 125., 125., 125., 100., 100., 100., 100., 80.,  80.,  80.,  80.,
+      100., 100., 100., 100., 120., 120., 120., 120., 140., 140., 140., 140.,
+      140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140., 140.,
+      120., 120., 120., 120., 100., 100., 100., 100., 80.,  80.,  80.,  80.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 4}};
+  const int features = 8;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
+TYPED_TEST(InputBackpropWindow7Stride1Groups4, SAMEHWCFSTRIDED3x10x10x16x16) {
+  using DataType = typename TestFixture::DataType;
+  const std::vector<DataType> exp_out = {
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490., 490.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360., 360.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420., 420.,
+      420., 420., 420., 420., 360., 360., 360., 360., 360., 360., 360., 360.,
+      360., 360., 360., 360., 360., 360., 360., 360., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 250., 250., 250., 250.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      300., 300., 300., 300., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350., 350.,
+      350., 350., 350., 350., 350., 350., 350., 350., 300., 300., 300., 300.,
+      300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300., 300.,
+      250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250., 250.,
+      250., 250., 250., 250., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.,
+      200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 240., 240., 240., 240., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280., 280.,
+      240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240., 240.,
+      240., 240., 240., 240., 200., 200., 200., 200., 200., 200., 200., 200.,
+      200., 200., 200., 200., 200., 200., 200., 200., 160., 160., 160., 160.,
+      160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160., 160.};
+  const std::array<int, 4> in_shape = {{3, 10, 10, 16}};
+  const int features = 16;
+  const auto padding = sycldnn::PaddingMode::SAME;
+  const auto filter_format = sycldnn::FilterFormat::HWCF;
+  const auto group_format = sycldnn::BatchFormat::STRIDED;
+  const DataType max_input_val = 2.0;
+  this->run_input_backprop_test(exp_out, in_shape, features, padding,
+                                filter_format, group_format, max_input_val);
+}
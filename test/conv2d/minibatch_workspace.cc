@@ -0,0 +1,204 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/launch.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/conv2d/selector/constant_selector.h"
+
+#include "portdnn/helpers/padding.h"
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Triple>
+struct MinibatchWorkspaceTest
+    : public BackendTestFixture<typename Triple::ThirdType> {
+  using SelectorType = typename Triple::FirstType;
+  using DataType = typename Triple::SecondType;
+  using Backend = typename Triple::ThirdType;
+
+ protected:
+  /**
+   * Run a convolution with a workspace which only holds the transforms for
+   * images_per_workspace images, so that the batch is split into at least
+   * min_minibatches minibatches, and check the result against the same
+   * convolution run with the recommended workspace.
+   */
+  template <typename ConvType>
+  void test_minibatches(sycldnn::conv2d::Conv2DParams const& params,
+                        size_t images_per_workspace,
+                        size_t min_minibatches = 3) {
+    SelectorType selector{};
+    auto const full_workspace =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    size_t const batch = static_cast<size_t>(params.batch);
+    ASSERT_GT(batch, 1u);
+    size_t const per_image =
+        (full_workspace.recommended_size - full_workspace.required_size) /
+        (batch - 1);
+    size_t const workspace_size = full_workspace.required_size +
+                                  (images_per_workspace - 1) * per_image;
+    size_t const minibatch_size = sycldnn::conv2d::minibatch_size_for_workspace(
+        full_workspace, batch, workspace_size);
+    ASSERT_EQ(images_per_workspace, minibatch_size);
+    ASSERT_GE((batch + minibatch_size - 1) / minibatch_size, min_minibatches);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    DataType const max_val = static_cast<DataType>(10);
+    auto input = iota_initialised_data(conv_sizes.input_size, max_val);
+    auto filter = iota_initialised_data(conv_sizes.filter_size, max_val);
+    std::vector<DataType> expected(conv_sizes.output_size);
+    std::vector<DataType> output(conv_sizes.output_size);
+
+    auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto exp_gpu =
+        provider.get_initialised_device_memory(expected.size(), expected);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    auto full_workspace_gpu =
+        backend.template allocate<DataType>(full_workspace.recommended_size);
+    auto workspace_gpu = backend.template allocate<DataType>(workspace_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(exp_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(full_workspace_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, fil_gpu, exp_gpu, params, selector, backend,
+        full_workspace_gpu, full_workspace.recommended_size);
+    if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+      GTEST_SKIP() << "Skipping test because the selected convolution "
+                      "algorithm does not support the provided parameters.";
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, fil_gpu, out_gpu, params, selector, backend, workspace_gpu,
+        workspace_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(expected.size(), exp_gpu, expected);
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(expected[i], output[i], 10u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::TypeList<
+    sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Winograd>,
+    sycldnn::conv2d::ConstantSelector<
+        sycldnn::conv2d::Algorithm::WinogradLarge>,
+    sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Im2col>>;
+using Backends = sycldnn::types::DefaultBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+TYPED_TEST_SUITE(MinibatchWorkspaceTest, GTestTypeTriples);
+
+sycldnn::conv2d::Conv2DParams get_params(int batch, int groups = 1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 4;
+  params.features = 6;
+  params.batch = batch;
+  params.in_rows = 9;
+  params.in_cols = 7;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.groups = groups;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+// A single image per minibatch leaves nothing to double buffer.
+TYPED_TEST(MinibatchWorkspaceTest, ForwardSingleImage) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  this->template test_minibatches<ConvType>(get_params(4), 1);
+}
+// Two images are split across the two buffers, giving 7 minibatches.
+TYPED_TEST(MinibatchWorkspaceTest, ForwardDoubleBuffered) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  this->template test_minibatches<ConvType>(get_params(7), 2);
+}
+// Four images are split into minibatches of 2, 2, 2 and 1.
+TYPED_TEST(MinibatchWorkspaceTest, ForwardDoubleBufferedRagged) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  this->template test_minibatches<ConvType>(get_params(7), 4);
+}
+TYPED_TEST(MinibatchWorkspaceTest, ForwardGroups2) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  this->template test_minibatches<ConvType>(get_params(7, 2), 2);
+}
+TYPED_TEST(MinibatchWorkspaceTest, FilterBackpropSingleImage) {
+  using ConvType = sycldnn::conv2d::conv_type::FilterBackprop;
+  this->template test_minibatches<ConvType>(get_params(4), 1);
+}
+TYPED_TEST(MinibatchWorkspaceTest, FilterBackpropDoubleBuffered) {
+  using ConvType = sycldnn::conv2d::conv_type::FilterBackprop;
+  this->template test_minibatches<ConvType>(get_params(7), 2);
+}
+TYPED_TEST(MinibatchWorkspaceTest, FilterBackpropDoubleBufferedRagged) {
+  using ConvType = sycldnn::conv2d::conv_type::FilterBackprop;
+  this->template test_minibatches<ConvType>(get_params(7), 4);
+}
+// The filter backprop gives up one of the five images to make room for the
+// partial gradients, and double buffers the remaining four into three
+// minibatches of two, so an odd number of partial gradients are summed.
+TYPED_TEST(MinibatchWorkspaceTest, FilterBackpropOddPartials) {
+  using ConvType = sycldnn::conv2d::conv_type::FilterBackprop;
+  this->template test_minibatches<ConvType>(get_params(6), 5, 2);
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/launch.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/selector/direct_selector.h"
+#include "portdnn/conv2d/selector/tiled_selector.h"
+#include "portdnn/conv2d/selector/winograd_selector.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+
+#include <CL/sycl.hpp>
+
+#include <vector>
+
+template <typename Backend>
+struct MixedPrecisionConvolution : public BackendTestFixture<Backend> {
+  using DataType = cl::sycl::half;
+
+ protected:
+  /**
+   * Convolve tensors of ones with a square window and no padding, so that
+   * every output is the window area times the number of channels. Half
+   * precision can only represent integers exactly up to 2048, so a half
+   * accumulator loses the sum past there while a float accumulator computes
+   * it exactly.
+   */
+  void test_ones(int channels, int features, int window,
+                 sycldnn::conv2d::Selector& selector) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = channels;
+    params.features = features;
+    params.batch = 1;
+    params.in_rows = window + 1;
+    params.in_cols = window + 2;
+    params.window_rows = window;
+    params.window_cols = window;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 2;
+    params.out_cols = 3;
+    params.pad_rows = 0;
+    params.pad_cols = 0;
+    using ConvType = sycldnn::conv2d::conv_type::Forward;
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector)
+            .recommended_size;
+    std::vector<DataType> input(sizes.input_size, DataType{1});
+    std::vector<DataType> filter(sizes.filter_size, DataType{1});
+    std::vector<DataType> output(sizes.output_size, DataType{0});
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    auto workspace_gpu = backend.template allocate<DataType>(workspace_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    auto status = sycldnn::conv2d::launch<DataType, ConvType, float>(
+        inp_gpu, fil_gpu, out_gpu, params, selector, backend, workspace_gpu,
+        workspace_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+    float const expected = static_cast<float>(window * window * channels);
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(expected, static_cast<float>(output[i]));
+    }
+  }
+};
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MixedPrecisionConvolution, Backends);
+
+TYPED_TEST(MixedPrecisionConvolution, Channels4096Features4) {
+  sycldnn::conv2d::DirectSelector selector;
+  this->test_ones(4096, 4, 1, selector);
+}
+TYPED_TEST(MixedPrecisionConvolution, Channels3000Features3) {
+  sycldnn::conv2d::DirectSelector selector;
+  this->test_ones(3000, 3, 1, selector);
+}
+TYPED_TEST(MixedPrecisionConvolution, TiledWindow3Channels512Features4) {
+  sycldnn::conv2d::TiledSelector selector;
+  this->test_ones(512, 4, 3, selector);
+}
+TYPED_TEST(MixedPrecisionConvolution, WinogradWindow3Channels512Features4) {
+  sycldnn::conv2d::WinogradSelector selector;
+  this->test_ones(512, 4, 3, selector);
+}
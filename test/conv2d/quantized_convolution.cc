@@ -0,0 +1,294 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/conv2d/launch_quantized.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/quantization_params.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/conv2d/selector/direct_selector.h"
+#include "portdnn/conv2d/selector/im2col_selector.h"
+#include "portdnn/conv2d/selector/matmul_selector.h"
+#include "portdnn/conv2d/selector/selector.h"
+#include "portdnn/conv2d/selector/tiled_selector.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+template <typename Pair>
+struct QuantizedConvolutionTest
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+
+ protected:
+  /**
+   * Run a quantized convolution with the algorithm chosen by the selector and
+   * check the result against requantizing an integer convolution computed on
+   * the host. Each feature has a different filter zero point.
+   */
+  void test_quantized(sycldnn::conv2d::Conv2DParams const& params,
+                      sycldnn::conv2d::QuantizationParams const& qparams,
+                      sycldnn::conv2d::Selector& selector) {
+    auto sizes =
+        sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(params);
+    auto input = quantized_data(sizes.input_size, 11);
+    auto filter = quantized_data(sizes.filter_size, 7);
+    std::vector<float> scales(params.features);
+    for (int f = 0; f < params.features; ++f) {
+      scales[f] = 0.25f + 0.125f * f;
+    }
+    int const mid = std::is_signed<DataType>::value ? 0 : 128;
+    std::vector<int32_t> zero_points(params.features);
+    for (int f = 0; f < params.features; ++f) {
+      zero_points[f] = mid + f % 3 - 1;
+    }
+    std::vector<DataType> output(sizes.output_size);
+    auto expected =
+        reference(params, qparams, input, filter, scales, zero_points);
+    auto workspace_size =
+        sycldnn::conv2d::query_quantized_workspace_size(params, selector)
+            .recommended_size;
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto scale_gpu =
+        provider.get_initialised_device_memory(scales.size(), scales);
+    auto zero_point_gpu = provider.get_initialised_device_memory(
+        zero_points.size(), zero_points);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    auto workspace_gpu = backend.template allocate<DataType>(workspace_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(scale_gpu);
+      provider.deallocate_ptr(zero_point_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    auto status = sycldnn::conv2d::launch_quantized<DataType>(
+        inp_gpu, fil_gpu, scale_gpu, zero_point_gpu, out_gpu, params, qparams,
+        selector, backend, workspace_gpu, workspace_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      // Allow the rounding to differ by one where the device computes the
+      // scaled value with a different floating point rounding.
+      EXPECT_NEAR(static_cast<int>(expected[i]), static_cast<int>(output[i]),
+                  1);
+    }
+  }
+
+ private:
+  /** Generate values covering a small range around the middle of the type. */
+  static std::vector<DataType> quantized_data(size_t size, int range) {
+    int const mid = std::is_signed<DataType>::value ? 0 : 128;
+    std::vector<DataType> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<DataType>(mid + static_cast<int>(i % range) -
+                                      range / 2);
+    }
+    return data;
+  }
+
+  /** Compute an NHWC quantized convolution with an HWCF filter. */
+  static std::vector<DataType> reference(
+      sycldnn::conv2d::Conv2DParams const& p,
+      sycldnn::conv2d::QuantizationParams const& q,
+      std::vector<DataType> const& input, std::vector<DataType> const& filter,
+      std::vector<float> const& scales,
+      std::vector<int32_t> const& zero_points) {
+    float min_val = static_cast<float>(std::numeric_limits<DataType>::lowest());
+    float max_val = static_cast<float>(std::numeric_limits<DataType>::max());
+    if (q.activation != sycldnn::conv2d::Activation::None) {
+      min_val = std::max(min_val, static_cast<float>(q.output_zero_point));
+    }
+    if (q.activation == sycldnn::conv2d::Activation::Relu6) {
+      max_val = std::min(max_val, std::round(6.f / q.output_scale) +
+                                      static_cast<float>(q.output_zero_point));
+    }
+    std::vector<DataType> output(
+        static_cast<size_t>(p.batch * p.out_rows * p.out_cols * p.features));
+    for (int b = 0; b < p.batch; ++b) {
+      for (int r = 0; r < p.out_rows; ++r) {
+        for (int c = 0; c < p.out_cols; ++c) {
+          for (int f = 0; f < p.features; ++f) {
+            int32_t acc = 0;
+            for (int kr = 0; kr < p.window_rows; ++kr) {
+              int const in_r =
+                  r * p.stride_rows - p.pad_rows + kr * p.dilation_rows;
+              if (in_r < 0 || in_r >= p.in_rows) {
+                continue;
+              }
+              for (int kc = 0; kc < p.window_cols; ++kc) {
+                int const in_c =
+                    c * p.stride_cols - p.pad_cols + kc * p.dilation_cols;
+                if (in_c < 0 || in_c >= p.in_cols) {
+                  continue;
+                }
+                for (int ch = 0; ch < p.channels; ++ch) {
+                  int const in_idx =
+                      ((b * p.in_rows + in_r) * p.in_cols + in_c) *
+                          p.channels +
+                      ch;
+                  int const fil_idx =
+                      ((kr * p.window_cols + kc) * p.channels + ch) *
+                          p.features +
+                      f;
+                  acc += (static_cast<int32_t>(input[in_idx]) -
+                          q.input_zero_point) *
+                         (static_cast<int32_t>(filter[fil_idx]) -
+                          zero_points[f]);
+                }
+              }
+            }
+            float const real =
+                static_cast<float>(acc) * q.input_scale * scales[f];
+            float quant = std::round(real / q.output_scale) +
+                          static_cast<float>(q.output_zero_point);
+            quant = std::min(std::max(quant, min_val), max_val);
+            int const out_idx =
+                ((b * p.out_rows + r) * p.out_cols + c) * p.features + f;
+            output[out_idx] = static_cast<DataType>(quant);
+          }
+        }
+      }
+    }
+    return output;
+  }
+};
+
+using DataTypeList = sycldnn::types::TypeList<int8_t, uint8_t>;
+using Backends = sycldnn::types::DefaultBackendTypes;
+
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+using GTestTypePairs = sycldnn::types::ToGTestTypes<BackendTypePairs>::type;
+TYPED_TEST_SUITE(QuantizedConvolutionTest, GTestTypePairs);
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride, int pad,
+                                         int features) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 3;
+  params.features = features;
+  params.batch = 2;
+  params.in_rows = 5;
+  params.in_cols = 6;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.out_rows = (params.in_rows + 2 * pad - window) / stride + 1;
+  params.out_cols = (params.in_cols + 2 * pad - window) / stride + 1;
+  params.pad_rows = pad;
+  params.pad_cols = pad;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  return params;
+}
+
+sycldnn::conv2d::QuantizationParams get_quant_params(int zero_point) {
+  sycldnn::conv2d::QuantizationParams qparams;
+  qparams.input_zero_point = zero_point;
+  qparams.output_zero_point = zero_point;
+  qparams.input_scale = 0.5f;
+  qparams.output_scale = 2.f;
+  return qparams;
+}
+
+int zero_point_for(bool is_signed) { return is_signed ? 0 : 128; }
+
+TYPED_TEST(QuantizedConvolutionTest, Window1Stride1) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::DirectSelector selector;
+  this->test_quantized(get_params(1, 1, 0, 4), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, Window3Stride1Pad1) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::DirectSelector selector;
+  this->test_quantized(get_params(3, 1, 1, 2), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, Window3Stride2OddFeatures) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::DirectSelector selector;
+  this->test_quantized(get_params(3, 2, 1, 5), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, Window3Stride1Relu6) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  qparams.output_scale = 0.25f;
+  qparams.activation = sycldnn::conv2d::Activation::Relu6;
+  sycldnn::conv2d::DirectSelector selector;
+  this->test_quantized(get_params(3, 1, 1, 4), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, TiledWindow3Stride1Pad1) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::TiledSelector selector;
+  this->test_quantized(get_params(3, 1, 1, 4), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, TiledWindow3Stride2OddFeatures) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::TiledSelector selector;
+  this->test_quantized(get_params(3, 2, 1, 5), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, Im2colWindow3Stride1Pad1) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::Im2colSelector selector;
+  this->test_quantized(get_params(3, 1, 1, 6), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, Im2colWindow3Stride2Relu) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  qparams.activation = sycldnn::conv2d::Activation::Relu;
+  sycldnn::conv2d::Im2colSelector selector;
+  this->test_quantized(get_params(3, 2, 1, 5), qparams, selector);
+}
+TYPED_TEST(QuantizedConvolutionTest, MatmulWindow1Stride1) {
+  using DataType = typename TestFixture::DataType;
+  auto qparams = get_quant_params(zero_point_for(std::is_signed_v<DataType>));
+  sycldnn::conv2d::MatmulSelector selector;
+  this->test_quantized(get_params(1, 1, 0, 7), qparams, selector);
+}
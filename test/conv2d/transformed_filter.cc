@@ -0,0 +1,233 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/padding_mode.h"
+
+#include "portdnn/conv2d/algorithm.h"
+#include "portdnn/conv2d/conv_type.h"
+#include "portdnn/conv2d/epilogue.h"
+#include "portdnn/conv2d/launch.h"
+#include "portdnn/conv2d/params.h"
+#include "portdnn/conv2d/sizes.h"
+#include "portdnn/conv2d/transformed_filter.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/conv2d/selector/constant_selector.h"
+
+#include "portdnn/helpers/padding.h"
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Triple>
+struct TransformedFilterTest
+    : public BackendTestFixture<typename Triple::ThirdType> {
+  using SelectorType = typename Triple::FirstType;
+  using DataType = typename Triple::SecondType;
+  using Backend = typename Triple::ThirdType;
+
+ protected:
+  /**
+   * Transform the filter once, then run forward convolutions with each of the
+   * given batch sizes using the transformed filter, and check the results
+   * against the same convolutions using the untransformed filter.
+   */
+  void test_transformed(sycldnn::conv2d::Conv2DParams params,
+                        std::vector<int> const& batches,
+                        bool use_required_workspace = false,
+                        sycldnn::conv2d::EpilogueParams const& epilogue_params =
+                            sycldnn::conv2d::EpilogueParams{}) {
+    using ConvType = sycldnn::conv2d::conv_type::Forward;
+    SelectorType selector{};
+    auto const algorithm = selector.template select<ConvType>(params);
+    size_t const transformed_size =
+        sycldnn::conv2d::query_transformed_filter_size(params, algorithm);
+    if (transformed_size == 0) {
+      GTEST_SKIP() << "Skipping test because the algorithm does not support "
+                      "pre-transformed filters";
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto filter_size = sycldnn::conv2d::get_sizes<ConvType>(params).filter_size;
+    DataType const max_val = static_cast<DataType>(10);
+    auto filter = iota_initialised_data(filter_size, max_val);
+    auto bias = iota_initialised_data<DataType>(params.features, max_val);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto bias_gpu = provider.get_initialised_device_memory(bias.size(), bias);
+    auto transform_gpu = backend.template allocate<DataType>(transformed_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(transform_gpu);
+    };
+
+    sycldnn::conv2d::TransformedFilter<DataType, Backend> transformed{
+        algorithm, params, transform_gpu};
+    auto status = sycldnn::conv2d::transform_filter<DataType>(
+        fil_gpu, transformed, backend);
+    if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+      GTEST_SKIP() << "Skipping test because the selected convolution "
+                      "algorithm does not support the provided parameters.";
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    sycldnn::conv2d::Epilogue<DataType, Backend> epilogue;
+    epilogue.params = epilogue_params;
+    epilogue.bias = bias_gpu;
+
+    for (int batch : batches) {
+      SCOPED_TRACE("Batch: " + std::to_string(batch));
+      params.batch = batch;
+      auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+      auto full_workspace =
+          sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+      auto transformed_workspace =
+          sycldnn::conv2d::query_workspace_size(transformed, params);
+      ASSERT_LE(transformed_workspace.required_size,
+                full_workspace.required_size);
+      ASSERT_LE(transformed_workspace.recommended_size,
+                full_workspace.recommended_size);
+      size_t const workspace_size =
+          use_required_workspace ? transformed_workspace.required_size
+                                 : transformed_workspace.recommended_size;
+
+      auto input = iota_initialised_data(conv_sizes.input_size, max_val);
+      std::vector<DataType> expected(conv_sizes.output_size);
+      std::vector<DataType> output(conv_sizes.output_size);
+      auto inp_gpu =
+          provider.get_initialised_device_memory(input.size(), input);
+      auto exp_gpu =
+          provider.get_initialised_device_memory(expected.size(), expected);
+      auto out_gpu =
+          provider.get_initialised_device_memory(output.size(), output);
+      auto full_workspace_gpu =
+          backend.template allocate<DataType>(full_workspace.recommended_size);
+      auto workspace_gpu = backend.template allocate<DataType>(workspace_size);
+      SNN_ON_SCOPE_EXIT {
+        backend.get_queue().wait_and_throw();
+        provider.deallocate_ptr(inp_gpu);
+        provider.deallocate_ptr(exp_gpu);
+        provider.deallocate_ptr(out_gpu);
+        provider.deallocate_ptr(full_workspace_gpu);
+        provider.deallocate_ptr(workspace_gpu);
+      };
+
+      status = sycldnn::conv2d::launch<DataType, ConvType>(
+          inp_gpu, fil_gpu, exp_gpu, params, selector, backend,
+          full_workspace_gpu, full_workspace.recommended_size, epilogue);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      status = sycldnn::conv2d::launch<DataType, ConvType>(
+          inp_gpu, transformed, out_gpu, params, backend, workspace_gpu,
+          workspace_size, epilogue);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(expected.size(), exp_gpu, expected);
+      provider.copy_device_data_to_host(output.size(), out_gpu, output);
+      for (size_t i = 0; i < expected.size(); ++i) {
+        SCOPED_TRACE("Element: " + std::to_string(i));
+        SNN_ALMOST_EQUAL(expected[i], output[i], 10u);
+      }
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::TypeList<
+    sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Winograd>,
+    sycldnn::conv2d::ConstantSelector<
+        sycldnn::conv2d::Algorithm::WinogradLarge>,
+    sycldnn::conv2d::ConstantSelector<
+        sycldnn::conv2d::Algorithm::WinogradFused>,
+    sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Im2col>>;
+using Backends = sycldnn::types::DefaultBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using TestTriples = sycldnn::types::NestedPairsToTriple<BackendTypePairs>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+TYPED_TEST_SUITE(TransformedFilterTest, GTestTypeTriples);
+
+sycldnn::conv2d::Conv2DParams get_params(int window_rows, int window_cols,
+                                         int groups = 1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 4;
+  params.features = 6;
+  params.batch = 1;
+  params.in_rows = 9;
+  params.in_cols = 7;
+  params.window_rows = window_rows;
+  params.window_cols = window_cols;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.groups = groups;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+TYPED_TEST(TransformedFilterTest, Window3x3) {
+  this->test_transformed(get_params(3, 3), {1});
+}
+TYPED_TEST(TransformedFilterTest, Window3x1) {
+  this->test_transformed(get_params(3, 1), {1});
+}
+TYPED_TEST(TransformedFilterTest, Window1x3) {
+  this->test_transformed(get_params(1, 3), {1});
+}
+TYPED_TEST(TransformedFilterTest, ReusedAcrossBatchSizes) {
+  this->test_transformed(get_params(3, 3), {1, 3, 2});
+}
+TYPED_TEST(TransformedFilterTest, RequiredWorkspace) {
+  this->test_transformed(get_params(3, 3), {3}, true);
+}
+TYPED_TEST(TransformedFilterTest, BiasRelu) {
+  sycldnn::conv2d::EpilogueParams epilogue;
+  epilogue.add_bias = true;
+  epilogue.activation = sycldnn::conv2d::Activation::Relu;
+  epilogue.output_scale = -1.f;
+  this->test_transformed(get_params(3, 3), {2}, false, epilogue);
+}
+TYPED_TEST(TransformedFilterTest, Groups2) {
+  this->test_transformed(get_params(3, 3, 2), {1, 2});
+}
+TYPED_TEST(TransformedFilterTest, Depthwise) {
+  auto params = get_params(3, 3, 4);
+  params.features = 4;
+  this->test_transformed(params, {2});
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/conv2d/launch_transposed.h"
+#include "portdnn/conv2d/transposed_params.h"
+#include "portdnn/conv2d/workspace_size.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/selector_list.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Pair>
+struct TransposedConvolutionTest
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using SelectorType = typename Pair::FirstType::FirstType;
+  using DataType = typename Pair::FirstType::SecondType;
+
+ protected:
+  /**
+   * Run a transposed convolution and check the result against scattering
+   * each input value through the filter on the host.
+   */
+  void test_transposed(sycldnn::conv2d::TransposedConv2DParams params) {
+    params = sycldnn::conv2d::add_output_sizes_to(params);
+    SelectorType selector{};
+    auto const conv_params = sycldnn::conv2d::get_conv2d_params(params);
+    if (selector.select_transposed(conv_params) ==
+        sycldnn::conv2d::Algorithm::NotSupported) {
+      GTEST_SKIP()
+          << "Skipping test because the implementation is not supported";
+    }
+
+    auto sizes = sycldnn::conv2d::get_transposed_sizes(params);
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size(params, selector);
+    DataType const max_val = static_cast<DataType>(4);
+    auto input = iota_initialised_data(sizes.input_size, max_val);
+    auto filter = iota_initialised_data(sizes.filter_size, max_val);
+    std::vector<DataType> output(sizes.output_size);
+    auto expected = reference(params, input, filter);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    auto workspace_gpu =
+        backend.template allocate<DataType>(workspace_size.recommended_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    auto status = sycldnn::conv2d::launch_transposed<DataType>(
+        inp_gpu, fil_gpu, out_gpu, params, selector, backend, workspace_gpu,
+        workspace_size.recommended_size);
+    if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+      GTEST_SKIP() << "Skipping test because the selected convolution "
+                      "algorithm does not support the provided parameters.";
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(expected[i], output[i], 10u);
+    }
+  }
+
+ private:
+  /** Compute an NHWC transposed convolution with an HWCF filter. */
+  static std::vector<DataType> reference(
+      sycldnn::conv2d::TransposedConv2DParams const& p,
+      std::vector<DataType> const& input, std::vector<DataType> const& filter) {
+    std::vector<DataType> output(
+        static_cast<size_t>(p.batch * p.out_rows * p.out_cols * p.features),
+        DataType{0});
+    int const in_group = p.channels / p.groups;
+    int const out_group = p.features / p.groups;
+    for (int b = 0; b < p.batch; ++b) {
+      for (int r = 0; r < p.in_rows; ++r) {
+        for (int c = 0; c < p.in_cols; ++c) {
+          for (int ch = 0; ch < p.channels; ++ch) {
+            int const group = ch / in_group;
+            DataType in_val =
+                input[((b * p.in_rows + r) * p.in_cols + c) * p.channels + ch];
+            for (int kr = 0; kr < p.window_rows; ++kr) {
+              int const out_r = r * p.stride_rows - p.pad_rows +
+                                kr * p.dilation_rows;
+              if (out_r < 0 || out_r >= p.out_rows) {
+                continue;
+              }
+              for (int kc = 0; kc < p.window_cols; ++kc) {
+                int const out_c = c * p.stride_cols - p.pad_cols +
+                                  kc * p.dilation_cols;
+                if (out_c < 0 || out_c >= p.out_cols) {
+                  continue;
+                }
+                for (int f = 0; f < out_group; ++f) {
+                  int const feature = group * out_group + f;
+                  int const fil_idx =
+                      ((kr * p.window_cols + kc) * out_group + f) *
+                          p.channels +
+                      ch;
+                  int const out_idx =
+                      ((b * p.out_rows + out_r) * p.out_cols + out_c) *
+                          p.features +
+                      feature;
+                  output[out_idx] += in_val * filter[fil_idx];
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    return output;
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::DefaultBackendTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using GTestTypePairs = sycldnn::types::ToGTestTypes<BackendTypePairs>::type;
+TYPED_TEST_SUITE(TransposedConvolutionTest, GTestTypePairs);
+
+sycldnn::conv2d::TransposedConv2DParams get_params(int window, int stride,
+                                                   int pad, int output_pad) {
+  sycldnn::conv2d::TransposedConv2DParams params;
+  params.channels = 3;
+  params.features = 2;
+  params.batch = 2;
+  params.in_rows = 4;
+  params.in_cols = 5;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.pad_rows = pad;
+  params.pad_cols = pad;
+  params.output_pad_rows = output_pad;
+  params.output_pad_cols = output_pad;
+  return params;
+}
+
+TYPED_TEST(TransposedConvolutionTest, Window1Stride1) {
+  this->test_transposed(get_params(1, 1, 0, 0));
+}
+TYPED_TEST(TransposedConvolutionTest, Window3Stride1Pad1) {
+  this->test_transposed(get_params(3, 1, 1, 0));
+}
+TYPED_TEST(TransposedConvolutionTest, Window3Stride2) {
+  this->test_transposed(get_params(3, 2, 0, 0));
+}
+TYPED_TEST(TransposedConvolutionTest, Window3Stride2Pad1OutputPad1) {
+  this->test_transposed(get_params(3, 2, 1, 1));
+}
+TYPED_TEST(TransposedConvolutionTest, Window4Stride2Pad1) {
+  this->test_transposed(get_params(4, 2, 1, 0));
+}
+TYPED_TEST(TransposedConvolutionTest, Window3Stride2Groups) {
+  auto params = get_params(3, 2, 1, 1);
+  params.channels = 4;
+  params.features = 6;
+  params.groups = 2;
+  this->test_transposed(params);
+}
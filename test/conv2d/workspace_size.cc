@@ -25,6 +25,8 @@
 
 #include "portdnn/conv2d/selector/direct_selector.h"
 #include "portdnn/conv2d/selector/im2col_selector.h"
+#include "portdnn/conv2d/selector/implicit_gemm_selector.h"
+#include "portdnn/conv2d/selector/local_tiled_selector.h"
 #include "portdnn/conv2d/selector/tiled_selector.h"
 #include "portdnn/conv2d/selector/winograd_selector.h"
 
@@ -89,6 +91,26 @@ TEST(Conv2DWorskpaceSize, TiledNoWorkspace) {
   EXPECT_EQ(0u, filbk_workspace.recommended_size);
 }
 
+TEST(Conv2DWorskpaceSize, ImplicitGemmNoWorkspace) {
+  sycldnn::conv2d::ImplicitGemmSelector selector{};
+  auto params = get_params(3, 1, 224, 64, 64, 32, sycldnn::PaddingMode::SAME);
+
+  auto forward_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, selector);
+  EXPECT_EQ(0u, forward_workspace.required_size);
+  EXPECT_EQ(0u, forward_workspace.recommended_size);
+}
+
+TEST(Conv2DWorskpaceSize, LocalTiledNoWorkspace) {
+  sycldnn::conv2d::LocalTiledSelector selector{};
+  auto params = get_params(3, 1, 224, 64, 64, 32, sycldnn::PaddingMode::SAME);
+
+  auto forward_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, selector);
+  EXPECT_EQ(0u, forward_workspace.required_size);
+  EXPECT_EQ(0u, forward_workspace.recommended_size);
+}
+
 TEST(Conv2DWorskpaceSize, Im2colVGGLayer1Workspace) {
   // We allow the queried workspace to be larger than the absolute minimum
   // required, so that internally we can add extra size requirements for
@@ -134,3 +134,27 @@ TYPED_TEST(BasicConvolutionTest, FilterBackprop3x3) {
   this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
                                                                        params);
 }
+/*
+ * A dilation of 2 spaces out the window elements in the input.
+ *
+ * Input:  1  2  3  4  5  6    Filter:  1  2  3
+ *         7  8  9 10 11 12             4  5  6
+ *        13 14 15 16 17 18             7  8  9
+ *        19 20 21 22 23 24
+ *        25 26 27 28 29 30
+ *
+ * Output: (1+6+15+52+75+102    (2+8+18+56+80+108
+ *         +175+216+261)        +182+224+270)
+ */
+TYPED_TEST(BasicConvolutionTest, Dilated3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {903, 948};
+  auto params = get_3x3_params();
+  params.in_rows = 5;
+  params.in_cols = 6;
+  params.out_rows = 1;
+  params.out_cols = 2;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
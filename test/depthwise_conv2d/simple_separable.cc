@@ -0,0 +1,158 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/backend/snn_backend.h"
+
+#include "portdnn/depthwise_conv2d/launch_separable.h"
+#include "portdnn/depthwise_conv2d/separable_params.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Pair>
+struct SeparableConvolutionTest
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+
+ protected:
+  /** Test a separable convolution with all tensors set to `1, 2, 3, 4,...` */
+  void test_separable(
+      std::vector<DataType> exp,
+      sycldnn::depthwise_conv2d::SeparableConv2DParams const& params) {
+    auto sizes = sycldnn::depthwise_conv2d::get_separable_sizes(params);
+    ASSERT_EQ(sizes.output_size, exp.size());
+
+    DataType const max_val = static_cast<DataType>(4);
+    std::vector<DataType> input =
+        iota_initialised_data(sizes.input_size, max_val);
+    std::vector<DataType> dw_filter =
+        iota_initialised_data(sizes.depthwise_filter_size, max_val);
+    std::vector<DataType> pw_filter =
+        iota_initialised_data(sizes.pointwise_filter_size, max_val);
+    std::vector<DataType> output(sizes.output_size, static_cast<DataType>(0));
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto dw_gpu = provider.get_initialised_device_memory(
+        sizes.depthwise_filter_size, dw_filter);
+    auto pw_gpu = provider.get_initialised_device_memory(
+        sizes.pointwise_filter_size, pw_filter);
+    auto out_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(dw_gpu);
+      provider.deallocate_ptr(pw_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status = sycldnn::depthwise_conv2d::launch_separable<DataType>(
+        inp_gpu, dw_gpu, pw_gpu, out_gpu, params, backend);
+
+    if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+      // Do not check results if the implementation is not supported.
+      GTEST_SKIP()
+          << "Skipping test because the implementation is not supported.";
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(sizes.output_size, out_gpu, output);
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], output[i], 10u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::TypeList<sycldnn::backend::SNNBackend>;
+
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+using GTestTypePairs = sycldnn::types::ToGTestTypes<BackendTypePairs>::type;
+TYPED_TEST_SUITE(SeparableConvolutionTest, GTestTypePairs);
+
+sycldnn::depthwise_conv2d::SeparableConv2DParams get_3x3_params() {
+  sycldnn::depthwise_conv2d::SeparableConv2DParams params;
+  params.depthwise.channels = 2;
+  params.depthwise.channel_multiplier = 1;
+  params.depthwise.batch = 1;
+  params.depthwise.in_rows = 4;
+  params.depthwise.in_cols = 4;
+  params.depthwise.window_rows = 3;
+  params.depthwise.window_cols = 3;
+  params.depthwise.stride_rows = 1;
+  params.depthwise.stride_cols = 1;
+  params.depthwise.out_rows = 2;
+  params.depthwise.out_cols = 2;
+  params.depthwise.pad_rows = 0;
+  params.depthwise.pad_cols = 0;
+  params.features = 3;
+  return params;
+}
+
+/**
+ * The input has two interleaved channels, so with values cycling through
+ * 1..4 the depthwise outputs are:
+ *
+ *   channel 0: 31 37    channel 1: 72 84
+ *              31 37               72 84
+ *
+ * The pointwise filter is [[1, 2, 3], [4, 1, 2]], so the first output pixel
+ * is [31 + 4x72, 2x31 + 72, 3x31 + 2x72] = [319, 134, 237].
+ */
+TYPED_TEST(SeparableConvolutionTest, Simple3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {319, 134, 237, 373, 158, 279,
+                               319, 134, 237, 373, 158, 279};
+  auto params = get_3x3_params();
+  this->test_separable(exp, params);
+}
+
+TYPED_TEST(SeparableConvolutionTest, Stride2SamePaddingMultiplier2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {88,  128, 199, 290, 104, 152, 199, 290, 243,
+                               354, 169, 246, 104, 152, 169, 246, 148, 216};
+  auto params = get_3x3_params();
+  params.depthwise.channels = 1;
+  params.depthwise.channel_multiplier = 2;
+  params.depthwise.in_rows = 5;
+  params.depthwise.in_cols = 5;
+  params.depthwise.stride_rows = 2;
+  params.depthwise.stride_cols = 2;
+  params.depthwise.out_rows = 3;
+  params.depthwise.out_cols = 3;
+  params.depthwise.pad_rows = 1;
+  params.depthwise.pad_cols = 1;
+  params.features = 2;
+  this->test_separable(exp, params);
+}
@@ -45,7 +45,7 @@ GROUPS = [2, 2, 3, 2, 3, 4, 4, 5, 6, 7]
 PADDING_VALUES = ["SAME", "VALID"]
 GROUP_FORMATS = ["STRIDED", "INTERLEAVED"]
 FILTER_FORMATS = ["HWCF", "FHWC"]
-TEST_TYPES = ["forward"]
+TEST_TYPES = ["forward", "input_backprop", "filter_backprop"]
 INCLUDES = r"""
 #include <gtest/gtest.h>
 
@@ -138,16 +138,108 @@ def get_forward_grouped_conv_results(
     return res
 
 
+def grouped_conv(inp, fil, stride_shape, padding, groups):
+    """
+    Compute a grouped convolution with the groups strided in the channels of
+    the input and output tensors.
+    """
+    input_groups = tf.split(axis=3, num_or_size_splits=groups, value=inp)
+    weights_groups = tf.split(axis=3, num_or_size_splits=groups, value=fil)
+    conv_groups = [
+        tf.nn.conv2d(i, k, strides=stride_shape, padding=padding,
+                     data_format="NHWC")
+        for i, k in zip(input_groups, weights_groups)]
+    return tf.concat(axis=-1, values=conv_groups)
+
+
+def get_input_backprop_grouped_conv_results(
+        max_val,
+        input_shape,
+        filter_shape,
+        stride_shape,
+        padding,
+        groups,
+        group_format):
+    """
+    Compute input backprop grouped convolution.
+
+    Will create input tensors of the required size filled with values 1, 2,
+    3... and use these to compute the convolution for the input backprop pass.
+    The output gradient is created with strided groups. Returns the computed
+    values in a numpy array, with the groups of the input gradient
+    interleaved if required.
+    """
+    input = tf.Variable(tf.zeros(input_shape, dtype=np.float64))
+    filter = helpers.get_variable(filter_shape, max_val)
+    with tf.GradientTape() as tape:
+        output = grouped_conv(input, filter, stride_shape, padding, groups)
+
+    output_shape = output.shape
+    error = helpers.get_variable(output_shape, max_val)
+    res = tape.gradient(output, input, error)
+    if group_format == "INTERLEAVED":
+        res = tf.reshape(res, list(input_shape[:3]) + [groups, -1])
+        res = tf.transpose(res, perm=[0, 1, 2, 4, 3])
+    return res
+
+
+def get_filter_backprop_grouped_conv_results(
+        max_val,
+        input_shape,
+        filter_shape,
+        stride_shape,
+        padding,
+        groups,
+        group_format):
+    """
+    Compute filter backprop grouped convolution.
+
+    Will create input tensors of the required size filled with values 1, 2,
+    3... and use these to compute the convolution for the filter backprop pass.
+    Only strided groups are supported. Returns the computed values in a numpy
+    array.
+    """
+    if group_format != "STRIDED":
+        raise ValueError("Filter backprop only supports strided groups.")
+    input = helpers.get_variable(input_shape, max_val)
+    filter = tf.Variable(tf.zeros(filter_shape, dtype=np.float64))
+    with tf.GradientTape() as tape:
+        output = grouped_conv(input, filter, stride_shape, padding, groups)
+
+    output_shape = output.shape
+    error = helpers.get_variable(output_shape, max_val)
+    return tape.gradient(output, filter, error)
+
+
 def get_conv_fn(test_type):
     """
     Get the function which computes the convolution corresponding to the test type.
     """
     if test_type == "forward":
         return get_forward_grouped_conv_results
+    elif test_type == "input_backprop":
+        return get_input_backprop_grouped_conv_results
+    elif test_type == "filter_backprop":
+        return get_filter_backprop_grouped_conv_results
     else:
         raise ValueError("Unknown test type requested.")
 
 
+def is_supported(test_type, filter_format, group_format):
+    """
+    Check whether the combination of formats is supported for the test type.
+
+    Interleaved groups require an HWCF filter. The backprop passes require an
+    HWCF filter, and the filter backprop only supports strided groups.
+    """
+    if filter_format == "FHWC" and (group_format == "INTERLEAVED" or
+                                    test_type != "forward"):
+        return False
+    if test_type == "filter_backprop" and group_format == "INTERLEAVED":
+        return False
+    return True
+
+
 def get_result_and_size(test_case, test_params):
     """
     Get the result of the specified convolution and max input value.
@@ -252,7 +344,7 @@ def test_params_for_test_case(test_case):
     param_cases = []
     for param_case in itertools.product(
             PADDING_VALUES, FILTER_FORMATS, GROUP_FORMATS, CHANNELS, FEATURES):
-        if param_case[1] == "FHWC" and param_case[2] == "INTERLEAVED":
+        if not is_supported(test_case.test_type, param_case[1], param_case[2]):
             continue
         param_cases.append(param_case)
     total_param_cases = len(param_cases)
@@ -132,3 +132,39 @@ TYPED_TEST(AddPaddingToParamsTest, SameStride2) {
 
   this->check_padding(params, sycldnn::PaddingMode::SAME);
 }
+TEST(AddPaddingToConv2DParamsTest, ValidDilation2) {
+  sycldnn::conv2d::Conv2DParams params{};
+  params.in_rows = 15;
+  params.in_cols = 10;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.dilation_rows = 2;
+  params.dilation_cols = 1;
+
+  auto result =
+      sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::VALID);
+  EXPECT_EQ(11, result.out_rows);
+  EXPECT_EQ(8, result.out_cols);
+  EXPECT_EQ(0, result.pad_rows);
+  EXPECT_EQ(0, result.pad_cols);
+}
+TEST(AddPaddingToConv2DParamsTest, SameDilation2) {
+  sycldnn::conv2d::Conv2DParams params{};
+  params.in_rows = 15;
+  params.in_cols = 10;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.dilation_rows = 2;
+  params.dilation_cols = 1;
+
+  auto result =
+      sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+  EXPECT_EQ(15, result.out_rows);
+  EXPECT_EQ(10, result.out_cols);
+  EXPECT_EQ(2, result.pad_rows);
+  EXPECT_EQ(1, result.pad_cols);
+}
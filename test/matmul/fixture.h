@@ -23,6 +23,7 @@
 #include "portdnn/helpers/scope_exit.h"
 #include "portdnn/matmul/launch.h"
 #include "portdnn/matmul/params.h"
+#include "portdnn/matmul/workspace_size.h"
 #include "test/backend/backend_test_fixture.h"
 #include "test/gen/iota_initialised_data.h"
 #include "test/helpers/float_comparison.h"
@@ -76,4 +77,125 @@ struct MatmulFixture : public BackendTestFixture<typename Pair::SecondType> {
   }
 };
 
+/**
+ * Fixture to compare matrix multiplies against a reference computed on the
+ * host, for any strides and batch format in the parameters.
+ *
+ * The values are small integers so the results are exact regardless of the
+ * order of accumulation.
+ */
+template <typename Backend>
+struct MatmulReferenceFixture : public BackendTestFixture<Backend> {
+  using DataType = float;
+
+ protected:
+  /** Run a matrix multiply with densely packed strided batches. */
+  template <bool TransposeLhs, bool TransposeRhs>
+  void test_matmul(int batches, int m, int k, int n, float beta) {
+    sycldnn::matmul::MatmulParams params;
+    params.batches = batches;
+    params.m = m;
+    params.k = k;
+    params.n = n;
+    params.beta = beta;
+    test_matmul<TransposeLhs, TransposeRhs>(params);
+  }
+
+  /**
+   * Run a matrix multiply with the given parameters. Any values in the
+   * tensors which are not part of the matrices must be left untouched. A
+   * strided output is followed by an extra matrix, to catch work-items past
+   * the last batch writing to the output.
+   */
+  template <bool TransposeLhs, bool TransposeRhs>
+  void test_matmul(sycldnn::matmul::MatmulParams const& params) {
+    using sycldnn::matmul::internal::strided_size;
+    auto const strides =
+        sycldnn::matmul::internal::resolve_strides<TransposeLhs,
+                                                   TransposeRhs>(params);
+    int const batches = params.batches;
+    int const m = params.m;
+    int const k = params.k;
+    int const n = params.n;
+    bool const interleaved =
+        params.batch_type == sycldnn::BatchFormat::INTERLEAVED;
+    // Offset of element (row, col) of the given batch of a matrix.
+    auto index = [&](int batch, int row, int col, int ld, int batch_stride) {
+      return interleaved ? (row * ld + col) * batches + batch
+                         : batch * batch_stride + row * ld + col;
+    };
+
+    std::vector<DataType> lhs(strided_size(
+        batches, strides.lhs_batch_stride, TransposeLhs ? k : m,
+        TransposeLhs ? m : k, strides.lda));
+    std::vector<DataType> rhs(strided_size(
+        batches, strides.rhs_batch_stride, TransposeRhs ? n : k,
+        TransposeRhs ? k : n, strides.ldb));
+    int const out_batches = interleaved ? batches : batches + 1;
+    std::vector<DataType> output(strided_size(
+        out_batches, strides.out_batch_stride, m, n, strides.ldc));
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      lhs[i] = static_cast<DataType>(i % 7) - 3;
+    }
+    for (size_t i = 0; i < rhs.size(); ++i) {
+      rhs[i] = static_cast<DataType>(i % 5) - 2;
+    }
+    for (size_t i = 0; i < output.size(); ++i) {
+      output[i] = static_cast<DataType>(i % 3);
+    }
+
+    std::vector<DataType> expected = output;
+    for (int b = 0; b < batches; ++b) {
+      for (int row = 0; row < m; ++row) {
+        for (int col = 0; col < n; ++col) {
+          DataType sum = 0;
+          for (int acc = 0; acc < k; ++acc) {
+            int const lhs_idx =
+                TransposeLhs
+                    ? index(b, acc, row, strides.lda, strides.lhs_batch_stride)
+                    : index(b, row, acc, strides.lda, strides.lhs_batch_stride);
+            int const rhs_idx =
+                TransposeRhs
+                    ? index(b, col, acc, strides.ldb, strides.rhs_batch_stride)
+                    : index(b, acc, col, strides.ldb, strides.rhs_batch_stride);
+            sum += lhs[lhs_idx] * rhs[rhs_idx];
+          }
+          int const out_idx =
+              index(b, row, col, strides.ldc, strides.out_batch_stride);
+          expected[out_idx] = sum + params.beta * output[out_idx];
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    auto const workspace_size = sycldnn::matmul::query_workspace_size(params);
+    auto workspace_gpu = backend.template allocate<DataType>(workspace_size);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(lhs_gpu);
+      provider.deallocate_ptr(rhs_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+    };
+
+    auto status = sycldnn::matmul::launch<DataType, TransposeLhs, TransposeRhs>(
+        lhs_gpu, rhs_gpu, out_gpu, params, backend, workspace_gpu,
+        workspace_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(expected[i], output[i]);
+    }
+  }
+};
+
 #endif  // PORTDNN_TEST_MATMUL_FIXTURE_H_
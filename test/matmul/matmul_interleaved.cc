@@ -0,0 +1,59 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "test/matmul/fixture.h"
+#include "test/types/test_backend_types.h"
+
+template <typename Backend>
+struct MatmulInterleaved : public MatmulReferenceFixture<Backend> {
+ protected:
+  /**
+   * Multiply batches of matrices stored in the interleaved batch format,
+   * where the batch is the fastest moving dimension.
+   */
+  template <bool TransposeLhs, bool TransposeRhs>
+  void test_interleaved(int batches, int m, int k, int n, float beta) {
+    sycldnn::matmul::MatmulParams params;
+    params.batches = batches;
+    params.m = m;
+    params.k = k;
+    params.n = n;
+    params.beta = beta;
+    params.batch_type = sycldnn::BatchFormat::INTERLEAVED;
+    this->template test_matmul<TransposeLhs, TransposeRhs>(params);
+  }
+};
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MatmulInterleaved, Backends);
+
+TYPED_TEST(MatmulInterleaved, FullTiles) {
+  this->template test_interleaved<false, false>(4, 8, 5, 8, 0.f);
+  this->template test_interleaved<true, false>(8, 4, 7, 4, 0.f);
+  this->template test_interleaved<false, true>(4, 4, 3, 12, 1.f);
+  this->template test_interleaved<true, true>(12, 8, 9, 4, 1.f);
+}
+TYPED_TEST(MatmulInterleaved, RaggedTiles) {
+  this->template test_interleaved<false, false>(3, 5, 6, 7, 0.f);
+  this->template test_interleaved<true, false>(7, 9, 4, 3, 1.f);
+  this->template test_interleaved<false, true>(5, 2, 11, 6, 0.f);
+  this->template test_interleaved<true, true>(6, 7, 5, 1, 1.f);
+}
+TYPED_TEST(MatmulInterleaved, Depthwise) {
+  this->template test_interleaved<false, false>(32, 49, 9, 1, 0.f);
+  this->template test_interleaved<false, false>(19, 30, 25, 1, 0.f);
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "test/matmul/fixture.h"
+#include "test/types/test_backend_types.h"
+
+// Shapes large enough to cover several work-group blocks of the local memory
+// kernel.
+template <typename Backend>
+using MatmulLocalMemory = MatmulReferenceFixture<Backend>;
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MatmulLocalMemory, Backends);
+
+TYPED_TEST(MatmulLocalMemory, Aligned) {
+  this->template test_matmul<false, false>(1, 64, 80, 96, 0.f);
+  this->template test_matmul<true, false>(1, 64, 80, 96, 0.f);
+  this->template test_matmul<false, true>(1, 64, 80, 96, 0.f);
+  this->template test_matmul<true, true>(1, 64, 80, 96, 0.f);
+}
+TYPED_TEST(MatmulLocalMemory, AlignedBeta1Batch2) {
+  this->template test_matmul<false, false>(2, 64, 48, 32, 1.f);
+  this->template test_matmul<true, true>(2, 64, 48, 32, 1.f);
+}
+TYPED_TEST(MatmulLocalMemory, Ragged) {
+  this->template test_matmul<false, false>(1, 65, 70, 33, 0.f);
+  this->template test_matmul<true, false>(1, 65, 70, 33, 0.f);
+  this->template test_matmul<false, true>(1, 65, 70, 33, 0.f);
+  this->template test_matmul<true, true>(1, 65, 70, 33, 0.f);
+}
+TYPED_TEST(MatmulLocalMemory, RaggedBeta1Batch3) {
+  this->template test_matmul<false, true>(3, 47, 9, 71, 1.f);
+  this->template test_matmul<true, false>(3, 47, 9, 71, 1.f);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/matmul/launch.h"
+#include "portdnn/matmul/params.h"
+
+#include "portdnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+
+#include <CL/sycl.hpp>
+
+#include <vector>
+
+template <typename Backend>
+struct MatmulMixedPrecision : public BackendTestFixture<Backend> {
+  using DataType = cl::sycl::half;
+
+ protected:
+  /**
+   * Multiply matrices of ones, so that every output is k. Half precision can
+   * only represent integers exactly up to 2048, so a half accumulator stops
+   * increasing there while a float accumulator reaches k.
+   */
+  void test_ones(int m, int k, int n) {
+    std::vector<DataType> lhs(m * k, DataType{1});
+    std::vector<DataType> rhs(k * n, DataType{1});
+    std::vector<DataType> output(m * n, DataType{0});
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+    auto out_gpu =
+        provider.get_initialised_device_memory(output.size(), output);
+    SNN_ON_SCOPE_EXIT {
+      backend.get_queue().wait_and_throw();
+      provider.deallocate_ptr(lhs_gpu);
+      provider.deallocate_ptr(rhs_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    sycldnn::matmul::MatmulParams params;
+    params.batches = 1;
+    params.m = m;
+    params.k = k;
+    params.n = n;
+    params.beta = 0.f;
+    auto status = sycldnn::matmul::launch<DataType, false, false, float>(
+        lhs_gpu, rhs_gpu, out_gpu, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(output.size(), out_gpu, output);
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(static_cast<float>(k), static_cast<float>(output[i]));
+    }
+  }
+};
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MatmulMixedPrecision, Backends);
+
+TYPED_TEST(MatmulMixedPrecision, M4xK4096xN4) { this->test_ones(4, 4096, 4); }
+TYPED_TEST(MatmulMixedPrecision, M5xK3000xN7) { this->test_ones(5, 3000, 7); }
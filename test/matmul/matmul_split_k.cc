@@ -0,0 +1,40 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "test/matmul/fixture.h"
+#include "test/types/test_backend_types.h"
+
+// Small outputs with a large accumulation dimension, which are split into
+// slices.
+template <typename Backend>
+using MatmulSplitK = MatmulReferenceFixture<Backend>;
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MatmulSplitK, Backends);
+
+TYPED_TEST(MatmulSplitK, FullyConnected) {
+  this->template test_matmul<false, false>(1, 1, 4096, 10, 0.f);
+  this->template test_matmul<true, false>(1, 3, 2048, 7, 0.f);
+  this->template test_matmul<false, true>(1, 8, 1024, 12, 1.f);
+  this->template test_matmul<true, true>(1, 2, 1030, 5, 1.f);
+}
+TYPED_TEST(MatmulSplitK, RaggedSlices) {
+  this->template test_matmul<false, false>(2, 5, 1001, 9, 0.f);
+  this->template test_matmul<true, false>(2, 5, 1001, 9, 1.f);
+  this->template test_matmul<false, true>(3, 4, 777, 4, 0.f);
+  this->template test_matmul<true, true>(3, 4, 777, 4, 1.f);
+}
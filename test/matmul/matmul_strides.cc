@@ -0,0 +1,68 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "test/matmul/fixture.h"
+#include "test/types/test_backend_types.h"
+
+template <typename Backend>
+struct MatmulStrides : public MatmulReferenceFixture<Backend> {
+ protected:
+  /**
+   * Multiply sub-matrices of larger tensors, where each row is followed by
+   * `pad` unused values and each matrix by another `pad` values. If
+   * `broadcast_rhs` is set the same right hand matrix is used for every
+   * batch.
+   */
+  template <bool TransposeLhs, bool TransposeRhs>
+  void test_strided(int batches, int m, int k, int n, float beta, int pad,
+                    bool broadcast_rhs) {
+    sycldnn::matmul::MatmulParams params;
+    params.batches = batches;
+    params.m = m;
+    params.k = k;
+    params.n = n;
+    params.beta = beta;
+    params.lda = (TransposeLhs ? m : k) + pad;
+    params.ldb = (TransposeRhs ? k : n) + pad;
+    params.ldc = n + pad;
+    params.lhs_batch_stride = (TransposeLhs ? k : m) * params.lda + pad;
+    params.rhs_batch_stride =
+        broadcast_rhs ? 0 : (TransposeRhs ? n : k) * params.ldb + pad;
+    params.out_batch_stride = m * params.ldc + pad;
+    this->template test_matmul<TransposeLhs, TransposeRhs>(params);
+  }
+};
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MatmulStrides, Backends);
+
+TYPED_TEST(MatmulStrides, SubMatrices) {
+  this->template test_strided<false, false>(1, 9, 11, 13, 0.f, 3, false);
+  this->template test_strided<true, false>(2, 16, 16, 16, 1.f, 5, false);
+  this->template test_strided<false, true>(3, 7, 5, 2, 0.f, 1, false);
+  this->template test_strided<true, true>(2, 1, 17, 40, 1.f, 4, false);
+}
+TYPED_TEST(MatmulStrides, BroadcastRHS) {
+  this->template test_strided<false, false>(4, 9, 11, 13, 0.f, 0, true);
+  this->template test_strided<true, false>(3, 64, 32, 48, 1.f, 2, true);
+  this->template test_strided<false, true>(6, 5, 8, 3, 0.f, 0, true);
+  this->template test_strided<true, true>(2, 33, 19, 35, 1.f, 7, true);
+}
+TYPED_TEST(MatmulStrides, SplitK) {
+  this->template test_strided<false, false>(1, 2, 2048, 7, 0.f, 3, false);
+  this->template test_strided<false, true>(3, 4, 1001, 5, 1.f, 2, true);
+}
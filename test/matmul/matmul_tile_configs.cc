@@ -0,0 +1,53 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "test/matmul/fixture.h"
+#include "test/types/test_backend_types.h"
+
+// Shapes chosen to use each of the default tile configurations.
+template <typename Backend>
+using MatmulTileConfigs = MatmulReferenceFixture<Backend>;
+
+using Backends = sycldnn::types::GTestDefaultBackendTypes;
+TYPED_TEST_SUITE(MatmulTileConfigs, Backends);
+
+TYPED_TEST(MatmulTileConfigs, SkinnyRows) {
+  this->template test_matmul<false, false>(1, 1, 37, 130, 0.f);
+  this->template test_matmul<true, false>(1, 2, 37, 130, 0.f);
+  this->template test_matmul<false, true>(2, 1, 37, 130, 1.f);
+  this->template test_matmul<true, true>(1, 2, 32, 128, 1.f);
+}
+TYPED_TEST(MatmulTileConfigs, SkinnyCols) {
+  this->template test_matmul<false, false>(1, 130, 37, 1, 0.f);
+  this->template test_matmul<true, false>(1, 130, 37, 2, 0.f);
+  this->template test_matmul<false, true>(2, 130, 37, 1, 1.f);
+  this->template test_matmul<true, true>(1, 128, 32, 2, 1.f);
+}
+TYPED_TEST(MatmulTileConfigs, SmallBatched) {
+  this->template test_matmul<false, false>(16, 9, 19, 21, 0.f);
+  this->template test_matmul<true, false>(16, 9, 19, 21, 0.f);
+  this->template test_matmul<false, true>(5, 16, 16, 16, 1.f);
+  this->template test_matmul<true, true>(7, 6, 12, 10, 1.f);
+}
+TYPED_TEST(MatmulTileConfigs, SmallBatchedOddBatches) {
+  // The small batched work-groups hold two matrices, so an odd batch leaves
+  // work-items past the last matrix.
+  this->template test_matmul<false, false>(5, 8, 12, 8, 0.f);
+  this->template test_matmul<true, false>(7, 17, 9, 13, 1.f);
+  this->template test_matmul<false, true>(9, 64, 16, 64, 0.f);
+  this->template test_matmul<true, true>(11, 5, 3, 6, 1.f);
+}
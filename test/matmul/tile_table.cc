@@ -0,0 +1,120 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "portdnn/matmul/params.h"
+
+#include "src/matmul/tile_table.h"
+
+namespace {
+
+using sycldnn::matmul::internal::TileConfig;
+using sycldnn::matmul::internal::TileFeature;
+using sycldnn::matmul::internal::TileNode;
+using sycldnn::matmul::internal::TileTable;
+
+sycldnn::matmul::MatmulParams get_params(int batches, int m, int k, int n) {
+  sycldnn::matmul::MatmulParams params;
+  params.batches = batches;
+  params.m = m;
+  params.k = k;
+  params.n = n;
+  params.beta = 0.f;
+  return params;
+}
+
+// SkinnyRows for a single row, otherwise Tiles444 unless the RHS is
+// transposed.
+constexpr TileNode nodes[] = {
+    {TileFeature::M, 1, 1, 2, TileConfig::NotSet},
+    {TileFeature::Leaf, 0, 0, 0, TileConfig::SkinnyRows},
+    {TileFeature::TransposeRHS, 0, 3, 4, TileConfig::NotSet},
+    {TileFeature::Leaf, 0, 0, 0, TileConfig::Tiles444},
+    {TileFeature::Leaf, 0, 0, 0, TileConfig::SmallBatched},
+};
+constexpr TileTable table{nodes, 5};
+
+}  // namespace
+
+TEST(MatmulTileTable, FollowsBranchesToLeaves) {
+  using sycldnn::matmul::internal::evaluate;
+  EXPECT_EQ(TileConfig::SkinnyRows,
+            evaluate(table, get_params(1, 1, 256, 1000), false, true));
+  EXPECT_EQ(TileConfig::Tiles444,
+            evaluate(table, get_params(1, 64, 64, 64), false, false));
+  EXPECT_EQ(TileConfig::Tiles444,
+            evaluate(table, get_params(1, 64, 64, 64), true, false));
+  EXPECT_EQ(TileConfig::SmallBatched,
+            evaluate(table, get_params(1, 64, 64, 64), false, true));
+}
+
+TEST(MatmulTileTable, EmptyOrMalformedTableIsNotSet) {
+  using sycldnn::matmul::internal::evaluate;
+  constexpr TileTable empty_table{nullptr, 0};
+  EXPECT_EQ(TileConfig::NotSet,
+            evaluate(empty_table, get_params(1, 8, 8, 8), false, false));
+  static constexpr TileNode cycle[] = {
+      {TileFeature::M, 16, 0, 0, TileConfig::NotSet},
+  };
+  constexpr TileTable cyclic_table{cycle, 1};
+  EXPECT_EQ(TileConfig::NotSet,
+            evaluate(cyclic_table, get_params(1, 8, 8, 8), false, false));
+  static constexpr TileNode out_of_range[] = {
+      {TileFeature::M, 16, 3, 3, TileConfig::NotSet},
+  };
+  constexpr TileTable bad_index_table{out_of_range, 1};
+  EXPECT_EQ(TileConfig::NotSet,
+            evaluate(bad_index_table, get_params(1, 8, 8, 8), false, false));
+}
+
+TEST(MatmulTileTable, DefaultConfigs) {
+  using sycldnn::matmul::internal::default_tile_config;
+  // Fully connected layers with a batch of one.
+  EXPECT_EQ(TileConfig::SkinnyRows,
+            default_tile_config(get_params(1, 1, 4096, 1000)));
+  EXPECT_EQ(TileConfig::SkinnyCols,
+            default_tile_config(get_params(1, 1000, 4096, 1)));
+  // Winograd batched multiplies on a small feature map.
+  EXPECT_EQ(TileConfig::SmallBatched,
+            default_tile_config(get_params(16, 16, 256, 64)));
+  EXPECT_EQ(TileConfig::Local,
+            default_tile_config(get_params(1, 256, 256, 256)));
+  EXPECT_EQ(TileConfig::Tiles444,
+            default_tile_config(get_params(3, 16, 16, 16)));
+}
+
+TEST(MatmulTileTable, SplitKFactor) {
+  using sycldnn::matmul::internal::split_k_factor;
+  // Fully connected layers with a small batch are split.
+  EXPECT_EQ(16, split_k_factor(get_params(1, 1, 4096, 4)));
+  EXPECT_EQ(9, split_k_factor(get_params(1, 8, 4096, 1000)));
+  // The slices are not made smaller than 256 values.
+  EXPECT_EQ(3, split_k_factor(get_params(1, 4, 800, 4)));
+  EXPECT_EQ(64, split_k_factor(get_params(1, 1, 1 << 20, 1)));
+  // Short accumulations and large outputs are not split.
+  EXPECT_EQ(1, split_k_factor(get_params(1, 1, 511, 4)));
+  EXPECT_EQ(1, split_k_factor(get_params(1, 64, 4096, 1000)));
+  EXPECT_EQ(1, split_k_factor(get_params(128, 16, 4096, 16)));
+}
+
+TEST(MatmulTileTable, SplitKWorkspaceSize) {
+  using sycldnn::matmul::internal::split_k_workspace_size;
+  // 800 values split three ways gives slices of 268, so three partial sums
+  // for each of the 16 outputs.
+  EXPECT_EQ(48u, split_k_workspace_size(get_params(1, 4, 800, 4)));
+  EXPECT_EQ(2u * 3 * 5 * 4, split_k_workspace_size(get_params(2, 3, 1030, 5)));
+  EXPECT_EQ(0u, split_k_workspace_size(get_params(1, 1, 511, 4)));
+}
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "portdnn/conv2d/epilogue.h"
 #include "portdnn/conv2d/launch.h"
 #include "portdnn/conv2d/selector/default_selector.h"
 #include "portdnn/conv2d/workspace_size.h"
@@ -96,6 +97,32 @@ struct ConvolutionLayer : Layer<DType, Backend> {
         workspace_, workspace_size_);
   }
 };
+
+// Convolution with bias, residual and activation fused into its output
+template <typename DType, typename Backend>
+struct FusedConvolutionLayer : ConvolutionLayer<DType, Backend> {
+  using DeviceMem = typename Backend::template pointer_type<DType>;
+  sycldnn::conv2d::Epilogue<DType, Backend> epilogue_;
+
+  FusedConvolutionLayer(
+      sycldnn::conv2d::Conv2DParams const& params, DeviceMem const input,
+      DeviceMem const weights, DeviceMem output, DeviceMem workspace,
+      size_t workspace_size,
+      sycldnn::conv2d::Epilogue<DType, Backend> const& epilogue, Backend& b,
+      sycldnn::conv2d::Selector& selector)
+      : ConvolutionLayer<DType, Backend>(params, input, weights, output,
+                                         workspace, workspace_size, b,
+                                         selector),
+        epilogue_{epilogue} {}
+
+  sycldnn::SNNStatus run() override {
+    return sycldnn::conv2d::launch<DType, sycldnn::conv2d::conv_type::Forward>(
+        this->input_, this->filter_, this->output_, this->params_,
+        this->selector_, this->backend_, this->workspace_,
+        this->workspace_size_, epilogue_);
+  }
+};
+
 template <typename DType, typename Backend>
 struct BiasAddLayer : Layer<DType, Backend> {
   using DeviceMem = typename Backend::template pointer_type<DType>;